@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "pvpserver/anticheat/hit_validator.h"  // Vec3, PlayerState
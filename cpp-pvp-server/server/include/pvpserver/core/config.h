@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace pvpserver {
 
@@ -10,10 +11,13 @@ class GameConfig {
     std::uint16_t metrics_port_;
     double tick_rate_;
     std::string database_dsn_;
+    bool deterministic_simulation_;
+    std::vector<std::string> matchmaking_regions_;
 
    public:
     GameConfig(std::uint16_t port, std::uint16_t metrics_port, double tick_rate,
-               std::string database_dsn);
+               std::string database_dsn, bool deterministic_simulation = false,
+               std::vector<std::string> matchmaking_regions = {"global"});
 
     static GameConfig FromEnv();
 
@@ -21,6 +25,11 @@ class GameConfig {
     std::uint16_t metrics_port() const noexcept { return metrics_port_; }
     double tick_rate() const noexcept { return tick_rate_; }
     const std::string& database_dsn() const noexcept { return database_dsn_; }
+    bool deterministic_simulation() const noexcept { return deterministic_simulation_; }
+    // 첫 번째 항목이 기본 리전 (알 수 없는 리전/"any" 요청이 배정됨)
+    const std::vector<std::string>& matchmaking_regions() const noexcept {
+        return matchmaking_regions_;
+    }
 };
 
 }  // namespace pvpserver
@@ -31,6 +31,8 @@ class GameLoop {
     double TargetDelta() const noexcept;
     double CurrentTickRate() const;
     std::vector<double> LastDurations() const;
+    // 최근 틱들의 콜백 처리 시간 분위수 (초, quantile 0~1). 로드 밸런서에 보고하는 부하 지표
+    double TickWorkPercentile(double quantile) const;
     std::string PrometheusSnapshot() const;
 
    private:
@@ -49,6 +51,7 @@ class GameLoop {
 
     mutable std::mutex metrics_mutex_;
     std::vector<double> last_durations_;
+    std::vector<double> last_work_;  // 콜백 처리 시간 (sleep 제외)
     std::uint64_t tick_counter_{0};
 };
 
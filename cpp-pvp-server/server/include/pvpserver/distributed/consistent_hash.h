@@ -1,9 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <map>
-#include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace pvpserver {
@@ -12,14 +13,25 @@ namespace distributed {
 /**
  * Consistent Hash Ring
  * 가상 노드를 사용하여 균등한 분배를 보장합니다.
+ *
+ * 링은 해시 오름차순 평면 배열 (이진 탐색, 연속 메모리)이고,
+ * Jump 모드는 링 없이 Jump Consistent Hash로 노드 번호를 계산합니다.
+ * 변경은 스레드 안전하지 않습니다. const 조회는 여러 스레드가 동시에 해도 됩니다
+ * (LoadBalancer는 변경할 때마다 복사본을 만들어 교체).
  */
 class ConsistentHashRing {
 public:
+    enum class Mode {
+        RING,  // 가상 노드 링: 임의 노드 추가/제거 시 그 노드 몫만 이동
+        JUMP   // Jump Consistent Hash: 메모리 0, 완벽한 균등, 마지막에 추가/제거할 때만 최소 이동
+    };
+
     /**
      * 생성자
-     * @param virtual_nodes 물리 노드당 가상 노드 수 (기본 150)
+     * @param virtual_nodes 물리 노드당 가상 노드 수 (기본 150, RING 모드만)
+     * @param mode 배치 방식
      */
-    explicit ConsistentHashRing(int virtual_nodes = 150);
+    explicit ConsistentHashRing(int virtual_nodes = 150, Mode mode = Mode::RING);
     ~ConsistentHashRing() = default;
 
     /**
@@ -41,6 +53,12 @@ public:
      */
     std::string GetNode(const std::string& key) const;
 
+    /**
+     * 복사 없는 조회
+     * @return 담당 노드 ID (노드 없으면 nullptr, 다음 Add/Remove 전까지 유효)
+     */
+    const std::string* Lookup(std::string_view key) const;
+
     /**
      * 키에 대한 N개 노드 조회 (복제 또는 페일오버용)
      * @param key 조회 키
@@ -49,6 +67,19 @@ public:
      */
     std::vector<std::string> GetNodes(const std::string& key, int n) const;
 
+    /**
+     * 키의 담당 노드부터 시계 방향으로 서로 다른 노드를 하나씩 방문
+     * visit가 true를 돌려주면 멈춤 (bounded load 배치에 사용)
+     */
+    void ForEachCandidate(std::string_view key,
+                          const std::function<bool(const std::string& node_id)>& visit) const;
+    // 같은 순서, 노드 번호(Members() 인덱스)로 방문 - 호출자가 번호로 자기 표를 바로 참조
+    void ForEachCandidateIndex(std::string_view key,
+                               const std::function<bool(std::size_t member)>& visit) const;
+
+    // 노드 번호 순 (추가 순서, 제거 시 뒤 번호가 당겨짐)
+    const std::vector<std::string>& Members() const noexcept { return members_; }
+
     /**
      * 현재 노드 수
      * @return 물리 노드 수
@@ -64,7 +95,7 @@ public:
 
     /**
      * 모든 노드 조회
-     * @return 노드 ID 목록
+     * @return 노드 ID 목록 (정렬)
      */
     std::vector<std::string> GetAllNodes() const;
 
@@ -76,20 +107,36 @@ public:
     std::map<std::string, int> GetDistribution(
         const std::vector<std::string>& keys) const;
 
-private:
-    int virtual_nodes_;
-    std::map<size_t, std::string> ring_;      // hash -> node_id
-    std::set<std::string> nodes_;              // 물리 노드 집합
+    Mode GetMode() const noexcept { return mode_; }
 
     /**
-     * 문자열 해시 (FNV-1a)
+     * 64비트 키 해시 (8바이트 단위 + 최종 혼합)
+     * 노드끼리 같은 배치를 얻으려면 모든 노드가 같은 함수를 써야 합니다.
      */
-    size_t Hash(const std::string& key) const;
+    static std::uint64_t HashKey(std::string_view key) noexcept;
 
     /**
-     * 가상 노드 키 생성
+     * Jump Consistent Hash (Lamping & Veach, 2014)
+     * @return [0, buckets) 범위의 버킷 번호
      */
-    std::string MakeVirtualNodeKey(const std::string& node_id, int index) const;
+    static std::int32_t JumpHash(std::uint64_t key, std::int32_t buckets) noexcept;
+
+private:
+    int virtual_nodes_;
+    Mode mode_;
+    std::vector<std::string> members_;  // 노드 번호 → ID (추가 순서 = Jump 버킷 순서)
+
+    // 링: 해시만 따로 모아 이진 탐색이 캐시 라인을 낭비하지 않게
+    std::vector<std::uint64_t> points_;  // 오름차순
+    std::vector<std::uint32_t> owners_;  // points_[i]의 노드 번호
+    // 해시 상위 bucket_bits_비트 → 그 구간의 첫 points_ 인덱스 (탐색 범위를 평균 1~2칸으로)
+    std::vector<std::uint32_t> buckets_;
+    int bucket_bits_ = 0;
+
+    std::size_t FindMember(const std::string& node_id) const;
+    // 키 해시 → 첫 담당 위치 (RING: points_ 인덱스, JUMP: 노드 번호)
+    std::size_t Locate(std::uint64_t hash) const;
+    void RebuildBuckets();
 };
 
 }  // namespace distributed
@@ -0,0 +1,257 @@
+#pragma once
+
+#include "load_balancer.h"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace pvpserver {
+namespace distributed {
+
+/**
+ * 멤버 상태 (SWIM)
+ */
+enum class MemberState : std::uint8_t {
+    ALIVE = 0,    // 응답 중
+    SUSPECT = 1,  // 직접/간접 ping 모두 실패, 본인 반박을 기다리는 중
+    DEAD = 2,     // 의심 시간 초과
+    LEFT = 3      // 정상 종료 (Unregister)
+};
+
+/**
+ * 가십으로 전파되는 멤버 한 명의 상태
+ * 부하(connections, tick p99, CPU)도 같이 실어 보냅니다.
+ */
+struct GossipMember {
+    ServerInfo info;                // server_id = 노드 ID
+    std::string gossip_host;        // 가십 주소 (게임 주소 info.host와 다를 수 있음)
+    std::uint16_t gossip_port = 0;
+    MemberState state = MemberState::ALIVE;
+    std::uint32_t incarnation = 0;  // 본인만 올림 (의심 반박/재가입)
+    std::uint32_t load_seq = 0;     // 본인만 올림 (부하 갱신 순서)
+};
+
+/**
+ * 가십 설정
+ * 기본값: 200ms 주기, 80ms 안에 ack 없으면 간접 ping, 4주기 의심 후 DEAD
+ * → 장애 감지 ~1초 (Redis 하트비트 TTL 15초 대비)
+ */
+struct GossipOptions {
+    std::string bind_address = "127.0.0.1";
+    // 다른 노드에 알리는 가십 주소 (비우면 bind_address, 0.0.0.0/:: 바인드면 ServerInfo.host)
+    std::string advertise_host;
+    std::uint16_t port = 0;  // 0 = 임의 포트 (Port()로 확인)
+    std::chrono::milliseconds protocol_period{200};
+    std::chrono::milliseconds ack_timeout{80};
+    int indirect_checks = 3;    // 간접 ping을 부탁할 멤버 수 (SWIM의 k)
+    int suspicion_periods = 4;  // SUSPECT → DEAD까지 주기 수
+    int retransmit_multiplier = 3;  // 업데이트 하나를 λ × ceil(log2(N+1))번 실어 보냄
+    std::size_t max_piggyback = 6;  // 메시지 하나에 싣는 업데이트 수
+    std::chrono::milliseconds dead_reap_after{10000};  // DEAD/LEFT 멤버를 목록에서 지우기까지
+};
+
+/**
+ * 가십 멤버십 (SWIM: Das, Gupta, Motivala, 2002)
+ * Redis 없이 UDP로 서버 등록/발견/장애 감지를 합니다 (ServiceDiscovery와 같은 사용법).
+ *
+ * - 주기마다 멤버 하나에 ping → ack 없으면 k명에게 간접 ping 부탁 → 그래도 없으면 SUSPECT
+ * - 멤버 변경과 부하는 ping/ack에 얹어(piggyback) 전파 → 추가 메시지 없음
+ * - 의심받은 노드는 incarnation을 올려 ALIVE로 반박
+ * - LoadBalancer를 주면 변경을 바로 반영 (RegisterServer/MarkServerHealthy/UpdateServerMetrics)
+ *
+ * 네트워크 처리는 자체 io 스레드 하나에서, 조회 메서드는 어느 스레드에서나 호출 가능합니다.
+ */
+class GossipMembership {
+public:
+    /**
+     * 생성자
+     * @param options 가십 설정
+     * @param balancer 멤버 변경을 반영할 로드 밸런서 (없으면 nullptr)
+     */
+    explicit GossipMembership(GossipOptions options = {},
+                              std::shared_ptr<LoadBalancer> balancer = nullptr);
+    ~GossipMembership();
+
+    GossipMembership(const GossipMembership&) = delete;
+    GossipMembership& operator=(const GossipMembership&) = delete;
+
+    /**
+     * 자신을 등록하고 가십 시작 (소켓 바인드)
+     * @param self 자신의 서버 정보 (server_id = 노드 ID)
+     */
+    void Register(const ServerInfo& self);
+
+    /**
+     * 클러스터 가입 (시드 노드에 전체 멤버 목록 요청)
+     * @param seeds "host:port" 목록
+     */
+    void Join(const std::vector<std::string>& seeds);
+
+    /**
+     * 정상 종료: LEFT를 알린 뒤 중지
+     */
+    void Unregister();
+
+    /**
+     * 알림 없이 중지 (프로세스 장애와 같음)
+     */
+    void Stop();
+
+    /**
+     * 바인드된 가십 포트
+     */
+    std::uint16_t Port() const;
+
+    /**
+     * 자신의 정보/부하 갱신 (다음 ping/ack부터 전파)
+     * @param info 갱신된 서버 정보
+     */
+    void UpdateServerInfo(const ServerInfo& info);
+
+    /**
+     * 사용 가능한(ALIVE) 서버 목록 (자신 포함)
+     */
+    std::vector<ServerInfo> GetAvailableServers() const;
+
+    /**
+     * 특정 서버 정보 조회
+     * @param server_id 서버 식별자
+     * @return 서버 정보 (모르거나 DEAD/LEFT면 nullopt)
+     */
+    std::optional<ServerInfo> GetServer(const std::string& server_id) const;
+
+    /**
+     * 멤버 상태 조회 (자신 제외)
+     */
+    std::optional<MemberState> GetState(const std::string& server_id) const;
+    std::vector<GossipMember> Members() const;
+
+    /**
+     * 서버 추가/제거 콜백 (io 스레드에서 호출)
+     */
+    void OnServerAdded(std::function<void(const ServerInfo&)> callback);
+    void OnServerRemoved(std::function<void(const std::string&)> callback);
+
+    /**
+     * Prometheus 메트릭
+     */
+    std::string MetricsSnapshot() const;
+
+private:
+    using udp = boost::asio::ip::udp;
+    using Clock = std::chrono::steady_clock;
+
+    struct MemberEntry {
+        GossipMember member;
+        udp::endpoint endpoint;
+        Clock::time_point state_since;
+    };
+
+    // 전파 대기 업데이트: 적게 보낸 것부터, 멤버십 변경이 부하 갱신보다 먼저
+    struct Broadcast {
+        GossipMember member;
+        int transmits = 0;
+        bool load_only = false;
+    };
+
+    struct Probe {
+        std::string target;
+        std::uint32_t seq = 0;
+        bool acked = true;
+    };
+
+    // 간접 ping 중계: 내가 보낸 ping seq → 부탁한 노드와 그 노드의 seq
+    struct Relay {
+        udp::endpoint requester;
+        std::uint32_t requester_seq;
+        Clock::time_point expires;
+    };
+
+    enum class EventKind { ADDED, ALIVE, SUSPECT, DEAD, LEFT, REAPED, LOAD };
+    struct Event {
+        EventKind kind;
+        ServerInfo info;
+    };
+
+    // ---- io 스레드 ----
+    void StartReceive();
+    void HandleDatagram(std::size_t bytes, const udp::endpoint& from);
+    void ScheduleTick();
+    void Tick();
+    void OnAckTimeout(std::uint32_t seq);
+    void Send(const udp::endpoint& to, std::vector<std::uint8_t> payload);
+
+    // ---- mutex_ 안에서 ----
+    // body를 kMaxDatagramSize까지 싣고, 남는 자리는 전파 대기 업데이트로 채움
+    // body_index: 주면 그 위치부터 싣고 다음에 실을 위치로 갱신 (SYNC 분할)
+    std::vector<std::uint8_t> Encode(std::uint8_t type, std::uint32_t seq,
+                                     const std::string& target,
+                                     const std::vector<GossipMember>& body,
+                                     std::size_t* body_index = nullptr);
+    // from: 직접 보낸 노드면 실제 주소 (아니면 광고된 주소 사용)
+    void Apply(const GossipMember& update, const udp::endpoint* from, std::vector<Event>& events);
+    void SetState(MemberEntry& entry, MemberState state, std::vector<Event>& events);
+    void Enqueue(const GossipMember& member, bool load_only);
+    GossipMember SelfRecord() const;
+    std::vector<std::string> ProbeCandidates(const std::string& exclude);
+    std::string NextProbeTarget();
+    std::size_t RetransmitLimit() const;
+
+    void Dispatch(const std::vector<Event>& events);
+
+    GossipOptions options_;
+    std::shared_ptr<LoadBalancer> balancer_;
+
+    boost::asio::io_context io_context_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    udp::socket socket_;
+    boost::asio::steady_timer tick_timer_;
+    boost::asio::steady_timer ack_timer_;
+    std::thread io_thread_;
+    static constexpr std::size_t kMaxDatagramSize = 1500;  // 송신 상한 = 수신 버퍼 (MTU 이하)
+    std::array<std::uint8_t, kMaxDatagramSize> recv_buffer_{};
+    udp::endpoint recv_from_;
+
+    mutable std::mutex mutex_;
+    GossipMember self_;
+    bool running_ = false;
+    std::unordered_map<std::string, MemberEntry> members_;
+    std::vector<Broadcast> broadcasts_;
+    std::vector<std::string> probe_order_;  // 섞은 순서로 한 바퀴씩 (SWIM round-robin)
+    std::size_t probe_index_ = 0;
+    Probe probe_;
+    std::uint32_t next_seq_ = 1;
+    std::unordered_map<std::uint32_t, Relay> relays_;
+    std::mt19937 rng_{std::random_device{}()};
+    std::vector<udp::endpoint> seeds_;  // 아무도 모르는 동안 주기마다 JOIN 재시도
+
+    std::function<void(const ServerInfo&)> on_server_added_;
+    std::function<void(const std::string&)> on_server_removed_;
+
+    // 메트릭
+    std::uint64_t messages_sent_ = 0;
+    std::uint64_t messages_received_ = 0;
+    std::uint64_t decode_errors_ = 0;
+    std::uint64_t indirect_probes_ = 0;
+    std::uint64_t suspicions_ = 0;
+    std::uint64_t failures_detected_ = 0;
+    std::uint64_t refutations_ = 0;
+};
+
+}  // namespace distributed
+}  // namespace pvpserver
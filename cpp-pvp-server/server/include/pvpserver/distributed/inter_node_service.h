@@ -0,0 +1,93 @@
+#pragma once
+
+#include "load_balancer.h"
+#include "match_migration.h"
+#include "rpc.h"
+#include "pvpserver/storage/session_store.h"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace pvpserver {
+namespace distributed {
+
+/**
+ * 서버 간 서비스 메서드 이름 (design/v2.0.2-grpc.md의 GameServerService)
+ */
+struct InterNodeMethods {
+    static constexpr const char* kHandoffMatch = "InterNode/HandoffMatch";
+    static constexpr const char* kLookupSession = "InterNode/LookupSession";
+    static constexpr const char* kReportLoad = "InterNode/ReportLoad";
+};
+
+/**
+ * 서버 간 서비스 (받는 쪽)
+ *
+ * 각 의존성은 없어도 됩니다 (nullptr → 해당 메서드는 UNIMPLEMENTED).
+ * - sessions: 세션 조회 대상 저장소
+ * - balancer: 다른 노드의 부하 보고를 반영할 로드 밸런서
+ * - import_handler: 매치 번들 복원 (MatchMigrationReceiver와 같은 핸들러, 워커 스레드에서 호출)
+ */
+class InterNodeService {
+public:
+    InterNodeService(std::string server_id, std::shared_ptr<storage::SessionStore> sessions,
+                     std::shared_ptr<LoadBalancer> balancer,
+                     MatchMigrationReceiver::ImportHandler import_handler);
+
+    /**
+     * 메서드 등록 (server.Start 이전에 호출)
+     */
+    void Register(RpcServer& server);
+
+private:
+    std::string server_id_;
+    std::shared_ptr<storage::SessionStore> sessions_;
+    std::shared_ptr<LoadBalancer> balancer_;
+    MatchMigrationReceiver::ImportHandler import_handler_;
+};
+
+/**
+ * 서버 간 서비스 (호출하는 쪽)
+ *
+ * 상대 노드는 ServerInfo의 host:grpc_port로 찾습니다.
+ * RpcClient를 여러 InterNodeClient/다른 서비스와 공유하면 노드당 연결 하나를 같이 씁니다.
+ */
+class InterNodeClient {
+public:
+    /**
+     * @param client 공유 RPC 클라이언트
+     * @param server_id 호출하는 노드 ID (매치 이전 요청에 실림)
+     * @param timeout 호출 기한
+     */
+    InterNodeClient(std::shared_ptr<RpcClient> client, std::string server_id,
+                    std::chrono::milliseconds timeout = std::chrono::milliseconds(2000));
+
+    /**
+     * 매치를 target 노드로 이전 (MatchMigrator와 같은 순서: 정지 → 전송 → REDIRECT, 실패 시 재개)
+     * 연결을 재사용하므로 두 번째 이전부터는 정지 구간에 TCP 핸드셰이크가 없습니다.
+     */
+    MigrationResult MigrateMatch(UdpGameServer& source, const std::string& room_id,
+                                 const ServerInfo& target);
+
+    /**
+     * 다른 노드의 세션 조회
+     * @return OK(session 채움) / NOT_FOUND / 전송 오류
+     */
+    RpcStatus LookupSession(const ServerInfo& peer, const std::string& session_id,
+                            std::optional<storage::SessionData>& session);
+
+    /**
+     * 자기 부하를 peer의 로드 밸런서에 보고
+     */
+    RpcStatus ReportLoad(const ServerInfo& peer, const ServerInfo& self);
+
+private:
+    std::shared_ptr<RpcClient> client_;
+    std::string server_id_;
+    std::chrono::milliseconds timeout_;
+};
+
+}  // namespace distributed
+}  // namespace pvpserver
@@ -3,9 +3,12 @@
 #include "consistent_hash.h"
 
 #include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -25,6 +28,8 @@ struct ServerInfo {
     int64_t last_heartbeat = 0;
     bool healthy = true;
     std::string region;
+    double tick_p99_ms = 0.0;      // 틱 처리 시간 p99 (GameLoop::TickWorkPercentile)
+    double cpu_utilization = 0.0;  // 0.0 ~ 1.0
 
     // 직렬화
     std::string Serialize() const;
@@ -48,12 +53,83 @@ struct ServerInfo {
 enum class LoadBalanceStrategy {
     CONSISTENT_HASH,     // 플레이어 ID 기반 고정 할당
     ROUND_ROBIN,         // 순환 분배
-    LEAST_CONNECTIONS    // 최소 연결 우선
+    LEAST_CONNECTIONS,   // 최소 연결 우선
+    POWER_OF_TWO,        // 무작위 두 서버 중 연결이 적은 쪽
+    WEIGHTED_HEADROOM    // 무작위 두 서버 중 틱 p99/CPU/연결 가중 비용이 낮은 쪽
+};
+
+/**
+ * WEIGHTED_HEADROOM 비용 가중치
+ * 비용 = connections × 연결률 + cpu × CPU + tick × (틱 p99 / 틱 예산)
+ * 틱 p99가 예산을 넘은 서버는 다른 후보가 모두 넘었을 때만 선택됩니다.
+ */
+struct LoadWeights {
+    double connections = 1.0;
+    double cpu = 1.0;
+    double tick = 2.0;
+    double tick_budget_ms = 1000.0 / 60.0;  // 60 TPS
+};
+
+/**
+ * 서버 하나의 공유 상태
+ * 정적 정보(info)는 등록 시점 값으로 고정, 부하/상태만 원자적으로 갱신합니다.
+ */
+struct ServerSlot {
+    explicit ServerSlot(const ServerInfo& server)
+        : info(server)
+        , connections(server.current_connections)
+        , healthy(server.healthy)
+        , tick_p99_ms(server.tick_p99_ms)
+        , cpu_utilization(server.cpu_utilization) {}
+
+    const ServerInfo info;
+    std::atomic<int> connections;
+    std::atomic<bool> healthy;
+    std::atomic<double> tick_p99_ms;
+    std::atomic<double> cpu_utilization;
+};
+
+/**
+ * 선택 결과 핸들
+ * 서버 문자열을 복사하지 않고 슬롯을 공유합니다 (서버가 해제돼도 핸들은 유효).
+ */
+class ServerHandle {
+public:
+    ServerHandle() = default;
+    explicit ServerHandle(std::shared_ptr<const ServerSlot> slot) : slot_(std::move(slot)) {}
+
+    explicit operator bool() const noexcept { return static_cast<bool>(slot_); }
+
+    const std::string& Id() const noexcept { return slot_->info.server_id; }
+    const std::string& Host() const noexcept { return slot_->info.host; }
+    int UdpPort() const noexcept { return slot_->info.udp_port; }
+    int MaxConnections() const noexcept { return slot_->info.max_connections; }
+    int Connections() const noexcept {
+        return slot_->connections.load(std::memory_order_relaxed);
+    }
+    bool Healthy() const noexcept { return slot_->healthy.load(std::memory_order_relaxed); }
+    double TickP99Ms() const noexcept {
+        return slot_->tick_p99_ms.load(std::memory_order_relaxed);
+    }
+    double CpuUtilization() const noexcept {
+        return slot_->cpu_utilization.load(std::memory_order_relaxed);
+    }
+
+    // 현재 부하/상태를 반영한 복사본
+    ServerInfo ToServerInfo() const;
+
+private:
+    std::shared_ptr<const ServerSlot> slot_;
 };
 
 /**
  * 로드 밸런서
  * 여러 분배 전략을 지원합니다.
+ *
+ * 읽기(선택/조회)는 잠금 없이 불변 스냅샷을 사용합니다 (RCU):
+ * - 서버 추가/제거/전략 외 설정 변경은 새 스냅샷을 만들어 원자적으로 교체
+ * - 부하/상태 갱신은 스냅샷을 바꾸지 않고 슬롯의 원자 변수만 갱신
+ * 쓰기끼리는 write_mutex_로 직렬화합니다.
  */
 class LoadBalancer {
 public:
@@ -84,6 +160,13 @@ public:
      */
     std::optional<ServerInfo> SelectServer(const std::string& player_id);
 
+    /**
+     * 잠금/문자열 복사 없는 선택
+     * @param player_id 플레이어 ID (Consistent Hash 시 사용)
+     * @return 선택된 서버 핸들 (없으면 빈 핸들)
+     */
+    ServerHandle Select(std::string_view player_id) const;
+
     /**
      * 서버 부하 업데이트
      * @param server_id 서버 식별자
@@ -91,6 +174,16 @@ public:
      */
     void UpdateServerLoad(const std::string& server_id, int connections);
 
+    /**
+     * 서버 부하 지표 업데이트 (하트비트로 받은 값)
+     * @param server_id 서버 식별자
+     * @param connections 현재 연결 수
+     * @param tick_p99_ms 틱 처리 시간 p99 (ms)
+     * @param cpu_utilization CPU 사용률 (0.0 ~ 1.0)
+     */
+    void UpdateServerMetrics(const std::string& server_id, int connections, double tick_p99_ms,
+                             double cpu_utilization);
+
     /**
      * 서버 상태 설정
      * @param server_id 서버 식별자
@@ -129,16 +222,75 @@ public:
      */
     LoadBalanceStrategy GetStrategy() const;
 
+    /**
+     * Consistent Hash 부하 상한 (Consistent Hashing with Bounded Loads)
+     * 서버 하나의 연결 수가 평균 × factor를 넘으면 링의 다음 서버로 넘깁니다.
+     * @param factor 1보다 커야 적용 (기본 1.25, 0 = 상한 없음)
+     */
+    void SetBoundedLoadFactor(double factor);
+    double GetBoundedLoadFactor() const;
+
+    /**
+     * 해시 배치 방식 변경 (등록된 서버로 다시 구성)
+     * @param mode RING(가상 노드) 또는 JUMP
+     */
+    void SetHashMode(ConsistentHashRing::Mode mode);
+
+    /**
+     * WEIGHTED_HEADROOM 가중치 설정
+     * @param weights 비용 가중치와 틱 예산
+     */
+    void SetLoadWeights(const LoadWeights& weights);
+    LoadWeights GetLoadWeights() const;
+
+    /**
+     * WEIGHTED_HEADROOM이 비교하는 비용 (낮을수록 여유)
+     * @return 가중 비용 (틱 예산 초과 시 큰 벌점 포함)
+     */
+    static double HeadroomCost(const ServerHandle& server, const LoadWeights& weights);
+
+    // 스냅샷 교체 횟수 (멤버 변경 빈도 확인용)
+    std::uint64_t SnapshotVersion() const noexcept {
+        return version_.load(std::memory_order_acquire);
+    }
+
 private:
-    LoadBalanceStrategy strategy_;
-    ConsistentHashRing hash_ring_;
-    mutable std::mutex mutex_;
-    std::unordered_map<std::string, ServerInfo> servers_;
-    std::atomic<size_t> round_robin_index_{0};
-
-    std::optional<ServerInfo> SelectByConsistentHash(const std::string& player_id);
-    std::optional<ServerInfo> SelectByRoundRobin();
-    std::optional<ServerInfo> SelectByLeastConnections();
+    // 불변 스냅샷: servers[i]는 ring.Members()[i]와 같은 서버
+    struct Snapshot {
+        std::uint64_t version{0};
+        std::vector<std::shared_ptr<ServerSlot>> servers;
+        std::unordered_map<std::string, std::size_t> index;  // server_id → servers 인덱스
+        ConsistentHashRing ring;
+        LoadWeights weights;
+    };
+
+    // 현재 스레드가 캐시한 스냅샷 (버전이 같으면 공유 카운터를 건드리지 않음)
+    const Snapshot& Current() const;
+    // write_mutex_ 안에서: 새 스냅샷 게시
+    void Publish(std::shared_ptr<Snapshot> next);
+    std::shared_ptr<Snapshot> CopyForWrite() const;
+    std::shared_ptr<ServerSlot> FindSlot(const std::string& server_id) const;
+    // 정상 서버 연결 합계 반영 (write_mutex_ 안에서)
+    void Account(bool healthy, int connections, int sign);
+
+    std::atomic<LoadBalanceStrategy> strategy_;
+    std::atomic<double> bounded_load_factor_{1.25};
+
+    std::mutex write_mutex_;
+    std::shared_ptr<const Snapshot> snapshot_;  // std::atomic_load/atomic_store로만 접근
+    std::atomic<std::uint64_t> version_{0};
+
+    // 상한 계산용 합계 (정상 서버만)
+    std::atomic<long long> healthy_connections_{0};
+    std::atomic<long long> healthy_servers_{0};
+    mutable std::atomic<size_t> round_robin_index_{0};
+
+    ServerHandle SelectByConsistentHash(const Snapshot& table, std::string_view player_id) const;
+    ServerHandle SelectByRoundRobin(const Snapshot& table) const;
+    ServerHandle SelectByLeastConnections(const Snapshot& table) const;
+    // 가용 서버 두 개를 무작위로 뽑아 better(a, b)가 true면 a
+    template <typename Better>
+    ServerHandle SelectByTwoChoices(const Snapshot& table, Better&& better) const;
 };
 
 }  // namespace distributed
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "pvpserver/network/udp_game_server.h"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pvpserver {
+namespace distributed {
+
+/**
+ * 이전된 매치의 새 게임 주소 (클라이언트가 REDIRECT로 받음)
+ */
+struct MigrationTarget {
+    std::string host;
+    std::uint16_t udp_port = 0;
+};
+
+/**
+ * 매치 이전 결과
+ */
+struct MigrationResult {
+    bool success = false;
+    std::string error;
+    std::size_t state_bytes = 0;
+    std::chrono::microseconds pause{0};  // 틱 정지 ~ REDIRECT 전송 (플레이어가 느끼는 서버 측 정지)
+    MigrationTarget target;
+};
+
+/**
+ * 매치 수신기 (대상 노드)
+ *
+ * TCP로 매치 번들을 받아 handler에 넘기고, handler가 돌려준 게임 주소를 원본에 응답합니다.
+ * handler는 보통 새 GameSession/UdpGameServer를 만들어 ImportMigratedMatch를 호출합니다.
+ * handler가 예외를 던지면 원본에 거부를 응답하고, 원본은 매치를 그대로 재개합니다.
+ */
+class MatchMigrationReceiver {
+public:
+    using ImportHandler =
+        std::function<MigrationTarget(const std::string& room_id, const std::vector<std::uint8_t>& state)>;
+
+    /**
+     * 생성자
+     * @param bind_address 수신 주소
+     * @param port 수신 포트 (0 = 임의 포트, Port()로 확인)
+     * @param handler 번들 복원 핸들러 (io 스레드에서 호출)
+     */
+    MatchMigrationReceiver(std::string bind_address, std::uint16_t port, ImportHandler handler);
+    ~MatchMigrationReceiver();
+
+    MatchMigrationReceiver(const MatchMigrationReceiver&) = delete;
+    MatchMigrationReceiver& operator=(const MatchMigrationReceiver&) = delete;
+
+    void Start();
+    void Stop();
+    std::uint16_t Port() const;
+
+    /**
+     * Prometheus 메트릭
+     */
+    std::string MetricsSnapshot() const;
+
+private:
+    using tcp = boost::asio::ip::tcp;
+    struct Connection;
+
+    void Accept();
+    void Handle(const std::shared_ptr<Connection>& connection);
+
+    std::string bind_address_;
+    ImportHandler handler_;
+
+    boost::asio::io_context io_context_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    tcp::acceptor acceptor_;
+    std::uint16_t port_ = 0;
+    std::thread io_thread_;
+
+    mutable std::mutex mutex_;
+    std::uint64_t imported_ = 0;
+    std::uint64_t rejected_ = 0;
+    double last_import_seconds_ = 0.0;
+};
+
+/**
+ * 매치 이전기 (원본 노드)
+ *
+ * 1. 대상 노드에 TCP 연결 (정지 전)
+ * 2. FreezeForMigration → 번들 전송 → 대상의 복원 ack 대기
+ * 3. 성공: CompleteMigration(REDIRECT) / 실패·시간 초과: ResumeAfterMigrationFailure
+ *
+ * 대상은 LoadBalancer::Select 등으로 고른 노드의 이전 포트를 넘기면 됩니다 (배포 드레인, 과열 노드 분산).
+ */
+class MatchMigrator {
+public:
+    /**
+     * @param timeout 연결 + 전송 + 복원 ack까지의 제한 시간
+     */
+    explicit MatchMigrator(std::chrono::milliseconds timeout = std::chrono::milliseconds(2000));
+
+    /**
+     * 매치를 대상 노드로 이전 (호출 스레드에서 끝날 때까지 블록)
+     * @param source 원본 게임 서버
+     * @param room_id 매치 식별자 (대상 handler에 전달)
+     * @param host 대상 노드의 이전 수신 주소
+     * @param port 대상 노드의 이전 수신 포트
+     */
+    MigrationResult Migrate(UdpGameServer& source, const std::string& room_id,
+                            const std::string& host, std::uint16_t port);
+
+    /**
+     * Prometheus 메트릭
+     */
+    std::string MetricsSnapshot() const;
+
+private:
+    void Record(const MigrationResult& result);
+
+    std::chrono::milliseconds timeout_;
+
+    mutable std::mutex mutex_;
+    std::uint64_t succeeded_ = 0;
+    std::uint64_t failed_ = 0;
+    std::uint64_t bytes_sent_ = 0;
+    double last_pause_seconds_ = 0.0;
+    double max_pause_seconds_ = 0.0;
+};
+
+}  // namespace distributed
+}  // namespace pvpserver
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <google/protobuf/message_lite.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace pvpserver {
+namespace distributed {
+
+/**
+ * RPC 상태 코드 (gRPC 상태 코드와 같은 번호)
+ */
+enum class RpcCode : std::uint8_t {
+    OK = 0,
+    CANCELLED = 1,
+    INVALID_ARGUMENT = 3,
+    DEADLINE_EXCEEDED = 4,
+    NOT_FOUND = 5,
+    UNIMPLEMENTED = 12,
+    INTERNAL = 13,
+    UNAVAILABLE = 14  // 연결 실패/끊김
+};
+
+const char* RpcCodeName(RpcCode code);
+
+struct RpcStatus {
+    RpcCode code = RpcCode::OK;
+    std::string message;
+
+    bool ok() const { return code == RpcCode::OK; }
+    static RpcStatus Ok() { return {}; }
+    static RpcStatus Error(RpcCode code, std::string message) { return {code, std::move(message)}; }
+};
+
+/**
+ * 메서드별 호출 수(코드별)와 지연 히스토그램 (Prometheus)
+ */
+class RpcMetrics {
+public:
+    static constexpr std::array<double, 10> kLatencyBuckets = {
+        0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 1.0};
+
+    explicit RpcMetrics(std::string prefix);  // "rpc_client" / "rpc_server"
+
+    void Record(const std::string& method, RpcCode code, double seconds);
+    std::uint64_t Count(const std::string& method, RpcCode code) const;
+    std::string Render() const;
+
+private:
+    struct MethodStats {
+        std::map<RpcCode, std::uint64_t> codes;
+        std::array<std::uint64_t, kLatencyBuckets.size()> buckets{};
+        std::uint64_t overflow = 0;
+        std::uint64_t count = 0;
+        double sum_seconds = 0.0;
+    };
+
+    std::string prefix_;
+    mutable std::mutex mutex_;
+    std::map<std::string, MethodStats> methods_;  // 이름순 출력
+};
+
+/**
+ * RPC 서버 설정
+ */
+struct RpcServerOptions {
+    std::string bind_address = "127.0.0.1";
+    std::uint16_t port = 0;          // 0 = 임의 포트 (Port()로 확인)
+    std::size_t worker_threads = 2;  // 핸들러 실행 스레드 (느린 요청이 같은 연결의 다른 요청을 막지 않게)
+};
+
+/**
+ * 서버 간 RPC 서버 (Protobuf 메시지를 길이 접두 프레임으로 TCP 위에 전송)
+ *
+ * - 연결 하나에 여러 요청이 동시에 오고, 끝난 순서대로 응답 (call_id로 짝지음)
+ * - 요청의 남은 기한이 핸들러 실행 전에 지났으면 실행하지 않고 DEADLINE_EXCEEDED
+ * - 메서드는 Start 이전에 등록
+ */
+class RpcServer {
+public:
+    using RawHandler = std::function<RpcStatus(const std::string& request, std::string& response)>;
+
+    explicit RpcServer(RpcServerOptions options = {});
+    ~RpcServer();
+
+    RpcServer(const RpcServer&) = delete;
+    RpcServer& operator=(const RpcServer&) = delete;
+
+    void RegisterMethod(const std::string& method, RawHandler handler);
+
+    // 타입 있는 핸들러: 요청 파싱 실패는 INVALID_ARGUMENT
+    template <typename Request, typename Response>
+    void RegisterMethod(const std::string& method,
+                        std::function<RpcStatus(const Request&, Response&)> handler) {
+        RegisterMethod(method, [handler = std::move(handler)](const std::string& request_bytes,
+                                                              std::string& response_bytes) {
+            Request request;
+            if (!request.ParseFromString(request_bytes)) {
+                return RpcStatus::Error(RpcCode::INVALID_ARGUMENT, "malformed request");
+            }
+            Response response;
+            RpcStatus status = handler(request, response);
+            if (status.ok()) {
+                response.SerializeToString(&response_bytes);
+            }
+            return status;
+        });
+    }
+
+    void Start();
+    void Stop();
+    std::uint16_t Port() const;
+
+    std::string MetricsSnapshot() const;
+
+private:
+    using tcp = boost::asio::ip::tcp;
+    struct Connection;
+
+    void Accept();
+    void ReadFrame(const std::shared_ptr<Connection>& connection);
+    void Dispatch(const std::shared_ptr<Connection>& connection, std::string frame_bytes);
+
+    RpcServerOptions options_;
+    std::unordered_map<std::string, RawHandler> handlers_;  // Start 이후 읽기 전용
+
+    boost::asio::io_context io_context_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    tcp::acceptor acceptor_;
+    std::uint16_t port_ = 0;
+    std::thread io_thread_;
+    std::unique_ptr<boost::asio::thread_pool> workers_;
+    std::vector<std::weak_ptr<Connection>> accepted_;  // io 스레드 전용 (Stop에서 닫음)
+
+    RpcMetrics metrics_{"rpc_server"};
+    std::atomic<std::int64_t> connections_{0};
+};
+
+/**
+ * RPC 클라이언트 설정
+ */
+struct RpcClientOptions {
+    std::chrono::milliseconds connect_timeout{500};
+};
+
+/**
+ * 서버 간 RPC 클라이언트
+ *
+ * - 상대 노드(host:port)마다 TCP 연결 하나를 만들어 모든 호출이 재사용 (연결 중에 온 호출은 대기열)
+ * - 한 연결 위에서 여러 호출을 동시에 진행 (응답 순서 무관)
+ * - 호출마다 기한: 지나면 DEADLINE_EXCEEDED로 끝내고 늦은 응답은 버림
+ * - 연결이 끊기면 진행 중인 호출은 UNAVAILABLE, 다음 호출에서 다시 연결
+ *
+ * 콜백은 클라이언트의 io 스레드에서 호출됩니다. 블로킹 Call은 그 스레드(콜백 안)에서 부르면 안 됩니다.
+ */
+class RpcClient {
+public:
+    using Callback = std::function<void(const RpcStatus& status, std::string response)>;
+
+    explicit RpcClient(RpcClientOptions options = {});
+    ~RpcClient();
+
+    RpcClient(const RpcClient&) = delete;
+    RpcClient& operator=(const RpcClient&) = delete;
+
+    void CallAsync(const std::string& host, std::uint16_t port, const std::string& method,
+                   std::string request, std::chrono::milliseconds timeout, Callback callback);
+
+    RpcStatus Call(const std::string& host, std::uint16_t port, const std::string& method,
+                   std::string request, std::string& response, std::chrono::milliseconds timeout);
+
+    // 타입 있는 호출 (Protobuf 메시지만; 문자열은 위 오버로드)
+    template <typename Request, typename Response,
+              typename = std::enable_if_t<std::is_base_of_v<google::protobuf::MessageLite, Request>>>
+    RpcStatus Call(const std::string& host, std::uint16_t port, const std::string& method,
+                   const Request& request, Response& response, std::chrono::milliseconds timeout) {
+        std::string response_bytes;
+        RpcStatus status =
+            Call(host, port, method, request.SerializeAsString(), response_bytes, timeout);
+        if (status.ok() && !response.ParseFromString(response_bytes)) {
+            return RpcStatus::Error(RpcCode::INTERNAL, "malformed response");
+        }
+        return status;
+    }
+
+    /**
+     * 열려 있는(또는 연결 중인) 연결 수
+     */
+    std::size_t ConnectionCount() const;
+
+    std::string MetricsSnapshot() const;
+
+private:
+    struct Channel;
+    struct Pending;
+
+    std::shared_ptr<Channel> ChannelFor(const std::string& host, std::uint16_t port);
+    void Connect(const std::shared_ptr<Channel>& channel);
+    void Write(const std::shared_ptr<Channel>& channel, std::shared_ptr<std::string> frame);
+    void WriteNext(const std::shared_ptr<Channel>& channel);
+    void ReadFrame(const std::shared_ptr<Channel>& channel);
+    void Complete(const std::shared_ptr<Channel>& channel, std::uint64_t call_id,
+                  const RpcStatus& status, std::string response);
+    void Fail(const std::shared_ptr<Channel>& channel, const RpcStatus& status);
+
+    RpcClientOptions options_;
+
+    boost::asio::io_context io_context_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    std::thread io_thread_;
+
+    // io 스레드 전용
+    std::unordered_map<std::string, std::shared_ptr<Channel>> channels_;  // "host:port"
+    std::uint64_t next_call_id_ = 1;
+
+    RpcMetrics metrics_{"rpc_client"};
+    std::atomic<std::size_t> open_channels_{0};
+    std::atomic<std::uint64_t> connects_{0};
+    std::atomic<std::int64_t> in_flight_{0};
+};
+
+}  // namespace distributed
+}  // namespace pvpserver
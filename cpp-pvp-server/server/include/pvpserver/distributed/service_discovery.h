@@ -8,10 +8,11 @@
 #include <thread>
 
 namespace pvpserver {
-namespace distributed {
+namespace storage {
+class RedisClusterClient;
+}  // namespace storage
 
-// Forward declaration
-class RedisClient;
+namespace distributed {
 
 /**
  * 서비스 디스커버리
@@ -21,9 +22,9 @@ class ServiceDiscovery {
 public:
     /**
      * 생성자
-     * @param redis Redis 클라이언트
+     * @param redis Redis 클라이언트 (세션 저장소와 같은 연결 풀을 공유 가능)
      */
-    explicit ServiceDiscovery(std::shared_ptr<RedisClient> redis);
+    explicit ServiceDiscovery(std::shared_ptr<storage::RedisClusterClient> redis);
     ~ServiceDiscovery();
 
     /**
@@ -79,7 +80,7 @@ public:
     void UpdateServerInfo(const ServerInfo& info);
 
 private:
-    std::shared_ptr<RedisClient> redis_;
+    std::shared_ptr<storage::RedisClusterClient> redis_;
     ServerInfo self_;
     std::atomic<bool> running_{false};
     std::thread heartbeat_thread_;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pvpserver {
+
+/**
+ * @brief Q16.16 고정소수점 수
+ *
+ * 정수 연산만 사용하므로 컴파일러/CPU/최적화 옵션과 무관하게 비트 단위로 같은 결과를 냅니다.
+ * 범위: ±32768, 해상도: 1/65536 (약 0.015mm).
+ */
+class Fixed {
+   public:
+    static constexpr int kFractionBits = 16;
+    static constexpr std::int64_t kOne = std::int64_t{1} << kFractionBits;
+
+    constexpr Fixed() = default;
+
+    static constexpr Fixed FromRaw(std::int32_t raw) {
+        Fixed value;
+        value.raw_ = raw;
+        return value;
+    }
+    static constexpr Fixed FromInt(std::int32_t value) {
+        return FromRaw(static_cast<std::int32_t>(value * kOne));
+    }
+    // 반올림 + 포화 변환 (같은 double 입력이면 항상 같은 raw 값)
+    static Fixed FromDouble(double value);
+
+    constexpr std::int32_t raw() const noexcept { return raw_; }
+    // raw / 65536은 double로 정확히 표현되므로 손실 없음
+    constexpr double ToDouble() const noexcept { return static_cast<double>(raw_) / kOne; }
+
+    friend Fixed operator+(Fixed a, Fixed b) { return Saturate(std::int64_t{a.raw_} + b.raw_); }
+    friend Fixed operator-(Fixed a, Fixed b) { return Saturate(std::int64_t{a.raw_} - b.raw_); }
+    friend Fixed operator-(Fixed a) { return Saturate(-std::int64_t{a.raw_}); }
+    friend Fixed operator*(Fixed a, Fixed b) {
+        return Saturate(FloorShift(std::int64_t{a.raw_} * b.raw_, kFractionBits));
+    }
+    // 0으로 나누면 0 (시뮬레이션 중 예외 대신 결정론적인 값)
+    friend Fixed operator/(Fixed a, Fixed b) {
+        return b.raw_ == 0 ? Fixed{} : Saturate(std::int64_t{a.raw_} * kOne / b.raw_);
+    }
+    Fixed& operator+=(Fixed other) { return *this = *this + other; }
+    Fixed& operator-=(Fixed other) { return *this = *this - other; }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.raw_ == b.raw_; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.raw_ != b.raw_; }
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.raw_ < b.raw_; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.raw_ <= b.raw_; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.raw_ > b.raw_; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.raw_ >= b.raw_; }
+
+    // 음수 우측 시프트는 C++17에서 구현 정의 → 내림 나눗셈으로 명시
+    static constexpr std::int64_t FloorShift(std::int64_t value, int bits) {
+        return value >= 0 ? (value >> bits) : -((-value + (std::int64_t{1} << bits) - 1) >> bits);
+    }
+    static constexpr Fixed Saturate(std::int64_t raw) {
+        return FromRaw(raw > INT32_MAX ? INT32_MAX
+                                       : (raw < INT32_MIN ? INT32_MIN : static_cast<std::int32_t>(raw)));
+    }
+
+   private:
+    std::int32_t raw_{0};
+};
+
+struct FixedVec2 {
+    Fixed x;
+    Fixed y;
+};
+
+/**
+ * @brief 정수 제곱근 (floor(sqrt(value)))
+ */
+std::uint64_t IntegerSqrt(std::uint64_t value);
+
+/**
+ * @brief 벡터 길이 (64비트 중간값, 오버플로 없음)
+ */
+Fixed FixedLength(FixedVec2 v);
+
+/**
+ * @brief 단위 벡터로 정규화 (길이가 0이면 0 벡터)
+ */
+FixedVec2 FixedNormalize(FixedVec2 v);
+
+/**
+ * @brief CORDIC atan2 (라디안, [-pi, pi])
+ */
+Fixed FixedAtan2(Fixed y, Fixed x);
+
+/**
+ * @brief CORDIC cos/sin (angle 라디안 → {cos, sin})
+ */
+FixedVec2 FixedDirection(Fixed angle);
+
+}  // namespace pvpserver
@@ -1,22 +1,35 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <limits>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "pvpserver/game/combat.h"
+#include "pvpserver/game/fixed_point.h"
 #include "pvpserver/game/movement.h"
 #include "pvpserver/game/player_state.h"
 #include "pvpserver/game/projectile.h"
 
 namespace pvpserver {
 
+// 시뮬레이션 수치 모드
+// - FloatingPoint: 기존 double 경로 (기본값)
+// - FixedPoint: Q16.16 정수 경로, 빌드/컴파일러와 무관하게 비트 단위 동일 (리플레이 검증용)
+enum class SimulationMode { FloatingPoint, FixedPoint };
+
 class GameSession {
    public:
-    explicit GameSession(double tick_rate);
+    // 롤백용 상태 체크포인트 (틱 시작 시점의 시뮬레이션 상태)
+    class Checkpoint;
+
+    explicit GameSession(double tick_rate, SimulationMode mode = SimulationMode::FloatingPoint);
+
+    SimulationMode simulation_mode() const noexcept { return mode_; }
 
     void UpsertPlayer(const std::string& player_id);
     void RemovePlayer(const std::string& player_id);
@@ -33,6 +46,19 @@ class GameSession {
     std::string MetricsSnapshot() const;
     std::size_t ActiveProjectileCount() const;
 
+    // 기존 Checkpoint 버퍼를 덮어써서 저장 (슬롯 재사용 시 추가 할당 최소화)
+    void SaveCheckpoint(Checkpoint& out) const;
+    void RestoreCheckpoint(const Checkpoint& checkpoint);
+    std::uint64_t PlayersDeadTotal() const;
+
+    // 시뮬레이션 상태 해시 (FNV-1a). 리플레이 시 틱별로 비교하여 상태 분기 검출
+    std::uint64_t StateChecksum() const;
+
+    // 라이브 매치 이전: 상태 전체를 바이트로 내보내고 다른 노드에서 그대로 복원
+    // - ImportState는 현재 상태를 교체. 형식이 깨졌거나 시뮬레이션 모드가 다르면 std::runtime_error
+    std::vector<std::uint8_t> ExportState() const;
+    void ImportState(const std::vector<std::uint8_t>& data);
+
    private:
     struct PlayerRuntimeState {
         PlayerState state;
@@ -42,14 +68,25 @@ class GameSession {
         int shots_fired{0};
         int hits_landed{0};
         int deaths{0};
+        // FixedPoint 모드 전용 (state.x/y는 표시용 사본)
+        FixedVec2 fixed_position;
+        Fixed fixed_last_fire_time;
+        bool has_fired{false};
     };
 
     void AppendCombatEvent(const CombatEvent& event);
     bool TrySpawnProjectile(PlayerRuntimeState& runtime, const MovementInput& input);
     void UpdateProjectilesLocked(std::uint64_t tick, double delta_seconds);
+    void ApplyInputFixedLocked(PlayerRuntimeState& runtime, const MovementInput& input,
+                               double delta_seconds);
+    bool TrySpawnProjectileFixed(PlayerRuntimeState& runtime, const MovementInput& input);
+    void UpdateProjectilesFixedLocked(std::uint64_t tick, double delta_seconds);
+    void ResolveHitLocked(Projectile& projectile, PlayerRuntimeState& runtime, std::uint64_t tick);
 
+    SimulationMode mode_;
     double speed_per_second_;
     double elapsed_time_{0.0};
+    Fixed fixed_elapsed_time_;
     std::uint64_t projectile_counter_{0};
     CombatLog combat_log_;
 
@@ -64,4 +101,29 @@ class GameSession {
     std::unordered_map<std::string, PlayerRuntimeState> players_;
 };
 
+class GameSession::Checkpoint {
+   public:
+    bool empty() const noexcept { return players_.empty() && projectiles_.empty(); }
+    std::size_t player_count() const noexcept { return players_.size(); }
+    std::uint64_t players_dead_total() const noexcept { return players_dead_total_; }
+
+    // 바이트 직렬화 (매치 이전 시 롤백 히스토리도 함께 옮기기 위함). 잘린 입력은 std::runtime_error
+    void Encode(std::vector<std::uint8_t>& out) const;
+    static Checkpoint Decode(const std::vector<std::uint8_t>& data, std::size_t& offset);
+
+   private:
+    friend class GameSession;
+
+    std::vector<std::pair<std::string, PlayerRuntimeState>> players_;
+    std::vector<Projectile> projectiles_;
+    CombatLog combat_log_{32};
+    double elapsed_time_{0.0};
+    Fixed fixed_elapsed_time_;
+    std::uint64_t projectile_counter_{0};
+    std::uint64_t projectiles_spawned_total_{0};
+    std::uint64_t projectiles_hits_total_{0};
+    std::uint64_t players_dead_total_{0};
+    std::uint64_t collisions_checked_total_{0};
+};
+
 }  // namespace pvpserver
@@ -2,17 +2,42 @@
 
 #include <string>
 
+#include "pvpserver/game/fixed_point.h"
+
 namespace pvpserver {
 
 class Projectile {
    public:
+    // 저장/복원용 전체 상태 (라이브 마이그레이션). 생성자와 달리 정규화 없이 값을 그대로 옮김
+    struct State {
+        std::string id;
+        std::string owner_id;
+        double x{0.0};
+        double y{0.0};
+        double dir_x{0.0};
+        double dir_y{0.0};
+        double spawn_time{0.0};
+        bool active{true};
+        FixedVec2 fixed_position;
+        FixedVec2 fixed_direction;
+        Fixed fixed_spawn_time;
+    };
+
     Projectile(std::string id, std::string owner_id, double x, double y, double dir_x, double dir_y,
                double spawn_time_seconds);
+    // 고정소수점 발사체 (결정론적 모드). direction은 이미 정규화된 값이어야 함
+    Projectile(std::string id, std::string owner_id, FixedVec2 position, FixedVec2 direction,
+               Fixed spawn_time_seconds);
 
     void Advance(double delta_seconds);
     bool IsExpired(double now_seconds) const;
+    void AdvanceFixed(Fixed delta_seconds);
+    bool IsExpiredFixed(Fixed now_seconds) const;
     void Deactivate();
 
+    State SaveState() const;
+    static Projectile FromState(State state);
+
     const std::string& id() const noexcept;
     const std::string& owner_id() const noexcept;
     double x() const noexcept;
@@ -22,20 +47,29 @@ class Projectile {
     double spawn_time() const noexcept;
     bool active() const noexcept;
     double radius() const noexcept;
+    FixedVec2 fixed_position() const noexcept;
 
+    static Fixed FixedRadius() noexcept;
     static double Speed() noexcept;
     static double Lifetime() noexcept;
 
    private:
+    Projectile() = default;
+
     std::string id_;
     std::string owner_id_;
-    double x_;
-    double y_;
-    double dir_x_;
-    double dir_y_;
-    double spawn_time_;
+    double x_{0.0};
+    double y_{0.0};
+    double dir_x_{0.0};
+    double dir_y_{0.0};
+    double spawn_time_{0.0};
     bool active_{true};
 
+    // 고정소수점 모드 상태 (x_/y_는 표시용으로 함께 갱신)
+    FixedVec2 fixed_position_;
+    FixedVec2 fixed_direction_;
+    Fixed fixed_spawn_time_;
+
     static constexpr double kSpeed_ = 30.0;    // meters per second
     static constexpr double kLifetime_ = 1.5;  // seconds
     static constexpr double kRadius_ = 0.2;    // meters
@@ -6,23 +6,37 @@
 
 namespace pvpserver {
 
+struct MatchTeam {
+    std::vector<std::string> players;
+    int average_elo{0};
+};
+
 class Match {
    public:
+    // 1:1 매치 (각 플레이어가 한 팀)
     Match(std::string match_id, std::vector<std::string> players, int average_elo,
           std::chrono::steady_clock::time_point created_at, std::string region);
+    // 팀전/개인전 매치
+    Match(std::string match_id, std::vector<MatchTeam> teams, int average_elo,
+          std::chrono::steady_clock::time_point created_at, std::string region,
+          std::string mode);
 
     const std::string& match_id() const noexcept { return match_id_; }
     const std::vector<std::string>& players() const noexcept { return players_; }
     int average_elo() const noexcept { return average_elo_; }
     std::chrono::steady_clock::time_point created_at() const noexcept { return created_at_; }
     const std::string& region() const noexcept { return region_; }
+    const std::vector<MatchTeam>& teams() const noexcept { return teams_; }
+    const std::string& mode() const noexcept { return mode_; }
 
    private:
     std::string match_id_;
     std::vector<std::string> players_;
+    std::vector<MatchTeam> teams_;
     int average_elo_;
     std::chrono::steady_clock::time_point created_at_;
     std::string region_;
+    std::string mode_;
 };
 
 }  // namespace pvpserver
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace pvpserver {
+
+/**
+ * @brief 매치 구성 규칙 (팀 수 × 팀 인원, 허용 파티 크기)
+ *
+ * - 1:1      : team_count=2, team_size=1
+ * - NvN      : team_count=2, team_size=N, 파티는 한 팀 안에만 배치됨
+ * - 개인전   : team_count=N, team_size=1 (파티 불가)
+ */
+struct MatchFormat {
+    std::string name{"1v1"};
+    std::size_t team_count{2};
+    std::size_t team_size{1};
+    std::size_t max_party_size{1};
+
+    std::size_t PlayersPerMatch() const noexcept { return team_count * team_size; }
+    bool IsDuel() const noexcept { return team_count == 2 && team_size == 1; }
+
+    static MatchFormat Duel() { return MatchFormat{}; }
+
+    static MatchFormat Teams(std::size_t team_size, std::size_t max_party_size) {
+        const std::string size = std::to_string(team_size);
+        return MatchFormat{size + "v" + size, 2, team_size,
+                           max_party_size < team_size ? max_party_size : team_size};
+    }
+
+    static MatchFormat FreeForAll(std::size_t players) {
+        return MatchFormat{"ffa" + std::to_string(players), players, 1, 1};
+    }
+};
+
+}  // namespace pvpserver
@@ -1,23 +1,215 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "pvpserver/matchmaking/match.h"
 
 namespace pvpserver {
 
+/**
+ * @brief 고정 크기 다중 생산자/다중 소비자 큐 (Vyukov 방식)
+ *
+ * 슬롯마다 순번(sequence)을 두어 생산자/소비자가 CAS 한 번으로 자리를 예약합니다.
+ * 가득 차면 TryPush가 false를 반환하며 절대 블로킹하지 않습니다.
+ */
+template <typename T>
+class BoundedMpmcQueue {
+   public:
+    explicit BoundedMpmcQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+    BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+    bool TryPush(T value) {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value.emplace(std::move(value));
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // 가득 참
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(T& out) {
+        std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(*cell.value);
+                    cell.value.reset();
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // 비어 있음
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 근사값 (동시 수정 중에는 순간값)
+    std::size_t ApproxSize() const noexcept {
+        const auto enqueued = enqueue_pos_.load(std::memory_order_relaxed);
+        const auto dequeued = dequeue_pos_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+    std::size_t Capacity() const noexcept { return mask_ + 1; }
+
+   private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        std::optional<T> value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_ = 0;
+    alignas(64) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<std::size_t> dequeue_pos_{0};
+};
+
+/**
+ * @brief 매치 생성 알림 채널
+ *
+ * - 우편함(Poll/Drain): 기존 풀 방식. 용량을 넘으면 가장 오래된 알림부터 버립니다.
+ * - 구독자(Subscribe): 구독자마다 고정 크기 큐를 두고, 전용 디스패처 스레드가
+ *   최대 max_batch개씩 묶어서 핸들러를 호출합니다.
+ *
+ * Publish는 어느 경우에도 블로킹하지 않으므로, 느린 구독자가 매칭 패스를 지연시키지 않습니다.
+ * 구독자 큐가 가득 차면 알림을 버리지 않고 구독자별 넘침 목록(overflow)에 옮겨 둡니다.
+ * 플레이어는 이미 대기열에서 빠졌으므로 알림을 잃으면 게임 세션 없이 매칭된 채로 남기 때문입니다.
+ * 디스패처는 고정 크기 큐 다음에 넘침 목록을 비우며, 넘침 목록이 빌 때까지 새 알림도 그 뒤에 붙습니다 (순서 유지).
+ */
 class MatchNotificationChannel {
    public:
+    struct Options {
+        std::size_t capacity = 4096;         // 구독자별 큐 / 우편함 용량
+        std::size_t dispatcher_threads = 1;  // 첫 Subscribe 때 시작
+        std::size_t max_batch = 64;
+        bool mailbox = true;
+    };
+
+    using BatchHandler = std::function<void(const std::vector<Match>& batch)>;
+
+    MatchNotificationChannel();
+    explicit MatchNotificationChannel(Options options);
+    ~MatchNotificationChannel();
+
+    MatchNotificationChannel(const MatchNotificationChannel&) = delete;
+    MatchNotificationChannel& operator=(const MatchNotificationChannel&) = delete;
+
     void Publish(const Match& match);
     std::optional<Match> Poll();
     std::vector<Match> Drain();
 
+    /**
+     * @brief 구독자 등록 (핸들러는 디스패처 스레드에서 호출됨, 같은 구독자는 한 스레드에서만)
+     */
+    void Subscribe(std::string name, BatchHandler handler);
+
+    /**
+     * @brief 지금까지 구독자 큐에 들어간 알림이 모두 전달될 때까지 대기
+     */
+    bool Flush(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
+
+    /**
+     * @brief 남은 알림을 전달한 뒤 디스패처 종료 (이후 구독자 알림은 버려짐)
+     */
+    void Stop();
+
+    void SetMailboxEnabled(bool enabled);
+    std::string MetricsSnapshot() const;
+
    private:
+    struct Subscriber {
+        Subscriber(std::string subscriber_name, BatchHandler batch_handler, std::size_t capacity,
+                   std::size_t dispatcher_index)
+            : name(std::move(subscriber_name)),
+              handler(std::move(batch_handler)),
+              queue(capacity),
+              dispatcher(dispatcher_index) {}
+
+        std::string name;
+        BatchHandler handler;
+        BoundedMpmcQueue<Match> queue;
+        std::size_t dispatcher;
+
+        std::atomic<std::uint64_t> enqueued_total{0};
+        std::atomic<std::uint64_t> delivered_total{0};
+        std::atomic<std::uint64_t> spilled_total{0};  // 큐가 가득 차 넘침 목록으로 간 알림
+
+        // 넘침 목록 (overflow_mutex 보호, 크기는 잠금 없이 확인)
+        std::mutex overflow_mutex;
+        std::deque<Match> overflow;
+        std::atomic<std::size_t> overflow_size{0};
+        std::atomic<std::uint64_t> batches_total{0};
+        std::atomic<std::uint64_t> handler_us_total{0};
+        std::atomic<std::size_t> depth_high_watermark{0};
+    };
+    using SubscriberList = std::vector<std::shared_ptr<Subscriber>>;
+
+    struct Dispatcher {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<bool> idle{false};
+    };
+
+    std::shared_ptr<const SubscriberList> LoadSubscribers() const;
+    void DispatchLoop(std::size_t index);
+    bool HasPending(const SubscriberList& subscribers, std::size_t index) const;
+    void Wake(Dispatcher& dispatcher);
+
+    Options options_;
+
+    // 우편함 (기존 Poll/Drain)
     std::mutex mutex_;
     std::queue<Match> queue_;
+    std::atomic<bool> mailbox_enabled_;
+    std::atomic<std::uint64_t> mailbox_dropped_total_{0};
+
+    // 구독자 목록은 복사 후 교체 (Publish는 스냅샷만 읽음)
+    std::shared_ptr<const SubscriberList> subscribers_;
+    std::mutex subscribe_mutex_;
+    std::vector<std::unique_ptr<Dispatcher>> dispatchers_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<std::uint64_t> published_total_{0};
 };
 
 }  // namespace pvpserver
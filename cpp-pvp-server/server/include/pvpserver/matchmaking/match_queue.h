@@ -1,11 +1,11 @@
 #pragma once
 
 #include <cstdint>
-#include <iostream>
-#include <list>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
-#include <ostream>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +14,10 @@
 
 namespace pvpserver {
 
+namespace storage {
+class RedisClient;
+}
+
 struct QueuedPlayer {
     MatchRequest request;
     std::uint64_t order{0};
@@ -21,13 +25,39 @@ struct QueuedPlayer {
 
 class MatchQueue {
    public:
+    using OrderedVisitor = std::function<void(const MatchRequest& request, std::uint64_t order)>;
+
     virtual ~MatchQueue() = default;
 
     virtual void Upsert(const MatchRequest& request, std::uint64_t order) = 0;
     virtual bool Remove(const std::string& player_id) = 0;
+    /**
+     * @brief 매치 단위로 대기열에서 가져가기
+     *
+     * 그룹마다 전원이 아직 대기 중일 때만 한꺼번에 제거합니다 (한 명이라도 없으면 아무도 제거하지 않음).
+     * @return 그룹별 성공 여부
+     */
+    virtual std::vector<bool> Claim(const std::vector<std::vector<std::string>>& groups) = 0;
     virtual std::vector<QueuedPlayer> FetchOrdered() const = 0;
+    /**
+     * @brief (ELO, 순서) 오름차순으로 복사 없이 순회
+     *
+     * 전달된 참조는 다음 순회 또는 Upsert/Remove 호출 전까지만 유효합니다.
+     * 기본 구현은 FetchOrdered() 결과를 fetched_ordered_에 보관한 채 순회합니다.
+     */
+    virtual void ForEachOrdered(const OrderedVisitor& visitor) const;
+    /**
+     * @brief min_elo ≤ ELO ≤ max_elo 구간만 ForEachOrdered와 같은 순서로 순회
+     *
+     * 기본 구현은 ForEachOrdered() 결과를 걸러냅니다.
+     */
+    virtual void ForEachInRange(int min_elo, int max_elo, const OrderedVisitor& visitor) const;
     virtual std::size_t Size() const = 0;
     virtual std::string Snapshot() const = 0;
+
+   private:
+    // 기본 ForEachOrdered가 마지막으로 가져온 요청 (visitor에 넘긴 참조의 수명 유지)
+    mutable std::vector<QueuedPlayer> fetched_ordered_;
 };
 
 class InMemoryMatchQueue : public MatchQueue {
@@ -37,35 +67,90 @@ class InMemoryMatchQueue : public MatchQueue {
 
     void Upsert(const MatchRequest& request, std::uint64_t order) override;
     bool Remove(const std::string& player_id) override;
+    std::vector<bool> Claim(const std::vector<std::vector<std::string>>& groups) override;
     std::vector<QueuedPlayer> FetchOrdered() const override;
+    void ForEachOrdered(const OrderedVisitor& visitor) const override;
+    void ForEachInRange(int min_elo, int max_elo, const OrderedVisitor& visitor) const override;
     std::size_t Size() const override;
     std::string Snapshot() const override;
 
    private:
-    struct BucketEntry {
-        MatchRequest request;
+    // 슬랩 슬롯: 요청 본문은 슬롯에 한 번만 저장, 버킷은 슬롯 번호만 가짐
+    struct Slot {
+        std::optional<MatchRequest> request;
+        std::uint64_t order{0};
+        std::uint32_t generation{0};  // 해제될 때마다 증가 (버킷의 툼스톤 판별용)
+    };
+
+    struct BucketRef {
+        std::uint32_t slot;
+        std::uint32_t generation;
         std::uint64_t order;
     };
 
-    using Bucket = std::list<BucketEntry>;
+    // ELO 하나의 FIFO 배열 (삭제는 툼스톤으로 표시하고 나중에 압축)
+    struct Bucket {
+        std::vector<BucketRef> entries;
+        std::size_t head{0};  // 앞쪽 툼스톤 건너뛰기
+        std::size_t live{0};
+    };
+
+    bool IsLive(const BucketRef& ref) const noexcept {
+        return slots_[ref.slot].generation == ref.generation;
+    }
+    void RemoveSlot(std::uint32_t slot);
+    static void InsertOrdered(Bucket& bucket, const BucketRef& ref);
+    void CompactIfSparse(Bucket& bucket);
+    template <typename Visitor>
+    void VisitBucket(const Bucket& bucket, Visitor&& visitor) const;
 
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> free_slots_;
     std::map<int, Bucket> buckets_;
-    std::unordered_map<std::string, std::pair<int, typename Bucket::iterator>> index_;
+    std::unordered_map<std::string, std::uint32_t> index_;  // player_id → 슬롯
 };
 
+/**
+ * @brief Redis Sorted Set 기반 공유 대기열
+ *
+ * 여러 게임 서버가 같은 key_prefix를 쓰면 하나의 대기열을 공유합니다.
+ * - {prefix}:queue    ZSET  member=player_id, score=ELO × 2^32 + order
+ * - {prefix}:requests HASH  player_id → 요청 본문 (order, ELO, 대기 시작 시각, 리전, 파티원)
+ * - {prefix}:order    STRING 대기 순서 카운터 (INCR, 서버 간 공유 → Upsert의 order 인자는 무시)
+ *
+ * Claim은 매치마다 Lua 스크립트(EVAL) 하나로 전원 확인 + ZREM/HDEL을 원자적으로 수행하고,
+ * 한 패스의 매치를 모두 한 번의 파이프라인으로 보냅니다.
+ *
+ * ForEachInRange는 ZRANGEBYSCORE로 해당 ELO 구간만 가져오므로, 서버(샤드)마다
+ * 겹치지 않는 ELO 구간을 맡기면 전체 대기열을 읽지 않고도 중복 매칭 없이 나눠 처리할 수 있습니다.
+ * 순회 중 전달된 참조는 다음 순회 또는 Upsert/Remove 전까지 유효합니다.
+ */
 class RedisMatchQueue : public MatchQueue {
    public:
-    explicit RedisMatchQueue(std::ostream& stream = std::cout);
+    static constexpr std::size_t kPageSize = 512;
+
+    explicit RedisMatchQueue(std::shared_ptr<storage::RedisClient> client,
+                             std::string key_prefix = "pvp:matchmaking");
 
     void Upsert(const MatchRequest& request, std::uint64_t order) override;
     bool Remove(const std::string& player_id) override;
+    std::vector<bool> Claim(const std::vector<std::vector<std::string>>& groups) override;
     std::vector<QueuedPlayer> FetchOrdered() const override;
+    void ForEachOrdered(const OrderedVisitor& visitor) const override;
+    void ForEachInRange(int min_elo, int max_elo, const OrderedVisitor& visitor) const override;
     std::size_t Size() const override;
     std::string Snapshot() const override;
 
    private:
-    std::ostream* stream_;
-    InMemoryMatchQueue fallback_;
+    void FetchScoreRange(const std::string& min_score, const std::string& max_score,
+                         const OrderedVisitor& visitor) const;
+
+    std::shared_ptr<storage::RedisClient> client_;
+    std::string queue_key_;
+    std::string requests_key_;
+    std::string order_key_;
+    // 마지막 순회에서 가져온 요청 (visitor에 넘긴 참조의 수명 유지)
+    mutable std::deque<MatchRequest> fetched_;
 };
 
 }  // namespace pvpserver
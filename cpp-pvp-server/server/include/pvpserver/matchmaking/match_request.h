@@ -1,19 +1,29 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace pvpserver {
 
 class MatchRequest {
    public:
+    /**
+     * @param player_id 요청 주체 (파티면 파티장, 대기열 키)
+     * @param elo 매칭 기준 ELO (파티면 파티 평균)
+     * @param party_members 파티장을 제외한 동반 파티원 (솔로면 비어 있음)
+     */
     MatchRequest(std::string player_id, int elo, std::chrono::steady_clock::time_point enqueued_at,
-                 std::string preferred_region = "global");
+                 std::string preferred_region = "global",
+                 std::vector<std::string> party_members = {});
 
     const std::string& player_id() const noexcept { return player_id_; }
     int elo() const noexcept { return elo_; }
     std::chrono::steady_clock::time_point enqueued_at() const noexcept { return enqueued_at_; }
     const std::string& preferred_region() const noexcept { return preferred_region_; }
+    const std::vector<std::string>& party_members() const noexcept { return party_members_; }
+    std::size_t party_size() const noexcept { return party_members_.size() + 1; }
 
     double WaitSeconds(std::chrono::steady_clock::time_point now) const noexcept;
     int CurrentTolerance(std::chrono::steady_clock::time_point now) const noexcept;
@@ -23,6 +33,7 @@ class MatchRequest {
     int elo_;
     std::chrono::steady_clock::time_point enqueued_at_;
     std::string preferred_region_;
+    std::vector<std::string> party_members_;
 };
 
 bool RegionsCompatible(const MatchRequest& lhs, const MatchRequest& rhs) noexcept;
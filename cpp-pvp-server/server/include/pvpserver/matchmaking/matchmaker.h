@@ -6,10 +6,13 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pvpserver/matchmaking/match.h"
+#include "pvpserver/matchmaking/match_format.h"
 #include "pvpserver/matchmaking/match_notification_channel.h"
 #include "pvpserver/matchmaking/match_queue.h"
 
@@ -17,24 +20,78 @@ namespace pvpserver {
 
 class Matchmaker {
    public:
-    explicit Matchmaker(std::shared_ptr<MatchQueue> queue);
+    static constexpr std::array<double, 6> kWaitBuckets{{0.0, 5.0, 10.0, 20.0, 40.0, 80.0}};
+
+    // Prometheus 출력용 누적값 (여러 Matchmaker를 합산할 수 있음)
+    struct MetricsTotals {
+        std::size_t queue_size{0};
+        std::uint64_t matches_created{0};
+        std::array<std::uint64_t, kWaitBuckets.size()> wait_bucket_counts{};
+        std::uint64_t wait_overflow_count{0};
+        double wait_sum{0.0};
+        std::uint64_t wait_count{0};
+        std::uint64_t pass_scanned_total{0};
+        double last_pass_seconds{0.0};
+
+        MetricsTotals& operator+=(const MetricsTotals& other);
+    };
+
+    explicit Matchmaker(std::shared_ptr<MatchQueue> queue, MatchFormat format = MatchFormat::Duel());
 
     void SetMatchCreatedCallback(std::function<void(const Match&)> callback);
 
-    void Enqueue(const MatchRequest& request);
+    // 파티 크기가 포맷 허용치를 넘으면 false (대기열에 넣지 않음)
+    bool Enqueue(const MatchRequest& request);
     bool Cancel(const std::string& player_id);
 
+    /**
+     * @brief 이 Matchmaker가 매칭할 ELO 구간 지정 (양 끝 포함)
+     *
+     * 여러 서버가 RedisMatchQueue 하나를 공유할 때 서버마다 겹치지 않는 구간을 맡기면
+     * 각 패스는 자기 구간만 조회하고, 같은 플레이어를 두 서버가 매칭하지 않습니다.
+     */
+    void SetEloBand(int min_elo, int max_elo);
+
     std::vector<Match> RunMatching(std::chrono::steady_clock::time_point now);
 
     std::string MetricsSnapshot() const;
+    MetricsTotals GetMetricsTotals() const;
+    static std::string RenderMetrics(const MetricsTotals& totals);
 
     MatchNotificationChannel& notification_channel() { return notifications_; }
+    const MatchFormat& format() const noexcept { return format_; }
 
    private:
+    // 스윕 인덱스 항목: 큐 내부 요청을 가리키는 포인터 + 지연 계산된 허용 범위
+    struct SweepEntry {
+        const MatchRequest* request;
+        int elo;
+        int tolerance;  // kToleranceUnknown이면 아직 계산 전
+    };
+    static constexpr int kToleranceUnknown = -1;
+    // 그룹 편성 시 앵커당 살펴볼 최대 후보 수 = 매치 인원 × 이 값
+    static constexpr std::size_t kGroupScanFactor = 8;
+
+    // 팀 편성 결과: 스윕 인덱스 + 배정된 팀 번호
+    struct GroupMember {
+        std::size_t entry;
+        std::size_t team;
+    };
+
+    void MatchPairsLocked(std::chrono::steady_clock::time_point now, std::vector<Match>& matches);
+    void MatchGroupsLocked(std::chrono::steady_clock::time_point now, std::vector<Match>& matches);
+    std::size_t ClaimMatchesLocked(std::chrono::steady_clock::time_point now,
+                                   std::vector<Match>& matches);
+    bool CollectGroupLocked(std::size_t anchor, std::chrono::steady_clock::time_point now);
+    void BalanceTeamsLocked();
+    Match BuildGroupMatchLocked(std::chrono::steady_clock::time_point now);
     void ObserveWaitLocked(double seconds);
+    int ToleranceLocked(SweepEntry& entry, std::chrono::steady_clock::time_point now);
+    std::size_t NextLiveLocked(std::size_t index);
     static std::string ResolveRegion(const MatchRequest& lhs, const MatchRequest& rhs);
 
     std::shared_ptr<MatchQueue> queue_;
+    MatchFormat format_;
     mutable std::mutex mutex_;
     std::function<void(const Match&)> callback_;
     MatchNotificationChannel notifications_;
@@ -43,8 +100,19 @@ class Matchmaker {
     std::uint64_t match_counter_{0};
     std::uint64_t matches_created_{0};
     std::size_t last_queue_size_{0};
+    std::optional<std::pair<int, int>> elo_band_;
+
+    // RunMatching 간 재사용 버퍼 (매 패스마다 재할당하지 않음)
+    std::vector<SweepEntry> sweep_;
+    std::vector<std::size_t> next_live_;  // 툼스톤 건너뛰기 링크 (경로 압축)
+    std::vector<GroupMember> group_;       // 편성 중인 그룹
+    std::vector<std::size_t> team_load_;   // 팀별 배정 인원
+    std::vector<long long> team_elo_sum_;  // 팀별 ELO 합 (인원 가중)
+    std::vector<std::size_t> match_entries_;  // 매치별 스윕 인덱스 (match_entry_ends_로 구분)
+    std::vector<std::size_t> match_entry_ends_;
+    std::uint64_t pass_scanned_total_{0};
+    double last_pass_seconds_{0.0};
 
-    static constexpr std::array<double, 6> kWaitBuckets{{0.0, 5.0, 10.0, 20.0, 40.0, 80.0}};
     std::array<std::uint64_t, kWaitBuckets.size()> wait_bucket_counts_{};
     std::uint64_t wait_overflow_count_{0};
     double wait_sum_{0.0};
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "pvpserver/matchmaking/match_format.h"
+#include "pvpserver/matchmaking/match_notification_channel.h"
+#include "pvpserver/matchmaking/match_queue.h"
+#include "pvpserver/matchmaking/matchmaker.h"
+
+namespace pvpserver {
+
+/**
+ * @brief 락 없는 다중 생산자/단일 소비자 제출 큐
+ *
+ * 생산자는 CAS로 스택 머리에 노드를 붙이고, 소비자는 exchange로 스택 전체를 가져와
+ * 뒤집어서 제출 순서(FIFO)대로 처리합니다.
+ */
+template <typename T>
+class SubmissionQueue {
+   public:
+    SubmissionQueue() = default;
+    SubmissionQueue(const SubmissionQueue&) = delete;
+    SubmissionQueue& operator=(const SubmissionQueue&) = delete;
+    ~SubmissionQueue() { DeleteList(head_.exchange(nullptr, std::memory_order_acquire)); }
+
+    void Push(T value) {
+        Node* node = new Node{std::move(value), head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+    }
+
+    // 지금까지 제출된 항목을 제출 순서대로 visitor에 전달 (소비자 스레드 전용)
+    template <typename Visitor>
+    std::size_t Drain(Visitor&& visitor) {
+        Node* list = head_.exchange(nullptr, std::memory_order_acquire);
+        Node* reversed = nullptr;
+        while (list) {
+            Node* next = list->next;
+            list->next = reversed;
+            reversed = list;
+            list = next;
+        }
+        std::size_t drained = 0;
+        while (reversed) {
+            Node* next = reversed->next;
+            visitor(reversed->value);
+            delete reversed;
+            reversed = next;
+            ++drained;
+        }
+        return drained;
+    }
+
+   private:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    static void DeleteList(Node* node) {
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    std::atomic<Node*> head_{nullptr};
+};
+
+/**
+ * @brief 리전 × 모드별로 샤딩된 매치메이커
+ *
+ * 샤드마다 독립된 대기열/Matchmaker/워커 스레드를 가지며, Enqueue/Cancel은
+ * 락 없는 제출 큐에 넣기만 하고 즉시 반환합니다. 워커가 매 패스 시작 시 제출분을 반영합니다.
+ *
+ * - 알 수 없는 리전은 리전을 그대로 둔 채 첫 번째 리전(기본 리전) 샤드로 보냅니다
+ *   (같은 리전이나 "any"와만 매칭되는 기존 규칙 유지).
+ * - "any"는 같은 모드의 모든 리전 샤드에 복사해 넣습니다. 한 샤드가 매치로 가져가면
+ *   공유 장부에서 표를 지우고 나머지 샤드에 Cancel을 보내므로 두 번 매칭되지 않습니다.
+ * - 샤드 워커는 생성된 매치를 알림 채널에 넣기만 하고, 콜백/구독자는
+ *   채널의 디스패처 스레드에서 호출됩니다 (느린 소비자가 매칭 패스를 지연시키지 않음).
+ */
+class ShardedMatchmaker {
+   public:
+    ShardedMatchmaker(std::vector<std::string> regions, std::vector<MatchFormat> formats,
+                      std::chrono::milliseconds interval = std::chrono::milliseconds(200));
+    ~ShardedMatchmaker();
+
+    ShardedMatchmaker(const ShardedMatchmaker&) = delete;
+    ShardedMatchmaker& operator=(const ShardedMatchmaker&) = delete;
+
+    // 알림 채널 구독자로 등록 (디스패처 스레드에서 호출됨)
+    void SetMatchCreatedCallback(std::function<void(const Match&)> callback);
+    MatchNotificationChannel& notification_channel() { return notifications_; }
+
+    /**
+     * @brief 대기열 등록 제출 (모드가 없거나 파티가 너무 크면 false)
+     */
+    bool Enqueue(const MatchRequest& request, const std::string& mode = "1v1");
+
+    /**
+     * @brief 취소 제출 (플레이어가 어느 샤드에 있는지 모르므로 모든 샤드에 전달)
+     */
+    void Cancel(const std::string& player_id);
+
+    void Start();
+    void Stop();
+
+    /**
+     * @brief 모든 샤드를 호출 스레드에서 한 번씩 실행 (Start() 전, 테스트/수동 구동용)
+     */
+    std::size_t RunOnce(std::chrono::steady_clock::time_point now);
+
+    std::string MetricsSnapshot() const;
+    std::size_t ShardCount() const noexcept { return shards_.size(); }
+
+   private:
+    static constexpr std::array<double, 7> kPassBuckets{
+        {0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5}};
+
+    struct Command {
+        enum class Kind { Enqueue, Cancel };
+        Kind kind;
+        std::optional<MatchRequest> request;
+        std::string player_id;
+        std::uint64_t ticket{0};  // "any" 복사본의 표 (0이면 일반 요청)
+    };
+
+    /**
+     * @brief 샤드 대기열
+     *
+     * "any" 복사본은 공유 장부(fanout_tickets_)에 자기 표가 아직 남아 있을 때만 Claim되고,
+     * Claim에 성공하면 표를 지운 뒤 같은 모드의 다른 샤드에 Cancel을 보냅니다.
+     */
+    class ShardQueue : public InMemoryMatchQueue {
+       public:
+        ShardQueue(ShardedMatchmaker& owner, std::string key, std::string mode);
+
+        // 다음 Upsert 전에 워커가 호출 (0이면 일반 요청)
+        void SetTicket(const std::string& player_id, std::uint64_t ticket);
+        bool Remove(const std::string& player_id) override;
+        std::vector<bool> Claim(const std::vector<std::vector<std::string>>& groups) override;
+        std::size_t FanoutCopies() const noexcept {
+            return fanout_copies_.load(std::memory_order_relaxed);
+        }
+
+       private:
+        ShardedMatchmaker& owner_;
+        std::string key_;
+        std::string mode_;
+        std::unordered_map<std::string, std::uint64_t> tickets_;  // 이 샤드의 "any" 복사본
+        std::atomic<std::size_t> fanout_copies_{0};               // 메트릭 스레드용
+    };
+
+    struct Shard {
+        std::string key;  // "region/mode"
+        MatchFormat format;
+        std::shared_ptr<ShardQueue> queue;
+        std::unique_ptr<Matchmaker> matchmaker;
+        SubmissionQueue<Command> submissions;
+        std::thread worker;
+
+        // 워커만 쓰고 메트릭 수집 스레드가 읽음 (relaxed 원자 변수)
+        std::array<std::atomic<std::uint64_t>, kPassBuckets.size()> pass_bucket_counts{};
+        std::atomic<std::uint64_t> pass_overflow_count{0};
+        std::atomic<std::uint64_t> pass_count{0};
+        std::atomic<std::uint64_t> pass_sum_us{0};
+        std::atomic<std::uint64_t> submitted_total{0};
+    };
+
+    Shard* FindShard(const std::string& region, const std::string& mode) const;
+    static std::string FanoutKey(const std::string& mode, const std::string& player_id) {
+        return mode + "/" + player_id;
+    }
+    // fanout_mutex_를 잡은 상태에서 호출: except_key 샤드를 뺀 같은 모드 샤드에 Cancel 제출
+    void CancelFanoutCopiesLocked(const std::string& mode, const std::string& player_id,
+                                  const std::string& except_key);
+    std::size_t RunShardPass(Shard& shard, std::chrono::steady_clock::time_point now);
+    void WorkerLoop(Shard& shard);
+
+    std::vector<std::string> regions_;
+    std::vector<MatchFormat> formats_;
+    std::chrono::milliseconds interval_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::unordered_map<std::string, Shard*> shard_index_;  // 생성 후 읽기 전용
+    MatchNotificationChannel notifications_;
+
+    // "any" 요청의 공유 장부: "mode/player_id" → 현재 유효한 표 (Claim/Cancel 시 삭제)
+    mutable std::mutex fanout_mutex_;
+    std::unordered_map<std::string, std::uint64_t> fanout_tickets_;
+    std::uint64_t next_ticket_{0};
+
+    std::atomic<bool> running_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+};
+
+}  // namespace pvpserver
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "pvpserver/game/player_state.h"
+#include "pvpserver/netcode/client_prediction.h"
+#include "pvpserver/network/packet_types.h"
+
+namespace pvpserver::netcode {
+
+/**
+ * @brief 읽기 전용 연속 메모리 뷰 (C++17에는 std::span이 없음)
+ */
+template <typename T>
+class ConstSpan {
+   public:
+    ConstSpan() = default;
+    ConstSpan(const T* data, std::size_t size) : data_(data), size_(size) {}
+
+    const T* begin() const noexcept { return data_; }
+    const T* end() const noexcept { return data_ + size_; }
+    const T* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    const T& operator[](std::size_t index) const noexcept { return data_[index]; }
+    const T& back() const noexcept { return data_[size_ - 1]; }
+
+   private:
+    const T* data_{nullptr};
+    std::size_t size_{0};
+};
+
+/**
+ * @brief 미러링 링 버퍼
+ *
+ * 각 원소를 [i]와 [i + N] 두 곳에 기록하여, 최대 N개의 구간이 항상
+ * 연속 메모리로 보이게 합니다. 덕분에 랩어라운드 없이 ConstSpan을 반환할 수 있습니다.
+ */
+template <typename T, std::size_t N>
+class MirroredRing {
+   public:
+    void PushBack(const T& value) {
+        if (size_ == N) {
+            PopFront();  // 가장 오래된 원소 덮어쓰기
+        }
+        const std::size_t slot = (head_ + size_) % N;
+        slots_[slot] = value;
+        slots_[slot + N] = value;
+        ++size_;
+    }
+
+    void PopFront() {
+        head_ = (head_ + 1) % N;
+        --size_;
+    }
+
+    void Clear() {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    ConstSpan<T> View() const { return ConstSpan<T>(slots_.data() + head_, size_); }
+    std::size_t Size() const noexcept { return size_; }
+    bool Empty() const noexcept { return size_ == 0; }
+    const T& Front() const { return slots_[head_]; }
+    const T& Back() const { return slots_[head_ + size_ - 1]; }
+
+   private:
+    std::array<T, N * 2> slots_{};
+    std::size_t head_{0};
+    std::size_t size_{0};
+};
+
+/**
+ * @brief 예측된 위치 (문자열 없는 경량 상태)
+ */
+struct PredictedPose {
+    std::uint32_t input_sequence{0};
+    double x{0.0};
+    double y{0.0};
+    double facing_radians{0.0};
+    std::uint64_t timestamp{0};
+};
+
+/**
+ * @brief 고정 용량 클라이언트 예측 엔진
+ *
+ * ClientPrediction과 동일한 로직이지만, MAX_PENDING_INPUTS 슬롯의 링 버퍼만 사용하여
+ * 입력/예측마다 힙 할당이 없습니다. 봇 클라이언트·부하 생성기처럼
+ * 한 프로세스에서 수천 명을 시뮬레이션하는 용도입니다.
+ */
+class FixedClientPrediction {
+   public:
+    static constexpr std::size_t MAX_PENDING_INPUTS = ClientPrediction::MAX_PENDING_INPUTS;
+
+    /**
+     * @brief 입력 적용 및 예측 상태 생성 (입력은 히스토리에 기록)
+     */
+    PredictedPose Predict(const PredictedPose& current, const InputCommand& input,
+                          float delta_time);
+
+    /**
+     * @brief 예측 상태 저장
+     */
+    void SavePrediction(const PredictedPose& prediction);
+
+    /**
+     * @brief 서버 확인된 시퀀스까지의 예측 제거
+     */
+    void AcknowledgeUpTo(std::uint32_t server_sequence);
+
+    /**
+     * @brief 미확인 입력 뷰 (다음 Predict/AcknowledgeUpTo 호출 전까지 유효)
+     */
+    ConstSpan<InputCommand> GetUnacknowledgedInputs(std::uint32_t after_sequence) const;
+
+    /**
+     * @brief 보관 중인 예측 상태 뷰 (오래된 순)
+     */
+    ConstSpan<PredictedPose> Predictions() const { return predictions_.View(); }
+
+    std::optional<PredictedPose> GetLatestPrediction() const;
+    std::optional<PredictedPose> GetPrediction(std::uint32_t sequence) const;
+
+    ClientPrediction::Stats GetStats() const { return stats_; }
+    void RecordPredictionResult(bool accurate);
+
+    /**
+     * @brief 단일 입력 시뮬레이션 (히스토리 변경 없음, 재시뮬레이션용)
+     */
+    static PredictedPose Simulate(const PredictedPose& pose, const InputCommand& input,
+                                  float delta_time);
+
+    static PredictedPose PoseFromState(const PlayerState& state);
+
+   private:
+    MirroredRing<PredictedPose, MAX_PENDING_INPUTS> predictions_;
+    MirroredRing<InputCommand, MAX_PENDING_INPUTS> input_history_;
+    std::uint32_t last_acknowledged_{0};
+    ClientPrediction::Stats stats_;
+};
+
+}  // namespace pvpserver::netcode
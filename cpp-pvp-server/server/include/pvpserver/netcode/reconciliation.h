@@ -4,6 +4,7 @@
 
 #include "pvpserver/game/player_state.h"
 #include "pvpserver/netcode/client_prediction.h"
+#include "pvpserver/netcode/fixed_client_prediction.h"
 
 namespace pvpserver::netcode {
 
@@ -17,6 +18,15 @@ struct ReconciliationResult {
     PlayerState corrected_state;
 };
 
+/**
+ * @brief 경량 리컨실리에이션 결과 (FixedClientPrediction용)
+ */
+struct PoseReconciliationResult {
+    bool mismatch_detected{false};
+    float position_error{0.0f};
+    PredictedPose corrected_pose;
+};
+
 /**
  * @brief 리컨실리에이션 시스템
  * 
@@ -38,6 +48,16 @@ class Reconciliation {
         float delta_time
     );
 
+    /**
+     * @brief 고정 용량 예측 엔진용 리컨실리에이션 (할당 없음)
+     * @param server_pose 서버 상태 (input_sequence = 서버가 처리한 마지막 입력)
+     */
+    PoseReconciliationResult Reconcile(
+        const PredictedPose& server_pose,
+        FixedClientPrediction& prediction,
+        float delta_time
+    );
+
     /**
      * @brief 부드러운 보정 (스냅이 아닌 보간)
      */
@@ -63,10 +83,12 @@ class Reconciliation {
      */
     PlayerState Resimulate(
         const PlayerState& server_state,
-        const std::vector<InputCommand>& inputs,
+        ConstSpan<InputCommand> inputs,
         float delta_time
     );
 
+    void RecordError(float position_error);
+
     Stats stats_;
 };
 
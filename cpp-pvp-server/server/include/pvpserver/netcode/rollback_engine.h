@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "pvpserver/game/game_session.h"
+#include "pvpserver/game/movement.h"
+
+namespace pvpserver::netcode {
+
+/**
+ * @brief 롤백 엔진 설정
+ */
+struct RollbackConfig {
+    std::size_t history_ticks{32};                // 체크포인트 보관 틱 수 (60 TPS 기준 약 0.5초)
+    std::chrono::microseconds tick_budget{2000};  // 틱당 재시뮬레이션 CPU 예산
+};
+
+/**
+ * @brief 입력 처리 결과
+ */
+enum class InputDisposition {
+    Applied,     // 현재 틱에 즉시 적용
+    RolledBack,  // 과거 틱에 삽입, 다음 틱에서 재시뮬레이션
+    Duplicate,   // 이미 기록된 시퀀스
+    TooOld,      // 히스토리 범위 밖 (또는 확정된 사망 이벤트 이전)
+};
+
+/**
+ * @brief 서버 측 롤백 & 재시뮬레이션 엔진
+ *
+ * 틱마다 GameSession 체크포인트와 해당 틱에 적용된 입력을 링 버퍼에 기록합니다.
+ * 늦게 도착했지만 유효한 입력은 원래 틱에 삽입하고, 다음 AdvanceTick에서
+ * 체크포인트를 복원한 뒤 중간 틱들을 결정론적으로 다시 실행합니다.
+ */
+class RollbackEngine {
+   public:
+    explicit RollbackEngine(GameSession& session, RollbackConfig config = {});
+
+    /**
+     * @brief 입력 제출 (네트워크 스레드)
+     */
+    InputDisposition SubmitInput(const std::string& player_id, const MovementInput& input,
+                                 double delta_seconds);
+
+    /**
+     * @brief 한 틱 진행 (게임 루프 스레드)
+     *
+     * 대기 중인 롤백이 있으면 먼저 재시뮬레이션한 뒤 session.Tick()을 호출합니다.
+     */
+    void AdvanceTick(std::uint64_t tick, double delta_seconds);
+
+    /**
+     * @brief 플레이어 입장/퇴장 시 히스토리 무효화
+     *
+     * 체크포인트는 로스터를 포함하므로 로스터가 바뀌면 그 이전으로는 되돌릴 수 없습니다.
+     */
+    void ResetHistory();
+
+    /**
+     * @brief 로스터 변경 (네트워크 스레드)
+     *
+     * 세션 변경과 히스토리 무효화를 같은 잠금 안에서 처리합니다. 따로 하면 그 사이에
+     * 게임 루프의 재시뮬레이션이 옛 체크포인트를 복원해 방금 들어온 플레이어를 지우거나
+     * 나간 플레이어를 되살릴 수 있습니다.
+     */
+    void AddPlayer(const std::string& player_id);
+    void RemovePlayer(const std::string& player_id);
+
+    /**
+     * @brief 히스토리 내보내기/가져오기 (노드 간 라이브 매치 이전)
+     *
+     * 체크포인트와 프레임별 입력을 함께 옮겨, 이전 직후 도착한 늦은 입력도 대상 노드에서
+     * 재시뮬레이션할 수 있게 합니다. ImportHistory는 GameSession::ImportState 다음에 호출하며,
+     * 형식이 깨졌으면 std::runtime_error를 던지고 히스토리는 그대로 둡니다.
+     */
+    std::vector<std::uint8_t> ExportHistory() const;
+    void ImportHistory(const std::vector<std::uint8_t>& data);
+
+    /**
+     * @brief 세션 상태와 히스토리를 함께 복원 (둘 다 검증된 뒤에만 적용)
+     * @param history_data 비어 있으면 히스토리를 새로 시작
+     */
+    void ImportMatch(const std::vector<std::uint8_t>& session_state,
+                     const std::vector<std::uint8_t>& history_data);
+
+    /**
+     * @brief 통계
+     */
+    struct Stats {
+        std::uint64_t inputs_applied{0};
+        std::uint64_t late_inputs_accepted{0};
+        std::uint64_t late_inputs_dropped{0};
+        std::uint64_t duplicate_inputs{0};
+        std::uint64_t rollbacks{0};
+        std::uint64_t resimulated_ticks{0};
+        std::uint64_t rollbacks_over_budget{0};
+        double last_rollback_seconds{0.0};
+    };
+    Stats GetStats() const;
+
+    std::string MetricsSnapshot() const;
+
+    std::size_t HistoryTicks() const noexcept { return frames_.size(); }
+
+   private:
+    struct LoggedInput {
+        std::string player_id;
+        MovementInput input;
+        double delta_seconds{0.0};
+    };
+
+    // 한 틱 분량의 기록: 틱 시작 시점 체크포인트 + 그 틱에 적용된 입력
+    struct Frame {
+        std::uint64_t index{0};
+        std::uint64_t loop_tick{0};
+        double delta_seconds{0.0};
+        GameSession::Checkpoint start_state;
+        std::vector<LoggedInput> inputs;
+    };
+
+    struct DecodedHistory {
+        std::uint64_t current_frame{0};
+        double avg_tick_seconds{0.0};
+        std::vector<Frame> frames;
+    };
+
+    static DecodedHistory DecodeHistory(const std::vector<std::uint8_t>& data);
+    void CommitHistoryLocked(DecodedHistory history);
+
+    Frame& FrameAt(std::uint64_t index) { return frames_[index % frames_.size()]; }
+    std::uint64_t OldestFrameLocked() const;
+    void BeginFrameLocked();
+    void ResetHistoryLocked();
+    void ResimulateLocked();
+    static void InsertOrdered(std::vector<LoggedInput>& inputs, LoggedInput logged);
+
+    GameSession& session_;
+    RollbackConfig config_;
+
+    mutable std::mutex mutex_;
+    std::vector<Frame> frames_;
+    std::uint64_t current_frame_{0};  // 입력을 수집 중인 프레임 번호
+    std::uint64_t history_floor_{0};  // 이 프레임 이전으로는 롤백 불가
+    std::uint64_t dirty_frame_{0};    // 재시뮬레이션 시작 프레임
+    bool rollback_pending_{false};
+    double avg_tick_seconds_{0.0};  // 틱 1회 비용 (EWMA), 예산 판정용
+    Stats stats_;
+};
+
+}  // namespace pvpserver::netcode
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace pvpserver {
+
+/**
+ * @brief 버전 태그가 붙은 직렬화 응답 캐시
+ *
+ * 원본 데이터의 버전(예: PlayerProfileService::Version)이 바뀌면 항목이 무효가 되지만,
+ * 마지막 생성 후 max_staleness가 지나기 전까지는 이전 바이트를 계속 내보냅니다.
+ * 반환되는 버퍼는 불변이므로 여러 연결이 동시에 같은 버퍼를 전송해도 안전합니다.
+ */
+class HttpResponseCache {
+   public:
+    using Body = std::shared_ptr<const std::string>;
+    // nullopt를 반환하면 캐시하지 않음 (예: 없는 프로필)
+    using Builder = std::function<std::optional<std::string>()>;
+
+    explicit HttpResponseCache(std::string name, std::size_t max_entries = 4096);
+
+    /**
+     * @brief 캐시된 바이트 반환, 없거나 오래됐으면 builder로 다시 생성
+     * @return builder가 nullopt를 반환하면 nullptr
+     */
+    Body GetOrBuild(const std::string& key, std::uint64_t version,
+                    std::chrono::milliseconds max_staleness, const Builder& builder);
+
+    void Clear();
+    std::size_t Size() const;
+    std::string MetricsSnapshot() const;
+
+   private:
+    struct Entry {
+        Body body;
+        std::uint64_t version{0};
+        std::chrono::steady_clock::time_point built_at;
+    };
+
+    void EvictUnsafe(std::uint64_t current_version);
+
+    const std::string name_;
+    const std::size_t max_entries_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::uint64_t hits_total_{0};
+    std::uint64_t stale_hits_total_{0};
+    std::uint64_t misses_total_{0};
+    std::uint64_t builds_total_{0};
+    std::uint64_t evictions_total_{0};
+};
+
+}  // namespace pvpserver
@@ -4,19 +4,32 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/http.hpp>
+#include <chrono>
 #include <functional>
 #include <memory>
 
+#include "pvpserver/network/shared_string_body.h"
+
 namespace pvpserver {
 
 class MetricsHttpServer : public std::enable_shared_from_this<MetricsHttpServer> {
    public:
+    using Request = boost::beast::http::request<boost::beast::http::string_body>;
+    // 본문은 공유 불변 버퍼 (캐시된 바이트를 복사 없이 전송)
+    using Response = boost::beast::http::response<SharedStringBody>;
+
     using RequestHandler =
         std::function<boost::beast::http::response<boost::beast::http::string_body>(
-            const boost::beast::http::request<boost::beast::http::string_body>&)>;
+            const Request&)>;
+    using SharedRequestHandler = std::function<Response(const Request&)>;
+
+    // 요청이 없을 때 keep-alive 연결을 유지하는 시간
+    static constexpr std::chrono::seconds kIdleTimeout{30};
 
     MetricsHttpServer(boost::asio::io_context& io_context, std::uint16_t port,
                       RequestHandler handler);
+    MetricsHttpServer(boost::asio::io_context& io_context, std::uint16_t port,
+                      SharedRequestHandler handler);
     ~MetricsHttpServer();
 
     void Start();
@@ -32,7 +45,7 @@ class MetricsHttpServer : public std::enable_shared_from_this<MetricsHttpServer>
     boost::asio::io_context& io_context_;
     boost::asio::ip::tcp::acceptor acceptor_;
     std::atomic<bool> running_{false};
-    RequestHandler handler_;
+    SharedRequestHandler handler_;
 };
 
 }  // namespace pvpserver
@@ -16,6 +16,7 @@ enum class PacketType : std::uint8_t {
     DISCONNECT = 0x03,
     HEARTBEAT = 0x04,
     HEARTBEAT_ACK = 0x05,
+    REDIRECT = 0x06,  // 매치가 다른 노드로 이전됨 → 새 주소로 재접속
 
     // 게임 입력 (클라이언트 → 서버)
     INPUT = 0x10,
@@ -72,6 +73,21 @@ struct ConnectAckPacket {
     static ConnectAckPacket Deserialize(const std::vector<std::uint8_t>& payload);
 };
 
+/**
+ * @brief 재접속 지시 패킷 (라이브 매치 이전)
+ *
+ * 클라이언트는 같은 player_id로 host:port에 CONNECT를 보내면 됩니다.
+ * 이전 노드는 이후 도착하는 패킷에도 같은 REDIRECT로 답하므로 유실돼도 다시 받습니다.
+ */
+struct RedirectPacket {
+    std::string host;
+    std::uint16_t port;
+    std::uint32_t server_tick;  // 이전 시점의 틱
+
+    std::vector<std::uint8_t> Serialize() const;
+    static RedirectPacket Deserialize(const std::vector<std::uint8_t>& payload);
+};
+
 /**
  * @brief 입력 커맨드
  */
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <boost/beast/http.hpp>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
 
+#include "pvpserver/network/http_response_cache.h"
+#include "pvpserver/network/shared_string_body.h"
 #include "pvpserver/stats/player_profile_service.h"
 
 namespace pvpserver {
@@ -12,27 +15,47 @@ namespace pvpserver {
 class ProfileHttpRouter {
    public:
     using MetricsProvider = std::function<std::string()>;
+    using Request = boost::beast::http::request<boost::beast::http::string_body>;
+    using SharedResponse = boost::beast::http::response<SharedStringBody>;
+
+    struct Options {
+        bool cache_enabled = true;
+        // 리더보드는 RecordMatch로 무효화돼도 이 간격보다 자주 다시 만들지 않음
+        std::chrono::milliseconds leaderboard_refresh{250};
+        std::size_t max_cached_profiles = 4096;
+    };
 
     ProfileHttpRouter(MetricsProvider metrics_provider,
                       std::shared_ptr<PlayerProfileService> profile_service);
+    ProfileHttpRouter(MetricsProvider metrics_provider,
+                      std::shared_ptr<PlayerProfileService> profile_service, Options options);
+
+    // 캐시된 바이트를 그대로 공유하는 응답 (MetricsHttpServer::SharedRequestHandler용)
+    SharedResponse HandleShared(const Request& request) const;
 
+    // string_body 응답 (본문을 한 번 복사)
     boost::beast::http::response<boost::beast::http::string_body> Handle(
-        const boost::beast::http::request<boost::beast::http::string_body>& request) const;
+        const Request& request) const;
+
+    std::string MetricsSnapshot() const;
 
    private:
-    boost::beast::http::response<boost::beast::http::string_body> HandleMetrics(
-        const boost::beast::http::request<boost::beast::http::string_body>& request) const;
-    boost::beast::http::response<boost::beast::http::string_body> HandleProfile(
-        const boost::beast::http::request<boost::beast::http::string_body>& request,
-        const std::string& player_id) const;
-    boost::beast::http::response<boost::beast::http::string_body> HandleLeaderboard(
-        const boost::beast::http::request<boost::beast::http::string_body>& request,
-        std::size_t limit) const;
+    SharedResponse HandleMetrics(const Request& request) const;
+    SharedResponse HandleProfile(const Request& request, const std::string& player_id) const;
+    SharedResponse HandleLeaderboard(const Request& request, std::size_t limit,
+                                     std::size_t offset) const;
+
+    static SharedResponse MakeResponse(const Request& request, boost::beast::http::status status,
+                                       const char* content_type, HttpResponseCache::Body body);
 
     static std::size_t ParseLimit(const std::string& query);
+    static std::size_t ParseOffset(const std::string& query);
 
     MetricsProvider metrics_provider_;
     std::shared_ptr<PlayerProfileService> profile_service_;
+    Options options_;
+    mutable HttpResponseCache leaderboard_cache_;
+    mutable HttpResponseCache profile_cache_;
 };
 
 }  // namespace pvpserver
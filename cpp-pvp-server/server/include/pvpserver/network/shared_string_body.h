@@ -0,0 +1,49 @@
+#pragma once
+
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/error.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace pvpserver {
+
+/**
+ * @brief 불변 문자열을 공유하는 Beast HTTP Body
+ *
+ * 캐시된 응답 바이트를 연결마다 복사하지 않고 shared_ptr 참조만 늘려 그대로 전송합니다.
+ * 직렬화(쓰기) 전용이며 요청 파싱에는 사용하지 않습니다.
+ */
+struct SharedStringBody {
+    using value_type = std::shared_ptr<const std::string>;
+
+    static std::uint64_t size(const value_type& body) noexcept { return body ? body->size() : 0; }
+
+    class writer {
+       public:
+        using const_buffers_type = boost::asio::const_buffer;
+
+        template <bool isRequest, class Fields>
+        writer(const boost::beast::http::header<isRequest, Fields>& /*header*/,
+               const value_type& body)
+            : body_(body) {}
+
+        void init(boost::beast::error_code& ec) { ec = {}; }
+
+        boost::optional<std::pair<const_buffers_type, bool>> get(boost::beast::error_code& ec) {
+            ec = {};
+            if (!body_ || body_->empty()) {
+                return boost::none;
+            }
+            return std::make_pair(const_buffers_type(body_->data(), body_->size()), false);
+        }
+
+       private:
+        const value_type& body_;
+    };
+};
+
+}  // namespace pvpserver
@@ -8,9 +8,11 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "pvpserver/core/game_loop.h"
 #include "pvpserver/game/game_session.h"
+#include "pvpserver/netcode/rollback_engine.h"
 #include "pvpserver/network/packet_types.h"
 #include "pvpserver/network/udp_socket.h"
 #include "pvpserver/stats/match_stats.h"
@@ -92,7 +94,43 @@ class UdpGameServer : public std::enable_shared_from_this<UdpGameServer> {
      */
     void SetMatchCompletedCallback(MatchCompletedCallback callback);
 
+    /**
+     * @brief 서버 측 롤백 활성화 (Start 이전에 호출)
+     *
+     * 활성화하면 늦게 도착한 입력을 버리지 않고 과거 틱으로 되돌려 재시뮬레이션하며,
+     * 틱 진행(GameSession::Tick)도 롤백 엔진이 담당합니다.
+     */
+    void EnableRollback(netcode::RollbackConfig config = {});
+
+    /**
+     * @brief 라이브 매치 이전 - 원본 노드
+     *
+     * FreezeForMigration: 틱 진행/브로드캐스트를 멈추고 세션, 롤백 히스토리, 클라이언트 목록을 내보냄
+     * CompleteMigration: 클라이언트에게 REDIRECT 전송. 이후 도착하는 패킷에도 REDIRECT로 응답
+     * ResumeAfterMigrationFailure: 전송 실패 시 멈췄던 매치를 그대로 재개
+     *
+     * 멈춘 동안 새 CONNECT는 응답 없이 거절하고(클라이언트가 재시도), DISCONNECT는 보류했다가
+     * 재개 시 적용합니다. 이전에 성공하면 보류된 퇴장은 대상 노드의 재접속 유예 만료로 정리됩니다.
+     */
+    std::vector<std::uint8_t> FreezeForMigration();
+    void CompleteMigration(const std::string& host, std::uint16_t port);
+    void ResumeAfterMigrationFailure();
+
+    /**
+     * @brief 라이브 매치 이전 - 대상 노드
+     *
+     * FreezeForMigration의 결과로 세션과 클라이언트 목록을 복원합니다 (롤백은 먼저 활성화).
+     * 클라이언트는 REDIRECT를 받은 뒤 같은 player_id로 CONNECT하면 기존 플레이어로 이어집니다.
+     * 세션과 롤백 히스토리를 모두 검증한 뒤에만 적용하며, 형식이 깨졌으면 std::runtime_error
+     * (기존 상태는 그대로). 유예 시간 안에 재접속하지 않은 플레이어는 퇴장 처리됩니다.
+     */
+    void ImportMigratedMatch(const std::vector<std::uint8_t>& data);
+    void SetMigrationReconnectGrace(std::chrono::milliseconds grace);
+
    private:
+    // 이전 진행 상태 (NONE → FROZEN → REDIRECTED, 실패 시 FROZEN → NONE)
+    enum class MigrationPhase : std::uint8_t { NONE, FROZEN, REDIRECTED };
+
     // 클라이언트 정보
     struct ClientInfo {
         std::string player_id;
@@ -100,6 +138,7 @@ class UdpGameServer : public std::enable_shared_from_this<UdpGameServer> {
         std::uint32_t last_input_sequence{0};
         std::uint64_t last_heartbeat{0};
         std::uint64_t connect_time{0};
+        std::uint64_t reconnect_deadline{0};  // 이전된 매치에서 재접속 대기 중이면 만료 시각 (ms)
         std::uint32_t rtt_ms{0};
     };
 
@@ -113,6 +152,8 @@ class UdpGameServer : public std::enable_shared_from_this<UdpGameServer> {
     void HandleDisconnect(const Endpoint& sender);
     void HandleHeartbeat(const Endpoint& sender, std::uint16_t sequence);
     void HandleInput(const Endpoint& sender, const std::vector<std::uint8_t>& payload);
+    void SendRedirect(const Endpoint& target);
+    void ExpireMigratedClients();  // tick_mutex_ 보유 상태에서 호출
 
     // 상태 브로드캐스트
     void BroadcastState(std::uint64_t tick, double delta_seconds);
@@ -159,6 +200,20 @@ class UdpGameServer : public std::enable_shared_from_this<UdpGameServer> {
     std::atomic<std::uint16_t> server_sequence_{0};
     std::atomic<std::uint32_t> current_tick_{0};
 
+    // 서버 측 롤백 (선택)
+    std::unique_ptr<netcode::RollbackEngine> rollback_;
+
+    // 라이브 매치 이전: tick_mutex_는 진행 중인 틱이 끝난 뒤에 멈추기 위함
+    std::mutex tick_mutex_;
+    std::atomic<MigrationPhase> migration_phase_{MigrationPhase::NONE};
+    std::vector<std::uint8_t> redirect_payload_;  // REDIRECTED 이후 불변
+    // 매치 틱 = 게임 루프 틱 + tick_offset_ (이전된 매치가 원본 틱에서 이어지도록, tick_mutex_ 보호)
+    std::int64_t tick_offset_{0};
+    std::uint64_t next_loop_tick_{0};  // 다음에 올 게임 루프 틱
+    std::vector<Endpoint> deferred_leaves_;  // FROZEN 동안 받은 DISCONNECT (clients_mutex_ 보호)
+    std::atomic<std::size_t> awaiting_reconnect_{0};
+    std::chrono::milliseconds reconnect_grace_{10000};
+
     // 스냅샷 관리 (v1.4.0-p3에서 구현)
     std::shared_ptr<SnapshotManager> snapshot_manager_;
 
@@ -2,12 +2,10 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
-#include <memory>
 #include <optional>
-#include <set>
+#include <random>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -18,32 +16,88 @@ class LeaderboardStore {
     virtual ~LeaderboardStore() = default;
 
     virtual void Upsert(const std::string& player_id, int score) = 0;
+    // 여러 점수를 한 번에 반영 (같은 player_id가 여러 번이면 마지막 값). 기본: Upsert 반복
+    virtual void UpsertBatch(const std::vector<std::pair<std::string, int>>& entries);
     virtual void Erase(const std::string& player_id) = 0;
+    // 점수 내림차순 (동점이면 player_id 오름차순)
     virtual std::vector<std::pair<std::string, int>> TopN(std::size_t limit) const = 0;
+    // 0부터 시작하는 순위 (1위 = 0), 없으면 nullopt
+    virtual std::optional<std::size_t> Rank(const std::string& player_id) const = 0;
+    // 순위 offset부터 count명 (TopN(n) == Range(0, n))
+    virtual std::vector<std::pair<std::string, int>> Range(std::size_t offset,
+                                                           std::size_t count) const = 0;
     virtual std::optional<int> Get(const std::string& player_id) const = 0;
     virtual std::size_t Size() const = 0;
 };
 
+/**
+ * @brief 순위 통계 스킵 리스트 기반 리더보드 (Redis Sorted Set과 같은 구조)
+ *
+ * 각 레벨의 링크가 건너뛰는 노드 수(span)를 함께 저장하므로
+ * Upsert/Erase/Rank/Range 모두 기대 O(log N)입니다. 스레드 안전하지 않습니다.
+ */
 class InMemoryLeaderboardStore : public LeaderboardStore {
    public:
+    InMemoryLeaderboardStore();
+    ~InMemoryLeaderboardStore() override;
+
+    InMemoryLeaderboardStore(const InMemoryLeaderboardStore&) = delete;
+    InMemoryLeaderboardStore& operator=(const InMemoryLeaderboardStore&) = delete;
+
     void Upsert(const std::string& player_id, int score) override;
+    // 배치가 전체의 1/8 이상이면 노드를 재사용해 정렬 후 한 번에 다시 연결 (O(N log N))
+    void UpsertBatch(const std::vector<std::pair<std::string, int>>& entries) override;
     void Erase(const std::string& player_id) override;
     std::vector<std::pair<std::string, int>> TopN(std::size_t limit) const override;
+    std::optional<std::size_t> Rank(const std::string& player_id) const override;
+    std::vector<std::pair<std::string, int>> Range(std::size_t offset,
+                                                   std::size_t count) const override;
     std::optional<int> Get(const std::string& player_id) const override;
     std::size_t Size() const override;
 
    private:
-    void RemoveFromOrdered(const std::string& player_id, int score);
+    static constexpr int kMaxLevel = 32;
+
+    struct Node;
+    struct Level {
+        Node* forward;
+        std::size_t span;  // forward까지 건너뛰는 노드 수
+    };
+    // 레벨 배열은 노드 바로 뒤에 붙여 한 번에 할당 (노드당 할당 1회)
+    struct Node {
+        std::string player_id;
+        int score;
+        int level_count;
+        Level* levels() noexcept { return reinterpret_cast<Level*>(this + 1); }
+        const Level* levels() const noexcept { return reinterpret_cast<const Level*>(this + 1); }
+    };
+
+    static Node* CreateNode(int level_count, int score, const std::string& player_id);
+    static void DestroyNode(Node* node);
+    static bool Before(int score, const std::string& player_id, const Node* node) noexcept;
+    int RandomLevel();
+    Node* Insert(int score, const std::string& player_id);
+    void Unlink(const Node* target);
+    void Rebuild(std::vector<Node*>& nodes);  // 정렬된 노드로 링크/스팬 재구성
+    const Node* NodeAtRank(std::size_t rank) const;  // 1부터 시작
 
-    std::unordered_map<std::string, int> scores_;
-    std::map<int, std::set<std::string>, std::greater<int>> ordered_;
+    Node* header_;
+    int level_count_ = 1;
+    std::size_t length_ = 0;
+    std::mt19937 random_{0x5EED};
+    // key는 노드 안의 player_id를 가리킴 (문자열 중복 저장 없음)
+    std::unordered_map<std::string_view, Node*> index_;
 };
 
 class RedisLeaderboardStore : public LeaderboardStore {
    public:
     void Upsert(const std::string& player_id, int score) override;
+    void UpsertBatch(const std::vector<std::pair<std::string, int>>& entries) override;
     void Erase(const std::string& player_id) override;
     std::vector<std::pair<std::string, int>> TopN(std::size_t limit) const override;
+    std::optional<std::size_t> Rank(const std::string& player_id) const override;
+    std::vector<std::pair<std::string, int>> Range(std::size_t offset,
+                                                   std::size_t count) const override;
     std::optional<int> Get(const std::string& player_id) const override;
     std::size_t Size() const override;
 };
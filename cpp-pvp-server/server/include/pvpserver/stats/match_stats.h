@@ -40,20 +40,27 @@ class PlayerMatchStats {
 
 class MatchResult {
    public:
+    // 1:1 결과
     MatchResult(std::string match_id, std::string winner_id, std::string loser_id,
                 std::chrono::system_clock::time_point completed_at,
                 std::vector<PlayerMatchStats> player_stats);
+    // 팀전/개인전 결과: placements[0]이 1위 팀, 이후 순위 순 (동순위 없음)
+    MatchResult(std::string match_id, std::vector<std::vector<std::string>> placements,
+                std::chrono::system_clock::time_point completed_at,
+                std::vector<PlayerMatchStats> player_stats);
 
     const std::string& match_id() const noexcept { return match_id_; }
     const std::string& winner_id() const noexcept { return winner_id_; }
     const std::string& loser_id() const noexcept { return loser_id_; }
     std::chrono::system_clock::time_point completed_at() const noexcept { return completed_at_; }
     const std::vector<PlayerMatchStats>& player_stats() const noexcept { return player_stats_; }
+    const std::vector<std::vector<std::string>>& placements() const noexcept { return placements_; }
 
    private:
     std::string match_id_;
     std::string winner_id_;
     std::string loser_id_;
+    std::vector<std::vector<std::string>> placements_;
     std::chrono::system_clock::time_point completed_at_;
     std::vector<PlayerMatchStats> player_stats_;
 };
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +19,31 @@
 
 namespace pvpserver {
 
+/**
+ * @brief 레이팅 차이별 기대 승률 표 (std::pow 대신 배열 조회)
+ *
+ * 레이팅은 정수이므로 차이 d ∈ [-kMaxDifference, kMaxDifference]의 값을 미리 계산해 두면
+ * 결과는 pow로 계산한 것과 똑같습니다. 범위 밖은 끝 값으로 고정 (K=25 기준 반올림 결과 동일).
+ */
+class ExpectedScoreTable {
+   public:
+    static constexpr int kMaxDifference = 2000;
+
+    static const ExpectedScoreTable& Instance();
+
+    // rating이 opponent를 이길 기대 확률 = 1 / (1 + 10^((opponent - rating) / 400))
+    double Expected(int rating, int opponent) const noexcept {
+        const int difference =
+            std::clamp(opponent - rating, -kMaxDifference, kMaxDifference);
+        return table_[static_cast<std::size_t>(difference + kMaxDifference)];
+    }
+
+   private:
+    ExpectedScoreTable();
+
+    std::array<double, 2 * kMaxDifference + 1> table_;
+};
+
 struct EloRatingUpdate {
     int winner_new{0};
     int loser_new{0};
@@ -21,7 +51,17 @@ struct EloRatingUpdate {
 
 class EloRatingCalculator {
    public:
+    static constexpr double kFactor = 25.0;  // K 상수: 변동폭 결정
+
     EloRatingUpdate Update(int winner_rating, int loser_rating) const;
+
+    /**
+     * @brief 다자간 ELO 변화량 (순위 순 팀 평균 레이팅 → 팀별 변화량)
+     *
+     * 각 팀 쌍을 1:1 대결로 보고 K/(팀 수 - 1)로 나눠 합산합니다.
+     * 팀이 둘이면 Update()와 같은 변화량입니다.
+     */
+    std::vector<int> TeamDeltas(const std::vector<int>& ratings_by_placement) const;
 };
 
 struct PlayerProfile {
@@ -40,20 +80,67 @@ struct PlayerProfile {
     double Accuracy() const noexcept;
 };
 
+class RatingBatchEngine;
+struct RatingRecord;
+
+// ApplyRatingJob 결과
+struct RatingJobReport {
+    std::size_t profiles{0};  // 스냅샷에 포함된 프로필 수
+    std::size_t changed{0};   // 레이팅이 바뀐 프로필 수
+    std::size_t refreshed{0}; // 계산 중 매치를 치러 반영 시 다시 계산한 수
+    double compute_seconds{0.0};
+    double apply_seconds{0.0};        // 매치 기록이 멈춰 있던 시간
+    double leaderboard_seconds{0.0};  // 리더보드 일괄 반영 (순위 조회가 기다린 시간)
+};
+
+/**
+ * @brief 플레이어 누적 통계 + ELO 서비스
+ *
+ * 프로필은 player_id 해시로 kStripes개 스트라이프에 나뉘어 저장됩니다.
+ * - RecordMatch: 참가자들의 스트라이프 잠금을 항상 번호 오름차순으로 잡음 (교착 없음)
+ * - GetProfile: 쓰기 잠금을 잡지 않고 seqlock으로 읽음 (쓰기 중이면 재시도)
+ * - TopProfiles: 리더보드 잠금은 순위 조회 동안만, 프로필은 seqlock 읽기
+ */
 class PlayerProfileService {
    public:
+    static constexpr std::size_t kStripes = 32;
+
+    // 매치 반영 직후 결과 + 참가자 프로필 스냅샷 전달 (예: Postgres write-behind 대기열)
+    // 참가자 스트라이프 잠금 안에서 호출되므로 블로킹 없이 빨리 반환해야 함
+    using PersistenceSink =
+        std::function<void(const MatchResult& result, const std::vector<PlayerProfile>& profiles)>;
+
     explicit PlayerProfileService(std::shared_ptr<LeaderboardStore> leaderboard_store);
 
+    // RecordMatch가 동시에 호출되기 전에 설정
+    void SetPersistenceSink(PersistenceSink sink);
+
     void RecordMatch(const MatchResult& result);
 
     std::optional<PlayerProfile> GetProfile(const std::string& player_id) const;
-    std::vector<PlayerProfile> TopProfiles(std::size_t limit) const;
+    // offset: 0부터 시작하는 순위 (offset=10000 → 10,001위부터)
+    std::vector<PlayerProfile> TopProfiles(std::size_t limit, std::size_t offset = 0) const;
+
+    /**
+     * @brief 전체 프로필 레이팅 일괄 변경 (시즌 초기화, 비활성 감쇠 등)
+     *
+     * 1. 스냅샷 (잠금 없이 seqlock 읽기)
+     * 2. engine 스레드 풀로 transform 계산 (매치 기록은 계속 진행)
+     * 3. 모든 스트라이프 잠금 안에서 프로필 반영 (그사이 매치를 치른 플레이어는 다시 계산)
+     * 4. 리더보드 잠금 안에서 UpsertBatch 한 번
+     * 리더보드 독자는 반영 전/후 중 하나만 봅니다. write-behind 싱크로는 전달하지 않습니다.
+     */
+    RatingJobReport ApplyRatingJob(RatingBatchEngine& engine,
+                                   const std::function<int(const RatingRecord&)>& transform);
 
     std::string SerializeProfile(const PlayerProfile& profile) const;
     std::string SerializeLeaderboard(const std::vector<PlayerProfile>& profiles) const;
 
     std::string MetricsSnapshot() const;
 
+    // RecordMatch마다 1씩 증가 (HTTP 응답 캐시 무효화용)
+    std::uint64_t Version() const noexcept { return version_.load(std::memory_order_acquire); }
+
    private:
     struct AggregateStats {
         std::uint64_t matches{0};
@@ -65,19 +152,62 @@ class PlayerProfileService {
         std::uint64_t hits_landed{0};
         std::uint64_t damage_dealt{0};
         std::uint64_t damage_taken{0};
+        std::int64_t last_match_ms{0};  // 마지막 매치 완료 시각 (비활성 감쇠 기준)
         int rating{1200};
     };
 
+    // seqlock으로 보호되는 프로필 한 명분 (생성 후 주소 고정, 삭제 없음)
+    class ProfileSlot {
+       public:
+        AggregateStats Read() const noexcept;
+        void Write(const AggregateStats& stats) noexcept;  // 스트라이프 쓰기 잠금 필요
+
+       private:
+        static constexpr std::size_t kWords = 11;
+        std::atomic<std::uint64_t> sequence_{0};  // 홀수 = 쓰는 중
+        std::array<std::atomic<std::uint64_t>, kWords> words_{};
+    };
+
+    struct alignas(64) Stripe {
+        std::mutex write_mutex;                 // 이 스트라이프 프로필을 바꾸는 RecordMatch 직렬화
+        mutable std::shared_mutex index_mutex;  // slots 구조 (새 플레이어 추가 시에만 배타)
+        std::unordered_map<std::string, std::unique_ptr<ProfileSlot>> slots;
+    };
+
+    // 이번 매치 참가자 작업본 (매치당 수~수십 명이라 선형 탐색이 해시보다 쌈)
+    struct WorkingEntry {
+        const std::string* player_id;
+        ProfileSlot* slot;  // 첫 매치면 nullptr (반영 시 생성)
+        AggregateStats stats;
+    };
+    using WorkingSet = std::vector<WorkingEntry>;
+
+    static std::size_t StripeIndex(const std::string& player_id) noexcept;
+    std::vector<std::unique_lock<std::mutex>> LockStripes(
+        const std::vector<const std::string*>& player_ids);
+    std::vector<std::unique_lock<std::mutex>> LockAllStripes();
+    ProfileSlot* FindSlot(const std::string& player_id) const;
+    ProfileSlot& CreateSlot(const std::string& player_id);
+
+    AggregateStats& Working(WorkingSet& working, const std::string& player_id) const;
+    void RecordTeamResultUnsafe(const MatchResult& result, WorkingSet& working,
+                                std::vector<const std::string*>& rated);
     PlayerProfile BuildProfileUnsafe(const std::string& player_id,
                                      const AggregateStats& stats) const;
 
     std::shared_ptr<LeaderboardStore> leaderboard_;
     EloRatingCalculator calculator_;
-
-    mutable std::mutex mutex_;
-    std::unordered_map<std::string, AggregateStats> aggregates_;
-    std::uint64_t matches_recorded_total_{0};
-    std::uint64_t rating_updates_total_{0};
+    PersistenceSink persistence_sink_;
+
+    std::array<Stripe, kStripes> stripes_;
+    mutable std::mutex leaderboard_mutex_;  // LeaderboardStore는 스레드 안전하지 않음
+    std::atomic<std::size_t> profiles_total_{0};
+    std::atomic<std::uint64_t> matches_recorded_total_{0};
+    std::atomic<std::uint64_t> rating_updates_total_{0};
+    std::atomic<std::uint64_t> version_{0};
+    std::atomic<std::uint64_t> rating_jobs_total_{0};
+    std::atomic<std::uint64_t> rating_job_profiles_total_{0};
+    std::atomic<double> rating_job_last_apply_seconds_{0.0};
 };
 
 }  // namespace pvpserver
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/stats/player_profile_service.h"
+
+namespace pvpserver {
+
+// 일괄 작업 입력 한 명분 (PlayerProfileService 스냅샷)
+struct RatingRecord {
+    int rating{1200};
+    std::uint64_t matches{0};
+    std::int64_t last_match_ms{0};  // 0 = 기록 없음
+};
+
+// 새 레이팅 계산 (스레드 여러 개가 동시에 호출 → 상태 없이)
+using RatingTransform = std::function<int(const RatingRecord& record)>;
+
+/**
+ * @brief 비활성 감쇠: 한 번 실행 = 한 주기
+ *
+ * 마지막 매치 후 grace가 지난 플레이어만 points_per_run 감소, floor 아래로는 내리지 않습니다.
+ */
+struct RatingDecayPolicy {
+    std::chrono::hours grace{24 * 14};
+    int points_per_run{15};
+    int floor{1200};
+
+    int Apply(const RatingRecord& record, std::int64_t now_ms) const noexcept;
+};
+
+// 시즌 초기화: anchor 쪽으로 (rating - anchor) * (1 - keep_fraction)만큼 당김
+struct SeasonResetPolicy {
+    int anchor{1200};
+    double keep_fraction{0.5};
+
+    int Apply(const RatingRecord& record) const noexcept;
+};
+
+// 재계산용 1:1 결과 (ratings 배열 인덱스)
+struct DuelOutcome {
+    std::uint32_t winner;
+    std::uint32_t loser;
+};
+
+/**
+ * @brief 레이팅 일괄 계산 엔진 (고정 스레드 풀)
+ *
+ * 작업은 호출 스레드도 함께 처리합니다. 한 번에 작업 하나만 실행합니다 (내부 직렬화).
+ */
+class RatingBatchEngine {
+   public:
+    // threads: 호출 스레드 포함 병렬도 (0 = 하드웨어 스레드 수)
+    explicit RatingBatchEngine(std::size_t threads = 0);
+    ~RatingBatchEngine();
+
+    RatingBatchEngine(const RatingBatchEngine&) = delete;
+    RatingBatchEngine& operator=(const RatingBatchEngine&) = delete;
+
+    std::size_t Threads() const noexcept { return workers_.size() + 1; }
+
+    // [0, count)를 청크로 나눠 body(begin, end)를 병렬 실행 (모두 끝나야 반환)
+    void ParallelFor(std::size_t count,
+                     const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+    std::vector<int> Transform(const std::vector<RatingRecord>& records,
+                               const RatingTransform& transform);
+
+    /**
+     * @brief 1:1 결과를 순서대로 다시 적용 (EloRatingCalculator::Update와 같은 결과)
+     *
+     * 각 매치를 "두 참가자의 이전 매치가 모두 끝난 다음 라운드"에 배치하면
+     * 같은 라운드 안의 매치는 서로 다른 플레이어만 건드리므로 병렬로 처리할 수 있습니다.
+     * @return 라운드 수
+     */
+    std::size_t ReplayDuels(std::vector<int>& ratings, const std::vector<DuelOutcome>& duels);
+
+   private:
+    static constexpr std::size_t kChunk = 4096;
+
+    void WorkerLoop();
+    void RunChunks();
+
+    std::mutex run_mutex_;  // 작업 하나씩
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(std::size_t, std::size_t)>* body_{nullptr};
+    std::size_t count_{0};
+    std::size_t next_{0};           // 다음 청크 시작 (mutex_ 보호)
+    std::uint64_t generation_{0};
+    std::size_t workers_done_{0};
+    bool stopping_{false};
+    std::vector<std::thread> workers_;
+    EloRatingCalculator calculator_;
+};
+
+}  // namespace pvpserver
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "session_store.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace pvpserver {
+namespace storage {
+
+/**
+ * 노드 간 무효화 채널
+ * 메시지는 불투명한 문자열 (CachedSessionStore가 만들고 해석).
+ * 전달 보장이 없어도 됩니다: 놓친 무효화는 near-cache TTL이 지나면 사라집니다.
+ */
+class SessionInvalidationBus {
+public:
+    using Handler = std::function<void(const std::string& message)>;
+
+    virtual ~SessionInvalidationBus() = default;
+
+    virtual void Publish(const std::string& message) = 0;
+    // 자기 자신이 발행한 메시지도 올 수 있음 (받는 쪽에서 걸러냄)
+    virtual void Subscribe(Handler handler) = 0;
+};
+
+/**
+ * Near-cache 설정
+ * capacity는 세션/플레이어 캐시 각각의 최대 엔트리 수 (샤드마다 capacity / shards).
+ */
+struct NearCacheOptions {
+    std::size_t capacity = 10000;
+    std::chrono::milliseconds ttl{2000};  // 다른 노드의 변경이 보이기까지 최대 지연
+    std::size_t shards = 16;
+};
+
+struct NearCacheStats {
+    std::uint64_t session_hits{0};
+    std::uint64_t session_misses{0};
+    std::uint64_t player_hits{0};
+    std::uint64_t player_misses{0};
+    std::uint64_t evictions{0};
+    std::uint64_t expirations{0};
+    std::uint64_t local_invalidations{0};
+    std::uint64_t remote_invalidations{0};
+    std::size_t entries{0};
+
+    double SessionHitRatio() const noexcept;
+    double PlayerHitRatio() const noexcept;
+};
+
+/**
+ * 세션 저장소 앞에 두는 프로세스 내 near-cache (데코레이터)
+ *
+ * - GetSession / GetSessionByPlayerId / SessionExists를 샤드별 LRU + TTL로 캐시
+ * - Save/Delete는 백엔드에 먼저 쓰고 해당 엔트리를 무효화 (버스가 있으면 다른 노드에도 알림)
+ * - Refresh는 무효화하지 않음: 캐시된 last_activity는 최대 ttl만큼 오래될 수 있음
+ * - 목록/개수 조회는 백엔드로 그대로 전달
+ */
+class CachedSessionStore : public SessionStore {
+public:
+    CachedSessionStore(std::shared_ptr<SessionStore> backend, NearCacheOptions options = {},
+                       std::shared_ptr<SessionInvalidationBus> bus = nullptr);
+    ~CachedSessionStore() override;
+
+    // SessionStore 인터페이스 구현
+    bool SaveSession(const std::string& session_id,
+                    const SessionData& data) override;
+
+    std::optional<SessionData> GetSession(
+        const std::string& session_id) override;
+
+    bool DeleteSession(const std::string& session_id) override;
+
+    bool RefreshSession(const std::string& session_id) override;
+
+    std::vector<std::string> GetAllSessionIds() override;
+
+    std::optional<std::string> GetSessionByPlayerId(
+        const std::string& player_id) override;
+
+    size_t GetActiveSessionCount() override;
+
+    bool SessionExists(const std::string& session_id) override;
+
+    // 로컬 엔트리만 제거 (백엔드/다른 노드에는 영향 없음)
+    void InvalidateSession(const std::string& session_id);
+    void InvalidatePlayer(const std::string& player_id);
+    void Clear();
+
+    NearCacheStats Stats() const;
+    std::string MetricsSnapshot() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // 샤드 하나: LRU 리스트(앞이 최근) + 키 → 리스트 위치
+    // epoch는 무효화마다 증가 → 백엔드 조회 중 무효화가 끼면 그 결과는 넣지 않음
+    template <typename V>
+    struct Shard {
+        struct Entry {
+            std::string key;
+            V value;
+            Clock::time_point expires;
+        };
+
+        std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> index;
+        std::uint64_t epoch{0};
+    };
+
+    template <typename V>
+    using ShardSet = std::vector<std::unique_ptr<Shard<V>>>;
+
+    template <typename V>
+    Shard<V>& ShardFor(ShardSet<V>& shards, const std::string& key);
+    template <typename V>
+    std::optional<V> Lookup(ShardSet<V>& shards, const std::string& key);
+    template <typename V>
+    std::uint64_t Epoch(ShardSet<V>& shards, const std::string& key);
+    template <typename V>
+    void Insert(ShardSet<V>& shards, const std::string& key, V value, std::uint64_t epoch);
+    template <typename V>
+    std::optional<V> Erase(ShardSet<V>& shards, const std::string& key);
+
+    // 로컬 무효화 + 버스 발행 ('s' = 세션, 'p' = 플레이어)
+    void InvalidateAndPublish(const std::string& session_id, const std::string& player_id);
+    void OnRemoteMessage(const std::string& message);
+
+    std::shared_ptr<SessionStore> backend_;
+    NearCacheOptions options_;
+    std::size_t shard_capacity_;
+    std::shared_ptr<SessionInvalidationBus> bus_;
+    std::string node_tag_;  // 자기 메시지 식별용
+
+    ShardSet<SessionData> sessions_;
+    ShardSet<std::string> players_;  // player_id → session_id
+
+    std::atomic<std::uint64_t> session_hits_{0};
+    std::atomic<std::uint64_t> session_misses_{0};
+    std::atomic<std::uint64_t> player_hits_{0};
+    std::atomic<std::uint64_t> player_misses_{0};
+    std::atomic<std::uint64_t> evictions_{0};
+    std::atomic<std::uint64_t> expirations_{0};
+    std::atomic<std::uint64_t> local_invalidations_{0};
+    std::atomic<std::uint64_t> remote_invalidations_{0};
+
+    // 버스 핸들러는 소멸 뒤에도 불릴 수 있음 → 소멸자가 owner를 비워 끊음
+    struct BusLink {
+        std::mutex mutex;
+        CachedSessionStore* owner{nullptr};
+    };
+    std::shared_ptr<BusLink> bus_link_;
+};
+
+}  // namespace storage
+}  // namespace pvpserver
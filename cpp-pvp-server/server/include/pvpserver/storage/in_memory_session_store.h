@@ -1,9 +1,14 @@
 #pragma once
 
 #include "session_store.h"
+#include "timer_wheel.h"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -13,9 +18,14 @@ namespace storage {
 /**
  * 인메모리 세션 저장소
  * 개발 및 테스트용 구현체입니다.
+ *
+ * 세션 ID 해시로 나눈 샤드마다 잠금/맵/타이밍 휠을 따로 둡니다.
+ * 조회는 공유 잠금 하나, 만료 정리는 만료된 세션 수에 비례합니다 (전체 스캔 없음).
  */
 class InMemorySessionStore : public SessionStore {
 public:
+    static constexpr std::size_t kShards = 32;
+
     /**
      * 생성자
      * @param ttl_seconds 세션 TTL (기본 1시간)
@@ -23,6 +33,13 @@ public:
      */
     explicit InMemorySessionStore(int ttl_seconds = 3600,
                                   int cleanup_interval_seconds = 60);
+
+    /**
+     * @param tick 타이밍 휠 해상도 (만료 정리가 최대 이만큼 늦을 수 있음)
+     */
+    InMemorySessionStore(std::chrono::milliseconds ttl,
+                         std::chrono::milliseconds cleanup_interval,
+                         std::chrono::milliseconds tick = std::chrono::seconds(1));
     ~InMemorySessionStore() override;
 
     // SessionStore 인터페이스 구현
@@ -41,6 +58,7 @@ public:
     std::optional<std::string> GetSessionByPlayerId(
         const std::string& player_id) override;
 
+    // 정리 후 샤드별 크기 합 (틱 하나 안쪽으로 막 만료된 세션은 포함될 수 있음)
     size_t GetActiveSessionCount() override;
 
     bool SessionExists(const std::string& session_id) override;
@@ -50,23 +68,45 @@ public:
     void StopCleanup();
 
 private:
-    struct SessionEntry {
+    // 휠 노드를 품은 엔트리: 재등록/해제에 할당이 없음
+    struct SessionEntry : TimerWheel::Node {
         SessionData data;
-        int64_t expiry_time;  // epoch ms
+        int64_t expiry_time;                      // epoch ms
+        const std::string* session_id{nullptr};  // 맵 키 (노드 주소는 안정적)
     };
 
-    int ttl_seconds_;
-    int cleanup_interval_seconds_;
+    struct alignas(64) Shard {
+        explicit Shard(std::uint64_t start_tick) : wheel(start_tick) {}
+
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, SessionEntry> sessions;
+        // player_id -> session_id (player_id 해시 기준 샤드에 보관)
+        std::unordered_map<std::string, std::string> players;
+        TimerWheel wheel;
+    };
+
+    Shard& ShardFor(const std::string& key) const;
+    std::uint64_t TickFor(int64_t expiry_ms) const;
+    void SetPlayerMapping(const std::string& player_id, const std::string& session_id);
+    // 아직 session_id를 가리킬 때만 제거 (그사이 새 세션으로 바뀌었으면 유지)
+    void RemovePlayerMapping(const std::string& player_id, const std::string& session_id);
+    // 샤드 잠금 안에서 호출: 엔트리 제거 후 지울 player 매핑을 돌려줌
+    std::pair<std::string, std::string> EraseLocked(
+        Shard& shard, std::unordered_map<std::string, SessionEntry>::iterator it);
+
+    int64_t ttl_ms_;
+    std::chrono::milliseconds cleanup_interval_;
+    int64_t tick_ms_;
 
-    mutable std::mutex mutex_;
-    std::unordered_map<std::string, SessionEntry> sessions_;
-    std::unordered_map<std::string, std::string> player_to_session_;  // player_id -> session_id
+    std::vector<std::unique_ptr<Shard>> shards_;
 
     std::atomic<bool> running_{true};
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
     std::thread cleanup_thread_;
 
     void CleanupLoop();
-    bool IsExpired(const SessionEntry& entry) const;
+    bool IsExpired(const SessionEntry& entry, int64_t now) const;
 };
 
 }  // namespace storage
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <libpq-fe.h>
+
+#include <array>
+#include <atomic>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pvpserver {
+
+/**
+ * @brief 쿼리 종류별 지연 시간 히스토그램 (Prometheus histogram)
+ *
+ * 대기열 대기 + 실행까지, 호출자가 체감하는 전체 시간을 기록합니다.
+ */
+class QueryLatencyHistogram {
+   public:
+    static constexpr std::array<double, 12> kBuckets{
+        {0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5}};
+
+    void Observe(const std::string& query, double seconds, bool ok);
+    std::string Snapshot(const std::string& metric_name) const;
+
+   private:
+    struct Series {
+        std::array<std::uint64_t, kBuckets.size()> buckets{};
+        std::uint64_t overflow{0};
+        std::uint64_t count{0};
+        std::uint64_t errors{0};
+        double sum{0.0};
+    };
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Series> series_;
+};
+
+struct PostgresPoolOptions {
+    std::size_t connections = 4;
+    bool pipeline = true;                    // libpq 14+ 파이프라인 모드 (없으면 무시)
+    std::size_t max_in_flight_per_connection = 64;
+    std::size_t max_queued = 10000;          // 넘으면 Execute가 즉시 false
+    std::chrono::milliseconds reconnect_backoff{250};
+    std::chrono::milliseconds max_reconnect_backoff{10000};
+};
+
+/**
+ * @brief libpq 비동기 연결 풀 (Boost.Asio 통합)
+ *
+ * 연결마다 PQsocket을 asio 디스크립터로 감싸 읽기/쓰기 가능 이벤트를 기다리므로
+ * io 스레드가 DB 응답을 기다리며 멈추지 않습니다. 모든 상태는 strand 위에서만 바뀝니다.
+ * 살아 있는 연결이 하나도 없으면 대기 중인 쿼리는 즉시 실패로 완료됩니다 (최선 노력 기록용).
+ */
+class PostgresConnectionPool : public std::enable_shared_from_this<PostgresConnectionPool> {
+   public:
+    using Callback = std::function<void(bool ok, const std::string& error)>;
+
+    PostgresConnectionPool(boost::asio::io_context& io_context, std::string dsn,
+                           PostgresPoolOptions options,
+                           std::shared_ptr<QueryLatencyHistogram> latency);
+    ~PostgresConnectionPool();
+
+    PostgresConnectionPool(const PostgresConnectionPool&) = delete;
+    PostgresConnectionPool& operator=(const PostgresConnectionPool&) = delete;
+
+    void Start();
+    void Stop();
+
+    /**
+     * @brief 쿼리 예약 (어느 스레드에서나 호출 가능, 블로킹 없음)
+     * @param label 히스토그램 라벨 (예: "session_event")
+     * @return 대기열이 가득 찼거나 정지 중이면 false (callback 호출 안 됨)
+     */
+    bool Execute(std::string label, std::string sql, std::vector<std::string> params,
+                 Callback callback = {});
+
+    std::string MetricsSnapshot() const;
+
+   private:
+    struct Query {
+        std::string label;
+        std::string sql;
+        std::vector<std::string> params;
+        Callback callback;
+        std::chrono::steady_clock::time_point enqueued_at;
+        bool ok{true};
+        std::string error;
+        bool results_done{false};  // 파이프라인: NULL 수신 후 SYNC 대기
+    };
+
+    struct Connection {
+        explicit Connection(boost::asio::io_context& io_context, std::size_t connection_index)
+            : descriptor(io_context), reconnect_timer(io_context), index(connection_index) {}
+
+        PGconn* pg{nullptr};
+        boost::asio::posix::stream_descriptor descriptor;
+        boost::asio::steady_timer reconnect_timer;
+        std::size_t index;
+        std::deque<Query> in_flight;
+        std::uint64_t generation{0};  // Close마다 증가 → 이전 연결의 늦은 핸들러 무시
+        bool connecting{false};
+        bool connected{false};
+        bool pipeline{false};
+        bool read_armed{false};
+        bool write_armed{false};
+        std::chrono::milliseconds backoff{0};
+    };
+
+    void Connect(Connection& conn);
+    void PollConnect(Connection& conn, PostgresPollingStatusType status);
+    void OnConnected(Connection& conn);
+    void AssignSocket(Connection& conn);
+    void ArmRead(Connection& conn);
+    void Flush(Connection& conn);
+    void ProcessResults(Connection& conn);
+    void Dispatch();
+    bool Send(Connection& conn, Query&& query);
+    void Complete(Query& query);
+    void Fail(Connection& conn, const std::string& error);
+    void Close(Connection& conn);
+    void ScheduleReconnect(Connection& conn);
+    void FailWaitingIfAllDown(const std::string& error);
+    std::size_t Capacity(const Connection& conn) const;
+
+    boost::asio::io_context& io_context_;
+    boost::asio::strand<boost::asio::io_context::executor_type> strand_;
+    const std::string dsn_;
+    const PostgresPoolOptions options_;
+    std::shared_ptr<QueryLatencyHistogram> latency_;
+
+    // strand 전용
+    std::vector<std::unique_ptr<Connection>> connections_;
+    std::deque<Query> waiting_;
+    bool stopping_{false};
+
+    std::atomic<bool> started_{false};
+    std::atomic<std::size_t> queued_{0};  // Execute ~ 결과 수신까지
+    std::atomic<std::size_t> connections_up_{0};
+    std::atomic<std::uint64_t> queries_ok_total_{0};
+    std::atomic<std::uint64_t> queries_failed_total_{0};
+    std::atomic<std::uint64_t> rejected_total_{0};
+    std::atomic<std::uint64_t> connect_failures_total_{0};
+    std::atomic<std::uint64_t> pipelined_connections_{0};
+};
+
+}  // namespace pvpserver
@@ -3,11 +3,53 @@
 #include <libpq-fe.h>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/storage/postgres_connection_pool.h"
 
 namespace pvpserver {
 
+// match_results 테이블 한 행
+struct MatchResultRecord {
+    std::string match_id;
+    std::string winner_id;
+    std::string loser_id;
+    std::string placements;  // 순위 순 팀 목록 "a,b;c,d"
+    std::int64_t completed_at_ms{0};
+};
+
+// player_profiles 테이블 한 행 (매치 직후 누적 값 스냅샷)
+struct ProfileRecord {
+    std::string player_id;
+    int rating{1200};
+    std::uint64_t matches{0};
+    std::uint64_t wins{0};
+    std::uint64_t losses{0};
+    std::uint64_t kills{0};
+    std::uint64_t deaths{0};
+    std::uint64_t shots_fired{0};
+    std::uint64_t hits_landed{0};
+    std::uint64_t damage_dealt{0};
+    std::uint64_t damage_taken{0};
+};
+
+struct WriteBehindOptions {
+    std::size_t capacity = 65536;  // 대기 중인 매치 최대 개수 (넘치면 버림)
+    std::size_t max_batch = 256;   // 트랜잭션 하나에 담는 매치 수
+    std::chrono::milliseconds flush_interval{100};
+    int max_attempts = 5;
+    std::chrono::milliseconds initial_backoff{100};
+    std::chrono::milliseconds max_backoff{5000};
+};
+
 class PostgresStorage {
    public:
     explicit PostgresStorage(std::string dsn);
@@ -18,8 +60,45 @@ class PostgresStorage {
 
     bool IsConnected() const noexcept;
 
+    /**
+     * @brief 세션 이벤트 기록
+     *
+     * StartAsync 이후에는 연결 풀에 맡기고 즉시 반환합니다 (io 스레드에서 호출해도 안전).
+     * 그 전에는 동기 연결(Connect)로 기록합니다.
+     */
     bool RecordSessionEvent(const std::string& player_id, const std::string& event);
 
+    // 완료 시 done 호출 (풀 strand에서 실행). 풀이 없거나 대기열이 가득 차면 false
+    bool RecordSessionEventAsync(const std::string& player_id, const std::string& event,
+                                 PostgresConnectionPool::Callback done = {});
+
+    /**
+     * @brief 비동기 연결 풀 시작 (io_context 위에서 libpq 논블로킹 소켓 사용)
+     *
+     * 다른 스레드가 RecordSessionEvent를 호출하기 전에 한 번 호출해야 합니다.
+     */
+    void StartAsync(boost::asio::io_context& io_context, PostgresPoolOptions options = {});
+    void StopAsync();
+
+    /**
+     * @brief 매치 결과/프로필 쓰기 지연(write-behind) 시작
+     *
+     * 전용 스레드가 별도 연결로 대기열을 배치 단위로 기록합니다.
+     * (RecordSessionEvent의 동기 연결과 공유하지 않음)
+     */
+    void StartWriteBehind(WriteBehindOptions options = {});
+    // 남은 대기열을 기록한 뒤 종료
+    void StopWriteBehind();
+
+    /**
+     * @brief 매치 결과와 참가자 프로필을 대기열에 추가 (블로킹 없음)
+     * @return 대기열이 가득 찼거나 write-behind가 꺼져 있으면 false
+     */
+    bool EnqueueMatch(MatchResultRecord match, std::vector<ProfileRecord> profiles);
+
+    // 지금까지 대기열에 들어간 항목이 기록(또는 재시도 포기)될 때까지 대기
+    bool FlushWriteBehind(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
+
     std::string MetricsSnapshot() const;
     double LastQueryDurationSeconds() const noexcept;
 
@@ -29,10 +108,47 @@ class PostgresStorage {
     struct ConnDeleter {
         void operator()(PGconn* conn) const noexcept;
     };
+    using Connection = std::unique_ptr<PGconn, ConnDeleter>;
+
+    struct PendingMatch {
+        MatchResultRecord match;
+        std::vector<ProfileRecord> profiles;
+    };
+
+    void WriteBehindLoop();
+    bool WriteWithRetry(const std::vector<PendingMatch>& batch);
+    bool WriteBatch(PGconn* conn, const std::vector<PendingMatch>& batch);
+    static bool EnsureSchema(PGconn* conn);
+    static bool Exec(PGconn* conn, const std::string& sql, const std::vector<std::string>& params);
 
     std::string dsn_;
-    std::unique_ptr<PGconn, ConnDeleter> connection_;
+    Connection connection_;
     std::atomic<double> last_query_seconds_{0.0};
+    std::shared_ptr<QueryLatencyHistogram> latency_;
+    std::shared_ptr<PostgresConnectionPool> pool_;
+
+    // write-behind (wb_mutex_ 보호)
+    WriteBehindOptions wb_options_;
+    std::mutex wb_mutex_;
+    std::condition_variable wb_cv_;       // 작성 스레드 깨우기
+    std::condition_variable wb_idle_cv_;  // Flush 대기
+    std::deque<PendingMatch> wb_pending_;
+    bool wb_running_{false};
+    bool wb_stopping_{false};
+    std::size_t wb_in_flight_{0};
+    std::thread wb_thread_;
+    Connection wb_connection_;  // 작성 스레드 전용
+
+    std::atomic<std::uint64_t> wb_enqueued_total_{0};
+    std::atomic<std::uint64_t> wb_dropped_total_{0};
+    std::atomic<std::uint64_t> wb_batches_total_{0};
+    std::atomic<std::uint64_t> wb_failed_batches_total_{0};
+    std::atomic<std::uint64_t> wb_retries_total_{0};
+    std::atomic<std::uint64_t> wb_match_rows_total_{0};
+    std::atomic<std::uint64_t> wb_profile_rows_total_{0};
+    std::atomic<std::uint64_t> wb_write_us_total_{0};
+    std::atomic<double> wb_last_batch_seconds_{0.0};
+    std::atomic<std::size_t> wb_queue_depth_{0};
 };
 
 }  // namespace pvpserver
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pvpserver {
+namespace storage {
+
+/**
+ * RESP2/RESP3 응답 값
+ * Map은 elements에 key, value가 번갈아 저장됩니다.
+ */
+struct RespValue {
+    enum class Type {
+        SimpleString,
+        Error,
+        Integer,
+        BulkString,
+        Array,
+        Null,
+        Boolean,
+        Double,
+        BigNumber,
+        Verbatim,
+        Map,
+        Set,
+        Push,
+    };
+
+    Type type{Type::Null};
+    std::string text;      // 문자열 계열 + Double/BigNumber 원문
+    long long integer{0};  // Integer, Boolean(0/1)
+    std::vector<RespValue> elements;
+
+    bool IsError() const noexcept { return type == Type::Error; }
+    bool IsNull() const noexcept { return type == Type::Null; }
+    // 문자열 계열이면 값, 아니면 nullopt
+    std::optional<std::string> AsString() const;
+};
+
+/**
+ * 증분 RESP 파서
+ * 소켓에서 받은 조각을 Feed()로 넣고, Next()로 완성된 응답을 하나씩 꺼냅니다.
+ */
+class RespParser {
+public:
+    void Feed(const char* data, std::size_t size);
+
+    // 완성된 응답이 없으면 nullopt, 프로토콜 위반이면 std::runtime_error
+    std::optional<RespValue> Next();
+
+    std::size_t Buffered() const noexcept { return buffer_.size() - offset_; }
+
+private:
+    bool Parse(std::size_t& pos, RespValue& out) const;
+    bool ReadLine(std::size_t& pos, std::string& line) const;
+
+    std::string buffer_;
+    std::size_t offset_ = 0;
+};
+
+/**
+ * 명령을 RESP 배열(bulk string)로 인코딩
+ */
+std::string EncodeRespCommand(const std::vector<std::string>& args);
+
+/**
+ * Redis 클라이언트 설정
+ */
+struct RedisClientConfig {
+    std::string host = "127.0.0.1";
+    std::uint16_t port = 6379;
+    std::string password;
+    int command_timeout_ms = 1000;
+    int connect_timeout_ms = 0;  // 0 = command_timeout_ms
+    bool use_resp3 = false;      // 연결 시 HELLO 3
+};
+
+/**
+ * Boost.Asio 기반 비동기 RESP 클라이언트
+ *
+ * - 연결 하나를 재사용하며, 끊어지면 다음 명령에서 다시 연결합니다.
+ * - 파이프라이닝: 여러 스레드에서 동시에 보낸 명령도 한 번의 write로 묶어 전송하고,
+ *   응답은 보낸 순서(FIFO)대로 각 future에 전달됩니다.
+ * - 내부 io 스레드 하나에서 모든 소켓 작업을 수행합니다.
+ *   외부 io_context를 받으면 스레드를 만들지 않고 그 context에서 동작합니다
+ *   (그 context는 스레드 하나가 실행해야 하며, 클라이언트 소멸 전에 멈춰 있어야 합니다).
+ */
+class RedisClient {
+public:
+    // 완료 핸들러: io 스레드에서 호출. reply가 없으면 error에 사유 (연결 실패 등)
+    using ReplyHandler =
+        std::function<void(std::optional<RespValue> reply, const std::string& error)>;
+    using BatchHandler = std::function<void(std::optional<std::vector<RespValue>> replies,
+                                            const std::string& error)>;
+    // RESP3 push 메시지 (구독 확인, 채널 메시지 등): io 스레드에서 호출
+    using PushHandler = std::function<void(const RespValue& push)>;
+
+    explicit RedisClient(RedisClientConfig config);
+    RedisClient(RedisClientConfig config, boost::asio::io_context& io_context);
+    ~RedisClient();
+
+    RedisClient(const RedisClient&) = delete;
+    RedisClient& operator=(const RedisClient&) = delete;
+
+    std::future<RespValue> ExecuteAsync(std::vector<std::string> args);
+    void ExecuteAsync(std::vector<std::string> args, ReplyHandler handler);
+
+    // 명령 묶음을 연속된 순서로 전송 (다른 호출자의 명령이 사이에 끼지 않음)
+    std::vector<std::future<RespValue>> PipelineAsync(
+        std::vector<std::vector<std::string>> commands);
+    // 전체 응답이 모이면 한 번 호출 (하나라도 전송 실패면 replies 없음)
+    void PipelineAsync(std::vector<std::vector<std::string>> commands, BatchHandler handler);
+
+    // 동기 래퍼: command_timeout_ms 초과/연결 실패 시 nullopt (Redis 오류 응답은 값으로 반환)
+    std::optional<RespValue> Execute(std::vector<std::string> args);
+    std::optional<std::vector<RespValue>> Pipeline(std::vector<std::vector<std::string>> commands);
+
+    /**
+     * 채널 구독 (use_resp3 = true 필요: RESP2 연결은 구독 후 일반 명령을 받지 않음)
+     * - push 메시지는 handler로 전달 (마지막에 넘긴 handler 하나만 유지)
+     * - 구독 중인 연결이 끊어지면 명령이 없어도 다시 연결해 전체 채널을 재구독
+     */
+    void Subscribe(std::vector<std::string> channels, PushHandler handler);
+
+    bool IsConnected() const noexcept { return connected_.load(); }
+    std::string MetricsSnapshot() const;
+
+private:
+    struct PendingCommand {
+        std::string payload;
+        ReplyHandler handler;  // 비어 있으면 응답을 버림 (HELLO/AUTH)
+        bool expects_reply = true;  // false: 응답이 push로 옴 (SUBSCRIBE)
+    };
+
+    static constexpr int kResubscribeDelayMs = 500;
+
+    void Submit(std::vector<PendingCommand> batch);
+    void FlushOutbox();
+    void StartConnect();
+    void StartRead();
+    void HandleFailure(const std::string& reason);
+
+    RedisClientConfig config_;
+    std::unique_ptr<boost::asio::io_context> owned_io_context_;  // 외부 context면 nullptr
+    boost::asio::io_context& io_context_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    boost::asio::ip::tcp::socket socket_;
+    boost::asio::ip::tcp::resolver resolver_;
+    boost::asio::steady_timer connect_timer_;
+    boost::asio::steady_timer resubscribe_timer_;
+    std::thread io_thread_;
+
+    // outbox_/구독 정보는 호출자 스레드와 공유 (mutex_), 나머지는 io 스레드 전용
+    std::mutex mutex_;
+    std::vector<PendingCommand> outbox_;
+    std::vector<std::string> subscriptions_;
+    PushHandler push_handler_;
+    bool flush_scheduled_ = false;
+    std::deque<ReplyHandler> awaiting_;
+    std::string write_buffer_;
+    std::array<char, 16 * 1024> read_buffer_{};
+    RespParser parser_;
+    bool connecting_ = false;
+    bool writing_ = false;
+    bool ever_connected_ = false;
+    bool shutting_down_ = false;
+
+    std::atomic<bool> connected_{false};
+    std::atomic<std::uint64_t> commands_total_{0};
+    std::atomic<std::uint64_t> batches_total_{0};
+    std::atomic<std::uint64_t> errors_total_{0};
+    std::atomic<std::uint64_t> reconnects_total_{0};
+};
+
+}  // namespace storage
+}  // namespace pvpserver
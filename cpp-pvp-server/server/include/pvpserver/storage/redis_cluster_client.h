@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "pvpserver/storage/redis_client.h"
+
+namespace pvpserver {
+namespace storage {
+
+/**
+ * Redis 연결 설정
+ */
+struct RedisConfig {
+    std::vector<std::string> cluster_nodes;  // "host:port" 형태 (비어 있으면 127.0.0.1:6379)
+    std::string password;
+    int connection_pool_size = 10;  // 노드당 연결 수
+    int connection_timeout_ms = 5000;
+    int command_timeout_ms = 1000;
+    int session_ttl_seconds = 3600;
+};
+
+/**
+ * 연결 풀 + 슬롯 라우팅 Redis 클라이언트
+ *
+ * - 노드마다 RedisClient 연결 connection_pool_size개 (io 스레드 하나 공유), 라운드 로빈 선택
+ * - 키의 CRC16 슬롯으로 노드 선택, MOVED/ASK 응답을 따라가며 슬롯 표를 갱신
+ * - 클러스터가 아닌 단일 Redis면 (CLUSTER SLOTS 오류) 모든 슬롯이 첫 노드
+ * - 핸들러는 io 스레드에서 호출됩니다 (오래 걸리는 작업 금지)
+ */
+class RedisClusterClient {
+public:
+    using ReplyHandler = RedisClient::ReplyHandler;
+    using BatchHandler = RedisClient::BatchHandler;
+
+    static constexpr std::size_t kSlots = 16384;
+    static constexpr int kMaxRedirects = 3;
+
+    explicit RedisClusterClient(const RedisConfig& config);
+    ~RedisClusterClient();
+
+    RedisClusterClient(const RedisClusterClient&) = delete;
+    RedisClusterClient& operator=(const RedisClusterClient&) = delete;
+
+    // 키는 args[1] (키 없는 명령은 첫 노드)
+    void ExecuteAsync(std::vector<std::string> args, ReplyHandler handler);
+    std::future<RespValue> ExecuteAsync(std::vector<std::string> args);
+
+    /**
+     * 명령 묶음 전송: 노드마다 한 번의 write
+     * 한 노드로 가는 명령이 모두 같은 슬롯이면 (단일 Redis면 항상) MULTI/EXEC로 감싸 원자적으로 실행.
+     * replies는 commands 순서.
+     */
+    void BatchAsync(std::vector<std::vector<std::string>> commands, BatchHandler handler);
+
+    // 동기 래퍼: command_timeout_ms 초과/연결 실패 시 nullopt (Redis 오류 응답은 값으로 반환)
+    std::optional<RespValue> Execute(std::vector<std::string> args);
+    std::optional<std::vector<RespValue>> Batch(std::vector<std::vector<std::string>> commands);
+
+    /**
+     * Pub/Sub: 클러스터에서 PUBLISH는 모든 노드로 전파되므로 구독은 첫 노드에 전용 연결 하나
+     * (RESP3, 끊어지면 자동 재구독). handler는 io 스레드에서 호출됩니다.
+     */
+    using MessageHandler = std::function<void(const std::string& message)>;
+    void Publish(const std::string& channel, const std::string& message);
+    void Subscribe(const std::string& channel, MessageHandler handler);
+
+    bool Ping();
+    bool ClusterEnabled() const noexcept { return cluster_enabled_.load(); }
+    std::size_t NodeCount() const;
+    std::string MetricsSnapshot() const;
+
+    // CRC16(XMODEM) % 16384, {hash tag} 지원 (Redis Cluster 규격)
+    static std::uint16_t KeySlot(std::string_view key) noexcept;
+
+private:
+    struct Node {
+        std::string address;
+        std::vector<std::unique_ptr<RedisClient>> connections;
+        std::atomic<std::size_t> next{0};
+    };
+
+    struct Redirect {
+        bool ask{false};
+        std::uint16_t slot{0};
+        std::string address;
+    };
+
+    static std::uint16_t CommandSlot(const std::vector<std::string>& args) noexcept;
+    static std::optional<Redirect> ParseRedirect(const RespValue& reply);
+
+    std::size_t NodeForSlot(std::uint16_t slot) const;
+    std::size_t NodeForAddress(const std::string& address);
+    RedisClient& Pick(std::size_t node);
+
+    void Send(std::size_t node, std::vector<std::string> args, ReplyHandler handler,
+              int redirects, bool asking);
+    void RefreshSlots();
+    void ApplySlots(const RespValue& reply);
+    void DispatchMessage(const RespValue& push);
+
+    RedisConfig config_;
+    RedisClientConfig client_config_;
+
+    boost::asio::io_context io_context_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    std::thread io_thread_;
+
+    // 토폴로지: 노드는 추가만 (포인터 안정), 슬롯 표는 MOVED/CLUSTER SLOTS로 갱신
+    mutable std::shared_mutex topology_mutex_;
+    std::vector<std::unique_ptr<Node>> nodes_;
+    std::array<std::uint16_t, kSlots> slot_owner_{};
+
+    std::mutex subscriber_mutex_;
+    std::unique_ptr<RedisClient> subscriber_;
+    std::unordered_map<std::string, std::vector<MessageHandler>> channel_handlers_;
+
+    std::atomic<bool> cluster_enabled_{false};
+    std::atomic<bool> refreshing_{false};
+    std::atomic<std::uint64_t> commands_total_{0};
+    std::atomic<std::uint64_t> batches_total_{0};
+    std::atomic<std::uint64_t> transactions_total_{0};
+    std::atomic<std::uint64_t> moved_total_{0};
+    std::atomic<std::uint64_t> ask_total_{0};
+    std::atomic<std::uint64_t> published_total_{0};
+    std::atomic<std::uint64_t> received_total_{0};
+};
+
+}  // namespace storage
+}  // namespace pvpserver
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "session_store.h"
+#include "cached_session_store.h"
+#include "redis_cluster_client.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -9,24 +12,10 @@
 namespace pvpserver {
 namespace storage {
 
-/**
- * Redis 연결 설정
- */
-struct RedisConfig {
-    std::vector<std::string> cluster_nodes;  // "host:port" 형태
-    std::string password;
-    int connection_pool_size = 10;
-    int connection_timeout_ms = 5000;
-    int command_timeout_ms = 1000;
-    int session_ttl_seconds = 3600;
-};
-
-// Forward declaration (실제 Redis 클라이언트 라이브러리에 의존)
-class RedisClusterClient;
-
 /**
  * Redis 세션 저장소
  * 프로덕션용 Redis Cluster 지원 구현체입니다.
+ * 저장 한 번 = 세션/플레이어 매핑/세션 집합 명령을 묶어 한 번의 왕복.
  */
 class RedisSessionStore : public SessionStore {
 public:
@@ -57,13 +46,22 @@ public:
 
     bool SessionExists(const std::string& session_id) override;
 
+    // 비동기 버전: 핸들러는 Redis io 스레드에서 호출
+    void SaveSessionAsync(const std::string& session_id, const SessionData& data,
+                          std::function<void(bool ok)> done);
+    void GetSessionAsync(const std::string& session_id,
+                         std::function<void(std::optional<SessionData>)> done);
+
     // Redis 특화 기능
     bool IsConnected() const;
     void Reconnect();
+    std::string MetricsSnapshot() const;
+    // 같은 연결 풀을 쓰는 구성 요소용 (RedisSessionInvalidationBus 등)
+    std::shared_ptr<RedisClusterClient> Client() const { return client_; }
 
 private:
     RedisConfig config_;
-    std::unique_ptr<RedisClusterClient> client_;
+    std::shared_ptr<RedisClusterClient> client_;
 
     static constexpr const char* SESSION_KEY_PREFIX = "pvp:session:";
     static constexpr const char* PLAYER_SESSION_PREFIX = "pvp:player_session:";
@@ -71,6 +69,27 @@ private:
 
     std::string MakeSessionKey(const std::string& session_id) const;
     std::string MakePlayerSessionKey(const std::string& player_id) const;
+    std::vector<std::vector<std::string>> MakeSaveCommands(const std::string& session_id,
+                                                           const SessionData& data) const;
+};
+
+/**
+ * Redis Pub/Sub 기반 near-cache 무효화 채널
+ * 모든 노드가 같은 채널을 구독하고, 각 CachedSessionStore가 Save/Delete마다 발행합니다.
+ */
+class RedisSessionInvalidationBus : public SessionInvalidationBus {
+public:
+    static constexpr const char* kDefaultChannel = "pvp:session:invalidate";
+
+    explicit RedisSessionInvalidationBus(std::shared_ptr<RedisClusterClient> client,
+                                         std::string channel = kDefaultChannel);
+
+    void Publish(const std::string& message) override;
+    void Subscribe(Handler handler) override;
+
+private:
+    std::shared_ptr<RedisClusterClient> client_;
+    std::string channel_;
 };
 
 }  // namespace storage
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace pvpserver {
@@ -21,9 +23,18 @@ struct SessionData {
     int elo_rating;
     std::string match_id;         // 현재 매치 (있는 경우)
 
-    // 직렬화
+    /**
+     * 직렬화 (바이너리 v1)
+     * [magic 0xB5][version][varint 길이+문자열 ×3][zigzag varint ×3][varint 길이+match_id]
+     */
     std::string Serialize() const;
-    static std::optional<SessionData> Deserialize(const std::string& data);
+    void SerializeTo(std::string& out) const;  // out 끝에 덧붙임 (버퍼 재사용)
+
+    // 이전 JSON 형식 (마이그레이션 테스트/디버깅용)
+    std::string SerializeJson() const;
+
+    // 바이너리와 이전 JSON 형식 모두 읽음 (첫 바이트로 구분)
+    static std::optional<SessionData> Deserialize(std::string_view data);
 
     // 현재 시간으로 last_activity 갱신
     void Touch();
@@ -32,6 +43,29 @@ struct SessionData {
     bool IsValid() const;
 };
 
+/**
+ * 바이너리 SessionData의 읽기 전용 뷰
+ * 문자열 필드는 원본 버퍼를 가리키므로 복사/할당이 없습니다 (버퍼보다 오래 쓰면 안 됨).
+ */
+struct SessionDataView {
+    static constexpr std::uint8_t kMagic = 0xB5;
+    static constexpr std::uint8_t kVersion = 1;
+
+    std::string_view player_id;
+    std::string_view player_name;
+    std::string_view server_id;
+    int64_t created_at{0};
+    int64_t last_activity{0};
+    int elo_rating{0};
+    std::string_view match_id;
+
+    // 바이너리 형식이 아니거나 잘렸으면 nullopt
+    static std::optional<SessionDataView> Parse(std::string_view data);
+    static bool IsBinary(std::string_view data) noexcept;
+
+    SessionData ToSessionData() const;
+};
+
 /**
  * 세션 저장소 추상 인터페이스
  * InMemory 또는 Redis 구현을 추상화합니다.
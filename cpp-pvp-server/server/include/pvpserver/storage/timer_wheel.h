@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace pvpserver {
+namespace storage {
+
+/**
+ * 계층형 타이밍 휠 (Varghese & Lauck)
+ * 레벨 4개 × 슬롯 64개: 틱이 1초면 레벨 0은 64초, 레벨 3은 약 194일까지 표현합니다.
+ * 노드는 호출자가 소유하는 침입형(intrusive) 리스트 노드이므로 등록/재등록/해제에 할당이 없습니다.
+ * 스레드 안전하지 않습니다 (호출자가 잠금).
+ */
+class TimerWheel {
+public:
+    struct Node {
+        Node* prev{nullptr};
+        Node* next{nullptr};
+        std::uint64_t expiry_tick{0};
+        bool scheduled{false};
+    };
+
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+
+    explicit TimerWheel(std::uint64_t start_tick = 0);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // expiry_tick에 만료되도록 등록 (이미 등록돼 있으면 옮김) - O(1)
+    void Schedule(Node& node, std::uint64_t expiry_tick);
+    void Cancel(Node& node);
+
+    /**
+     * now_tick까지 진행하며 만료된 노드를 리스트에서 떼어 on_expire로 전달
+     * 만료 노드 수 + 지나간 틱 수에 비례 (전체 스캔 없음)
+     * @return 만료된 노드 수
+     */
+    std::size_t Advance(std::uint64_t now_tick, const std::function<void(Node&)>& on_expire);
+
+    std::size_t Size() const noexcept { return size_; }
+    std::uint64_t CurrentTick() const noexcept { return current_tick_; }
+
+private:
+    void Link(Node& node);
+    static void Unlink(Node& node);
+    void Cascade(int level, std::size_t slot);
+    // 슬롯 리스트를 통째로 떼어 nullptr로 끝나는 단일 체인으로 반환
+    Node* Detach(Node& head);
+
+    std::uint64_t current_tick_;  // 이 틱의 슬롯은 아직 처리 전
+    std::size_t size_{0};
+    // 슬롯마다 원형 리스트 머리(센티널) → 빈 리스트도 분기 없이 연결/해제
+    std::array<std::array<Node, kSlots>, kLevels> slots_{};
+};
+
+}  // namespace storage
+}  // namespace pvpserver
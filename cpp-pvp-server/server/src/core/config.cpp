@@ -16,6 +16,9 @@
 
 #include <cstdlib>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace {
 constexpr double kDefaultTickRate = 60.0;
@@ -34,6 +37,43 @@ double ParseDoubleOrDefault(const char* value, double fallback) {
     }
 }
 
+bool ParseBoolOrDefault(const char* value, bool fallback) {
+    if (!value) {
+        return fallback;
+    }
+    const std::string text(value);
+    if (text == "1" || text == "true" || text == "on") {
+        return true;
+    }
+    if (text == "0" || text == "false" || text == "off") {
+        return false;
+    }
+    return fallback;
+}
+
+// "kr, us ,eu" → {"kr", "us", "eu"} (빈 항목 무시, 결과가 비면 fallback)
+std::vector<std::string> ParseListOrDefault(const char* value, std::vector<std::string> fallback) {
+    if (!value) {
+        return fallback;
+    }
+    std::vector<std::string> items;
+    std::string current;
+    const std::string text(value);
+    for (std::size_t i = 0; i <= text.size(); ++i) {
+        if (i == text.size() || text[i] == ',') {
+            const auto first = current.find_first_not_of(' ');
+            if (first != std::string::npos) {
+                const auto last = current.find_last_not_of(' ');
+                items.push_back(current.substr(first, last - first + 1));
+            }
+            current.clear();
+        } else {
+            current.push_back(text[i]);
+        }
+    }
+    return items.empty() ? fallback : items;
+}
+
 std::uint16_t ParsePortOrDefault(const char* value, std::uint16_t fallback) {
     if (!value) {
         return fallback;
@@ -53,24 +93,31 @@ std::uint16_t ParsePortOrDefault(const char* value, std::uint16_t fallback) {
 namespace pvpserver {
 
 GameConfig::GameConfig(std::uint16_t port, std::uint16_t metrics_port, double tick_rate,
-                       std::string database_dsn)
+                       std::string database_dsn, bool deterministic_simulation,
+                       std::vector<std::string> matchmaking_regions)
     : port_(port),
       metrics_port_(metrics_port),
       tick_rate_(tick_rate),
-      database_dsn_(std::move(database_dsn)) {}
+      database_dsn_(std::move(database_dsn)),
+      deterministic_simulation_(deterministic_simulation),
+      matchmaking_regions_(std::move(matchmaking_regions)) {}
 
 GameConfig GameConfig::FromEnv() {
     const char* env_port = std::getenv("PVPSERVER_PORT");
     const char* env_metrics_port = std::getenv("PVPSERVER_METRICS_PORT");
     const char* env_tick = std::getenv("PVPSERVER_TICK_RATE");
     const char* env_dsn = std::getenv("PVPSERVER_DATABASE_DSN");
+    const char* env_deterministic = std::getenv("PVPSERVER_DETERMINISTIC_SIM");
+    const char* env_regions = std::getenv("PVPSERVER_MATCHMAKING_REGIONS");
 
     const auto port = ParsePortOrDefault(env_port, kDefaultPort);
     const auto metrics_port = ParsePortOrDefault(env_metrics_port, kDefaultMetricsPort);
     const auto tick_rate = ParseDoubleOrDefault(env_tick, kDefaultTickRate);
     const std::string dsn = env_dsn ? env_dsn : kDefaultDsn;
+    const bool deterministic = ParseBoolOrDefault(env_deterministic, false);
+    auto regions = ParseListOrDefault(env_regions, {"global"});
 
-    return GameConfig{port, metrics_port, tick_rate, dsn};
+    return GameConfig{port, metrics_port, tick_rate, dsn, deterministic, std::move(regions)};
 }
 
 }  // namespace pvpserver
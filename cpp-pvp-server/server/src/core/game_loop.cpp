@@ -10,6 +10,7 @@
 
 #include "pvpserver/core/game_loop.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <sstream>
@@ -45,6 +46,7 @@ void GameLoop::Start() {
     {
         std::lock_guard<std::mutex> lk(metrics_mutex_);
         last_durations_.clear();
+        last_work_.clear();
         tick_counter_ = 0;
     }
     stop_requested_ = false;
@@ -99,6 +101,28 @@ std::vector<double> GameLoop::LastDurations() const {
     return last_durations_;
 }
 
+// TickWorkPercentile - 틱 간격(delta)이 아니라 콜백이 실제로 쓴 시간
+// [LEARN] 틱 간격은 sleep이 메워서 항상 ~16.7ms로 보인다.
+//         서버의 여유는 "일한 시간"의 꼬리(p99)가 예산(1/tick_rate)에 얼마나 가까운지로 봐야 한다.
+//         로드 밸런서가 이 값을 받아 틱 예산에 가까운 서버를 피한다.
+double GameLoop::TickWorkPercentile(double quantile) const {
+    std::vector<double> samples;
+    {
+        std::lock_guard<std::mutex> lk(metrics_mutex_);
+        samples = last_work_;
+    }
+    if (samples.empty()) {
+        return 0.0;
+    }
+    const double clamped = std::min(1.0, std::max(0.0, quantile));
+    const auto rank = static_cast<std::size_t>(
+        std::ceil(clamped * static_cast<double>(samples.size())));
+    const auto index = rank == 0 ? 0 : rank - 1;
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index),
+                     samples.end());
+    return samples[index];
+}
+
 std::string GameLoop::PrometheusSnapshot() const {
     std::ostringstream oss;
     oss << "# TYPE game_tick_rate gauge\n";
@@ -112,6 +136,9 @@ std::string GameLoop::PrometheusSnapshot() const {
     }
     oss << "# TYPE game_tick_duration_seconds gauge\n";
     oss << "game_tick_duration_seconds " << last_duration << "\n";
+    oss << "# TYPE game_tick_work_seconds gauge\n";
+    oss << "game_tick_work_seconds{quantile=\"0.5\"} " << TickWorkPercentile(0.5) << "\n";
+    oss << "game_tick_work_seconds{quantile=\"0.99\"} " << TickWorkPercentile(0.99) << "\n";
     return oss.str();
 }
 
@@ -154,6 +181,8 @@ void GameLoop::Run() {
             }
         }
 
+        const double work_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - frame_start).count();
         previous = frame_start;
         next_frame += target_delta_;
 
@@ -163,6 +192,10 @@ void GameLoop::Run() {
             if (last_durations_.size() > 240) {
                 last_durations_.erase(last_durations_.begin());
             }
+            last_work_.push_back(work_seconds);
+            if (last_work_.size() > 240) {
+                last_work_.erase(last_work_.begin());
+            }
             ++tick_counter_;
         }
 
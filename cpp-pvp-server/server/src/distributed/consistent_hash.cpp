@@ -8,154 +8,287 @@
 //         일반 해싱은 노드 추가/제거 시 거의 모든 키가 재배치되지만,
 //         Consistent Hashing은 평균 K/N개만 이동 (K=키 수, N=노드 수).
 //         가상 노드(Virtual Node)로 부하 균등화 향상.
+//
+// [LEARN] std::map 링의 비용: 조회마다 트리 노드를 따라 포인터 추적 (노드마다 캐시 미스),
+//         가상 노드 키 "node-1#0"을 문자열로 만들고 바이트 단위로 해시.
+//         → 해시만 모은 정렬 배열 + 이진 탐색, 가상 노드 해시는 정수 혼합으로 계산.
 
 #include "pvpserver/distributed/consistent_hash.h"
 
 #include <algorithm>
-#include <sstream>
+#include <cstring>
 
 namespace pvpserver {
 namespace distributed {
 
+namespace {
+
+constexpr std::uint64_t kGolden = 0x9E3779B97F4A7C15ULL;
+constexpr std::uint64_t kMul = 0xC2B2AE3D27D4EB4FULL;
+
+// MurmurHash3 fmix64: 모든 입력 비트가 모든 출력 비트에 영향
+constexpr std::uint64_t Mix(std::uint64_t x) noexcept {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+constexpr std::uint64_t Rotl(std::uint64_t x, int r) noexcept {
+    return (x << r) | (x >> (64 - r));
+}
+
+}  // namespace
+
 // [Order 1] 생성자 - 가상 노드 수 설정
 // - virtual_nodes_: 실제 노드당 가상 노드 수 (기본 150)
-// - 가상 노드가 많을수록 부하 분산이 균등하지만 메모리 사용 증가
-ConsistentHashRing::ConsistentHashRing(int virtual_nodes)
-    : virtual_nodes_(virtual_nodes) {}
-
-// [Order 2] Hash - FNV-1a 해시 함수
-// [LEARN] FNV-1a는 빠르고 분포가 좋은 비암호화 해시.
-//         게임 서버에서는 MurmurHash3도 많이 사용.
-//         암호화 해시(SHA)보다 훨씬 빠름.
-size_t ConsistentHashRing::Hash(const std::string& key) const {
-    // FNV-1a 해시 초기값과 프라임
-    size_t hash = 14695981039346656037ULL;
-    for (char c : key) {
-        hash ^= static_cast<size_t>(c);  // XOR
-        hash *= 1099511628211ULL;        // FNV 프라임
-    }
-    return hash;
-}
-
-// 가상 노드 키 생성: "node-1#0", "node-1#1", ...
-std::string ConsistentHashRing::MakeVirtualNodeKey(
-    const std::string& node_id, int index) const {
-    std::ostringstream oss;
-    oss << node_id << "#" << index;
-    return oss.str();
-}
-
-// [Order 3] AddNode - 노드 추가
-// - 실제 노드 1개 추가 시 가상 노드 virtual_nodes_개가 링에 배치됨
+// - 가상 노드가 많을수록 부하 분산이 균등하지만 메모리 사용 증가 (가상 노드당 12바이트)
+ConsistentHashRing::ConsistentHashRing(int virtual_nodes, Mode mode)
+    : virtual_nodes_(std::max(1, virtual_nodes)), mode_(mode) {}
+
+// [Order 2] HashKey - 8바이트씩 읽어 섞고 마지막에 fmix64
+// [LEARN] FNV-1a는 바이트마다 곱셈 하나 → 긴 키일수록 느림.
+//         8바이트 단위로 처리하면 곱셈 수가 1/8, 분포는 최종 혼합이 보장.
+//         (리틀 엔디언 기준 값: 노드끼리 아키텍처가 같아야 같은 배치)
+std::uint64_t ConsistentHashRing::HashKey(std::string_view key) noexcept {
+    std::uint64_t hash = Mix(key.size() * kGolden);
+    const char* data = key.data();
+    std::size_t remaining = key.size();
+    while (remaining >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data, 8);
+        hash = Rotl(hash ^ (word * kMul), 31) * kGolden;
+        data += 8;
+        remaining -= 8;
+    }
+    if (remaining > 0) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data, remaining);
+        hash = Rotl(hash ^ (word * kMul), 31) * kGolden;
+    }
+    return Mix(hash);
+}
+
+// [LEARN] Jump Consistent Hash: 버킷 수가 n → n+1이 될 때 키가 새 버킷으로 옮길 확률이
+//         정확히 1/(n+1)이 되도록 "다음으로 점프할 버킷"을 난수로 건너뛰며 계산.
+//         메모리 없이 O(log n), 분포는 거의 완벽하게 균등.
+std::int32_t ConsistentHashRing::JumpHash(std::uint64_t key, std::int32_t buckets) noexcept {
+    std::int64_t bucket = -1;
+    std::int64_t next = 0;
+    while (next < buckets) {
+        bucket = next;
+        key = key * 2862933555777941757ULL + 1;
+        next = static_cast<std::int64_t>(
+            static_cast<double>(bucket + 1) *
+            (static_cast<double>(1LL << 31) / static_cast<double>((key >> 33) + 1)));
+    }
+    return static_cast<std::int32_t>(bucket);
+}
+
+// [Order 3] AddNode / RemoveNode - 정렬 배열에 병합 / 걸러내기 (O(가상 노드 전체))
+// - 실제 노드 1개 = 가상 노드 virtual_nodes_개: Mix(HashKey(id) + i × 황금비 상수)
 // [LEARN] 가상 노드가 링에 분산되어 있어서 부하가 균등해짐.
 //         가상 노드 없이 실제 노드만 사용하면 노드 간 부하 편차가 큼.
+//         멤버 변경은 드물고 조회는 매 접속마다 → 변경 때 비용을 치르고 조회를 싸게.
 void ConsistentHashRing::AddNode(const std::string& node_id) {
-    if (nodes_.count(node_id) > 0) {
+    if (FindMember(node_id) != members_.size()) {
         return;  // 이미 존재
     }
+    const auto node = static_cast<std::uint32_t>(members_.size());
+    members_.push_back(node_id);
+    if (mode_ == Mode::JUMP) {
+        return;
+    }
 
-    nodes_.insert(node_id);
-
-    // 가상 노드들을 링에 추가
+    std::vector<std::uint64_t> added;
+    added.reserve(static_cast<std::size_t>(virtual_nodes_));
+    const auto base = HashKey(node_id);
     for (int i = 0; i < virtual_nodes_; ++i) {
-        std::string vnode_key = MakeVirtualNodeKey(node_id, i);
-        size_t hash = Hash(vnode_key);
-        ring_[hash] = node_id;  // 해시값 → 실제 노드 ID 매핑
+        added.push_back(Mix(base + static_cast<std::uint64_t>(i + 1) * kGolden));
     }
+    std::sort(added.begin(), added.end());
+
+    // 기존 배열과 병합 (같은 해시면 번호가 작은 노드 먼저 → 추가 순서와 무관하게 결정적)
+    std::vector<std::uint64_t> points;
+    std::vector<std::uint32_t> owners;
+    points.reserve(points_.size() + added.size());
+    owners.reserve(points_.size() + added.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < points_.size() || j < added.size()) {
+        if (j == added.size() || (i < points_.size() && points_[i] <= added[j])) {
+            points.push_back(points_[i]);
+            owners.push_back(owners_[i]);
+            ++i;
+        } else {
+            points.push_back(added[j]);
+            owners.push_back(node);
+            ++j;
+        }
+    }
+    points_.swap(points);
+    owners_.swap(owners);
+    RebuildBuckets();
 }
 
-// [Order 4] RemoveNode - 노드 제거
-// - 해당 노드의 모든 가상 노드를 링에서 제거
 // - 제거된 가상 노드가 담당하던 키들은 다음 노드로 이동
+// - JUMP 모드에서 중간 노드를 빼면 뒤 노드 번호가 당겨져 더 많은 키가 이동
 void ConsistentHashRing::RemoveNode(const std::string& node_id) {
-    if (nodes_.count(node_id) == 0) {
+    const auto index = FindMember(node_id);
+    if (index == members_.size()) {
         return;  // 존재하지 않음
     }
+    members_.erase(members_.begin() + static_cast<std::ptrdiff_t>(index));
+    const auto removed = static_cast<std::uint32_t>(index);
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < points_.size(); ++i) {
+        if (owners_[i] == removed) {
+            continue;
+        }
+        points_[out] = points_[i];
+        owners_[out] = owners_[i] > removed ? owners_[i] - 1 : owners_[i];
+        ++out;
+    }
+    points_.resize(out);
+    owners_.resize(out);
+    RebuildBuckets();
+}
 
-    nodes_.erase(node_id);
-
-    // 가상 노드 제거
-    for (int i = 0; i < virtual_nodes_; ++i) {
-        std::string vnode_key = MakeVirtualNodeKey(node_id, i);
-        size_t hash = Hash(vnode_key);
-        ring_.erase(hash);
+// [LEARN] 해시는 균등 분포 → 상위 비트로 나눈 구간마다 가상 노드가 평균 1개 안팎.
+//         구간 시작 인덱스 표를 두면 이진 탐색(가상 노드 7500개면 13단계)이 표 조회 + 1~2칸 비교로 줄어듦.
+void ConsistentHashRing::RebuildBuckets() {
+    buckets_.clear();
+    bucket_bits_ = 0;
+    if (points_.empty()) {
+        return;
+    }
+    while ((std::size_t{1} << bucket_bits_) < points_.size() && bucket_bits_ < 24) {
+        ++bucket_bits_;
     }
+    const std::size_t count = std::size_t{1} << bucket_bits_;
+    buckets_.resize(count + 1);
+    std::size_t point = 0;
+    for (std::size_t bucket = 0; bucket < count; ++bucket) {
+        const std::uint64_t start = bucket_bits_ == 0 ? 0 : bucket << (64 - bucket_bits_);
+        while (point < points_.size() && points_[point] < start) {
+            ++point;
+        }
+        buckets_[bucket] = static_cast<std::uint32_t>(point);
+    }
+    buckets_[count] = static_cast<std::uint32_t>(points_.size());
+}
+
+std::size_t ConsistentHashRing::FindMember(const std::string& node_id) const {
+    return static_cast<std::size_t>(std::find(members_.begin(), members_.end(), node_id) -
+                                    members_.begin());
 }
 
-// [Order 5] GetNode - 키에 해당하는 노드 조회
+// [Order 4] Locate / GetNode - 키에 해당하는 노드 조회
 // [LEARN] 키의 해시값보다 크거나 같은 첫 번째 가상 노드 선택.
 //         링 끝을 넘어가면 처음으로 돌아감 (원형 구조).
-std::string ConsistentHashRing::GetNode(const std::string& key) const {
-    if (ring_.empty()) {
-        return "";
+std::size_t ConsistentHashRing::Locate(std::uint64_t hash) const {
+    if (mode_ == Mode::JUMP) {
+        return static_cast<std::size_t>(
+            JumpHash(hash, static_cast<std::int32_t>(members_.size())));
     }
+    const std::size_t bucket = bucket_bits_ == 0 ? 0 : hash >> (64 - bucket_bits_);
+    const auto first = points_.begin() + buckets_[bucket];
+    const auto last = points_.begin() + buckets_[bucket + 1];
+    const auto it = std::lower_bound(first, last, hash);  // 답은 [first, last] 안
+    return it == points_.end() ? 0 : static_cast<std::size_t>(it - points_.begin());
+}
 
-    size_t hash = Hash(key);
-    auto it = ring_.lower_bound(hash);  // hash 이상인 첫 번째 항목
-
-    // 링 끝을 넘어가면 처음으로 돌아감 (원형 링)
-    if (it == ring_.end()) {
-        it = ring_.begin();
+const std::string* ConsistentHashRing::Lookup(std::string_view key) const {
+    if (members_.empty()) {
+        return nullptr;
     }
-
-    return it->second;  // 실제 노드 ID 반환
+    const auto position = Locate(HashKey(key));
+    return &members_[mode_ == Mode::JUMP ? position : owners_[position]];
 }
 
-// [Order 6] GetNodes - 복제용 N개 노드 조회
-// - 키에 대해 담당 노드 + 복제 노드 N개 반환
-// - 고가용성(HA) 구현에 사용
-std::vector<std::string> ConsistentHashRing::GetNodes(
-    const std::string& key, int n) const {
-    std::vector<std::string> result;
-
-    if (ring_.empty() || n <= 0) {
-        return result;
-    }
+std::string ConsistentHashRing::GetNode(const std::string& key) const {
+    const auto* node = Lookup(key);
+    return node ? *node : std::string{};
+}
 
-    // 실제 노드 수보다 많이 요청하면 전체 반환
-    int max_nodes = std::min(n, static_cast<int>(nodes_.size()));
+// [Order 5] ForEachCandidate / GetNodes - 담당 노드 다음 후보들 (페일오버, bounded load)
+// - RING: 시계 방향으로 가상 노드를 따라가며 처음 보는 실제 노드만
+// - JUMP: 담당 버킷부터 번호 순서대로
+void ConsistentHashRing::ForEachCandidate(
+    std::string_view key, const std::function<bool(const std::string& node_id)>& visit) const {
+    ForEachCandidateIndex(key, [&](std::size_t member) { return visit(members_[member]); });
+}
 
-    size_t hash = Hash(key);
-    auto it = ring_.lower_bound(hash);
-    if (it == ring_.end()) {
-        it = ring_.begin();
+void ConsistentHashRing::ForEachCandidateIndex(
+    std::string_view key, const std::function<bool(std::size_t member)>& visit) const {
+    const std::size_t count = members_.size();
+    if (count == 0) {
+        return;
     }
-
-    std::set<std::string> seen;  // 중복 방지 (가상 노드가 같은 실제 노드일 수 있음)
-    auto start_it = it;
-    bool wrapped = false;
-
-    while (static_cast<int>(result.size()) < max_nodes) {
-        if (seen.count(it->second) == 0) {
-            result.push_back(it->second);
-            seen.insert(it->second);
+    const auto position = Locate(HashKey(key));
+    if (mode_ == Mode::JUMP) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (visit((position + i) % count)) {
+                return;
+            }
         }
-
-        ++it;
-        if (it == ring_.end()) {
-            it = ring_.begin();
-            wrapped = true;
+        return;
+    }
+    // 노드 64개까지는 비트마스크, 그 이상은 배열로 중복 방문 방지
+    std::uint64_t seen_mask = 0;
+    std::vector<bool> seen_large(count > 64 ? count : 0);
+    std::size_t distinct = 0;
+    for (std::size_t step = 0; step < points_.size() && distinct < count; ++step) {
+        const auto node = owners_[(position + step) % points_.size()];
+        if (count <= 64) {
+            const auto bit = std::uint64_t{1} << node;
+            if (seen_mask & bit) {
+                continue;
+            }
+            seen_mask |= bit;
+        } else {
+            if (seen_large[node]) {
+                continue;
+            }
+            seen_large[node] = true;
         }
-
-        // 전체 순회 완료 (무한 루프 방지)
-        if (wrapped && it == start_it) {
-            break;
+        ++distinct;
+        if (visit(node)) {
+            return;
         }
     }
+}
 
+std::vector<std::string> ConsistentHashRing::GetNodes(
+    const std::string& key, int n) const {
+    std::vector<std::string> result;
+    if (members_.empty() || n <= 0) {
+        return result;
+    }
+    // 실제 노드 수보다 많이 요청하면 전체 반환
+    const auto max_nodes = std::min<std::size_t>(static_cast<std::size_t>(n), members_.size());
+    result.reserve(max_nodes);
+    ForEachCandidate(key, [&](const std::string& node_id) {
+        result.push_back(node_id);
+        return result.size() >= max_nodes;
+    });
     return result;
 }
 
 size_t ConsistentHashRing::GetNodeCount() const {
-    return nodes_.size();
+    return members_.size();
 }
 
 bool ConsistentHashRing::HasNode(const std::string& node_id) const {
-    return nodes_.count(node_id) > 0;
+    return FindMember(node_id) != members_.size();
 }
 
 std::vector<std::string> ConsistentHashRing::GetAllNodes() const {
-    return std::vector<std::string>(nodes_.begin(), nodes_.end());
+    std::vector<std::string> nodes(members_);
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
 }
 
 std::map<std::string, int> ConsistentHashRing::GetDistribution(
@@ -163,15 +296,14 @@ std::map<std::string, int> ConsistentHashRing::GetDistribution(
     std::map<std::string, int> distribution;
 
     // 모든 노드 초기화
-    for (const auto& node : nodes_) {
+    for (const auto& node : members_) {
         distribution[node] = 0;
     }
 
     // 키별 분배 계산
     for (const auto& key : keys) {
-        std::string node = GetNode(key);
-        if (!node.empty()) {
-            ++distribution[node];
+        if (const auto* node = Lookup(key)) {
+            ++distribution[*node];
         }
     }
 
@@ -195,11 +327,16 @@ std::map<std::string, int> ConsistentHashRing::GetDistribution(
 //    - 부하 균등화 향상: 노드 간 편차 감소
 //    - 트레이드오프: 메모리 사용량 증가
 //
-// 3. FNV-1a 해시
-//    - Fast, Non-cryptographic, Varied: 빠르고 분포 좋은 해시
-//    - 게임 서버에서는 MurmurHash3도 많이 사용
+// 3. 키 해시 (HashKey)
+//    - 8바이트 단위 곱셈/회전 + MurmurHash3 fmix64 최종 혼합 (비암호화)
+//    - 예전 FNV-1a(바이트 단위)와 값이 다르므로 모든 노드가 같은 버전이어야 같은 배치
 //    - SHA/MD5 같은 암호화 해시보다 10-100배 빠름
 //
+// 4. 평면 링 vs Jump Consistent Hash
+//    - 평면 링: 정렬 배열 + 상위 비트 구간표, 노드 150개 × 가상 150개 = 22500칸 (해시 180KB)
+//    - Jump: 메모리 없음, 균등 분포, 단 버킷은 번호라서 중간 노드 제거 시 이동이 큼
+//      → 노드가 번호로 관리되고 끝에서만 늘고 주는 구성(샤드 풀)에 적합
+//
 // 관련 설계 문서:
 // - design/v2.0.0-session-store.md (분산 세션)
 // - design/v2.0.1-load-balancer.md (로드 밸런싱)
@@ -0,0 +1,988 @@
+// [FILE]
+// - 목적: SWIM 가십 멤버십 (Redis 없는 서버 발견/장애 감지)
+// - 주요 역할: UDP ping/ack로 생존 확인, 멤버 변경과 부하를 메시지에 얹어 전파
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템
+// - 권장 읽는 순서: Register → Tick → OnAckTimeout → HandleDatagram → Apply
+//
+// [LEARN] 하트비트 + TTL 방식의 한계:
+//         - 장애 감지 시간 = TTL (15초). 줄이면 하트비트 트래픽이 N에 비례해 늘고 저장소가 병목.
+//         SWIM (Das 외, 2002):
+//         - 각 노드가 주기마다 멤버 "하나"에만 ping → 노드당 부하가 N과 무관
+//         - ack가 없으면 k명에게 대신 ping을 부탁 (내 쪽 네트워크 문제로 오판하지 않게)
+//         - 그래도 없으면 바로 죽었다고 하지 않고 SUSPECT → 본인이 들으면 incarnation을 올려 반박
+//         - 변경은 별도 방송 없이 ping/ack에 얹어 감염(epidemic)처럼 퍼짐: O(log N) 주기 안에 전체 도달
+
+#include "pvpserver/distributed/gossip_membership.h"
+
+#include <boost/asio/post.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+
+namespace pvpserver {
+namespace distributed {
+
+namespace {
+
+constexpr std::uint16_t kMagic = 0x5357;  // "SW"
+constexpr std::uint8_t kVersion = 1;
+
+enum MessageType : std::uint8_t {
+    PING = 1,
+    ACK = 2,
+    PING_REQ = 3,  // target에게 대신 ping 해 달라
+    JOIN = 4,      // 전체 멤버 목록 요청
+    SYNC = 5,      // JOIN 응답 (멤버 목록)
+    GOSSIP = 6     // 업데이트만 (LEFT 알림)
+};
+
+// [Order 1] 직렬화 - packet_types.cpp와 같은 Big-Endian 헬퍼
+void WriteUint8(std::vector<std::uint8_t>& buffer, std::uint8_t value) {
+    buffer.push_back(value);
+}
+
+void WriteUint16BE(std::vector<std::uint8_t>& buffer, std::uint16_t value) {
+    buffer.push_back(static_cast<std::uint8_t>((value >> 8) & 0xFF));
+    buffer.push_back(static_cast<std::uint8_t>(value & 0xFF));
+}
+
+void WriteUint32BE(std::vector<std::uint8_t>& buffer, std::uint32_t value) {
+    buffer.push_back(static_cast<std::uint8_t>((value >> 24) & 0xFF));
+    buffer.push_back(static_cast<std::uint8_t>((value >> 16) & 0xFF));
+    buffer.push_back(static_cast<std::uint8_t>((value >> 8) & 0xFF));
+    buffer.push_back(static_cast<std::uint8_t>(value & 0xFF));
+}
+
+void WriteFloat(std::vector<std::uint8_t>& buffer, float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteUint32BE(buffer, bits);
+}
+
+void WriteString(std::vector<std::uint8_t>& buffer, const std::string& str) {
+    const auto len = static_cast<std::uint8_t>(std::min<std::size_t>(str.size(), 255));
+    WriteUint8(buffer, len);
+    buffer.insert(buffer.end(), str.begin(), str.begin() + len);
+}
+
+std::uint8_t ReadUint8(const std::uint8_t* data, std::size_t size, std::size_t& offset) {
+    if (offset >= size) throw std::runtime_error("Buffer underflow");
+    return data[offset++];
+}
+
+std::uint16_t ReadUint16BE(const std::uint8_t* data, std::size_t size, std::size_t& offset) {
+    if (offset + 2 > size) throw std::runtime_error("Buffer underflow");
+    const auto value = static_cast<std::uint16_t>((data[offset] << 8) | data[offset + 1]);
+    offset += 2;
+    return value;
+}
+
+std::uint32_t ReadUint32BE(const std::uint8_t* data, std::size_t size, std::size_t& offset) {
+    if (offset + 4 > size) throw std::runtime_error("Buffer underflow");
+    const std::uint32_t value = (static_cast<std::uint32_t>(data[offset]) << 24) |
+                                (static_cast<std::uint32_t>(data[offset + 1]) << 16) |
+                                (static_cast<std::uint32_t>(data[offset + 2]) << 8) |
+                                static_cast<std::uint32_t>(data[offset + 3]);
+    offset += 4;
+    return value;
+}
+
+float ReadFloat(const std::uint8_t* data, std::size_t size, std::size_t& offset) {
+    const std::uint32_t bits = ReadUint32BE(data, size, offset);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::string ReadString(const std::uint8_t* data, std::size_t size, std::size_t& offset) {
+    const std::uint8_t len = ReadUint8(data, size, offset);
+    if (offset + len > size) throw std::runtime_error("Buffer underflow");
+    std::string str(reinterpret_cast<const char*>(data + offset), len);
+    offset += len;
+    return str;
+}
+
+// 멤버 레코드: ID, 가십 주소, 상태, 버전, 게임 주소, 부하
+void WriteMember(std::vector<std::uint8_t>& buffer, const GossipMember& member) {
+    WriteString(buffer, member.info.server_id);
+    WriteString(buffer, member.gossip_host);
+    WriteUint16BE(buffer, member.gossip_port);
+    WriteUint8(buffer, static_cast<std::uint8_t>(member.state));
+    WriteUint32BE(buffer, member.incarnation);
+    WriteUint32BE(buffer, member.load_seq);
+    WriteString(buffer, member.info.host);
+    WriteUint16BE(buffer, static_cast<std::uint16_t>(member.info.udp_port));
+    WriteUint16BE(buffer, static_cast<std::uint16_t>(member.info.grpc_port));
+    WriteUint32BE(buffer, static_cast<std::uint32_t>(member.info.max_connections));
+    WriteUint32BE(buffer, static_cast<std::uint32_t>(member.info.current_connections));
+    WriteFloat(buffer, static_cast<float>(member.info.tick_p99_ms));
+    WriteFloat(buffer, static_cast<float>(member.info.cpu_utilization));
+    WriteString(buffer, member.info.region);
+}
+
+// WriteMember가 쓰는 바이트 수 (문자열 4개 + 고정 31바이트)
+std::size_t MemberSize(const GossipMember& member) {
+    const auto string_size = [](const std::string& str) {
+        return 1 + std::min<std::size_t>(str.size(), 255);
+    };
+    return string_size(member.info.server_id) + string_size(member.gossip_host) +
+           string_size(member.info.host) + string_size(member.info.region) + 31;
+}
+
+GossipMember ReadMember(const std::uint8_t* data, std::size_t size, std::size_t& offset) {
+    GossipMember member;
+    member.info.server_id = ReadString(data, size, offset);
+    member.gossip_host = ReadString(data, size, offset);
+    member.gossip_port = ReadUint16BE(data, size, offset);
+    const auto state = ReadUint8(data, size, offset);
+    if (state > static_cast<std::uint8_t>(MemberState::LEFT)) {
+        throw std::runtime_error("Invalid member state");
+    }
+    member.state = static_cast<MemberState>(state);
+    member.incarnation = ReadUint32BE(data, size, offset);
+    member.load_seq = ReadUint32BE(data, size, offset);
+    member.info.host = ReadString(data, size, offset);
+    member.info.udp_port = ReadUint16BE(data, size, offset);
+    member.info.grpc_port = ReadUint16BE(data, size, offset);
+    member.info.max_connections = static_cast<int>(ReadUint32BE(data, size, offset));
+    member.info.current_connections = static_cast<int>(ReadUint32BE(data, size, offset));
+    member.info.tick_p99_ms = ReadFloat(data, size, offset);
+    member.info.cpu_utilization = ReadFloat(data, size, offset);
+    member.info.region = ReadString(data, size, offset);
+    member.info.healthy = member.state == MemberState::ALIVE;
+    return member;
+}
+
+bool IsGone(MemberState state) {
+    return state == MemberState::DEAD || state == MemberState::LEFT;
+}
+
+const char* StateName(MemberState state) {
+    switch (state) {
+        case MemberState::ALIVE:
+            return "alive";
+        case MemberState::SUSPECT:
+            return "suspect";
+        case MemberState::DEAD:
+            return "dead";
+        case MemberState::LEFT:
+            return "left";
+    }
+    return "unknown";
+}
+
+std::int64_t NowMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace
+
+// [Order 2] 생성/시작/중지 - io 스레드 하나 (RedisClient의 자체 io_context와 같은 구성)
+GossipMembership::GossipMembership(GossipOptions options, std::shared_ptr<LoadBalancer> balancer)
+    : options_(std::move(options)),
+      balancer_(std::move(balancer)),
+      socket_(io_context_),
+      tick_timer_(io_context_),
+      ack_timer_(io_context_) {}
+
+GossipMembership::~GossipMembership() {
+    Stop();
+}
+
+void GossipMembership::Register(const ServerInfo& self) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            return;
+        }
+        const auto address = boost::asio::ip::make_address(options_.bind_address);
+        socket_.open(address.is_v6() ? udp::v6() : udp::v4());
+        socket_.bind(udp::endpoint(address, options_.port));
+
+        self_.info = self;
+        self_.info.healthy = true;
+        self_.info.last_heartbeat = NowMillis();
+        if (!options_.advertise_host.empty()) {
+            self_.gossip_host = options_.advertise_host;
+        } else if (address.is_unspecified()) {
+            self_.gossip_host = self.host;  // 0.0.0.0을 알리면 아무도 연락할 수 없음
+        } else {
+            self_.gossip_host = options_.bind_address;
+        }
+        self_.gossip_port = socket_.local_endpoint().port();
+        self_.state = MemberState::ALIVE;
+        running_ = true;
+    }
+    if (balancer_) {
+        balancer_->RegisterServer(self);
+    }
+
+    work_guard_ = std::make_unique<
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+        io_context_.get_executor());
+    boost::asio::post(io_context_, [this] {
+        StartReceive();
+        ScheduleTick();
+    });
+    io_thread_ = std::thread([this] { io_context_.run(); });
+}
+
+void GossipMembership::Join(const std::vector<std::string>& seeds) {
+    std::vector<udp::endpoint> endpoints;
+    for (const auto& seed : seeds) {
+        const auto colon = seed.rfind(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        boost::system::error_code ec;
+        const auto address = boost::asio::ip::make_address(seed.substr(0, colon), ec);
+        if (ec) {
+            continue;
+        }
+        endpoints.emplace_back(address,
+                               static_cast<std::uint16_t>(std::stoi(seed.substr(colon + 1))));
+    }
+
+    std::vector<std::uint8_t> payload;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        seeds_ = endpoints;
+        payload = Encode(JOIN, next_seq_++, "", {});
+    }
+    boost::asio::post(io_context_, [this, endpoints, payload] {
+        for (const auto& endpoint : endpoints) {
+            Send(endpoint, payload);
+        }
+    });
+}
+
+// Unregister - LEFT를 아는 멤버 모두에게 직접 알린 뒤 중지 (감지 시간 없이 바로 빠짐)
+void GossipMembership::Unregister() {
+    std::vector<udp::endpoint> targets;
+    std::vector<std::uint8_t> payload;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        self_.state = MemberState::LEFT;
+        ++self_.incarnation;
+        for (const auto& [id, entry] : members_) {
+            if (!IsGone(entry.member.state)) {
+                targets.push_back(entry.endpoint);
+            }
+        }
+        payload = Encode(GOSSIP, next_seq_++, "", {});
+    }
+
+    // 소켓은 io 스레드만 만지므로 전송도 io 스레드에서, 끝날 때까지 대기
+    auto sent = std::make_shared<std::promise<void>>();
+    auto done = sent->get_future();
+    boost::asio::post(io_context_, [this, sent, targets = std::move(targets),
+                                    payload = std::move(payload)] {
+        for (const auto& target : targets) {
+            boost::system::error_code ec;
+            socket_.send_to(boost::asio::buffer(payload), target, 0, ec);
+        }
+        sent->set_value();
+    });
+    done.wait_for(std::chrono::seconds(1));
+    Stop();
+}
+
+void GossipMembership::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    if (!io_thread_.joinable()) {
+        return;
+    }
+    boost::asio::post(io_context_, [this] {
+        boost::system::error_code ec;
+        tick_timer_.cancel();
+        ack_timer_.cancel();
+        socket_.close(ec);
+    });
+    work_guard_.reset();
+    io_thread_.join();
+}
+
+std::uint16_t GossipMembership::Port() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return self_.gossip_port;
+}
+
+// UpdateServerInfo - 부하 갱신: load_seq만 올리고 전파 (멤버십 변경보다 뒤 순위)
+void GossipMembership::UpdateServerInfo(const ServerInfo& info) {
+    std::vector<Event> events;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto id = self_.info.server_id;
+        self_.info = info;
+        self_.info.server_id = id;
+        self_.info.healthy = true;
+        ++self_.load_seq;
+        Enqueue(SelfRecord(), true);
+        events.push_back({EventKind::LOAD, self_.info});
+    }
+    Dispatch(events);
+}
+
+// [Order 3] Tick - 프로토콜 주기 하나
+// 1. 지난 주기 ping이 (간접 포함) 응답 없었으면 SUSPECT
+// 2. 의심 시간이 지난 SUSPECT → DEAD, 오래된 DEAD/LEFT 정리
+// 3. 다음 멤버에게 ping, ack_timeout 뒤에 간접 ping 여부 판단
+void GossipMembership::ScheduleTick() {
+    tick_timer_.expires_after(options_.protocol_period);
+    tick_timer_.async_wait([this](const boost::system::error_code& ec) {
+        if (!ec) {
+            Tick();
+        }
+    });
+}
+
+void GossipMembership::Tick() {
+    std::vector<Event> events;
+    std::vector<std::pair<udp::endpoint, std::vector<std::uint8_t>>> outgoing;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        const auto now = Clock::now();
+        self_.info.last_heartbeat = NowMillis();
+
+        if (!probe_.acked) {
+            auto it = members_.find(probe_.target);
+            if (it != members_.end() && it->second.member.state == MemberState::ALIVE) {
+                ++suspicions_;
+                SetState(it->second, MemberState::SUSPECT, events);
+                Enqueue(it->second.member, false);
+            }
+            probe_.acked = true;
+        }
+
+        const auto suspicion_timeout = options_.protocol_period * options_.suspicion_periods;
+        for (auto it = members_.begin(); it != members_.end();) {
+            auto& entry = it->second;
+            const auto age = now - entry.state_since;
+            if (entry.member.state == MemberState::SUSPECT && age >= suspicion_timeout) {
+                ++failures_detected_;
+                SetState(entry, MemberState::DEAD, events);
+                Enqueue(entry.member, false);
+            } else if (IsGone(entry.member.state) && age >= options_.dead_reap_after) {
+                if (entry.member.state == MemberState::DEAD) {
+                    events.push_back({EventKind::REAPED, entry.member.info});
+                }
+                it = members_.erase(it);
+                continue;
+            }
+            ++it;
+        }
+        for (auto it = relays_.begin(); it != relays_.end();) {
+            it = it->second.expires <= now ? relays_.erase(it) : std::next(it);
+        }
+
+        // 아직 아무도 모르면 시드에 JOIN 재시도 (UDP 유실 대비)
+        if (members_.empty() && !seeds_.empty()) {
+            const auto payload = Encode(JOIN, next_seq_++, "", {});
+            for (const auto& seed : seeds_) {
+                outgoing.emplace_back(seed, payload);
+            }
+        }
+
+        const auto target = NextProbeTarget();
+        if (!target.empty()) {
+            probe_ = {target, next_seq_++, false};
+            outgoing.emplace_back(members_.at(target).endpoint,
+                                  Encode(PING, probe_.seq, "", {}));
+            const auto seq = probe_.seq;
+            ack_timer_.expires_after(options_.ack_timeout);
+            ack_timer_.async_wait([this, seq](const boost::system::error_code& ec) {
+                if (!ec) {
+                    OnAckTimeout(seq);
+                }
+            });
+        }
+    }
+    for (auto& [endpoint, payload] : outgoing) {
+        Send(endpoint, std::move(payload));
+    }
+    Dispatch(events);
+    ScheduleTick();
+}
+
+// OnAckTimeout - 직접 ack가 없으면 k명에게 PING_REQ (주기 끝까지 간접 ack를 기다림)
+void GossipMembership::OnAckTimeout(std::uint32_t seq) {
+    std::vector<std::pair<udp::endpoint, std::vector<std::uint8_t>>> outgoing;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_ || probe_.seq != seq || probe_.acked) {
+            return;
+        }
+        auto helpers = ProbeCandidates(probe_.target);
+        if (helpers.size() > static_cast<std::size_t>(options_.indirect_checks)) {
+            helpers.resize(static_cast<std::size_t>(options_.indirect_checks));
+        }
+        for (const auto& helper : helpers) {
+            ++indirect_probes_;
+            outgoing.emplace_back(members_.at(helper).endpoint,
+                                  Encode(PING_REQ, seq, probe_.target, {}));
+        }
+    }
+    for (auto& [endpoint, payload] : outgoing) {
+        Send(endpoint, std::move(payload));
+    }
+}
+
+// [Order 4] 수신 - 헤더, 보낸 노드 레코드, 타입별 필드, 얹힌 업데이트
+void GossipMembership::StartReceive() {
+    socket_.async_receive_from(
+        boost::asio::buffer(recv_buffer_), recv_from_,
+        [this](const boost::system::error_code& ec, std::size_t bytes) {
+            if (ec == boost::asio::error::operation_aborted || !socket_.is_open()) {
+                return;
+            }
+            if (!ec) {
+                HandleDatagram(bytes, recv_from_);
+            }
+            StartReceive();
+        });
+}
+
+void GossipMembership::HandleDatagram(std::size_t bytes, const udp::endpoint& from) {
+    std::uint8_t type = 0;
+    std::uint32_t seq = 0;
+    std::string target;
+    GossipMember sender;
+    std::vector<GossipMember> updates;
+    try {
+        const std::uint8_t* data = recv_buffer_.data();
+        std::size_t offset = 0;
+        if (ReadUint16BE(data, bytes, offset) != kMagic || ReadUint8(data, bytes, offset) != kVersion) {
+            throw std::runtime_error("Not a gossip message");
+        }
+        type = ReadUint8(data, bytes, offset);
+        seq = ReadUint32BE(data, bytes, offset);
+        sender = ReadMember(data, bytes, offset);
+        if (type == PING_REQ) {
+            target = ReadString(data, bytes, offset);
+        }
+        const auto count = ReadUint8(data, bytes, offset);
+        for (std::uint8_t i = 0; i < count; ++i) {
+            updates.push_back(ReadMember(data, bytes, offset));
+        }
+    } catch (const std::exception&) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++decode_errors_;
+        return;
+    }
+
+    std::vector<Event> events;
+    std::vector<std::pair<udp::endpoint, std::vector<std::uint8_t>>> outgoing;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        ++messages_received_;
+        Apply(sender, &from, events);
+        for (const auto& update : updates) {
+            Apply(update, nullptr, events);
+        }
+
+        switch (type) {
+            case PING:
+                outgoing.emplace_back(from, Encode(ACK, seq, "", {}));
+                break;
+            case ACK:
+                if (seq == probe_.seq) {
+                    probe_.acked = true;
+                } else if (auto relay = relays_.find(seq); relay != relays_.end()) {
+                    // 간접 ping 응답 → 부탁한 노드에게 그 노드의 seq로 전달
+                    outgoing.emplace_back(relay->second.requester,
+                                          Encode(ACK, relay->second.requester_seq, "", {}));
+                    relays_.erase(relay);
+                }
+                break;
+            case PING_REQ:
+                if (auto it = members_.find(target); it != members_.end()) {
+                    const auto relay_seq = next_seq_++;
+                    relays_[relay_seq] = {from, seq, Clock::now() + options_.protocol_period};
+                    outgoing.emplace_back(it->second.endpoint, Encode(PING, relay_seq, "", {}));
+                }
+                break;
+            case JOIN: {
+                std::vector<GossipMember> known;
+                for (const auto& [id, entry] : members_) {
+                    if (!IsGone(entry.member.state) && id != sender.info.server_id) {
+                        known.push_back(entry.member);
+                    }
+                }
+                // 자신은 보낸 노드 레코드로 가므로 빈 목록이어도 한 번은 응답
+                // 패킷마다 수신 버퍼(kMaxDatagramSize)에 들어가는 만큼만 싣고 나머지는 다음 패킷으로
+                std::size_t index = 0;
+                do {
+                    outgoing.emplace_back(from, Encode(SYNC, seq, "", known, &index));
+                } while (index < known.size());
+                break;
+            }
+            default:
+                break;  // SYNC/GOSSIP: 업데이트 적용만
+        }
+    }
+    for (auto& [endpoint, payload] : outgoing) {
+        Send(endpoint, std::move(payload));
+    }
+    Dispatch(events);
+}
+
+void GossipMembership::Send(const udp::endpoint& to, std::vector<std::uint8_t> payload) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++messages_sent_;
+    }
+    auto buffer = std::make_shared<std::vector<std::uint8_t>>(std::move(payload));
+    socket_.async_send_to(boost::asio::buffer(*buffer), to,
+                          [buffer](const boost::system::error_code&, std::size_t) {});
+}
+
+// [Order 5] Encode - 남는 자리를 전파 대기 업데이트로 채움
+// [LEARN] 업데이트마다 λ·log N번만 보내면 감염 전파로 거의 모든 노드에 도달 (SWIM §4.1)
+//         멤버십 변경(장애/가입)이 부하 갱신보다 먼저 실리도록 정렬
+//         레코드는 가변 길이(문자열 4개)라 개수가 아니라 바이트로 상한을 건다.
+std::vector<std::uint8_t> GossipMembership::Encode(std::uint8_t type, std::uint32_t seq,
+                                                   const std::string& target,
+                                                   const std::vector<GossipMember>& body,
+                                                   std::size_t* body_index) {
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(512);
+    WriteUint16BE(buffer, kMagic);
+    WriteUint8(buffer, kVersion);
+    WriteUint8(buffer, type);
+    WriteUint32BE(buffer, seq);
+    WriteMember(buffer, SelfRecord());
+    if (type == PING_REQ) {
+        WriteString(buffer, target);
+    }
+
+    const std::size_t count_offset = buffer.size();
+    WriteUint8(buffer, 0);  // 레코드 수 (아래에서 채움)
+    std::size_t count = 0;
+    const auto fits = [&buffer](const GossipMember& member) {
+        return buffer.size() + MemberSize(member) <= kMaxDatagramSize;
+    };
+
+    std::size_t index = body_index ? *body_index : 0;
+    for (; index < body.size() && count < 255 && fits(body[index]); ++index, ++count) {
+        WriteMember(buffer, body[index]);
+    }
+    if (body_index) {
+        // 한 레코드만으로 한도를 넘으면 건너뜀 (무한 반복 방지)
+        *body_index = index == *body_index ? index + 1 : index;
+    }
+
+    std::stable_sort(broadcasts_.begin(), broadcasts_.end(),
+                     [](const Broadcast& a, const Broadcast& b) {
+                         if (a.load_only != b.load_only) {
+                             return !a.load_only;
+                         }
+                         return a.transmits < b.transmits;
+                     });
+    const std::size_t room = count >= options_.max_piggyback ? 0 : options_.max_piggyback - count;
+    const std::size_t piggyback = std::min(room, broadcasts_.size());
+    for (std::size_t i = 0; i < piggyback && fits(broadcasts_[i].member); ++i, ++count) {
+        WriteMember(buffer, broadcasts_[i].member);
+        ++broadcasts_[i].transmits;
+    }
+    buffer[count_offset] = static_cast<std::uint8_t>(count);
+
+    const auto limit = static_cast<int>(RetransmitLimit());
+    broadcasts_.erase(std::remove_if(broadcasts_.begin(), broadcasts_.end(),
+                                     [limit](const Broadcast& b) { return b.transmits >= limit; }),
+                      broadcasts_.end());
+    return buffer;
+}
+
+// [Order 6] Apply - SWIM 병합 규칙 (incarnation이 높을수록, 같으면 SUSPECT > ALIVE)
+// - ALIVE(i)  : 현재 incarnation < i 이면 적용 (DEAD/LEFT에서의 재가입 포함)
+// - SUSPECT(i): 현재 ALIVE(≤ i) 또는 SUSPECT(< i) 이면 적용
+// - DEAD/LEFT : 아직 살아 있는 것으로 알고 있으면 적용
+// - 같은 상태·incarnation에서 load_seq가 크면 부하만 갱신
+void GossipMembership::Apply(const GossipMember& update, const udp::endpoint* from,
+                             std::vector<Event>& events) {
+    const auto& id = update.info.server_id;
+    if (id.empty()) {
+        return;
+    }
+    if (id == self_.info.server_id) {
+        // 나에 대한 의심/사망 소문 → incarnation을 올려 반박
+        if (self_.state == MemberState::ALIVE && update.state != MemberState::ALIVE &&
+            update.incarnation >= self_.incarnation) {
+            self_.incarnation = update.incarnation + 1;
+            ++refutations_;
+            Enqueue(SelfRecord(), false);
+        }
+        return;
+    }
+
+    udp::endpoint endpoint;
+    if (from) {
+        endpoint = *from;
+    } else {
+        boost::system::error_code ec;
+        endpoint = udp::endpoint(boost::asio::ip::make_address(update.gossip_host, ec),
+                                 update.gossip_port);
+        if (ec) {
+            return;
+        }
+    }
+
+    auto it = members_.find(id);
+    if (it == members_.end()) {
+        if (IsGone(update.state)) {
+            return;  // 모르는 노드의 사망 소식은 무시
+        }
+        MemberEntry entry{update, endpoint, Clock::now()};
+        entry.member.info.healthy = update.state == MemberState::ALIVE;
+        events.push_back({EventKind::ADDED, entry.member.info});
+        if (update.state == MemberState::SUSPECT) {
+            events.push_back({EventKind::SUSPECT, entry.member.info});
+        }
+        members_.emplace(id, std::move(entry));
+        // 새 멤버는 순회 목록의 임의 위치에 (다음 바퀴를 기다리지 않게)
+        std::uniform_int_distribution<std::size_t> pick(0, probe_order_.size());
+        probe_order_.insert(probe_order_.begin() + static_cast<std::ptrdiff_t>(pick(rng_)), id);
+        Enqueue(update, false);
+        return;
+    }
+
+    auto& entry = it->second;
+    const auto& current = entry.member;
+    bool newer = false;
+    switch (update.state) {
+        case MemberState::ALIVE:
+            newer = update.incarnation > current.incarnation;
+            break;
+        case MemberState::SUSPECT:
+            newer = (current.state == MemberState::ALIVE && update.incarnation >= current.incarnation) ||
+                    (current.state == MemberState::SUSPECT && update.incarnation > current.incarnation);
+            break;
+        case MemberState::DEAD:
+        case MemberState::LEFT:
+            newer = !IsGone(current.state);
+            break;
+    }
+
+    if (newer) {
+        const auto previous = current.state;
+        entry.member.info = update.info;
+        entry.member.incarnation = update.incarnation;
+        entry.member.load_seq = update.load_seq;
+        entry.member.gossip_host = update.gossip_host;
+        entry.member.gossip_port = update.gossip_port;
+        entry.endpoint = endpoint;
+        if (update.state == MemberState::ALIVE && IsGone(previous)) {
+            // 재가입: 로드 밸런서에 다시 등록
+            entry.member.state = MemberState::ALIVE;
+            entry.state_since = Clock::now();
+            events.push_back({EventKind::ADDED, entry.member.info});
+            if (std::find(probe_order_.begin(), probe_order_.end(), id) == probe_order_.end()) {
+                probe_order_.push_back(id);
+            }
+        } else {
+            SetState(entry, update.state, events);
+            if (update.state == MemberState::ALIVE) {
+                events.push_back({EventKind::LOAD, entry.member.info});
+            }
+        }
+        Enqueue(entry.member, false);
+        return;
+    }
+
+    // 우리가 의심/사망으로 아는 노드가 직접 말을 걸면 그 소문을 답장에 실어 반박 기회를 줌
+    if (from && current.state != MemberState::ALIVE && update.state == MemberState::ALIVE) {
+        Enqueue(current, false);
+        return;
+    }
+
+    if (update.state == current.state && update.incarnation == current.incarnation &&
+        update.load_seq > current.load_seq) {
+        entry.member.info = update.info;
+        entry.member.load_seq = update.load_seq;
+        events.push_back({EventKind::LOAD, entry.member.info});
+        Enqueue(entry.member, true);
+    }
+}
+
+void GossipMembership::SetState(MemberEntry& entry, MemberState state, std::vector<Event>& events) {
+    if (entry.member.state == state) {
+        return;
+    }
+    entry.member.state = state;
+    entry.member.info.healthy = state == MemberState::ALIVE;
+    entry.state_since = Clock::now();
+    switch (state) {
+        case MemberState::ALIVE:
+            events.push_back({EventKind::ALIVE, entry.member.info});
+            break;
+        case MemberState::SUSPECT:
+            events.push_back({EventKind::SUSPECT, entry.member.info});
+            break;
+        case MemberState::DEAD:
+            events.push_back({EventKind::DEAD, entry.member.info});
+            break;
+        case MemberState::LEFT:
+            events.push_back({EventKind::LEFT, entry.member.info});
+            break;
+    }
+}
+
+// 같은 노드의 이전 업데이트는 새 것으로 교체 (전송 횟수 초기화)
+void GossipMembership::Enqueue(const GossipMember& member, bool load_only) {
+    auto it = std::find_if(broadcasts_.begin(), broadcasts_.end(), [&](const Broadcast& b) {
+        return b.member.info.server_id == member.info.server_id;
+    });
+    if (it != broadcasts_.end()) {
+        // 대기 중인 멤버십 변경을 부하 갱신이 밀어내지 않게
+        it->load_only = it->load_only && load_only;
+        it->member = member;
+        it->transmits = 0;
+        return;
+    }
+    broadcasts_.push_back({member, 0, load_only});
+}
+
+GossipMember GossipMembership::SelfRecord() const {
+    return self_;
+}
+
+// 간접 ping을 부탁할 후보: 살아 있는 멤버 중 무작위
+std::vector<std::string> GossipMembership::ProbeCandidates(const std::string& exclude) {
+    std::vector<std::string> candidates;
+    for (const auto& [id, entry] : members_) {
+        if (id != exclude && entry.member.state == MemberState::ALIVE) {
+            candidates.push_back(id);
+        }
+    }
+    std::shuffle(candidates.begin(), candidates.end(), rng_);
+    return candidates;
+}
+
+// 섞은 순서로 한 바퀴씩 돌아 모든 멤버가 N주기 안에 한 번은 ping을 받게 (SWIM §4.3)
+std::string GossipMembership::NextProbeTarget() {
+    for (std::size_t attempts = 0; attempts <= probe_order_.size(); ++attempts) {
+        if (probe_index_ >= probe_order_.size()) {
+            probe_order_.clear();
+            for (const auto& [id, entry] : members_) {
+                if (!IsGone(entry.member.state)) {
+                    probe_order_.push_back(id);
+                }
+            }
+            std::shuffle(probe_order_.begin(), probe_order_.end(), rng_);
+            probe_index_ = 0;
+            if (probe_order_.empty()) {
+                return "";
+            }
+        }
+        const auto& id = probe_order_[probe_index_++];
+        auto it = members_.find(id);
+        if (it != members_.end() && !IsGone(it->second.member.state)) {
+            return id;
+        }
+    }
+    return "";
+}
+
+std::size_t GossipMembership::RetransmitLimit() const {
+    const double nodes = static_cast<double>(members_.size() + 1);
+    return static_cast<std::size_t>(options_.retransmit_multiplier) *
+           static_cast<std::size_t>(std::ceil(std::log2(nodes + 1.0)));
+}
+
+// [Order 7] Dispatch - 잠금 밖에서 로드 밸런서/콜백 반영 (io 스레드)
+void GossipMembership::Dispatch(const std::vector<Event>& events) {
+    if (events.empty()) {
+        return;
+    }
+    std::function<void(const ServerInfo&)> on_server_added;
+    std::function<void(const std::string&)> on_server_removed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        on_server_added = on_server_added_;
+        on_server_removed = on_server_removed_;
+    }
+    for (const auto& event : events) {
+        const auto& info = event.info;
+        switch (event.kind) {
+            case EventKind::ADDED:
+                if (balancer_) {
+                    balancer_->RegisterServer(info);
+                }
+                if (on_server_added) {
+                    on_server_added(info);
+                }
+                break;
+            case EventKind::ALIVE:
+                if (balancer_) {
+                    balancer_->MarkServerHealthy(info.server_id, true);
+                }
+                break;
+            case EventKind::SUSPECT:
+                // 의심 중에는 새 배치만 피함 (반박되면 바로 복귀)
+                if (balancer_) {
+                    balancer_->MarkServerHealthy(info.server_id, false);
+                }
+                break;
+            case EventKind::DEAD:
+                if (balancer_) {
+                    balancer_->MarkServerHealthy(info.server_id, false);
+                }
+                if (on_server_removed) {
+                    on_server_removed(info.server_id);
+                }
+                break;
+            case EventKind::LEFT:
+                if (balancer_) {
+                    balancer_->UnregisterServer(info.server_id);
+                }
+                if (on_server_removed) {
+                    on_server_removed(info.server_id);
+                }
+                break;
+            case EventKind::REAPED:
+                if (balancer_) {
+                    balancer_->UnregisterServer(info.server_id);
+                }
+                break;
+            case EventKind::LOAD:
+                if (balancer_) {
+                    balancer_->UpdateServerMetrics(info.server_id, info.current_connections,
+                                                   info.tick_p99_ms, info.cpu_utilization);
+                }
+                break;
+        }
+    }
+}
+
+// [Order 8] 조회 - ServiceDiscovery와 같은 모양
+std::vector<ServerInfo> GossipMembership::GetAvailableServers() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<ServerInfo> servers;
+    if (running_) {
+        servers.push_back(self_.info);
+    }
+    for (const auto& [id, entry] : members_) {
+        if (entry.member.state == MemberState::ALIVE) {
+            servers.push_back(entry.member.info);
+        }
+    }
+    return servers;
+}
+
+std::optional<ServerInfo> GossipMembership::GetServer(const std::string& server_id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (server_id == self_.info.server_id) {
+        return self_.info;
+    }
+    auto it = members_.find(server_id);
+    if (it == members_.end() || IsGone(it->second.member.state)) {
+        return std::nullopt;
+    }
+    return it->second.member.info;
+}
+
+std::optional<MemberState> GossipMembership::GetState(const std::string& server_id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = members_.find(server_id);
+    if (it == members_.end()) {
+        return std::nullopt;
+    }
+    return it->second.member.state;
+}
+
+std::vector<GossipMember> GossipMembership::Members() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<GossipMember> result;
+    result.reserve(members_.size());
+    for (const auto& [id, entry] : members_) {
+        result.push_back(entry.member);
+    }
+    return result;
+}
+
+void GossipMembership::OnServerAdded(std::function<void(const ServerInfo&)> callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_server_added_ = std::move(callback);
+}
+
+void GossipMembership::OnServerRemoved(std::function<void(const std::string&)> callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_server_removed_ = std::move(callback);
+}
+
+std::string GossipMembership::MetricsSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t counts[4] = {0, 0, 0, 0};
+    for (const auto& [id, entry] : members_) {
+        ++counts[static_cast<std::size_t>(entry.member.state)];
+    }
+
+    std::ostringstream oss;
+    oss << "# TYPE gossip_members gauge\n";
+    for (std::size_t state = 0; state < 4; ++state) {
+        oss << "gossip_members{state=\"" << StateName(static_cast<MemberState>(state)) << "\"} "
+            << counts[state] << "\n";
+    }
+    oss << "# TYPE gossip_messages_total counter\n";
+    oss << "gossip_messages_total{direction=\"sent\"} " << messages_sent_ << "\n";
+    oss << "gossip_messages_total{direction=\"received\"} " << messages_received_ << "\n";
+    oss << "# TYPE gossip_decode_errors_total counter\n";
+    oss << "gossip_decode_errors_total " << decode_errors_ << "\n";
+    oss << "# TYPE gossip_indirect_probes_total counter\n";
+    oss << "gossip_indirect_probes_total " << indirect_probes_ << "\n";
+    oss << "# TYPE gossip_suspicions_total counter\n";
+    oss << "gossip_suspicions_total " << suspicions_ << "\n";
+    oss << "# TYPE gossip_failures_detected_total counter\n";
+    oss << "gossip_failures_detected_total " << failures_detected_ << "\n";
+    oss << "# TYPE gossip_refutations_total counter\n";
+    oss << "gossip_refutations_total " << refutations_ << "\n";
+    oss << "# TYPE gossip_pending_broadcasts gauge\n";
+    oss << "gossip_pending_broadcasts " << broadcasts_.size() << "\n";
+    return oss.str();
+}
+
+}  // namespace distributed
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 1. 장애 감지 시간
+//    - 최악: ping 주기(T) + 의심 시간(suspicion_periods × T) ≈ 200ms + 800ms
+//    - 오판을 줄이는 장치: 간접 ping(k명), SUSPECT 단계의 본인 반박
+//
+// 2. incarnation
+//    - 노드 자신만 올리는 번호. 소문끼리 충돌하면 번호가 높은 쪽이 이김
+//    - 같은 번호면 SUSPECT가 ALIVE를 이김 → 반박하려면 번호를 올려야 함
+//
+// 3. 부하 전파
+//    - 보낸 노드 레코드가 메시지마다 실리므로 ping/ack만으로 최신 부하가 오감
+//    - load_seq가 큰 레코드만 적용, 멤버십 변경보다 전파 순위가 낮음
+//
+// 4. 잠금
+//    - 상태는 mutex_ 하나, 네트워크 처리는 io 스레드 하나
+//    - LoadBalancer 반영과 콜백은 잠금 밖(Dispatch)에서 → 콜백이 조회 메서드를 불러도 안전
+//
+// 관련 설계 문서:
+// - design/v2.0.1-load-balancer.md (로드 밸런싱)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/distributed/service_discovery.cpp (Redis 하트비트 방식)
+// - server/src/distributed/load_balancer.cpp (반영 대상)
+// ================================================================================
@@ -0,0 +1,220 @@
+// [FILE]
+// - 목적: 서버 간 서비스 (매치 이전, 노드 간 세션 조회, 부하 보고)
+// - 주요 역할: InterNode 메서드를 RpcServer에 등록, 호출 쪽 래퍼 (ServerInfo.grpc_port로 상대 노드 지정)
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템
+// - 권장 읽는 순서: InterNodeClient::MigrateMatch → InterNodeService::Register
+//
+// [LEARN] 매치 이전(MatchMigrator)은 이전마다 TCP 연결을 새로 맺었고, 세션 조회/부하 보고는
+//         Redis를 거쳐야 했다. 같은 RPC 채널 위에 세 기능을 올리면 노드 쌍마다 연결 하나로
+//         모두 처리되고, 호출별 기한과 메서드별 지연 히스토그램을 공짜로 얻는다.
+
+#include "pvpserver/distributed/inter_node_service.h"
+
+#include "inter_node.pb.h"
+
+#include <iostream>
+#include <utility>
+
+namespace pvpserver {
+namespace distributed {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+RpcStatus Unimplemented(const char* what) {
+    return RpcStatus::Error(RpcCode::UNIMPLEMENTED, std::string(what) + " not served by this node");
+}
+
+}  // namespace
+
+// ---- InterNodeService ----
+
+InterNodeService::InterNodeService(std::string server_id,
+                                   std::shared_ptr<storage::SessionStore> sessions,
+                                   std::shared_ptr<LoadBalancer> balancer,
+                                   MatchMigrationReceiver::ImportHandler import_handler)
+    : server_id_(std::move(server_id)),
+      sessions_(std::move(sessions)),
+      balancer_(std::move(balancer)),
+      import_handler_(std::move(import_handler)) {}
+
+// [Order 2] Register - 메서드별 요청/응답 메시지 변환
+void InterNodeService::Register(RpcServer& server) {
+    server.RegisterMethod<rpc::MatchHandoffRequest, rpc::MatchHandoffResponse>(
+        InterNodeMethods::kHandoffMatch,
+        [this](const rpc::MatchHandoffRequest& request, rpc::MatchHandoffResponse& response) {
+            if (!import_handler_) {
+                return Unimplemented("match handoff");
+            }
+            const std::vector<std::uint8_t> state(request.state().begin(), request.state().end());
+            try {
+                const MigrationTarget target = import_handler_(request.room_id(), state);
+                response.set_host(target.host);
+                response.set_udp_port(target.udp_port);
+            } catch (const std::exception& e) {
+                // 거부는 정상 응답 경로: 원본은 매치를 재개
+                return RpcStatus::Error(RpcCode::UNAVAILABLE, e.what());
+            }
+            return RpcStatus::Ok();
+        });
+
+    server.RegisterMethod<rpc::SessionLookupRequest, rpc::SessionLookupResponse>(
+        InterNodeMethods::kLookupSession,
+        [this](const rpc::SessionLookupRequest& request, rpc::SessionLookupResponse& response) {
+            if (!sessions_) {
+                return Unimplemented("session lookup");
+            }
+            const auto session = sessions_->GetSession(request.session_id());
+            if (!session) {
+                return RpcStatus::Error(RpcCode::NOT_FOUND, "no session on " + server_id_);
+            }
+            response.set_player_id(session->player_id);
+            response.set_player_name(session->player_name);
+            response.set_server_id(session->server_id);
+            response.set_created_at(session->created_at);
+            response.set_last_activity(session->last_activity);
+            response.set_elo_rating(session->elo_rating);
+            response.set_match_id(session->match_id);
+            return RpcStatus::Ok();
+        });
+
+    server.RegisterMethod<rpc::LoadReport, rpc::LoadReportAck>(
+        InterNodeMethods::kReportLoad,
+        [this](const rpc::LoadReport& report, rpc::LoadReportAck& ack) {
+            if (!balancer_) {
+                return Unimplemented("load report");
+            }
+            if (report.server_id().empty()) {
+                return RpcStatus::Error(RpcCode::INVALID_ARGUMENT, "missing server_id");
+            }
+            // 처음 보는 노드는 등록, 아는 노드는 부하만 갱신 (스냅샷 교체 없음)
+            if (!balancer_->GetServer(report.server_id())) {
+                ServerInfo info;
+                info.server_id = report.server_id();
+                info.host = report.host();
+                info.udp_port = static_cast<int>(report.udp_port());
+                info.grpc_port = static_cast<int>(report.rpc_port());
+                info.current_connections = report.current_connections();
+                info.max_connections = report.max_connections();
+                info.tick_p99_ms = report.tick_p99_ms();
+                info.cpu_utilization = report.cpu_utilization();
+                info.region = report.region();
+                balancer_->RegisterServer(info);
+            } else {
+                balancer_->UpdateServerMetrics(report.server_id(), report.current_connections(),
+                                               report.tick_p99_ms(), report.cpu_utilization());
+                balancer_->MarkServerHealthy(report.server_id(), true);
+            }
+            ack.set_server_id(server_id_);
+            return RpcStatus::Ok();
+        });
+}
+
+// ---- InterNodeClient ----
+
+InterNodeClient::InterNodeClient(std::shared_ptr<RpcClient> client, std::string server_id,
+                                 std::chrono::milliseconds timeout)
+    : client_(std::move(client)), server_id_(std::move(server_id)), timeout_(timeout) {}
+
+// [Order 1] MigrateMatch - 정지 → HandoffMatch 호출 → REDIRECT 또는 재개
+MigrationResult InterNodeClient::MigrateMatch(UdpGameServer& source, const std::string& room_id,
+                                              const ServerInfo& target) {
+    MigrationResult result;
+    const auto frozen_at = Clock::now();
+    std::vector<std::uint8_t> bundle;
+    try {
+        bundle = source.FreezeForMigration();
+    } catch (const std::exception& e) {
+        result.error = e.what();
+        return result;
+    }
+    result.state_bytes = bundle.size();
+
+    rpc::MatchHandoffRequest request;
+    request.set_room_id(room_id);
+    request.set_source_server_id(server_id_);
+    request.set_state(bundle.data(), bundle.size());
+    rpc::MatchHandoffResponse response;
+    const RpcStatus status =
+        client_->Call(target.host, static_cast<std::uint16_t>(target.grpc_port),
+                      InterNodeMethods::kHandoffMatch, request, response, timeout_);
+    if (!status.ok()) {
+        source.ResumeAfterMigrationFailure();
+        result.error = std::string(RpcCodeName(status.code)) + ": " + status.message;
+        std::cerr << "Match handoff to " << target.server_id << " failed: " << result.error
+                  << std::endl;
+        return result;
+    }
+
+    result.target = MigrationTarget{response.host(), static_cast<std::uint16_t>(response.udp_port())};
+    source.CompleteMigration(result.target.host, result.target.udp_port);
+    result.pause = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - frozen_at);
+    result.success = true;
+    return result;
+}
+
+RpcStatus InterNodeClient::LookupSession(const ServerInfo& peer, const std::string& session_id,
+                                         std::optional<storage::SessionData>& session) {
+    session.reset();
+    rpc::SessionLookupRequest request;
+    request.set_session_id(session_id);
+    rpc::SessionLookupResponse response;
+    const RpcStatus status =
+        client_->Call(peer.host, static_cast<std::uint16_t>(peer.grpc_port),
+                      InterNodeMethods::kLookupSession, request, response, timeout_);
+    if (!status.ok()) {
+        return status;
+    }
+    storage::SessionData data;
+    data.player_id = response.player_id();
+    data.player_name = response.player_name();
+    data.server_id = response.server_id();
+    data.created_at = response.created_at();
+    data.last_activity = response.last_activity();
+    data.elo_rating = response.elo_rating();
+    data.match_id = response.match_id();
+    session = std::move(data);
+    return status;
+}
+
+RpcStatus InterNodeClient::ReportLoad(const ServerInfo& peer, const ServerInfo& self) {
+    rpc::LoadReport report;
+    report.set_server_id(self.server_id);
+    report.set_host(self.host);
+    report.set_udp_port(static_cast<std::uint32_t>(self.udp_port));
+    report.set_rpc_port(static_cast<std::uint32_t>(self.grpc_port));
+    report.set_current_connections(self.current_connections);
+    report.set_max_connections(self.max_connections);
+    report.set_tick_p99_ms(self.tick_p99_ms);
+    report.set_cpu_utilization(self.cpu_utilization);
+    report.set_region(self.region);
+    rpc::LoadReportAck ack;
+    return client_->Call(peer.host, static_cast<std::uint16_t>(peer.grpc_port),
+                         InterNodeMethods::kReportLoad, report, ack, timeout_);
+}
+
+}  // namespace distributed
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 1. 매치 이전 경로 비교
+//    - MatchMigrator: 이전마다 전용 TCP 연결 (연결은 정지 전에 맺음)
+//    - InterNodeClient::MigrateMatch: 공유 채널 재사용, 실패/시간 초과는 RPC 상태 코드로 구분
+//    - 둘 다 대상 쪽은 같은 ImportHandler (UdpGameServer::ImportMigratedMatch)
+//
+// 2. 부하 보고
+//    - 가십/Redis 하트비트 없이도 노드끼리 직접 LoadBalancer를 채울 수 있음
+//    - 아는 노드는 UpdateServerMetrics만 (RCU 스냅샷 교체 없음)
+//
+// 3. 세션 조회
+//    - 세션이 다른 노드의 로컬 저장소(InMemory)에만 있을 때 사용, 없으면 NOT_FOUND
+//
+// 관련 설계 문서:
+// - design/v2.0.2-grpc.md (GameServerService)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/distributed/rpc.cpp (전송 계층)
+// - server/src/distributed/match_migration.cpp (전용 연결 이전)
+// ================================================================================
@@ -9,11 +9,24 @@
 //         - LEAST_CONNECTIONS: 연결 수 최소 서버 선택
 //         - WEIGHTED: 서버 성능별 가중치
 //         - CONSISTENT_HASH: 세션 고정 (같은 플레이어 → 같은 서버)
+//         - POWER_OF_TWO: 무작위 두 서버 비교 (O(1), 늦게 온 지표에도 몰림 없음)
+//         - WEIGHTED_HEADROOM: 두 후보를 틱 p99/CPU/연결 가중 비용으로 비교
+//           (연결 수가 같아도 느린 하드웨어, 무거운 매치, 이웃 프로세스 때문에 틱 여유는 다름)
+//
+// [LEARN] 해시 고정의 약점: 인기 키가 몰리거나 한 서버의 가상 노드 구간이 넓으면 그 서버만 과부하.
+//         Bounded Loads(Mirrokni 외, 2018): 상한 = ceil(평균 부하 × c)
+//         담당 서버가 상한에 닿았으면 링에서 다음 서버로 → 대부분은 그대로, 넘친 만큼만 이동.
+//
+// [LEARN] 선택 경로는 잠금이 없습니다: 불변 스냅샷(서버 표 + 링)을 통째로 교체하고,
+//         선택 결과는 ServerInfo 복사 대신 슬롯을 공유하는 ServerHandle.
 
 #include "pvpserver/distributed/load_balancer.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <memory>
+#include <random>
 #include <sstream>
 
 namespace pvpserver {
@@ -33,7 +46,9 @@ std::string ServerInfo::Serialize() const {
     oss << "\"max_connections\":" << max_connections << ",";
     oss << "\"last_heartbeat\":" << last_heartbeat << ",";
     oss << "\"healthy\":" << (healthy ? "true" : "false") << ",";
-    oss << "\"region\":\"" << region << "\"";
+    oss << "\"region\":\"" << region << "\",";
+    oss << "\"tick_p99_ms\":" << tick_p99_ms << ",";
+    oss << "\"cpu_utilization\":" << cpu_utilization;
     oss << "}";
     return oss.str();
 }
@@ -81,6 +96,20 @@ std::optional<ServerInfo> ServerInfo::Deserialize(const std::string& data) {
         }
     };
 
+    auto extract_double = [&data](const std::string& key) -> double {
+        std::string search = "\"" + key + "\":";
+        auto pos = data.find(search);
+        if (pos == std::string::npos) return 0.0;  // 이전 버전 서버는 보고하지 않음
+        pos += search.length();
+        auto end = data.find_first_of(",}", pos);
+        if (end == std::string::npos) return 0.0;
+        try {
+            return std::stod(data.substr(pos, end - pos));
+        } catch (...) {
+            return 0.0;
+        }
+    };
+
     auto extract_bool = [&data](const std::string& key) -> bool {
         std::string search = "\"" + key + "\":";
         auto pos = data.find(search);
@@ -98,6 +127,8 @@ std::optional<ServerInfo> ServerInfo::Deserialize(const std::string& data) {
     info.last_heartbeat = extract_int64("last_heartbeat");
     info.healthy = extract_bool("healthy");
     info.region = extract_string("region");
+    info.tick_p99_ms = extract_double("tick_p99_ms");
+    info.cpu_utilization = extract_double("cpu_utilization");
 
     if (info.server_id.empty()) {
         return std::nullopt;  // 필수 필드 없으면 실패
@@ -106,153 +137,411 @@ std::optional<ServerInfo> ServerInfo::Deserialize(const std::string& data) {
     return info;
 }
 
+ServerInfo ServerHandle::ToServerInfo() const {
+    ServerInfo info = slot_->info;
+    info.current_connections = Connections();
+    info.healthy = Healthy();
+    info.tick_p99_ms = TickP99Ms();
+    info.cpu_utilization = CpuUtilization();
+    return info;
+}
+
+namespace {
+
+// 모든 LoadBalancer가 공유하는 버전 발급기
+// 버전이 전역에서 유일하므로 (주소, 버전) 쌍이 같으면 같은 스냅샷 (주소 재사용에도 안전)
+std::atomic<std::uint64_t> g_snapshot_versions{0};
+
+bool Available(const ServerSlot& slot) {
+    return slot.healthy.load(std::memory_order_relaxed) &&
+           slot.connections.load(std::memory_order_relaxed) < slot.info.max_connections;
+}
+
+// 틱 예산을 넘은 서버는 어떤 가중 합보다도 뒤로
+constexpr double kOverBudgetPenalty = 1000.0;
+
+double Cost(int connections, int max_connections, double cpu, double tick_p99_ms,
+            const LoadWeights& weights) {
+    const double connection_ratio =
+        max_connections > 0 ? static_cast<double>(connections) / max_connections : 1.0;
+    const double tick_ratio =
+        weights.tick_budget_ms > 0.0 ? tick_p99_ms / weights.tick_budget_ms : 0.0;
+    double cost = weights.connections * connection_ratio + weights.cpu * cpu +
+                  weights.tick * tick_ratio;
+    if (tick_ratio >= 1.0) {
+        cost += kOverBudgetPenalty;
+    }
+    return cost;
+}
+
+double SlotCost(const ServerSlot& slot, const LoadWeights& weights) {
+    return Cost(slot.connections.load(std::memory_order_relaxed), slot.info.max_connections,
+                slot.cpu_utilization.load(std::memory_order_relaxed),
+                slot.tick_p99_ms.load(std::memory_order_relaxed), weights);
+}
+
+// 선택 경로용 스레드별 난수 (공유 상태 없음)
+std::mt19937_64& ThreadRandom() {
+    thread_local std::mt19937_64 rng{std::random_device{}()};
+    return rng;
+}
+
+}  // namespace
+
 // [Order 2] LoadBalancer - 부하 분산 핵심 클래스
+// [LEARN] 읽기 경로 (RCU, Read-Copy-Update):
+//         - 선택은 초당 수십만 번, 서버 추가/제거는 분 단위 → 읽기 쪽 잠금이 병목
+//         - 쓰기: 현재 스냅샷을 복사해 고친 뒤 통째로 교체 (atomic_store)
+//         - 읽기: 스레드마다 마지막 스냅샷을 들고 있다가 버전이 바뀐 경우에만 atomic_load
+//           → 평소에는 원자 변수 하나 읽기 + 공유 쓰기 없음
+//         - 부하/상태는 자주 바뀌므로 스냅샷에 넣지 않고 슬롯의 원자 변수로 (교체 비용 없음)
 
 LoadBalancer::LoadBalancer(LoadBalanceStrategy strategy)
-    : strategy_(strategy) {}
+    : strategy_(strategy) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    Publish(std::make_shared<Snapshot>());
+}
+
+const LoadBalancer::Snapshot& LoadBalancer::Current() const {
+    struct Cache {
+        const LoadBalancer* owner = nullptr;
+        std::uint64_t version = 0;
+        std::shared_ptr<const Snapshot> snapshot;
+    };
+    thread_local Cache cache;
+
+    const auto version = version_.load(std::memory_order_acquire);
+    if (cache.owner != this || cache.version != version) {
+        cache.snapshot = std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+        cache.owner = this;
+        cache.version = cache.snapshot->version;
+    }
+    return *cache.snapshot;
+}
+
+void LoadBalancer::Publish(std::shared_ptr<Snapshot> next) {
+    next->version = g_snapshot_versions.fetch_add(1, std::memory_order_relaxed) + 1;
+    const auto version = next->version;
+    std::atomic_store_explicit(&snapshot_, std::shared_ptr<const Snapshot>(std::move(next)),
+                               std::memory_order_release);
+    version_.store(version, std::memory_order_release);
+}
+
+std::shared_ptr<LoadBalancer::Snapshot> LoadBalancer::CopyForWrite() const {
+    return std::make_shared<Snapshot>(*std::atomic_load(&snapshot_));
+}
+
+std::shared_ptr<ServerSlot> LoadBalancer::FindSlot(const std::string& server_id) const {
+    const auto table = std::atomic_load(&snapshot_);
+    auto it = table->index.find(server_id);
+    if (it == table->index.end()) {
+        return nullptr;
+    }
+    return table->servers[it->second];
+}
 
 // RegisterServer - 서버 등록
 // [LEARN] 서버 시작 시 로드 밸런서에 자신을 등록
+//         같은 ID로 다시 등록하면 새 슬롯으로 교체 (기존 핸들은 옛 정보를 계속 봄)
 void LoadBalancer::RegisterServer(const ServerInfo& server) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    servers_[server.server_id] = server;
-    hash_ring_.AddNode(server.server_id);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto next = CopyForWrite();
+    auto slot = std::make_shared<ServerSlot>(server);
+
+    auto it = next->index.find(server.server_id);
+    if (it != next->index.end()) {
+        const auto& old = *next->servers[it->second];
+        Account(old.healthy.load(), old.connections.load(), -1);
+        next->servers[it->second] = slot;
+    } else {
+        next->ring.AddNode(server.server_id);
+        next->index.emplace(server.server_id, next->servers.size());
+        next->servers.push_back(slot);
+    }
+    Account(server.healthy, server.current_connections, +1);
+    Publish(std::move(next));
 }
 
 void LoadBalancer::UnregisterServer(const std::string& server_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    servers_.erase(server_id);
-    hash_ring_.RemoveNode(server_id);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto next = CopyForWrite();
+    auto it = next->index.find(server_id);
+    if (it == next->index.end()) {
+        return;
+    }
+    const auto& old = *next->servers[it->second];
+    Account(old.healthy.load(), old.connections.load(), -1);
+
+    // 링이 뒤 번호를 당기므로 servers/index도 Members() 순서로 다시 맞춤
+    next->servers.erase(next->servers.begin() + static_cast<std::ptrdiff_t>(it->second));
+    next->ring.RemoveNode(server_id);
+    next->index.clear();
+    for (std::size_t i = 0; i < next->servers.size(); ++i) {
+        next->index.emplace(next->servers[i]->info.server_id, i);
+    }
+    Publish(std::move(next));
+}
+
+// 정상 서버의 연결 수 합계/개수를 변경마다 갱신 (선택 시 전체 순회 없음)
+void LoadBalancer::Account(bool healthy, int connections, int sign) {
+    if (!healthy) {
+        return;
+    }
+    healthy_servers_.fetch_add(sign, std::memory_order_relaxed);
+    healthy_connections_.fetch_add(static_cast<long long>(sign) * connections,
+                                   std::memory_order_relaxed);
 }
 
 std::optional<ServerInfo> LoadBalancer::SelectServer(const std::string& player_id) {
-    switch (strategy_) {
+    auto handle = Select(player_id);
+    if (!handle) {
+        return std::nullopt;
+    }
+    return handle.ToServerInfo();
+}
+
+ServerHandle LoadBalancer::Select(std::string_view player_id) const {
+    const Snapshot& table = Current();
+    switch (strategy_.load(std::memory_order_relaxed)) {
         case LoadBalanceStrategy::CONSISTENT_HASH:
-            return SelectByConsistentHash(player_id);
+            return SelectByConsistentHash(table, player_id);
         case LoadBalanceStrategy::ROUND_ROBIN:
-            return SelectByRoundRobin();
+            return SelectByRoundRobin(table);
         case LoadBalanceStrategy::LEAST_CONNECTIONS:
-            return SelectByLeastConnections();
+            return SelectByLeastConnections(table);
+        case LoadBalanceStrategy::POWER_OF_TWO:
+            return SelectByTwoChoices(table, [](const ServerSlot& a, const ServerSlot& b) {
+                return a.connections.load(std::memory_order_relaxed) <=
+                       b.connections.load(std::memory_order_relaxed);
+            });
+        case LoadBalanceStrategy::WEIGHTED_HEADROOM:
+            return SelectByTwoChoices(table, [&table](const ServerSlot& a, const ServerSlot& b) {
+                return SlotCost(a, table.weights) <= SlotCost(b, table.weights);
+            });
         default:
-            return SelectByConsistentHash(player_id);
+            return SelectByConsistentHash(table, player_id);
     }
 }
 
-std::optional<ServerInfo> LoadBalancer::SelectByConsistentHash(
-    const std::string& player_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    // Consistent Hash로 후보 노드 조회
-    auto candidates = hash_ring_.GetNodes(player_id, 3);
+// [Order 3] SelectByConsistentHash - 담당 서버부터 링 순서로, 정상 + 여유 + 상한 이하인 첫 서버
+// - 상한 = ceil((정상 서버 연결 합 + 1) / 정상 서버 수 × factor), 새 플레이어 몫 포함
+// - 링 노드 번호 = servers 인덱스라 ID 문자열 조회 없이 바로 슬롯을 봄
+ServerHandle LoadBalancer::SelectByConsistentHash(const Snapshot& table,
+                                                  std::string_view player_id) const {
+    long long bound = std::numeric_limits<long long>::max();
+    const double factor = bounded_load_factor_.load(std::memory_order_relaxed);
+    const long long healthy_servers = healthy_servers_.load(std::memory_order_relaxed);
+    if (factor > 1.0 && healthy_servers > 0) {
+        const double average =
+            static_cast<double>(healthy_connections_.load(std::memory_order_relaxed) + 1) /
+            static_cast<double>(healthy_servers);
+        bound = static_cast<long long>(std::ceil(average * factor));
+    }
 
-    for (const auto& server_id : candidates) {
-        auto it = servers_.find(server_id);
-        if (it != servers_.end() &&
-            it->second.healthy &&
-            it->second.HasCapacity()) {
-            return it->second;
+    const std::shared_ptr<ServerSlot>* selected = nullptr;
+    table.ring.ForEachCandidateIndex(player_id, [&](std::size_t member) {
+        const auto& slot = table.servers[member];
+        if (!Available(*slot)) {
+            return false;
         }
+        if (slot->connections.load(std::memory_order_relaxed) + 1LL > bound) {
+            return false;  // 과부하 → 다음 서버
+        }
+        selected = &slot;
+        return true;
+    });
+
+    if (selected) {
+        return ServerHandle(*selected);
     }
+    return ServerHandle();
+}
 
-    return std::nullopt;
+// 정상 서버 목록을 만들지 않고 시작 위치부터 한 바퀴 돌며 첫 가용 서버
+ServerHandle LoadBalancer::SelectByRoundRobin(const Snapshot& table) const {
+    const std::size_t count = table.servers.size();
+    if (count == 0) {
+        return ServerHandle();
+    }
+    const std::size_t start = round_robin_index_.fetch_add(1, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& slot = table.servers[(start + i) % count];
+        if (Available(*slot)) {
+            return ServerHandle(slot);
+        }
+    }
+    return ServerHandle();
 }
 
-std::optional<ServerInfo> LoadBalancer::SelectByRoundRobin() {
-    std::lock_guard<std::mutex> lock(mutex_);
+ServerHandle LoadBalancer::SelectByLeastConnections(const Snapshot& table) const {
+    const std::shared_ptr<ServerSlot>* best = nullptr;
+    int min_connections = std::numeric_limits<int>::max();
 
-    std::vector<ServerInfo> healthy;
-    for (const auto& [id, server] : servers_) {
-        if (server.healthy && server.HasCapacity()) {
-            healthy.push_back(server);
+    for (const auto& slot : table.servers) {
+        if (!Available(*slot)) {
+            continue;
+        }
+        const int connections = slot->connections.load(std::memory_order_relaxed);
+        if (connections < min_connections) {
+            min_connections = connections;
+            best = &slot;
         }
     }
 
-    if (healthy.empty()) {
-        return std::nullopt;
+    if (best) {
+        return ServerHandle(*best);
     }
-
-    size_t index = round_robin_index_.fetch_add(1) % healthy.size();
-    return healthy[index];
+    return ServerHandle();
 }
 
-std::optional<ServerInfo> LoadBalancer::SelectByLeastConnections() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    ServerInfo* best = nullptr;
-    int min_connections = std::numeric_limits<int>::max();
-
-    for (auto& [id, server] : servers_) {
-        if (server.healthy && server.HasCapacity()) {
-            if (server.current_connections < min_connections) {
-                min_connections = server.current_connections;
-                best = &server;
+// [Order 4] SelectByTwoChoices - Power of Two Random Choices (Mitzenmacher, 2001)
+// [LEARN] 전체 최소(LEAST_CONNECTIONS)는 O(N) 순회에, 지표가 몇 초씩 늦게 오면
+//         다음 보고 전까지 모든 요청이 같은 "최소" 서버로 몰립니다 (herd).
+//         무작위 두 개 중 나은 쪽만 골라도 최대 부하가 log N → log log N 수준으로 줄고,
+//         같은 오래된 지표를 봐도 요청이 여러 서버로 흩어집니다.
+// - 무작위로 뽑은 자리가 불가용이면 그 자리부터 다음 가용 서버 (전부 불가용이면 빈 핸들)
+template <typename Better>
+ServerHandle LoadBalancer::SelectByTwoChoices(const Snapshot& table, Better&& better) const {
+    const std::size_t count = table.servers.size();
+    if (count == 0) {
+        return ServerHandle();
+    }
+    auto& rng = ThreadRandom();
+    auto next_available = [&](std::size_t start, std::size_t skip) -> std::size_t {
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t index = (start + i) % count;
+            if (index != skip && Available(*table.servers[index])) {
+                return index;
             }
         }
-    }
+        return count;
+    };
 
-    if (best) {
-        return *best;
+    const std::size_t first = next_available(rng() % count, count);
+    if (first == count) {
+        return ServerHandle();
     }
-    return std::nullopt;
+    const std::size_t second = next_available(rng() % count, first);
+    if (second == count) {
+        return ServerHandle(table.servers[first]);
+    }
+    const auto& a = table.servers[first];
+    const auto& b = table.servers[second];
+    return ServerHandle(better(*a, *b) ? a : b);
 }
 
+// 부하/상태 갱신 - 스냅샷은 그대로, 슬롯만 (합계와 어긋나지 않게 쓰기끼리는 직렬화)
 void LoadBalancer::UpdateServerLoad(const std::string& server_id, int connections) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto slot = FindSlot(server_id);
+    if (!slot) {
+        return;
+    }
+    const bool healthy = slot->healthy.load(std::memory_order_relaxed);
+    Account(healthy, slot->connections.load(std::memory_order_relaxed), -1);
+    slot->connections.store(connections, std::memory_order_relaxed);
+    Account(healthy, connections, +1);
+}
 
-    auto it = servers_.find(server_id);
-    if (it != servers_.end()) {
-        it->second.current_connections = connections;
+void LoadBalancer::UpdateServerMetrics(const std::string& server_id, int connections,
+                                       double tick_p99_ms, double cpu_utilization) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto slot = FindSlot(server_id);
+    if (!slot) {
+        return;
     }
+    const bool healthy = slot->healthy.load(std::memory_order_relaxed);
+    Account(healthy, slot->connections.load(std::memory_order_relaxed), -1);
+    slot->connections.store(connections, std::memory_order_relaxed);
+    slot->tick_p99_ms.store(tick_p99_ms, std::memory_order_relaxed);
+    slot->cpu_utilization.store(cpu_utilization, std::memory_order_relaxed);
+    Account(healthy, connections, +1);
 }
 
 void LoadBalancer::MarkServerHealthy(const std::string& server_id, bool healthy) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto it = servers_.find(server_id);
-    if (it != servers_.end()) {
-        it->second.healthy = healthy;
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto slot = FindSlot(server_id);
+    if (!slot) {
+        return;
     }
+    const int connections = slot->connections.load(std::memory_order_relaxed);
+    Account(slot->healthy.load(std::memory_order_relaxed), connections, -1);
+    slot->healthy.store(healthy, std::memory_order_relaxed);
+    Account(healthy, connections, +1);
 }
 
 std::vector<ServerInfo> LoadBalancer::GetAllServers() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    const auto table = std::atomic_load(&snapshot_);
 
     std::vector<ServerInfo> result;
-    result.reserve(servers_.size());
-    for (const auto& [id, server] : servers_) {
-        result.push_back(server);
+    result.reserve(table->servers.size());
+    for (const auto& slot : table->servers) {
+        result.push_back(ServerHandle(slot).ToServerInfo());
     }
     return result;
 }
 
 std::vector<ServerInfo> LoadBalancer::GetHealthyServers() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    const auto table = std::atomic_load(&snapshot_);
 
     std::vector<ServerInfo> result;
-    for (const auto& [id, server] : servers_) {
-        if (server.healthy) {
-            result.push_back(server);
+    for (const auto& slot : table->servers) {
+        if (slot->healthy.load(std::memory_order_relaxed)) {
+            result.push_back(ServerHandle(slot).ToServerInfo());
         }
     }
     return result;
 }
 
 std::optional<ServerInfo> LoadBalancer::GetServer(const std::string& server_id) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto it = servers_.find(server_id);
-    if (it != servers_.end()) {
-        return it->second;
+    auto slot = FindSlot(server_id);
+    if (slot) {
+        return ServerHandle(slot).ToServerInfo();
     }
     return std::nullopt;
 }
 
 void LoadBalancer::SetStrategy(LoadBalanceStrategy strategy) {
-    strategy_ = strategy;
+    strategy_.store(strategy, std::memory_order_relaxed);
 }
 
 LoadBalanceStrategy LoadBalancer::GetStrategy() const {
-    return strategy_;
+    return strategy_.load(std::memory_order_relaxed);
+}
+
+void LoadBalancer::SetBoundedLoadFactor(double factor) {
+    bounded_load_factor_.store(factor, std::memory_order_relaxed);
+}
+
+double LoadBalancer::GetBoundedLoadFactor() const {
+    return bounded_load_factor_.load(std::memory_order_relaxed);
+}
+
+void LoadBalancer::SetHashMode(ConsistentHashRing::Mode mode) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto next = CopyForWrite();
+    ConsistentHashRing ring(150, mode);
+    for (const auto& server_id : next->ring.Members()) {
+        ring.AddNode(server_id);  // 같은 순서로 추가 → 노드 번호 = servers 인덱스 유지
+    }
+    next->ring = std::move(ring);
+    Publish(std::move(next));
+}
+
+void LoadBalancer::SetLoadWeights(const LoadWeights& weights) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto next = CopyForWrite();
+    next->weights = weights;
+    Publish(std::move(next));
+}
+
+LoadWeights LoadBalancer::GetLoadWeights() const {
+    return std::atomic_load(&snapshot_)->weights;
+}
+
+double LoadBalancer::HeadroomCost(const ServerHandle& server, const LoadWeights& weights) {
+    return Cost(server.Connections(), server.MaxConnections(), server.CpuUtilization(),
+                server.TickP99Ms(), weights);
 }
 
 }  // namespace distributed
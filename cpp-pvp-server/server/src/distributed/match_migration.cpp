@@ -0,0 +1,394 @@
+// [FILE]
+// - 목적: 라이브 매치 이전 (노드 드레인/재배치 시 진행 중인 매치를 끊지 않고 옮김)
+// - 주요 역할: 원본 노드에서 매치를 멈추고 상태를 TCP로 전송, 대상 노드가 복원하면 클라이언트를 REDIRECT
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템
+// - 권장 읽는 순서: MatchMigrator::Migrate → MatchMigrationReceiver::Handle → UdpGameServer 이전 API
+//
+// [LEARN] 지금까지는 노드를 내리면 그 노드의 매치가 통째로 사라졌다.
+//         VM 라이브 마이그레이션과 같은 stop-and-copy:
+//         - 틱 사이에서 멈춤 → 세션/롤백 히스토리/클라이언트 목록을 한 번에 직렬화 (수 KB)
+//         - 대상이 복원 후 ack → 원본이 클라이언트에게 새 주소를 알림 (REDIRECT)
+//         - 연결 수립은 멈추기 전에 끝내 두므로 정지 시간 = 직렬화 + 전송 1 RTT + 복원
+//         상태가 작아서 사전 복사(pre-copy) 반복 없이도 정지가 한두 틱(수 ms) 수준.
+
+#include "pvpserver/distributed/match_migration.h"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace pvpserver {
+namespace distributed {
+
+namespace {
+
+using tcp = boost::asio::ip::tcp;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::uint8_t kVersion = 1;
+constexpr std::uint8_t kStatusOk = 0;
+constexpr std::uint8_t kStatusRejected = 1;
+constexpr std::uint32_t kMaxFrameBytes = 64u << 20;  // 비정상 길이로 메모리를 잡아먹지 않게
+
+// 프레임: [u32 길이][본문]
+// 요청 본문: [u8 버전][u16 room_id 길이][room_id][번들]
+// 응답 본문: [u8 상태][u16 텍스트 길이][host 또는 오류 메시지][u16 udp 포트]
+void WriteU16(std::vector<std::uint8_t>& out, std::uint16_t value) {
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+void WriteU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+void WriteText(std::vector<std::uint8_t>& out, const std::string& text) {
+    const auto size = static_cast<std::uint16_t>(std::min<std::size_t>(text.size(), 0xFFFF));
+    WriteU16(out, size);
+    out.insert(out.end(), text.begin(), text.begin() + size);
+}
+
+std::uint32_t ReadU32(const std::uint8_t* data) {
+    return (std::uint32_t{data[0]} << 24) | (std::uint32_t{data[1]} << 16) |
+           (std::uint32_t{data[2]} << 8) | std::uint32_t{data[3]};
+}
+
+std::uint16_t ReadU16(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    if (offset + 2 > data.size()) {
+        throw std::runtime_error("migration frame truncated");
+    }
+    const auto value = static_cast<std::uint16_t>((data[offset] << 8) | data[offset + 1]);
+    offset += 2;
+    return value;
+}
+
+std::string ReadText(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint16_t size = ReadU16(data, offset);
+    if (offset + size > data.size()) {
+        throw std::runtime_error("migration frame truncated");
+    }
+    std::string text(data.begin() + static_cast<std::ptrdiff_t>(offset),
+                     data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+    offset += size;
+    return text;
+}
+
+std::vector<std::uint8_t> EncodeReply(std::uint8_t status, const std::string& text,
+                                      std::uint16_t udp_port) {
+    // 길이 자리를 비워 두고 한 버퍼에 본문까지 쓴 뒤 길이를 채움
+    std::vector<std::uint8_t> frame;
+    frame.reserve(4 + 1 + 2 + std::min<std::size_t>(text.size(), 0xFFFF) + 2);
+    WriteU32(frame, 0);
+    frame.push_back(status);
+    WriteText(frame, text);
+    WriteU16(frame, udp_port);
+    const auto body_size = static_cast<std::uint32_t>(frame.size() - 4);
+    for (int i = 0; i < 4; ++i) {
+        frame[i] = static_cast<std::uint8_t>(body_size >> (24 - 8 * i));
+    }
+    return frame;
+}
+
+// 비동기 작업 하나를 deadline까지 실행. 시간 초과면 소켓을 닫아 작업을 취소하고 timed_out
+template <typename Start>
+boost::system::error_code RunUntil(boost::asio::io_context& io, tcp::socket& socket,
+                                   Clock::time_point deadline, Start&& start) {
+    boost::system::error_code result = boost::asio::error::would_block;
+    start([&result](const boost::system::error_code& ec, auto&&...) { result = ec; });
+    io.restart();
+    io.run_until(deadline);
+    if (result == boost::asio::error::would_block) {
+        boost::system::error_code ignored;
+        socket.close(ignored);
+        io.restart();
+        io.run();
+        return boost::asio::error::timed_out;
+    }
+    return result;
+}
+
+}  // namespace
+
+// ---- MatchMigrationReceiver (대상 노드) ----
+
+struct MatchMigrationReceiver::Connection {
+    explicit Connection(boost::asio::io_context& io) : socket(io) {}
+    tcp::socket socket;
+    std::array<std::uint8_t, 4> header{};
+    std::vector<std::uint8_t> body;
+    std::vector<std::uint8_t> reply;
+};
+
+MatchMigrationReceiver::MatchMigrationReceiver(std::string bind_address, std::uint16_t port,
+                                               ImportHandler handler)
+    : bind_address_(std::move(bind_address)), handler_(std::move(handler)), acceptor_(io_context_) {
+    const tcp::endpoint endpoint(boost::asio::ip::make_address(bind_address_), port);
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(tcp::acceptor::reuse_address(true));
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+    port_ = acceptor_.local_endpoint().port();
+}
+
+MatchMigrationReceiver::~MatchMigrationReceiver() {
+    Stop();
+}
+
+void MatchMigrationReceiver::Start() {
+    if (io_thread_.joinable()) {
+        return;
+    }
+    work_guard_ = std::make_unique<
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+        io_context_.get_executor());
+    Accept();
+    io_thread_ = std::thread([this] { io_context_.run(); });
+}
+
+void MatchMigrationReceiver::Stop() {
+    if (!io_thread_.joinable()) {
+        return;
+    }
+    // 진행 중인 연결의 읽기도 함께 끊기 위해 io_context를 멈춘 뒤 스레드 밖에서 정리
+    work_guard_.reset();
+    io_context_.stop();
+    io_thread_.join();
+    boost::system::error_code ec;
+    acceptor_.close(ec);
+}
+
+std::uint16_t MatchMigrationReceiver::Port() const {
+    return port_;  // Stop 이후에도 조회 가능
+}
+
+void MatchMigrationReceiver::Accept() {
+    auto connection = std::make_shared<Connection>(io_context_);
+    acceptor_.async_accept(connection->socket, [this, connection](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted) {
+            return;
+        }
+        if (!ec) {
+            connection->socket.set_option(tcp::no_delay(true));
+            Handle(connection);
+        }
+        Accept();
+    });
+}
+
+// [Order 2] Handle - 번들 수신 → handler로 복원 → 게임 주소 응답
+// - 복원은 io 스레드에서 바로 실행 (원본이 멈춰서 기다리는 중이므로 큐에 넣지 않음)
+void MatchMigrationReceiver::Handle(const std::shared_ptr<Connection>& connection) {
+    boost::asio::async_read(
+        connection->socket, boost::asio::buffer(connection->header),
+        [this, connection](const boost::system::error_code& ec, std::size_t) {
+            if (ec) {
+                return;
+            }
+            const std::uint32_t size = ReadU32(connection->header.data());
+            if (size == 0 || size > kMaxFrameBytes) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++rejected_;
+                return;  // 연결을 닫음 → 원본은 실패로 처리
+            }
+            connection->body.resize(size);
+            boost::asio::async_read(
+                connection->socket, boost::asio::buffer(connection->body),
+                [this, connection](const boost::system::error_code& read_ec, std::size_t) {
+                    if (read_ec) {
+                        return;
+                    }
+                    const auto start = Clock::now();
+                    bool ok = false;
+                    try {
+                        std::size_t offset = 0;
+                        if (connection->body[offset++] != kVersion) {
+                            throw std::runtime_error("unsupported migration version");
+                        }
+                        const std::string room_id = ReadText(connection->body, offset);
+                        const std::vector<std::uint8_t> state(
+                            connection->body.begin() + static_cast<std::ptrdiff_t>(offset),
+                            connection->body.end());
+                        const MigrationTarget target = handler_(room_id, state);
+                        connection->reply = EncodeReply(kStatusOk, target.host, target.udp_port);
+                        ok = true;
+                    } catch (const std::exception& e) {
+                        connection->reply = EncodeReply(kStatusRejected, e.what(), 0);
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        ++(ok ? imported_ : rejected_);
+                        last_import_seconds_ =
+                            std::chrono::duration<double>(Clock::now() - start).count();
+                    }
+                    boost::asio::async_write(
+                        connection->socket, boost::asio::buffer(connection->reply),
+                        [connection](const boost::system::error_code&, std::size_t) {});
+                });
+        });
+}
+
+std::string MatchMigrationReceiver::MetricsSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream oss;
+    oss << "# TYPE match_migrations_received_total counter\n";
+    oss << "match_migrations_received_total{result=\"imported\"} " << imported_ << "\n";
+    oss << "match_migrations_received_total{result=\"rejected\"} " << rejected_ << "\n";
+    oss << "# TYPE match_migration_import_seconds gauge\n";
+    oss << "match_migration_import_seconds " << last_import_seconds_ << "\n";
+    return oss.str();
+}
+
+// ---- MatchMigrator (원본 노드) ----
+
+MatchMigrator::MatchMigrator(std::chrono::milliseconds timeout) : timeout_(timeout) {}
+
+// [Order 1] Migrate - 연결 → 정지 → 전송 → ack → REDIRECT (실패 시 재개)
+// [LEARN] 대상이 복원은 했지만 ack가 유실되면 원본이 재개하고 대상 쪽 매치는 아무도 접속하지 않는
+//         빈 방이 된다 (중복 진행은 없음: 클라이언트는 REDIRECT를 받은 쪽 하나만 따라감).
+MigrationResult MatchMigrator::Migrate(UdpGameServer& source, const std::string& room_id,
+                                       const std::string& host, std::uint16_t port) {
+    MigrationResult result;
+    boost::asio::io_context io;
+    tcp::socket socket(io);
+    const auto deadline = Clock::now() + timeout_;
+
+    boost::system::error_code ec;
+    tcp::resolver resolver(io);
+    const auto endpoints = resolver.resolve(host, std::to_string(port), ec);
+    if (!ec) {
+        ec = RunUntil(io, socket, deadline, [&](auto handler) {
+            boost::asio::async_connect(socket, endpoints, std::move(handler));
+        });
+    }
+    if (ec) {
+        result.error = "connect: " + ec.message();
+        Record(result);
+        return result;
+    }
+    socket.set_option(tcp::no_delay(true));
+
+    // 여기부터 매치 정지
+    const auto frozen_at = Clock::now();
+    std::vector<std::uint8_t> bundle;
+    try {
+        bundle = source.FreezeForMigration();
+    } catch (const std::exception& e) {
+        result.error = e.what();
+        Record(result);
+        return result;
+    }
+    result.state_bytes = bundle.size();
+
+    std::vector<std::uint8_t> head;
+    WriteU32(head, static_cast<std::uint32_t>(1 + 2 + std::min<std::size_t>(room_id.size(), 0xFFFF) +
+                                              bundle.size()));
+    head.push_back(kVersion);
+    WriteText(head, room_id);
+    const std::array<boost::asio::const_buffer, 2> request = {boost::asio::buffer(head),
+                                                              boost::asio::buffer(bundle)};
+
+    std::array<std::uint8_t, 4> reply_header{};
+    std::vector<std::uint8_t> reply;
+    ec = RunUntil(io, socket, deadline, [&](auto handler) {
+        boost::asio::async_write(socket, request, std::move(handler));
+    });
+    if (!ec) {
+        ec = RunUntil(io, socket, deadline, [&](auto handler) {
+            boost::asio::async_read(socket, boost::asio::buffer(reply_header), std::move(handler));
+        });
+    }
+    if (!ec) {
+        const std::uint32_t size = ReadU32(reply_header.data());
+        if (size == 0 || size > kMaxFrameBytes) {
+            ec = boost::asio::error::message_size;
+        } else {
+            reply.resize(size);
+            ec = RunUntil(io, socket, deadline, [&](auto handler) {
+                boost::asio::async_read(socket, boost::asio::buffer(reply), std::move(handler));
+            });
+        }
+    }
+
+    try {
+        if (ec) {
+            throw std::runtime_error("transfer: " + ec.message());
+        }
+        std::size_t offset = 1;
+        const std::string text = ReadText(reply, offset);
+        const std::uint16_t udp_port = ReadU16(reply, offset);
+        if (reply[0] != kStatusOk) {
+            throw std::runtime_error("rejected by target: " + text);
+        }
+        result.target = MigrationTarget{text, udp_port};
+    } catch (const std::exception& e) {
+        source.ResumeAfterMigrationFailure();
+        result.error = e.what();
+        Record(result);
+        return result;
+    }
+
+    source.CompleteMigration(result.target.host, result.target.udp_port);
+    result.pause = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - frozen_at);
+    result.success = true;
+    Record(result);
+    return result;
+}
+
+void MatchMigrator::Record(const MigrationResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!result.success) {
+        ++failed_;
+        std::cerr << "Match migration failed: " << result.error << std::endl;
+        return;
+    }
+    ++succeeded_;
+    bytes_sent_ += result.state_bytes;
+    last_pause_seconds_ = std::chrono::duration<double>(result.pause).count();
+    max_pause_seconds_ = std::max(max_pause_seconds_, last_pause_seconds_);
+}
+
+std::string MatchMigrator::MetricsSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream oss;
+    oss << "# TYPE match_migrations_total counter\n";
+    oss << "match_migrations_total{result=\"success\"} " << succeeded_ << "\n";
+    oss << "match_migrations_total{result=\"failure\"} " << failed_ << "\n";
+    oss << "# TYPE match_migration_bytes_total counter\n";
+    oss << "match_migration_bytes_total " << bytes_sent_ << "\n";
+    oss << "# TYPE match_migration_pause_seconds gauge\n";
+    oss << "match_migration_pause_seconds{stat=\"last\"} " << last_pause_seconds_ << "\n";
+    oss << "match_migration_pause_seconds{stat=\"max\"} " << max_pause_seconds_ << "\n";
+    return oss.str();
+}
+
+}  // namespace distributed
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 1. 정지 시간의 구성
+//    - 직렬화 (플레이어/발사체 수에 비례, 수십 µs) + 전송 1 RTT + 대상 복원
+//    - TCP 연결/이름 해석은 정지 전에 끝냄, Nagle 끄기(no_delay)로 작은 응답 지연 방지
+//
+// 2. 실패 처리
+//    - 연결 실패: 매치를 멈추지 않음
+//    - 전송/복원 실패, 시간 초과: 원본이 그대로 재개 (플레이어는 짧은 렉으로만 느낌)
+//
+// 3. 클라이언트 전환
+//    - REDIRECT 유실 대비: 원본은 이후 모든 패킷에 REDIRECT로 응답
+//    - 재접속은 기존 CONNECT 그대로 → 대상에는 플레이어가 이미 있으므로 재접속 경로로 처리
+//
+// 관련 설계 문서:
+// - design/v2.0.1-load-balancer.md (로드 밸런싱)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/network/udp_game_server.cpp (FreezeForMigration/ImportMigratedMatch)
+// - server/src/game/game_session.cpp (ExportState/ImportState)
+// ================================================================================
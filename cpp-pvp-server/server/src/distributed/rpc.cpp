@@ -0,0 +1,654 @@
+// [FILE]
+// - 목적: 서버 간 RPC 전송 계층 (design/v2.0.2-grpc.md의 GameServerService를 Protobuf-over-TCP로)
+// - 주요 역할: 연결 재사용, 한 연결 위 요청 다중화, 호출별 기한, 메서드별 지연 메트릭
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템
+// - 권장 읽는 순서: RpcClient::CallAsync → RpcServer::Dispatch → RpcClient::ReadFrame
+//
+// [LEARN] 노드끼리 호출할 때마다 TCP 연결을 새로 맺으면 호출마다 핸드셰이크 1 RTT가 더 든다.
+//         gRPC(HTTP/2)처럼 상대 노드마다 연결 하나를 유지하고, 요청에 call_id를 붙여
+//         여러 호출을 동시에 흘려보낸 뒤 응답을 도착 순서대로 짝짓는다 (head-of-line 없음).
+//         프레임은 [u32 길이][RpcFrame] — RpcFrame과 메서드별 메시지는 proto/inter_node.proto.
+
+#include "pvpserver/distributed/rpc.h"
+
+#include "inter_node.pb.h"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace pvpserver {
+namespace distributed {
+
+namespace {
+
+using tcp = boost::asio::ip::tcp;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::uint32_t kMaxFrameBytes = 16u << 20;  // 비정상 길이로 메모리를 잡아먹지 않게
+
+std::uint32_t ReadU32(const std::uint8_t* data) {
+    return (std::uint32_t{data[0]} << 24) | (std::uint32_t{data[1]} << 16) |
+           (std::uint32_t{data[2]} << 8) | std::uint32_t{data[3]};
+}
+
+// [u32 길이][RpcFrame] 한 덩어리 (쓰기 큐에 그대로 들어감)
+std::shared_ptr<std::string> EncodeFrame(const rpc::RpcFrame& frame) {
+    const std::size_t size = frame.ByteSizeLong();
+    auto out = std::make_shared<std::string>(4 + size, '\0');
+    for (int i = 0; i < 4; ++i) {
+        (*out)[i] = static_cast<char>(size >> (24 - 8 * i));
+    }
+    frame.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t*>(&(*out)[4]));
+    return out;
+}
+
+double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+const char* RpcCodeName(RpcCode code) {
+    switch (code) {
+        case RpcCode::OK:
+            return "OK";
+        case RpcCode::CANCELLED:
+            return "CANCELLED";
+        case RpcCode::INVALID_ARGUMENT:
+            return "INVALID_ARGUMENT";
+        case RpcCode::DEADLINE_EXCEEDED:
+            return "DEADLINE_EXCEEDED";
+        case RpcCode::NOT_FOUND:
+            return "NOT_FOUND";
+        case RpcCode::UNIMPLEMENTED:
+            return "UNIMPLEMENTED";
+        case RpcCode::INTERNAL:
+            return "INTERNAL";
+        case RpcCode::UNAVAILABLE:
+            return "UNAVAILABLE";
+    }
+    return "UNKNOWN";
+}
+
+// ---- RpcMetrics ----
+
+RpcMetrics::RpcMetrics(std::string prefix) : prefix_(std::move(prefix)) {}
+
+void RpcMetrics::Record(const std::string& method, RpcCode code, double seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    MethodStats& stats = methods_[method];
+    ++stats.codes[code];
+    ++stats.count;
+    stats.sum_seconds += seconds;
+    for (std::size_t i = 0; i < kLatencyBuckets.size(); ++i) {
+        if (seconds <= kLatencyBuckets[i]) {
+            ++stats.buckets[i];
+            return;
+        }
+    }
+    ++stats.overflow;
+}
+
+std::uint64_t RpcMetrics::Count(const std::string& method, RpcCode code) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = methods_.find(method);
+    if (it == methods_.end()) {
+        return 0;
+    }
+    const auto code_it = it->second.codes.find(code);
+    return code_it == it->second.codes.end() ? 0 : code_it->second;
+}
+
+std::string RpcMetrics::Render() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream oss;
+    oss << "# TYPE " << prefix_ << "_requests_total counter\n";
+    for (const auto& [method, stats] : methods_) {
+        for (const auto& [code, count] : stats.codes) {
+            oss << prefix_ << "_requests_total{method=\"" << method << "\",code=\""
+                << RpcCodeName(code) << "\"} " << count << "\n";
+        }
+    }
+    oss << "# TYPE " << prefix_ << "_latency_seconds histogram\n";
+    for (const auto& [method, stats] : methods_) {
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < kLatencyBuckets.size(); ++i) {
+            cumulative += stats.buckets[i];
+            oss << prefix_ << "_latency_seconds_bucket{method=\"" << method << "\",le=\""
+                << kLatencyBuckets[i] << "\"} " << cumulative << "\n";
+        }
+        cumulative += stats.overflow;
+        oss << prefix_ << "_latency_seconds_bucket{method=\"" << method << "\",le=\"+Inf\"} "
+            << cumulative << "\n";
+        oss << prefix_ << "_latency_seconds_sum{method=\"" << method << "\"} " << stats.sum_seconds
+            << "\n";
+        oss << prefix_ << "_latency_seconds_count{method=\"" << method << "\"} " << stats.count
+            << "\n";
+    }
+    return oss.str();
+}
+
+// ---- RpcServer ----
+
+struct RpcServer::Connection : std::enable_shared_from_this<Connection> {
+    explicit Connection(boost::asio::io_context& io) : socket(io) {}
+    tcp::socket socket;
+    std::array<std::uint8_t, 4> header{};
+    std::string body;
+    std::deque<std::shared_ptr<std::string>> write_queue;  // io 스레드 전용
+
+    // [Order 3] 응답 쓰기 - 한 번에 하나의 async_write만 진행 (프레임이 섞이지 않게)
+    void Send(std::shared_ptr<std::string> frame) {
+        write_queue.push_back(std::move(frame));
+        if (write_queue.size() == 1) {
+            WriteNext();
+        }
+    }
+
+    void WriteNext() {
+        boost::asio::async_write(socket, boost::asio::buffer(*write_queue.front()),
+                                 [self = shared_from_this()](const boost::system::error_code& ec,
+                                                             std::size_t) {
+                                     if (ec) {
+                                         self->write_queue.clear();
+                                         return;
+                                     }
+                                     self->write_queue.pop_front();
+                                     if (!self->write_queue.empty()) {
+                                         self->WriteNext();
+                                     }
+                                 });
+    }
+};
+
+RpcServer::RpcServer(RpcServerOptions options)
+    : options_(std::move(options)), acceptor_(io_context_) {
+    const tcp::endpoint endpoint(boost::asio::ip::make_address(options_.bind_address),
+                                 options_.port);
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(tcp::acceptor::reuse_address(true));
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+    port_ = acceptor_.local_endpoint().port();
+}
+
+RpcServer::~RpcServer() {
+    Stop();
+}
+
+void RpcServer::RegisterMethod(const std::string& method, RawHandler handler) {
+    if (io_thread_.joinable()) {
+        throw std::logic_error("RpcServer::RegisterMethod after Start");
+    }
+    handlers_[method] = std::move(handler);
+}
+
+void RpcServer::Start() {
+    if (io_thread_.joinable()) {
+        return;
+    }
+    workers_ = std::make_unique<boost::asio::thread_pool>(std::max<std::size_t>(1, options_.worker_threads));
+    work_guard_ = std::make_unique<
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+        io_context_.get_executor());
+    Accept();
+    io_thread_ = std::thread([this] { io_context_.run(); });
+}
+
+void RpcServer::Stop() {
+    if (!io_thread_.joinable()) {
+        return;
+    }
+    work_guard_.reset();
+    io_context_.stop();
+    io_thread_.join();
+    boost::system::error_code ec;
+    acceptor_.close(ec);
+    // 열린 연결을 닫아 상대 클라이언트가 기한까지 기다리지 않고 바로 UNAVAILABLE을 받게 함
+    for (const auto& weak : accepted_) {
+        if (auto connection = weak.lock()) {
+            connection->socket.close(ec);
+        }
+    }
+    accepted_.clear();
+    // 실행 중인 핸들러가 끝날 때까지 대기 (이후 응답은 멈춘 io_context에 쌓였다가 버려짐)
+    workers_->join();
+}
+
+std::uint16_t RpcServer::Port() const {
+    return port_;
+}
+
+void RpcServer::Accept() {
+    auto connection = std::make_shared<Connection>(io_context_);
+    acceptor_.async_accept(connection->socket, [this, connection](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted) {
+            return;
+        }
+        if (!ec) {
+            connection->socket.set_option(tcp::no_delay(true));
+            ++connections_;
+            accepted_.erase(std::remove_if(accepted_.begin(), accepted_.end(),
+                                           [](const auto& weak) { return weak.expired(); }),
+                            accepted_.end());
+            accepted_.push_back(connection);
+            ReadFrame(connection);
+        }
+        Accept();
+    });
+}
+
+// [Order 1] ReadFrame - 프레임을 읽는 즉시 다음 프레임을 읽음 (처리 완료를 기다리지 않음)
+void RpcServer::ReadFrame(const std::shared_ptr<Connection>& connection) {
+    boost::asio::async_read(
+        connection->socket, boost::asio::buffer(connection->header),
+        [this, connection](const boost::system::error_code& ec, std::size_t) {
+            if (ec) {
+                --connections_;
+                return;
+            }
+            const std::uint32_t size = ReadU32(connection->header.data());
+            if (size > kMaxFrameBytes) {
+                --connections_;
+                boost::system::error_code ignored;
+                connection->socket.close(ignored);
+                return;
+            }
+            connection->body.resize(size);
+            boost::asio::async_read(
+                connection->socket, boost::asio::buffer(connection->body),
+                [this, connection](const boost::system::error_code& read_ec, std::size_t) {
+                    if (read_ec) {
+                        --connections_;
+                        return;
+                    }
+                    Dispatch(connection, std::move(connection->body));
+                    ReadFrame(connection);
+                });
+        });
+}
+
+// [Order 2] Dispatch - 워커 풀에서 핸들러 실행 → 응답은 io 스레드의 쓰기 큐로
+// [LEARN] 핸들러를 io 스레드에서 바로 돌리면 느린 호출 하나(매치 복원 등)가
+//         같은 연결의 뒤 요청과 다른 연결의 읽기까지 모두 막는다.
+void RpcServer::Dispatch(const std::shared_ptr<Connection>& connection, std::string frame_bytes) {
+    auto request = std::make_shared<rpc::RpcFrame>();
+    if (!request->ParseFromString(frame_bytes) || request->kind() != rpc::RpcFrame::REQUEST) {
+        boost::system::error_code ignored;
+        connection->socket.close(ignored);  // 프로토콜 위반: 연결을 끊음 → 클라이언트는 UNAVAILABLE
+        return;
+    }
+    const auto received_at = Clock::now();
+    boost::asio::post(*workers_, [this, connection, request, received_at] {
+        RpcStatus status;
+        std::string response_bytes;
+        const auto handler = handlers_.find(request->method());
+        const auto deadline =
+            received_at + std::chrono::milliseconds(request->timeout_ms());
+        if (handler == handlers_.end()) {
+            status = RpcStatus::Error(RpcCode::UNIMPLEMENTED, "unknown method " + request->method());
+        } else if (request->timeout_ms() > 0 && Clock::now() >= deadline) {
+            // 대기열에서 기한이 지남: 클라이언트가 이미 포기했으므로 실행하지 않음
+            status = RpcStatus::Error(RpcCode::DEADLINE_EXCEEDED, "deadline expired before dispatch");
+        } else {
+            try {
+                status = handler->second(request->payload(), response_bytes);
+            } catch (const std::exception& e) {
+                status = RpcStatus::Error(RpcCode::INTERNAL, e.what());
+            }
+        }
+        metrics_.Record(request->method(), status.code, SecondsSince(received_at));
+
+        rpc::RpcFrame response;
+        response.set_kind(rpc::RpcFrame::RESPONSE);
+        response.set_call_id(request->call_id());
+        response.set_code(static_cast<std::uint32_t>(status.code));
+        if (status.ok()) {
+            response.set_payload(std::move(response_bytes));
+        } else {
+            response.set_error(status.message);
+        }
+        auto frame = EncodeFrame(response);
+        boost::asio::post(io_context_, [connection, frame] { connection->Send(frame); });
+    });
+}
+
+std::string RpcServer::MetricsSnapshot() const {
+    std::ostringstream oss;
+    oss << metrics_.Render();
+    oss << "# TYPE rpc_server_connections gauge\n";
+    oss << "rpc_server_connections " << connections_.load() << "\n";
+    return oss.str();
+}
+
+// ---- RpcClient ----
+
+struct RpcClient::Pending {
+    std::string method;
+    Callback callback;
+    std::unique_ptr<boost::asio::steady_timer> timer;
+    Clock::time_point started;
+};
+
+struct RpcClient::Channel {
+    enum class State { IDLE, CONNECTING, OPEN };
+
+    Channel(boost::asio::io_context& io, std::string host_, std::uint16_t port_)
+        : host(std::move(host_)), port(port_), socket(io), resolver(io), connect_timer(io) {}
+
+    std::string host;
+    std::uint16_t port;
+    State state = State::IDLE;
+    std::uint64_t generation = 0;  // 재연결 전 소켓의 늦은 완료 핸들러를 무시하기 위함
+
+    tcp::socket socket;
+    tcp::resolver resolver;
+    boost::asio::steady_timer connect_timer;
+
+    std::vector<std::shared_ptr<std::string>> backlog;  // 연결 중에 들어온 요청
+    std::deque<std::shared_ptr<std::string>> write_queue;
+    std::array<std::uint8_t, 4> header{};
+    std::string body;
+
+    std::unordered_map<std::uint64_t, Pending> pending;
+};
+
+RpcClient::RpcClient(RpcClientOptions options) : options_(options) {
+    work_guard_ = std::make_unique<
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+        io_context_.get_executor());
+    io_thread_ = std::thread([this] { io_context_.run(); });
+}
+
+RpcClient::~RpcClient() {
+    // 남은 호출을 CANCELLED로 끝낸 뒤 io 스레드 종료 (블로킹 Call이 영원히 기다리지 않게)
+    boost::asio::post(io_context_, [this] {
+        for (auto& entry : channels_) {
+            Fail(entry.second, RpcStatus::Error(RpcCode::CANCELLED, "client shutting down"));
+        }
+        io_context_.stop();
+    });
+    work_guard_.reset();
+    io_thread_.join();
+}
+
+// [Order 1] CallAsync - 채널 선택(없으면 연결) → 기한 타이머 → 프레임 전송
+void RpcClient::CallAsync(const std::string& host, std::uint16_t port, const std::string& method,
+                          std::string request, std::chrono::milliseconds timeout,
+                          Callback callback) {
+    ++in_flight_;
+    boost::asio::post(io_context_, [this, host, port, method, request = std::move(request), timeout,
+                                    callback = std::move(callback)]() mutable {
+        auto channel = ChannelFor(host, port);
+        const std::uint64_t call_id = next_call_id_++;
+
+        Pending pending;
+        pending.method = method;
+        pending.callback = std::move(callback);
+        pending.started = Clock::now();
+        pending.timer = std::make_unique<boost::asio::steady_timer>(io_context_, timeout);
+        pending.timer->async_wait([this, channel, call_id](const boost::system::error_code& ec) {
+            if (ec != boost::asio::error::operation_aborted) {
+                // 늦게 오는 응답은 Complete에서 call_id를 못 찾아 버려짐
+                Complete(channel, call_id,
+                         RpcStatus::Error(RpcCode::DEADLINE_EXCEEDED, "deadline exceeded"), {});
+            }
+        });
+        channel->pending.emplace(call_id, std::move(pending));
+
+        rpc::RpcFrame frame;
+        frame.set_kind(rpc::RpcFrame::REQUEST);
+        frame.set_call_id(call_id);
+        frame.set_method(method);
+        frame.set_timeout_ms(static_cast<std::uint32_t>(std::max<std::int64_t>(1, timeout.count())));
+        frame.set_payload(std::move(request));
+
+        if (channel->state == Channel::State::IDLE) {
+            Connect(channel);
+        }
+        Write(channel, EncodeFrame(frame));
+    });
+}
+
+RpcStatus RpcClient::Call(const std::string& host, std::uint16_t port, const std::string& method,
+                          std::string request, std::string& response,
+                          std::chrono::milliseconds timeout) {
+    if (std::this_thread::get_id() == io_thread_.get_id()) {
+        return RpcStatus::Error(RpcCode::INTERNAL, "blocking Call from RPC callback");
+    }
+    std::promise<std::pair<RpcStatus, std::string>> promise;
+    auto future = promise.get_future();
+    CallAsync(host, port, method, std::move(request), timeout,
+              [&promise](const RpcStatus& status, std::string payload) {
+                  promise.set_value({status, std::move(payload)});
+              });
+    auto result = future.get();  // 기한 타이머가 있으므로 항상 끝남
+    response = std::move(result.second);
+    return result.first;
+}
+
+std::shared_ptr<RpcClient::Channel> RpcClient::ChannelFor(const std::string& host,
+                                                          std::uint16_t port) {
+    const std::string key = host + ":" + std::to_string(port);
+    auto it = channels_.find(key);
+    if (it == channels_.end()) {
+        it = channels_.emplace(key, std::make_shared<Channel>(io_context_, host, port)).first;
+    }
+    return it->second;
+}
+
+// [Order 2] Connect - 채널당 연결 하나. 실패하면 대기 중인 호출 모두 UNAVAILABLE
+void RpcClient::Connect(const std::shared_ptr<Channel>& channel) {
+    channel->state = Channel::State::CONNECTING;
+    const std::uint64_t generation = ++channel->generation;
+    ++open_channels_;
+    ++connects_;
+
+    channel->connect_timer.expires_after(options_.connect_timeout);
+    channel->connect_timer.async_wait([channel, generation](const boost::system::error_code& ec) {
+        if (!ec && channel->generation == generation && channel->state == Channel::State::CONNECTING) {
+            boost::system::error_code ignored;
+            channel->resolver.cancel();
+            channel->socket.close(ignored);  // 진행 중인 연결을 취소 → 아래 핸들러가 실패 처리
+        }
+    });
+
+    channel->resolver.async_resolve(
+        channel->host, std::to_string(channel->port),
+        [this, channel, generation](const boost::system::error_code& ec,
+                                    const tcp::resolver::results_type& endpoints) {
+            if (channel->generation != generation) {
+                return;
+            }
+            if (ec) {
+                Fail(channel, RpcStatus::Error(RpcCode::UNAVAILABLE, "resolve: " + ec.message()));
+                return;
+            }
+            boost::asio::async_connect(
+                channel->socket, endpoints,
+                [this, channel, generation](const boost::system::error_code& connect_ec,
+                                            const tcp::endpoint&) {
+                    if (channel->generation != generation) {
+                        return;
+                    }
+                    channel->connect_timer.cancel();
+                    if (connect_ec || !channel->socket.is_open()) {
+                        Fail(channel, RpcStatus::Error(RpcCode::UNAVAILABLE,
+                                                       "connect " + channel->host + ":" +
+                                                           std::to_string(channel->port) + ": " +
+                                                           connect_ec.message()));
+                        return;
+                    }
+                    channel->socket.set_option(tcp::no_delay(true));
+                    channel->state = Channel::State::OPEN;
+                    auto backlog = std::move(channel->backlog);
+                    channel->backlog.clear();
+                    for (auto& frame : backlog) {
+                        Write(channel, std::move(frame));
+                    }
+                    ReadFrame(channel);
+                });
+        });
+}
+
+void RpcClient::Write(const std::shared_ptr<Channel>& channel, std::shared_ptr<std::string> frame) {
+    if (channel->state != Channel::State::OPEN) {
+        channel->backlog.push_back(std::move(frame));
+        return;
+    }
+    channel->write_queue.push_back(std::move(frame));
+    if (channel->write_queue.size() == 1) {
+        WriteNext(channel);  // 아니면 앞선 쓰기가 끝난 뒤 이어서 보냄
+    }
+}
+
+void RpcClient::WriteNext(const std::shared_ptr<Channel>& channel) {
+    const std::uint64_t generation = channel->generation;
+    boost::asio::async_write(
+        channel->socket, boost::asio::buffer(*channel->write_queue.front()),
+        [this, channel, generation](const boost::system::error_code& ec, std::size_t) {
+            if (channel->generation != generation) {
+                return;
+            }
+            if (ec) {
+                Fail(channel, RpcStatus::Error(RpcCode::UNAVAILABLE, "write: " + ec.message()));
+                return;
+            }
+            channel->write_queue.pop_front();
+            if (!channel->write_queue.empty()) {
+                WriteNext(channel);
+            }
+        });
+}
+
+// [Order 3] ReadFrame - 응답을 call_id로 대기 중인 호출과 짝지음 (도착 순서 무관)
+void RpcClient::ReadFrame(const std::shared_ptr<Channel>& channel) {
+    const std::uint64_t generation = channel->generation;
+    boost::asio::async_read(
+        channel->socket, boost::asio::buffer(channel->header),
+        [this, channel, generation](const boost::system::error_code& ec, std::size_t) {
+            if (channel->generation != generation) {
+                return;
+            }
+            if (ec) {
+                Fail(channel, RpcStatus::Error(RpcCode::UNAVAILABLE, "read: " + ec.message()));
+                return;
+            }
+            const std::uint32_t size = ReadU32(channel->header.data());
+            if (size > kMaxFrameBytes) {
+                Fail(channel, RpcStatus::Error(RpcCode::UNAVAILABLE, "oversized frame"));
+                return;
+            }
+            channel->body.resize(size);
+            boost::asio::async_read(
+                channel->socket, boost::asio::buffer(channel->body),
+                [this, channel, generation](const boost::system::error_code& read_ec, std::size_t) {
+                    if (channel->generation != generation) {
+                        return;
+                    }
+                    rpc::RpcFrame frame;
+                    if (read_ec || !frame.ParseFromString(channel->body) ||
+                        frame.kind() != rpc::RpcFrame::RESPONSE) {
+                        Fail(channel, RpcStatus::Error(RpcCode::UNAVAILABLE,
+                                                       read_ec ? "read: " + read_ec.message()
+                                                               : "malformed response frame"));
+                        return;
+                    }
+                    Complete(channel, frame.call_id(),
+                             RpcStatus{static_cast<RpcCode>(frame.code()), frame.error()},
+                             std::move(*frame.mutable_payload()));
+                    ReadFrame(channel);
+                });
+        });
+}
+
+void RpcClient::Complete(const std::shared_ptr<Channel>& channel, std::uint64_t call_id,
+                         const RpcStatus& status, std::string response) {
+    const auto it = channel->pending.find(call_id);
+    if (it == channel->pending.end()) {
+        return;  // 이미 기한 초과로 끝난 호출
+    }
+    Pending pending = std::move(it->second);
+    channel->pending.erase(it);
+    pending.timer->cancel();
+    metrics_.Record(pending.method, status.code, SecondsSince(pending.started));
+    --in_flight_;
+    pending.callback(status, std::move(response));
+}
+
+// 연결을 버리고 진행 중인 호출을 모두 status로 끝냄. 다음 호출이 새로 연결함
+void RpcClient::Fail(const std::shared_ptr<Channel>& channel, const RpcStatus& status) {
+    if (channel->state != Channel::State::IDLE) {
+        --open_channels_;
+    }
+    channel->state = Channel::State::IDLE;
+    ++channel->generation;
+    boost::system::error_code ignored;
+    channel->connect_timer.cancel();
+    channel->socket.close(ignored);
+    channel->backlog.clear();
+    channel->write_queue.clear();
+
+    auto pending = std::move(channel->pending);
+    channel->pending.clear();
+    for (auto& [call_id, call] : pending) {
+        call.timer->cancel();
+        metrics_.Record(call.method, status.code, SecondsSince(call.started));
+        --in_flight_;
+        call.callback(status, {});
+    }
+}
+
+std::size_t RpcClient::ConnectionCount() const {
+    return open_channels_.load();
+}
+
+std::string RpcClient::MetricsSnapshot() const {
+    std::ostringstream oss;
+    oss << metrics_.Render();
+    oss << "# TYPE rpc_client_connects_total counter\n";
+    oss << "rpc_client_connects_total " << connects_.load() << "\n";
+    oss << "# TYPE rpc_client_connections gauge\n";
+    oss << "rpc_client_connections " << open_channels_.load() << "\n";
+    oss << "# TYPE rpc_client_inflight gauge\n";
+    oss << "rpc_client_inflight " << in_flight_.load() << "\n";
+    return oss.str();
+}
+
+}  // namespace distributed
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 1. 왜 gRPC가 아닌가
+//    - 빌드 환경에 grpc_cpp_plugin이 없고, 서버의 다른 전송(UDP 게임, 가십, 매치 이전)이 모두 Asio 직접 구현
+//    - 필요한 것(연결 재사용, 다중화, 기한, 상태 코드)만 가져옴. 상태 코드 번호는 gRPC와 같음
+//
+// 2. 스레드 모델
+//    - 클라이언트: io 스레드 하나가 채널/대기 호출 표를 소유 (잠금 없음), 공개 API는 post로 넘김
+//    - 서버: io 스레드는 읽기/쓰기만, 핸들러는 워커 풀 → 응답 쓰기는 다시 io 스레드로
+//
+// 3. 기한
+//    - 클라이언트 타이머가 기준: 지나면 DEADLINE_EXCEEDED, 늦은 응답은 버림
+//    - 서버는 남은 시간(timeout_ms)으로 이미 늦은 요청을 건너뜀 (실행 중인 핸들러는 끊지 않음)
+//
+// 4. 장애
+//    - 연결 끊김/프로토콜 오류: 그 채널의 호출 모두 UNAVAILABLE, 다음 호출이 다시 연결
+//    - generation으로 닫힌 소켓의 늦은 완료 핸들러를 무시
+//
+// 관련 설계 문서:
+// - design/v2.0.2-grpc.md (GameServerService)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/distributed/inter_node_service.cpp (매치 이전/세션 조회/부하 보고)
+// - server/proto/inter_node.proto
+// ================================================================================
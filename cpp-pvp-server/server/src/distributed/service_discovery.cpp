@@ -10,53 +10,21 @@
 //         - Redis Pub/Sub: 이벤트 기반 알림 (서버 추가/제거)
 //
 // 대안: Consul, etcd, Kubernetes Service Discovery
+//       Redis 없이 UDP 가십으로: gossip_membership.cpp (SWIM, 장애 감지 ~1초)
 
 #include "pvpserver/distributed/service_discovery.h"
 
 #include <chrono>
 
+#include "pvpserver/storage/redis_cluster_client.h"
+
 namespace pvpserver {
 namespace distributed {
 
-// [Order 1] RedisClient 스텁
-// [LEARN] 실제 구현 시 redis-plus-plus 사용.
-//         스텁: 인터페이스만 정의, 실제 동작 없음 (테스트/개발용)
-class RedisClient {
-public:
-    // SET key value EX ttl
-    bool set(const std::string& /*key*/, const std::string& /*value*/,
-             int /*ttl_seconds*/) { return true; }
-    // GET key
-    std::optional<std::string> get(const std::string& /*key*/) {
-        return std::nullopt;
-    }
-    // DEL key
-    bool del(const std::string& /*key*/) { return true; }
-    // EXPIRE key seconds
-    bool expire(const std::string& /*key*/, int /*seconds*/) { return true; }
-    // SMEMBERS key (Set 조회)
-    std::vector<std::string> smembers(const std::string& /*key*/) { return {}; }
-    // SADD key member (Set 추가)
-    bool sadd(const std::string& /*key*/, const std::string& /*member*/) {
-        return true;
-    }
-    // SREM key member (Set 제거)
-    bool srem(const std::string& /*key*/, const std::string& /*member*/) {
-        return true;
-    }
-    // PUBLISH channel message (Pub/Sub)
-    void publish(const std::string& /*channel*/, const std::string& /*msg*/) {}
-    // SUBSCRIBE channel
-    void subscribe(const std::string& /*channel*/,
-                  std::function<void(const std::string&)> /*handler*/) {}
-    // PING - 연결 확인
-    bool ping() { return true; }
-};
-
 // ==================== ServiceDiscovery ====================
 
-// 생성자 - Redis 클라이언트 주입
-ServiceDiscovery::ServiceDiscovery(std::shared_ptr<RedisClient> redis)
+// [Order 1] 생성자 - Redis 클라이언트 주입 (storage::RedisClusterClient, 실제 RESP 연결)
+ServiceDiscovery::ServiceDiscovery(std::shared_ptr<storage::RedisClusterClient> redis)
     : redis_(redis) {}
 
 ServiceDiscovery::~ServiceDiscovery() {
@@ -79,14 +47,13 @@ void ServiceDiscovery::Unregister() {
     StopHeartbeat();
 
     if (redis_) {
-        // 서버 정보 삭제
-        redis_->del("pvp:server:" + self_.server_id);
-        redis_->srem("pvp:servers", self_.server_id);
-
-        // 제거 이벤트 발행 (Pub/Sub)
-        redis_->publish("pvp:server:events",
-                       "{\"event\":\"removed\",\"server_id\":\"" +
-                       self_.server_id + "\"}");
+        // 서버 정보 삭제 + 제거 이벤트 발행 (Pub/Sub) - 한 번에 전송
+        redis_->Batch({
+            {"DEL", "pvp:server:" + self_.server_id},
+            {"SREM", "pvp:servers", self_.server_id},
+            {"PUBLISH", "pvp:server:events",
+             "{\"event\":\"removed\",\"server_id\":\"" + self_.server_id + "\"}"},
+        });
     }
 }
 
@@ -98,15 +65,22 @@ std::vector<ServerInfo> ServiceDiscovery::GetAvailableServers() {
     if (!redis_) return servers;
 
     // pvp:servers Set에서 모든 서버 ID 조회
-    auto server_ids = redis_->smembers("pvp:servers");
-    for (const auto& id : server_ids) {
-        // 각 서버의 상세 정보 조회
-        auto data = redis_->get("pvp:server:" + id);
-        if (data) {
-            auto info = ServerInfo::Deserialize(*data);
-            if (info) {
-                servers.push_back(*info);
-            }
+    auto members = redis_->Execute({"SMEMBERS", "pvp:servers"});
+    if (!members || members->elements.empty()) return servers;
+
+    // 각 서버의 상세 정보 조회 - 서버 N개를 왕복 N번이 아니라 노드당 한 번에
+    std::vector<std::vector<std::string>> gets;
+    gets.reserve(members->elements.size());
+    for (const auto& id : members->elements) {
+        gets.push_back({"GET", "pvp:server:" + id.text});
+    }
+    auto replies = redis_->Batch(std::move(gets));
+    if (!replies) return servers;
+    for (const auto& data : *replies) {
+        if (data.type != storage::RespValue::Type::BulkString) continue;  // 만료된 서버
+        auto info = ServerInfo::Deserialize(data.text);
+        if (info) {
+            servers.push_back(*info);
         }
     }
 
@@ -117,10 +91,10 @@ std::vector<ServerInfo> ServiceDiscovery::GetAvailableServers() {
 std::optional<ServerInfo> ServiceDiscovery::GetServer(const std::string& server_id) {
     if (!redis_) return std::nullopt;
 
-    auto data = redis_->get("pvp:server:" + server_id);
-    if (!data) return std::nullopt;
+    auto data = redis_->Execute({"GET", "pvp:server:" + server_id});
+    if (!data || data->type != storage::RespValue::Type::BulkString) return std::nullopt;
 
-    return ServerInfo::Deserialize(*data);
+    return ServerInfo::Deserialize(data->text);
 }
 
 // 콜백 등록 - 서버 추가/제거 이벤트
@@ -168,12 +142,14 @@ void ServiceDiscovery::PublishServerInfo() {
         std::chrono::system_clock::now().time_since_epoch()
     ).count();
 
-    // 서버 정보 저장
-    redis_->set("pvp:server:" + self_.server_id,
-               self_.Serialize(), SERVER_TTL_SEC);
-
-    // 서버 집합에 추가
-    redis_->sadd("pvp:servers", self_.server_id);
+    // 서버 정보 저장 (TTL) + 서버 집합에 추가 - 응답을 기다리지 않음
+    redis_->BatchAsync(
+        {
+            {"SET", "pvp:server:" + self_.server_id, self_.Serialize(), "EX",
+             std::to_string(SERVER_TTL_SEC)},
+            {"SADD", "pvp:servers", self_.server_id},
+        },
+        [](std::optional<std::vector<storage::RespValue>>, const std::string&) {});
 }
 
 void ServiceDiscovery::SubscriptionLoop() {
@@ -238,6 +214,9 @@ void HealthChecker::CheckLoop() {
             std::lock_guard<std::mutex> lock(mutex_);
 
             if (healthy) {
+                // 하트비트로 받은 부하 지표 전달 (WEIGHTED_HEADROOM이 사용)
+                balancer_->UpdateServerMetrics(server.server_id, server.current_connections,
+                                               server.tick_p99_ms, server.cpu_utilization);
                 // 복구 확인
                 if (failure_counts_[server.server_id] >= FAILURE_THRESHOLD) {
                     if (on_recovered_) {
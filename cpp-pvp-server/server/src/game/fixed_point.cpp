@@ -0,0 +1,172 @@
+// [FILE]
+// - 목적: Q16.16 고정소수점 수학 (결정론적 시뮬레이션용)
+// - 주요 역할: double 변환, 정수 제곱근, CORDIC 기반 atan2/sin/cos
+// - 관련 클론 가이드 단계: [v1.4.1] 클라이언트 예측/리컨실리에이션
+// - 권장 읽는 순서: Fixed::FromDouble → IntegerSqrt → FixedNormalize → FixedAtan2
+//
+// [LEARN] 부동소수점 결과는 컴파일러(FMA 축약, x87 vs SSE), libm 구현에 따라
+//         마지막 비트가 달라질 수 있다. 서버 빌드마다 결과가 다르면
+//         리플레이 검증·롤백이 불가능. 정수만 쓰면 어디서든 같은 결과가 나온다.
+//         sqrt/atan2/sin/cos는 CORDIC(시프트 + 덧셈 반복)으로 구현.
+
+#include "pvpserver/game/fixed_point.h"
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+
+namespace pvpserver {
+
+namespace {
+
+// atan(2^-i) × 65536 (반올림), CORDIC 회전 각도 테이블
+constexpr std::array<std::int64_t, 16> kAtanTable = {51472, 30386, 16055, 8150, 4091, 2047,
+                                                     1024,  512,   256,   128,  64,   32,
+                                                     16,    8,     4,     2};
+constexpr std::int64_t kCordicGain = 39797;  // 1/K = Π cos(atan(2^-i)) × 65536
+constexpr std::int64_t kPi = 205887;
+constexpr std::int64_t kHalfPi = 102944;
+constexpr std::int64_t kTwoPi = 411775;
+
+}  // namespace
+
+Fixed Fixed::FromDouble(double value) {
+    if (!std::isfinite(value)) {
+        return Fixed{};
+    }
+    const double scaled = value * static_cast<double>(kOne);
+    if (scaled >= static_cast<double>(INT32_MAX)) {
+        return FromRaw(INT32_MAX);
+    }
+    if (scaled <= static_cast<double>(INT32_MIN)) {
+        return FromRaw(INT32_MIN);
+    }
+    return FromRaw(static_cast<std::int32_t>(std::llround(scaled)));
+}
+
+// [Order 1] IntegerSqrt - 비트 단위 정수 제곱근 (부동소수점 미사용)
+std::uint64_t IntegerSqrt(std::uint64_t value) {
+    std::uint64_t result = 0;
+    std::uint64_t bit = std::uint64_t{1} << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+// [Order 2] FixedLength / FixedNormalize
+// [LEARN] raw 값의 제곱합의 제곱근 = 길이의 raw 값 (스케일이 그대로 유지됨)
+Fixed FixedLength(FixedVec2 v) {
+    const auto ax = static_cast<std::uint64_t>(std::llabs(v.x.raw()));
+    const auto ay = static_cast<std::uint64_t>(std::llabs(v.y.raw()));
+    return Fixed::Saturate(static_cast<std::int64_t>(IntegerSqrt(ax * ax + ay * ay)));
+}
+
+FixedVec2 FixedNormalize(FixedVec2 v) {
+    const Fixed length = FixedLength(v);
+    if (length.raw() == 0) {
+        return FixedVec2{};
+    }
+    return FixedVec2{v.x / length, v.y / length};
+}
+
+// [Order 3] FixedAtan2 - CORDIC 벡터링 모드
+// - 벡터를 x축으로 회전시키면서 누적한 회전 각도가 atan2(y, x)
+Fixed FixedAtan2(Fixed y, Fixed x) {
+    std::int64_t vx = x.raw();
+    std::int64_t vy = y.raw();
+    if (vx == 0 && vy == 0) {
+        return Fixed{};
+    }
+    std::int64_t angle = 0;
+    if (vx < 0) {
+        // 좌반면 → 180도 회전하여 우반면으로
+        angle = vy >= 0 ? kPi : -kPi;
+        vx = -vx;
+        vy = -vy;
+    }
+    for (std::size_t i = 0; i < kAtanTable.size(); ++i) {
+        const int shift = static_cast<int>(i);
+        const std::int64_t nx = vy > 0 ? vx + Fixed::FloorShift(vy, shift)
+                                       : vx - Fixed::FloorShift(vy, shift);
+        const std::int64_t ny = vy > 0 ? vy - Fixed::FloorShift(vx, shift)
+                                       : vy + Fixed::FloorShift(vx, shift);
+        angle += vy > 0 ? kAtanTable[i] : -kAtanTable[i];
+        vx = nx;
+        vy = ny;
+    }
+    if (angle > kPi) {
+        angle -= kTwoPi;
+    } else if (angle < -kPi) {
+        angle += kTwoPi;
+    }
+    return Fixed::Saturate(angle);
+}
+
+// [Order 4] FixedDirection - CORDIC 회전 모드 ({cos, sin})
+FixedVec2 FixedDirection(Fixed angle) {
+    // [-pi, pi]로 정규화 후, |angle| > pi/2면 180도 뒤집어서 수렴 범위 안으로
+    std::int64_t z = angle.raw() % kTwoPi;
+    if (z > kPi) {
+        z -= kTwoPi;
+    } else if (z < -kPi) {
+        z += kTwoPi;
+    }
+    bool flip = false;
+    if (z > kHalfPi) {
+        z -= kPi;
+        flip = true;
+    } else if (z < -kHalfPi) {
+        z += kPi;
+        flip = true;
+    }
+
+    std::int64_t vx = kCordicGain;
+    std::int64_t vy = 0;
+    for (std::size_t i = 0; i < kAtanTable.size(); ++i) {
+        const int shift = static_cast<int>(i);
+        const std::int64_t nx = z >= 0 ? vx - Fixed::FloorShift(vy, shift)
+                                       : vx + Fixed::FloorShift(vy, shift);
+        const std::int64_t ny = z >= 0 ? vy + Fixed::FloorShift(vx, shift)
+                                       : vy - Fixed::FloorShift(vx, shift);
+        z += z >= 0 ? -kAtanTable[i] : kAtanTable[i];
+        vx = nx;
+        vy = ny;
+    }
+    if (flip) {
+        vx = -vx;
+        vy = -vy;
+    }
+    return FixedVec2{Fixed::Saturate(vx), Fixed::Saturate(vy)};
+}
+
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 이 파일에서 처음 등장한 개념:
+//
+// 1. Q16.16 고정소수점
+//    - int32의 상위 16비트 = 정수부, 하위 16비트 = 소수부
+//    - 곱셈: 64비트로 곱한 뒤 16비트 시프트, 나눗셈: 65536을 곱한 뒤 나눔
+//    - 음수 시프트/좌측 시프트는 C++17에서 구현 정의/UB → FloorShift, 곱셈으로 대체
+//
+// 2. CORDIC (COordinate Rotation DIgital Computer)
+//    - atan(2^-i) 각도로 회전을 반복하면 시프트 + 덧셈만으로 삼각함수 계산
+//    - 16회 반복 = 약 16비트 정밀도 (Q16.16 해상도와 일치)
+//
+// 관련 설계 문서:
+// - design/v1.4.1-prediction.md (결정론적 시뮬레이션)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/game/game_session.cpp (SimulationMode::FixedPoint 경로)
+// ================================================================================
@@ -12,7 +12,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
 
@@ -29,11 +32,128 @@ constexpr double kPlayerRadius = 0.5;  // 플레이어 충돌 반경 (m)
 constexpr double kFireCooldown = 0.1;  // 발사 쿨다운 (초, 초당 10발)
 constexpr double kSpawnOffset = 0.3;   // 발사체 생성 오프셋 (플레이어 앞)
 constexpr int kDamagePerHit = 20;      // 발사체 적중 데미지 (HP)
+
+// FixedPoint 모드 상수 (같은 double 상수에서 결정론적으로 변환)
+const Fixed kFixedPlayerSpeed = Fixed::FromDouble(kPlayerSpeed);
+const Fixed kFixedPlayerRadius = Fixed::FromDouble(kPlayerRadius);
+const Fixed kFixedFireCooldown = Fixed::FromDouble(kFireCooldown);
+const Fixed kFixedSpawnOffset = Fixed::FromDouble(kSpawnOffset);
+
+// FNV-1a 64비트 해시 (StateChecksum용)
+constexpr std::uint64_t kFnvOffset = 1469598103934665603ULL;
+constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+
+void HashBytes(std::uint64_t& hash, const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+}
+
+template <typename T>
+void HashValue(std::uint64_t& hash, const T& value) {
+    HashBytes(hash, &value, sizeof(value));
+}
+
+// 상태 직렬화 (ExportState / Checkpoint::Encode용, 빅엔디언)
+// - double은 비트 패턴 그대로 → 이전 후에도 StateChecksum이 같음
+constexpr std::uint8_t kStateMagic[2] = {'G', 'S'};
+constexpr std::uint8_t kStateVersion = 1;
+
+void WriteU8(std::vector<std::uint8_t>& out, std::uint8_t value) { out.push_back(value); }
+
+void WriteU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+void WriteU64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+void WriteDouble(std::vector<std::uint8_t>& out, double value) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteU64(out, bits);
+}
+
+void WriteFixed(std::vector<std::uint8_t>& out, Fixed value) {
+    WriteU32(out, static_cast<std::uint32_t>(value.raw()));
+}
+
+void WriteString(std::vector<std::uint8_t>& out, const std::string& value) {
+    WriteU32(out, static_cast<std::uint32_t>(value.size()));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+void Require(const std::vector<std::uint8_t>& data, std::size_t offset, std::size_t size) {
+    if (size > data.size() || offset > data.size() - size) {
+        throw std::runtime_error("GameSession state truncated");
+    }
+}
+
+std::uint8_t ReadU8(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    Require(data, offset, 1);
+    return data[offset++];
+}
+
+std::uint32_t ReadU32(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    Require(data, offset, 4);
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value = (value << 8) | data[offset++];
+    }
+    return value;
+}
+
+std::uint64_t ReadU64(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    Require(data, offset, 8);
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | data[offset++];
+    }
+    return value;
+}
+
+double ReadDouble(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint64_t bits = ReadU64(data, offset);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+Fixed ReadFixed(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    return Fixed::FromRaw(static_cast<std::int32_t>(ReadU32(data, offset)));
+}
+
+std::string ReadString(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint32_t size = ReadU32(data, offset);
+    Require(data, offset, size);
+    std::string value(data.begin() + static_cast<std::ptrdiff_t>(offset),
+                      data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+    offset += size;
+    return value;
+}
+
+// 개수 필드 검증: 항목마다 최소 1바이트는 있어야 하므로 남은 길이보다 클 수 없음
+std::uint32_t ReadCount(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint32_t count = ReadU32(data, offset);
+    if (count > data.size() - offset) {
+        throw std::runtime_error("GameSession state count out of range");
+    }
+    return count;
+}
 }  // namespace
 
 // [Order 2] 생성자
 // - combat_log_(32): 최근 32개의 전투 이벤트를 링 버퍼로 저장
-GameSession::GameSession(double /*tick_rate*/) : speed_per_second_(kPlayerSpeed), combat_log_(32) {}
+// - mode: FixedPoint면 이동/발사체/충돌을 Q16.16 정수 연산으로 수행
+GameSession::GameSession(double /*tick_rate*/, SimulationMode mode)
+    : mode_(mode), speed_per_second_(kPlayerSpeed), combat_log_(32) {}
 
 // [Order 3] UpsertPlayer - 플레이어 생성 또는 갱신
 // - 새 플레이어면 초기 상태로 생성, 기존 플레이어면 체력 리셋
@@ -49,6 +169,7 @@ void GameSession::UpsertPlayer(const std::string& player_id) {
         runtime.state.y = 0.0;
         runtime.state.facing_radians = 0.0;
         runtime.state.last_sequence = 0;
+        runtime.fixed_position = FixedVec2{};
         runtime.shots_fired = 0;
         runtime.hits_landed = 0;
         runtime.deaths = 0;
@@ -61,6 +182,7 @@ void GameSession::UpsertPlayer(const std::string& player_id) {
     runtime.state.is_alive = runtime.health.is_alive();
     runtime.death_announced = false;
     runtime.last_fire_time = std::numeric_limits<double>::lowest();
+    runtime.has_fired = false;
 }
 
 // [Order 4] RemovePlayer - 플레이어 제거
@@ -99,6 +221,11 @@ void GameSession::ApplyInput(const std::string& player_id, const MovementInput&
     }
     state.last_sequence = input.sequence;
 
+    if (mode_ == SimulationMode::FixedPoint) {
+        ApplyInputFixedLocked(runtime, input, delta_seconds);
+        return;
+    }
+
     // 마우스 위치로 플레이어 바라보는 방향 계산
     // [LEARN] atan2(y, x)는 C 표준 라이브러리 함수. 라디안 각도 반환.
     state.facing_radians = std::atan2(input.mouse_y, input.mouse_x);
@@ -143,7 +270,11 @@ void GameSession::ApplyInput(const std::string& player_id, const MovementInput&
 // - 클론 가이드 단계: [v1.0.0], [v1.1.0]
 void GameSession::Tick(std::uint64_t tick, double delta_seconds) {
     std::lock_guard<std::mutex> lk(mutex_);
-    UpdateProjectilesLocked(tick, delta_seconds);
+    if (mode_ == SimulationMode::FixedPoint) {
+        UpdateProjectilesFixedLocked(tick, delta_seconds);
+    } else {
+        UpdateProjectilesLocked(tick, delta_seconds);
+    }
 }
 
 PlayerState GameSession::GetPlayer(const std::string& player_id) const {
@@ -204,6 +335,298 @@ std::size_t GameSession::ActiveProjectileCount() const {
 
 void GameSession::AppendCombatEvent(const CombatEvent& event) { combat_log_.Add(event); }
 
+// [Order 6-1] SaveCheckpoint / RestoreCheckpoint - 롤백용 상태 저장/복원
+// - 서버 측 롤백 엔진(RollbackEngine)이 틱 시작 시점마다 호출
+// - out의 기존 벡터/문자열 용량을 재사용하므로 정상 상태에서는 할당이 거의 없음
+// [LEARN] 복원 시 players_ 맵을 새로 만들지 않고 기존 엔트리에 대입.
+//         unordered_map의 버킷 구조가 그대로 유지되어 순회 순서(=충돌 검사 순서)도
+//         원래 시뮬레이션과 같아진다. 재시뮬레이션 결정론에 필요.
+void GameSession::SaveCheckpoint(Checkpoint& out) const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    out.players_.resize(players_.size());
+    std::size_t index = 0;
+    for (const auto& kv : players_) {
+        out.players_[index].first = kv.first;
+        out.players_[index].second = kv.second;
+        ++index;
+    }
+    out.projectiles_ = projectiles_;
+    out.combat_log_ = combat_log_;
+    out.elapsed_time_ = elapsed_time_;
+    out.fixed_elapsed_time_ = fixed_elapsed_time_;
+    out.projectile_counter_ = projectile_counter_;
+    out.projectiles_spawned_total_ = projectiles_spawned_total_;
+    out.projectiles_hits_total_ = projectiles_hits_total_;
+    out.players_dead_total_ = players_dead_total_;
+    out.collisions_checked_total_ = collisions_checked_total_;
+}
+
+void GameSession::RestoreCheckpoint(const Checkpoint& checkpoint) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    // 체크포인트 이후 입장한 플레이어는 제거 (로스터 변경 시 롤백 엔진이 히스토리를 리셋함)
+    for (auto it = players_.begin(); it != players_.end();) {
+        const bool known = std::any_of(
+            checkpoint.players_.begin(), checkpoint.players_.end(),
+            [&](const auto& saved) { return saved.first == it->first; });
+        it = known ? std::next(it) : players_.erase(it);
+    }
+    for (const auto& saved : checkpoint.players_) {
+        players_[saved.first] = saved.second;
+    }
+    projectiles_ = checkpoint.projectiles_;
+    combat_log_ = checkpoint.combat_log_;
+    elapsed_time_ = checkpoint.elapsed_time_;
+    fixed_elapsed_time_ = checkpoint.fixed_elapsed_time_;
+    projectile_counter_ = checkpoint.projectile_counter_;
+    projectiles_spawned_total_ = checkpoint.projectiles_spawned_total_;
+    projectiles_hits_total_ = checkpoint.projectiles_hits_total_;
+    players_dead_total_ = checkpoint.players_dead_total_;
+    collisions_checked_total_ = checkpoint.collisions_checked_total_;
+}
+
+std::uint64_t GameSession::PlayersDeadTotal() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return players_dead_total_;
+}
+
+// [Order 6-2] StateChecksum - 시뮬레이션 상태 해시
+// - 플레이어는 ID 순으로 정렬 (unordered_map 순회 순서는 빌드마다 다를 수 있음)
+// - FixedPoint 모드: raw 정수값을 해시 → 빌드 간 비교 가능
+// - FloatingPoint 모드: double 비트 패턴을 해시 → 같은 바이너리 내 비교용
+std::uint64_t GameSession::StateChecksum() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<const std::pair<const std::string, PlayerRuntimeState>*> ordered;
+    ordered.reserve(players_.size());
+    for (const auto& kv : players_) {
+        ordered.push_back(&kv);
+    }
+    std::sort(ordered.begin(), ordered.end(),
+              [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    const bool fixed = mode_ == SimulationMode::FixedPoint;
+    std::uint64_t hash = kFnvOffset;
+    if (fixed) {
+        HashValue(hash, fixed_elapsed_time_.raw());
+    } else {
+        HashValue(hash, elapsed_time_);
+    }
+    for (const auto* entry : ordered) {
+        const PlayerRuntimeState& runtime = entry->second;
+        HashBytes(hash, entry->first.data(), entry->first.size());
+        if (fixed) {
+            HashValue(hash, runtime.fixed_position.x.raw());
+            HashValue(hash, runtime.fixed_position.y.raw());
+        } else {
+            HashValue(hash, runtime.state.x);
+            HashValue(hash, runtime.state.y);
+        }
+        HashValue(hash, runtime.state.last_sequence);
+        HashValue(hash, runtime.state.health);
+        HashValue(hash, runtime.state.shots_fired);
+        HashValue(hash, runtime.state.hits_landed);
+    }
+    for (const auto& projectile : projectiles_) {
+        HashBytes(hash, projectile.id().data(), projectile.id().size());
+        if (fixed) {
+            HashValue(hash, projectile.fixed_position().x.raw());
+            HashValue(hash, projectile.fixed_position().y.raw());
+        } else {
+            HashValue(hash, projectile.x());
+            HashValue(hash, projectile.y());
+        }
+    }
+    return hash;
+}
+
+
+// [Order 6-3] ExportState / ImportState - 라이브 매치 이전 (노드 간 상태 전송)
+// - 형식: 'G''S' + 버전 + 시뮬레이션 모드 + Checkpoint::Encode
+// - 복원은 RestoreCheckpoint를 그대로 사용 → 롤백과 같은 경로로 검증된 복원 로직
+// [LEARN] 틱 사이에서 내보내므로 아직 소비되지 않은 사망 이벤트는 없다 (틱 직후 바로 소비됨).
+std::vector<std::uint8_t> GameSession::ExportState() const {
+    Checkpoint checkpoint;
+    SaveCheckpoint(checkpoint);
+    std::vector<std::uint8_t> out;
+    out.reserve(256 + checkpoint.player_count() * 128);
+    WriteU8(out, kStateMagic[0]);
+    WriteU8(out, kStateMagic[1]);
+    WriteU8(out, kStateVersion);
+    WriteU8(out, static_cast<std::uint8_t>(mode_));
+    checkpoint.Encode(out);
+    return out;
+}
+
+void GameSession::ImportState(const std::vector<std::uint8_t>& data) {
+    std::size_t offset = 0;
+    if (ReadU8(data, offset) != kStateMagic[0] || ReadU8(data, offset) != kStateMagic[1]) {
+        throw std::runtime_error("GameSession state: bad magic");
+    }
+    if (ReadU8(data, offset) != kStateVersion) {
+        throw std::runtime_error("GameSession state: unsupported version");
+    }
+    if (ReadU8(data, offset) != static_cast<std::uint8_t>(mode_)) {
+        throw std::runtime_error("GameSession state: simulation mode mismatch");
+    }
+    const Checkpoint checkpoint = Checkpoint::Decode(data, offset);
+    if (offset != data.size()) {
+        throw std::runtime_error("GameSession state: trailing bytes");
+    }
+    RestoreCheckpoint(checkpoint);
+    std::lock_guard<std::mutex> lk(mutex_);
+    pending_deaths_.clear();
+}
+
+void GameSession::Checkpoint::Encode(std::vector<std::uint8_t>& out) const {
+    WriteDouble(out, elapsed_time_);
+    WriteFixed(out, fixed_elapsed_time_);
+    WriteU64(out, projectile_counter_);
+    WriteU64(out, projectiles_spawned_total_);
+    WriteU64(out, projectiles_hits_total_);
+    WriteU64(out, players_dead_total_);
+    WriteU64(out, collisions_checked_total_);
+
+    WriteU32(out, static_cast<std::uint32_t>(players_.size()));
+    for (const auto& [player_id, runtime] : players_) {
+        WriteString(out, player_id);
+        WriteDouble(out, runtime.state.x);
+        WriteDouble(out, runtime.state.y);
+        WriteDouble(out, runtime.state.facing_radians);
+        WriteU64(out, runtime.state.last_sequence);
+        WriteU32(out, static_cast<std::uint32_t>(runtime.state.health));
+        WriteU8(out, runtime.state.is_alive ? 1 : 0);
+        WriteU32(out, static_cast<std::uint32_t>(runtime.state.shots_fired));
+        WriteU32(out, static_cast<std::uint32_t>(runtime.state.hits_landed));
+        WriteU32(out, static_cast<std::uint32_t>(runtime.state.deaths));
+        WriteU32(out, static_cast<std::uint32_t>(runtime.health.max()));
+        WriteU32(out, static_cast<std::uint32_t>(runtime.health.current()));
+        WriteDouble(out, runtime.last_fire_time);
+        WriteU8(out, runtime.death_announced ? 1 : 0);
+        WriteU32(out, static_cast<std::uint32_t>(runtime.shots_fired));
+        WriteU32(out, static_cast<std::uint32_t>(runtime.hits_landed));
+        WriteU32(out, static_cast<std::uint32_t>(runtime.deaths));
+        WriteFixed(out, runtime.fixed_position.x);
+        WriteFixed(out, runtime.fixed_position.y);
+        WriteFixed(out, runtime.fixed_last_fire_time);
+        WriteU8(out, runtime.has_fired ? 1 : 0);
+    }
+
+    WriteU32(out, static_cast<std::uint32_t>(projectiles_.size()));
+    for (const auto& projectile : projectiles_) {
+        const Projectile::State state = projectile.SaveState();
+        WriteString(out, state.id);
+        WriteString(out, state.owner_id);
+        WriteDouble(out, state.x);
+        WriteDouble(out, state.y);
+        WriteDouble(out, state.dir_x);
+        WriteDouble(out, state.dir_y);
+        WriteDouble(out, state.spawn_time);
+        WriteU8(out, state.active ? 1 : 0);
+        WriteFixed(out, state.fixed_position.x);
+        WriteFixed(out, state.fixed_position.y);
+        WriteFixed(out, state.fixed_direction.x);
+        WriteFixed(out, state.fixed_direction.y);
+        WriteFixed(out, state.fixed_spawn_time);
+    }
+
+    const auto events = combat_log_.Snapshot();
+    WriteU32(out, static_cast<std::uint32_t>(combat_log_.Capacity()));
+    WriteU32(out, static_cast<std::uint32_t>(events.size()));
+    for (const auto& event : events) {
+        WriteU8(out, static_cast<std::uint8_t>(event.type));
+        WriteString(out, event.shooter_id);
+        WriteString(out, event.target_id);
+        WriteString(out, event.projectile_id);
+        WriteU32(out, static_cast<std::uint32_t>(event.damage));
+        WriteU64(out, event.tick);
+    }
+}
+
+GameSession::Checkpoint GameSession::Checkpoint::Decode(const std::vector<std::uint8_t>& data,
+                                                        std::size_t& offset) {
+    Checkpoint checkpoint;
+    checkpoint.elapsed_time_ = ReadDouble(data, offset);
+    checkpoint.fixed_elapsed_time_ = ReadFixed(data, offset);
+    checkpoint.projectile_counter_ = ReadU64(data, offset);
+    checkpoint.projectiles_spawned_total_ = ReadU64(data, offset);
+    checkpoint.projectiles_hits_total_ = ReadU64(data, offset);
+    checkpoint.players_dead_total_ = ReadU64(data, offset);
+    checkpoint.collisions_checked_total_ = ReadU64(data, offset);
+
+    const std::uint32_t player_count = ReadCount(data, offset);
+    checkpoint.players_.reserve(player_count);
+    for (std::uint32_t i = 0; i < player_count; ++i) {
+        std::string player_id = ReadString(data, offset);
+        PlayerRuntimeState runtime;
+        runtime.state.player_id = player_id;
+        runtime.state.x = ReadDouble(data, offset);
+        runtime.state.y = ReadDouble(data, offset);
+        runtime.state.facing_radians = ReadDouble(data, offset);
+        runtime.state.last_sequence = ReadU64(data, offset);
+        runtime.state.health = static_cast<int>(ReadU32(data, offset));
+        runtime.state.is_alive = ReadU8(data, offset) != 0;
+        runtime.state.shots_fired = static_cast<int>(ReadU32(data, offset));
+        runtime.state.hits_landed = static_cast<int>(ReadU32(data, offset));
+        runtime.state.deaths = static_cast<int>(ReadU32(data, offset));
+        const int max_hp = static_cast<int>(ReadU32(data, offset));
+        const int current_hp = static_cast<int>(ReadU32(data, offset));
+        if (max_hp <= 0 || current_hp < 0 || current_hp > max_hp) {
+            throw std::runtime_error("GameSession state: invalid health");
+        }
+        // HealthComponent는 현재 HP를 직접 설정할 수 없으므로 차이만큼 데미지로 재현
+        runtime.health = HealthComponent(max_hp);
+        runtime.health.ApplyDamage(max_hp - current_hp);
+        runtime.last_fire_time = ReadDouble(data, offset);
+        runtime.death_announced = ReadU8(data, offset) != 0;
+        runtime.shots_fired = static_cast<int>(ReadU32(data, offset));
+        runtime.hits_landed = static_cast<int>(ReadU32(data, offset));
+        runtime.deaths = static_cast<int>(ReadU32(data, offset));
+        runtime.fixed_position.x = ReadFixed(data, offset);
+        runtime.fixed_position.y = ReadFixed(data, offset);
+        runtime.fixed_last_fire_time = ReadFixed(data, offset);
+        runtime.has_fired = ReadU8(data, offset) != 0;
+        checkpoint.players_.emplace_back(std::move(player_id), std::move(runtime));
+    }
+
+    const std::uint32_t projectile_count = ReadCount(data, offset);
+    checkpoint.projectiles_.reserve(projectile_count);
+    for (std::uint32_t i = 0; i < projectile_count; ++i) {
+        Projectile::State state;
+        state.id = ReadString(data, offset);
+        state.owner_id = ReadString(data, offset);
+        state.x = ReadDouble(data, offset);
+        state.y = ReadDouble(data, offset);
+        state.dir_x = ReadDouble(data, offset);
+        state.dir_y = ReadDouble(data, offset);
+        state.spawn_time = ReadDouble(data, offset);
+        state.active = ReadU8(data, offset) != 0;
+        state.fixed_position.x = ReadFixed(data, offset);
+        state.fixed_position.y = ReadFixed(data, offset);
+        state.fixed_direction.x = ReadFixed(data, offset);
+        state.fixed_direction.y = ReadFixed(data, offset);
+        state.fixed_spawn_time = ReadFixed(data, offset);
+        checkpoint.projectiles_.push_back(Projectile::FromState(std::move(state)));
+    }
+
+    const std::uint32_t capacity = ReadU32(data, offset);
+    const std::uint32_t event_count = ReadCount(data, offset);
+    checkpoint.combat_log_ = CombatLog(capacity);
+    for (std::uint32_t i = 0; i < event_count; ++i) {
+        CombatEvent event;
+        const std::uint8_t type = ReadU8(data, offset);
+        if (type > static_cast<std::uint8_t>(CombatEventType::Death)) {
+            throw std::runtime_error("GameSession state: invalid combat event");
+        }
+        event.type = static_cast<CombatEventType>(type);
+        event.shooter_id = ReadString(data, offset);
+        event.target_id = ReadString(data, offset);
+        event.projectile_id = ReadString(data, offset);
+        event.damage = static_cast<int>(ReadU32(data, offset));
+        event.tick = ReadU64(data, offset);
+        checkpoint.combat_log_.Add(event);
+    }
+    return checkpoint;
+}
+
 // [Order 7] TrySpawnProjectile - 발사체 생성 시도
 // - 쿨다운 체크, 방향 계산, 발사체 객체 생성
 // - 클론 가이드 단계: [v1.1.0]
@@ -290,47 +713,7 @@ void GameSession::UpdateProjectilesLocked(std::uint64_t tick, double delta_secon
             const double distance_sq = dx * dx + dy * dy;
             if (distance_sq <= radius_sum * radius_sum) {
                 // 충돌 발생!
-                projectile.Deactivate();
-                CombatEvent hit_event;
-                hit_event.type = CombatEventType::Hit;
-                hit_event.shooter_id = projectile.owner_id();
-                hit_event.target_id = runtime.state.player_id;
-                hit_event.projectile_id = projectile.id();
-                hit_event.damage = kDamagePerHit;
-                hit_event.tick = tick;
-                AppendCombatEvent(hit_event);
-                std::cout << "hit " << hit_event.shooter_id << "->" << hit_event.target_id
-                          << " dmg=" << hit_event.damage << std::endl;
-                ++projectiles_hits_total_;
-
-                // 데미지 적용 + 사망 체크
-                const bool died = runtime.health.ApplyDamage(kDamagePerHit);
-                runtime.state.health = runtime.health.current();
-                runtime.state.is_alive = runtime.health.is_alive();
-
-                // 발사한 플레이어의 적중 횟수 증가
-                auto shooter_it = players_.find(projectile.owner_id());
-                if (shooter_it != players_.end()) {
-                    ++shooter_it->second.hits_landed;
-                    shooter_it->second.state.hits_landed = shooter_it->second.hits_landed;
-                }
-
-                if (died && !runtime.death_announced) {
-                    // 사망 이벤트 발생 (한 번만)
-                    runtime.death_announced = true;
-                    CombatEvent death_event;
-                    death_event.type = CombatEventType::Death;
-                    death_event.shooter_id = projectile.owner_id();
-                    death_event.target_id = runtime.state.player_id;
-                    death_event.projectile_id = projectile.id();
-                    death_event.tick = tick;
-                    pending_deaths_.push_back(death_event);  // 클라이언트에 브로드캐스트용
-                    AppendCombatEvent(death_event);
-                    ++players_dead_total_;
-                    ++runtime.deaths;
-                    runtime.state.deaths = runtime.deaths;
-                    std::cout << "death " << runtime.state.player_id << std::endl;
-                }
+                ResolveHitLocked(projectile, runtime, tick);
                 break;  // 발사체는 한 명만 맞추면 소멸
             }
         }
@@ -345,6 +728,176 @@ void GameSession::UpdateProjectilesLocked(std::uint64_t tick, double delta_secon
         projectiles_.end());
 }
 
+// [Order 9] ResolveHitLocked - 적중 처리 (데미지, 통계, 사망 이벤트)
+// - double/고정소수점 충돌 검사 양쪽에서 공용으로 사용
+void GameSession::ResolveHitLocked(Projectile& projectile, PlayerRuntimeState& runtime,
+                                   std::uint64_t tick) {
+    projectile.Deactivate();
+    CombatEvent hit_event;
+    hit_event.type = CombatEventType::Hit;
+    hit_event.shooter_id = projectile.owner_id();
+    hit_event.target_id = runtime.state.player_id;
+    hit_event.projectile_id = projectile.id();
+    hit_event.damage = kDamagePerHit;
+    hit_event.tick = tick;
+    AppendCombatEvent(hit_event);
+    std::cout << "hit " << hit_event.shooter_id << "->" << hit_event.target_id
+              << " dmg=" << hit_event.damage << std::endl;
+    ++projectiles_hits_total_;
+
+    // 데미지 적용 + 사망 체크
+    const bool died = runtime.health.ApplyDamage(kDamagePerHit);
+    runtime.state.health = runtime.health.current();
+    runtime.state.is_alive = runtime.health.is_alive();
+
+    // 발사한 플레이어의 적중 횟수 증가
+    auto shooter_it = players_.find(projectile.owner_id());
+    if (shooter_it != players_.end()) {
+        ++shooter_it->second.hits_landed;
+        shooter_it->second.state.hits_landed = shooter_it->second.hits_landed;
+    }
+
+    if (died && !runtime.death_announced) {
+        // 사망 이벤트 발생 (한 번만)
+        runtime.death_announced = true;
+        CombatEvent death_event;
+        death_event.type = CombatEventType::Death;
+        death_event.shooter_id = projectile.owner_id();
+        death_event.target_id = runtime.state.player_id;
+        death_event.projectile_id = projectile.id();
+        death_event.tick = tick;
+        pending_deaths_.push_back(death_event);  // 클라이언트에 브로드캐스트용
+        AppendCombatEvent(death_event);
+        ++players_dead_total_;
+        ++runtime.deaths;
+        runtime.state.deaths = runtime.deaths;
+        std::cout << "death " << runtime.state.player_id << std::endl;
+    }
+}
+
+// [Order 10] ApplyInputFixedLocked - 고정소수점 입력 처리 (SimulationMode::FixedPoint)
+// - ApplyInput과 같은 규칙, 모든 계산을 Q16.16 정수로 수행
+// [LEARN] 입력(double)은 진입 시 한 번만 Fixed로 양자화. 같은 입력이면 항상 같은 raw 값이므로
+//         이후 계산은 컴파일러/CPU에 관계없이 동일하다. state.x/y는 표시용 사본.
+void GameSession::ApplyInputFixedLocked(PlayerRuntimeState& runtime, const MovementInput& input,
+                                        double delta_seconds) {
+    PlayerState& state = runtime.state;
+    const FixedVec2 aim{Fixed::FromDouble(input.mouse_x), Fixed::FromDouble(input.mouse_y)};
+    state.facing_radians = FixedAtan2(aim.y, aim.x).ToDouble();
+
+    if (state.is_alive) {
+        FixedVec2 direction;
+        if (input.up) {
+            direction.y -= Fixed::FromInt(1);
+        }
+        if (input.down) {
+            direction.y += Fixed::FromInt(1);
+        }
+        if (input.left) {
+            direction.x -= Fixed::FromInt(1);
+        }
+        if (input.right) {
+            direction.x += Fixed::FromInt(1);
+        }
+        direction = FixedNormalize(direction);
+
+        const Fixed distance = kFixedPlayerSpeed * Fixed::FromDouble(delta_seconds);
+        runtime.fixed_position.x += direction.x * distance;
+        runtime.fixed_position.y += direction.y * distance;
+        state.x = runtime.fixed_position.x.ToDouble();
+        state.y = runtime.fixed_position.y.ToDouble();
+    }
+
+    TrySpawnProjectileFixed(runtime, input);
+}
+
+bool GameSession::TrySpawnProjectileFixed(PlayerRuntimeState& runtime, const MovementInput& input) {
+    if (!input.fire || !runtime.state.is_alive) {
+        return false;
+    }
+    const FixedVec2 direction =
+        FixedNormalize(FixedVec2{Fixed::FromDouble(input.mouse_x), Fixed::FromDouble(input.mouse_y)});
+    if (direction.x.raw() == 0 && direction.y.raw() == 0) {
+        return false;
+    }
+    if (runtime.has_fired && (fixed_elapsed_time_ - runtime.fixed_last_fire_time) < kFixedFireCooldown) {
+        return false;
+    }
+    runtime.has_fired = true;
+    runtime.fixed_last_fire_time = fixed_elapsed_time_;
+    runtime.last_fire_time = fixed_elapsed_time_.ToDouble();
+
+    const FixedVec2 spawn{runtime.fixed_position.x + direction.x * kFixedSpawnOffset,
+                          runtime.fixed_position.y + direction.y * kFixedSpawnOffset};
+    std::ostringstream id_stream;
+    id_stream << "projectile-" << ++projectile_counter_;
+    projectiles_.emplace_back(id_stream.str(), runtime.state.player_id, spawn, direction,
+                              fixed_elapsed_time_);
+    ++projectiles_spawned_total_;
+    ++runtime.shots_fired;
+    runtime.state.shots_fired = runtime.shots_fired;
+    return true;
+}
+
+// [Order 11] UpdateProjectilesFixedLocked - 고정소수점 발사체 이동 + 충돌
+// - 플레이어를 ID 순으로 검사 (unordered_map 순회 순서는 표준 라이브러리마다 다름)
+// - 거리² 비교는 64비트 raw 값으로 수행 (AABB 검사 후라 오버플로 없음)
+void GameSession::UpdateProjectilesFixedLocked(std::uint64_t tick, double delta_seconds) {
+    const Fixed delta = Fixed::FromDouble(delta_seconds);
+    fixed_elapsed_time_ += delta;
+    elapsed_time_ = fixed_elapsed_time_.ToDouble();
+
+    for (auto& projectile : projectiles_) {
+        projectile.AdvanceFixed(delta);
+        if (projectile.IsExpiredFixed(fixed_elapsed_time_)) {
+            projectile.Deactivate();
+        }
+    }
+
+    std::vector<PlayerRuntimeState*> ordered;
+    ordered.reserve(players_.size());
+    for (auto& kv : players_) {
+        ordered.push_back(&kv.second);
+    }
+    std::sort(ordered.begin(), ordered.end(), [](const auto* a, const auto* b) {
+        return a->state.player_id < b->state.player_id;
+    });
+
+    const Fixed radius_sum = Projectile::FixedRadius() + kFixedPlayerRadius;
+    const std::int64_t radius_sum_sq = std::int64_t{radius_sum.raw()} * radius_sum.raw();
+    std::uint64_t pairs_checked = 0;
+    for (auto& projectile : projectiles_) {
+        if (!projectile.active()) {
+            continue;
+        }
+        const FixedVec2 position = projectile.fixed_position();
+        for (PlayerRuntimeState* runtime : ordered) {
+            if (!runtime->state.is_alive || runtime->state.player_id == projectile.owner_id()) {
+                continue;
+            }
+            ++pairs_checked;
+
+            const std::int64_t dx =
+                std::int64_t{position.x.raw()} - runtime->fixed_position.x.raw();
+            const std::int64_t dy =
+                std::int64_t{position.y.raw()} - runtime->fixed_position.y.raw();
+            if (std::llabs(dx) > radius_sum.raw() || std::llabs(dy) > radius_sum.raw()) {
+                continue;
+            }
+            if (dx * dx + dy * dy <= radius_sum_sq) {
+                ResolveHitLocked(projectile, *runtime, tick);
+                break;
+            }
+        }
+    }
+
+    collisions_checked_total_ += pairs_checked;
+    projectiles_.erase(
+        std::remove_if(projectiles_.begin(), projectiles_.end(),
+                       [](const Projectile& projectile) { return !projectile.active(); }),
+        projectiles_.end());
+}
+
 }  // namespace pvpserver
 
 // [Reader Notes]
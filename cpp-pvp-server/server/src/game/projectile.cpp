@@ -42,6 +42,25 @@ Projectile::Projectile(std::string id, std::string owner_id, double x, double y,
     dir_y_ /= magnitude;
 }
 
+// [Order 1-1] 고정소수점 생성자 - 결정론적 시뮬레이션 모드
+// - 방향 정규화는 호출자(GameSession)가 FixedNormalize로 이미 수행
+Projectile::Projectile(std::string id, std::string owner_id, FixedVec2 position,
+                       FixedVec2 direction, Fixed spawn_time_seconds)
+    : id_(std::move(id)),
+      owner_id_(std::move(owner_id)),
+      x_(position.x.ToDouble()),
+      y_(position.y.ToDouble()),
+      dir_x_(direction.x.ToDouble()),
+      dir_y_(direction.y.ToDouble()),
+      spawn_time_(spawn_time_seconds.ToDouble()),
+      fixed_position_(position),
+      fixed_direction_(direction),
+      fixed_spawn_time_(spawn_time_seconds) {
+    if (direction.x.raw() == 0 && direction.y.raw() == 0) {
+        throw std::invalid_argument("Projectile direction must be non-zero");
+    }
+}
+
 // [Order 2] Advance - 발사체 이동
 // - 거리 = 속도 × 시간 (등속 직선 운동)
 // - kSpeed_ = 30.0 m/s (헤더에서 정의)
@@ -63,9 +82,64 @@ bool Projectile::IsExpired(double now_seconds) const {
     return (now_seconds - spawn_time_) >= kLifetime_;
 }
 
+// [Order 3-1] AdvanceFixed / IsExpiredFixed - 고정소수점 경로 (정수 연산만 사용)
+void Projectile::AdvanceFixed(Fixed delta_seconds) {
+    if (!active_) {
+        return;
+    }
+    static const Fixed kFixedSpeed = Fixed::FromDouble(kSpeed_);
+    const Fixed distance = kFixedSpeed * delta_seconds;
+    fixed_position_.x += fixed_direction_.x * distance;
+    fixed_position_.y += fixed_direction_.y * distance;
+    x_ = fixed_position_.x.ToDouble();
+    y_ = fixed_position_.y.ToDouble();
+}
+
+bool Projectile::IsExpiredFixed(Fixed now_seconds) const {
+    if (!active_) {
+        return true;
+    }
+    static const Fixed kFixedLifetime = Fixed::FromDouble(kLifetime_);
+    return (now_seconds - fixed_spawn_time_) >= kFixedLifetime;
+}
+
 // 발사체 비활성화 (충돌 또는 만료 시 호출)
 void Projectile::Deactivate() { active_ = false; }
 
+// [Order 3-2] SaveState / FromState - 노드 간 매치 이전용
+// - 생성자를 거치면 방향을 다시 정규화하므로 마지막 비트가 달라질 수 있음 → 필드를 그대로 복사
+Projectile::State Projectile::SaveState() const {
+    State state;
+    state.id = id_;
+    state.owner_id = owner_id_;
+    state.x = x_;
+    state.y = y_;
+    state.dir_x = dir_x_;
+    state.dir_y = dir_y_;
+    state.spawn_time = spawn_time_;
+    state.active = active_;
+    state.fixed_position = fixed_position_;
+    state.fixed_direction = fixed_direction_;
+    state.fixed_spawn_time = fixed_spawn_time_;
+    return state;
+}
+
+Projectile Projectile::FromState(State state) {
+    Projectile projectile;
+    projectile.id_ = std::move(state.id);
+    projectile.owner_id_ = std::move(state.owner_id);
+    projectile.x_ = state.x;
+    projectile.y_ = state.y;
+    projectile.dir_x_ = state.dir_x;
+    projectile.dir_y_ = state.dir_y;
+    projectile.spawn_time_ = state.spawn_time;
+    projectile.active_ = state.active;
+    projectile.fixed_position_ = state.fixed_position;
+    projectile.fixed_direction_ = state.fixed_direction;
+    projectile.fixed_spawn_time_ = state.fixed_spawn_time;
+    return projectile;
+}
+
 const std::string& Projectile::id() const noexcept { return id_; }
 
 const std::string& Projectile::owner_id() const noexcept { return owner_id_; }
@@ -84,6 +158,13 @@ bool Projectile::active() const noexcept { return active_; }
 
 double Projectile::radius() const noexcept { return kRadius_; }
 
+FixedVec2 Projectile::fixed_position() const noexcept { return fixed_position_; }
+
+Fixed Projectile::FixedRadius() noexcept {
+    static const Fixed kFixedRadius = Fixed::FromDouble(kRadius_);
+    return kFixedRadius;
+}
+
 double Projectile::Speed() noexcept { return kSpeed_; }
 
 double Projectile::Lifetime() noexcept { return kLifetime_; }
@@ -24,6 +24,7 @@
 #include "pvpserver/game/game_session.h"
 #include "pvpserver/matchmaking/match_queue.h"
 #include "pvpserver/matchmaking/matchmaker.h"
+#include "pvpserver/matchmaking/sharded_matchmaker.h"
 #include "pvpserver/network/metrics_http_server.h"
 #include "pvpserver/network/profile_http_router.h"
 #include "pvpserver/network/websocket_server.h"
@@ -48,13 +49,10 @@ int main() {
     // - GameLoop: 60 TPS 고정 틱레이트 루프
     // - PostgresStorage: 데이터베이스 연결
     // 클론 가이드 단계: [v1.0.0]
-    GameSession session(config.tick_rate());
+    GameSession session(config.tick_rate(), config.deterministic_simulation()
+                                                ? SimulationMode::FixedPoint
+                                                : SimulationMode::FloatingPoint);
     GameLoop loop(config.tick_rate());
-    PostgresStorage storage(config.database_dsn());
-    if (!storage.Connect()) {
-        std::cerr << "Failed to connect to Postgres at startup; continuing in degraded mode."
-                  << std::endl;
-    }
 
     // [Order 3] Boost.Asio io_context 및 서비스 객체들 생성
     // [LEARN] io_context는 C의 epoll/kqueue 이벤트 루프를 추상화한 것.
@@ -62,9 +60,16 @@ int main() {
     //         C에서 while(1) { epoll_wait(...); handle_events(); } 패턴과 유사.
     // [LEARN] std::make_shared<T>()는 힙에 T를 할당하고 참조 카운팅 포인터 반환.
     //         C의 malloc + 수동 free 대신 자동 메모리 관리.
+    // [LEARN] 지역 변수는 선언의 역순으로 소멸한다. io_context를 storage보다 먼저 선언해야
+    //         연결 풀(디스크립터/타이머/strand)이 살아 있는 io_context 위에서 정리된다.
     boost::asio::io_context io_context;
-    auto match_queue = std::make_shared<InMemoryMatchQueue>();
-    auto matchmaker = std::make_shared<Matchmaker>(match_queue);
+    PostgresStorage storage(config.database_dsn());
+    // 세션 이벤트는 비동기 연결 풀로 기록 (io 스레드가 DB 응답을 기다리지 않음).
+    // 연결 실패는 풀이 백오프로 재시도하며, 그동안 이벤트는 실패로 집계만 된다.
+    storage.StartAsync(io_context);
+    // 리전별 매치메이킹 샤드 (각자 워커 스레드에서 200ms마다 매칭)
+    auto matchmaker = std::make_shared<ShardedMatchmaker>(
+        config.matchmaking_regions(), std::vector<MatchFormat>{MatchFormat::Duel()});
     auto leaderboard = std::make_shared<InMemoryLeaderboardStore>();
     auto profile_service = std::make_shared<PlayerProfileService>(leaderboard);
     auto server = std::make_shared<WebSocketServer>(io_context, config.port(), session, loop);
@@ -92,6 +97,37 @@ int main() {
     server->SetMatchCompletedCallback(
         [profile_service](const MatchResult& result) { profile_service->RecordMatch(result); });
 
+    // 매치 결과/프로필은 메모리가 원본, Postgres는 전용 스레드가 모아서 기록 (write-behind)
+    storage.StartWriteBehind();
+    profile_service->SetPersistenceSink(
+        [&storage](const MatchResult& result, const std::vector<PlayerProfile>& profiles) {
+            MatchResultRecord record;
+            record.match_id = result.match_id();
+            record.winner_id = result.winner_id();
+            record.loser_id = result.loser_id();
+            for (const auto& team : result.placements()) {
+                if (!record.placements.empty()) {
+                    record.placements += ';';
+                }
+                for (std::size_t i = 0; i < team.size(); ++i) {
+                    record.placements += (i ? "," : "") + team[i];
+                }
+            }
+            record.completed_at_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                         result.completed_at().time_since_epoch())
+                                         .count();
+            std::vector<ProfileRecord> rows;
+            rows.reserve(profiles.size());
+            for (const auto& profile : profiles) {
+                rows.push_back(ProfileRecord{profile.player_id, profile.rating, profile.matches,
+                                             profile.wins, profile.losses, profile.kills,
+                                             profile.deaths, profile.shots_fired,
+                                             profile.hits_landed, profile.damage_dealt,
+                                             profile.damage_taken});
+            }
+            storage.EnqueueMatch(std::move(record), std::move(rows));
+        });
+
     // [Order 5] Prometheus 메트릭 수집 및 HTTP 서버 설정
     // - 여러 컴포넌트의 메트릭을 하나로 합쳐서 /metrics 엔드포인트로 노출
     // 클론 가이드 단계: [v1.3.0] 통계 & 모니터링
@@ -105,36 +141,20 @@ int main() {
         return oss.str();
     };
     auto router = std::make_shared<ProfileHttpRouter>(metrics_provider, profile_service);
-    MetricsHttpServer::RequestHandler http_handler =
-        [router](const boost::beast::http::request<boost::beast::http::string_body>& request) {
-            return router->Handle(request);
+    // 캐시된 응답 바이트를 복사 없이 전송 (keep-alive 연결 재사용)
+    MetricsHttpServer::SharedRequestHandler http_handler =
+        [router](const MetricsHttpServer::Request& request) {
+            return router->HandleShared(request);
         };
     auto metrics_server = std::make_shared<MetricsHttpServer>(io_context, config.metrics_port(),
                                                               std::move(http_handler));
 
-    // [Order 6] 매치메이킹 주기 타이머 설정
-    // [LEARN] steady_timer는 일정 간격으로 콜백을 실행하는 타이머.
-    //         C의 timerfd + epoll 조합을 추상화한 것.
-    //         200ms마다 매치메이킹 로직을 실행.
+    // [Order 6] 매치메이킹 워커 시작
+    // [LEARN] 예전에는 io_context의 steady_timer로 200ms마다 RunMatching을 호출했다.
+    //         매칭이 길어지면 같은 스레드의 네트워크 처리도 함께 밀리므로,
+    //         이제는 ShardedMatchmaker가 리전 샤드마다 전용 스레드에서 매칭한다.
     // 클론 가이드 단계: [v1.2.0] 매치메이킹
-    auto matchmaking_timer = std::make_shared<boost::asio::steady_timer>(io_context);
-    std::function<void(const boost::system::error_code&)> matchmaking_tick;
-    matchmaking_tick = [matchmaking_timer, matchmaker,
-                        &matchmaking_tick](const boost::system::error_code& ec) {
-        if (ec == boost::asio::error::operation_aborted) {
-            return;
-        }
-        if (ec) {
-            std::cerr << "matchmaking timer error: " << ec.message() << std::endl;
-            return;
-        }
-        matchmaker->RunMatching(std::chrono::steady_clock::now());
-        matchmaker->notification_channel().Drain();
-        matchmaking_timer->expires_after(std::chrono::milliseconds(200));
-        matchmaking_timer->async_wait(matchmaking_tick);
-    };
-    matchmaking_timer->expires_after(std::chrono::milliseconds(200));
-    matchmaking_timer->async_wait(matchmaking_tick);
+    matchmaker->Start();
 
     // [Order 7] 시그널 핸들러 (graceful shutdown)
     // [LEARN] signal_set은 C의 sigaction/signal을 추상화.
@@ -145,7 +165,8 @@ int main() {
         server->Stop();
         metrics_server->Stop();
         loop.Stop();
-        matchmaking_timer->cancel();
+        matchmaker->Stop();
+        storage.StopAsync();  // 연결 닫기는 풀의 strand에 예약됨 → 아래 poll에서 실행
         io_context.stop();
     });
 
@@ -160,8 +181,14 @@ int main() {
     //         이 호출이 반환되면 서버가 종료됨.
     io_context.run();
 
+    // stop()으로 빠져나오면 예약만 되고 실행되지 못한 정리 핸들러가 남으므로 한 번 더 처리
+    storage.StopAsync();
+    io_context.restart();
+    io_context.poll();
+
     loop.Stop();
     loop.Join();
+    storage.StopWriteBehind();  // 남은 매치 결과 기록
 
     std::cout << "PvP Server stopped" << std::endl;
     return 0;
@@ -15,7 +15,7 @@ namespace pvpserver {
 
 // [Order 1] Match 생성자 - 매치 정보 초기화
 // - match_id: 고유 매치 식별자 ("match-123")
-// - players: 참가자 ID 목록 (보통 2명)
+// - players: 참가자 ID 목록 (1:1이면 2명, 각자 한 팀)
 // - average_elo: 참가자들의 평균 ELO 레이팅
 // - created_at: 매치 생성 시간 (대기 시간 측정용)
 // - region: 게임 서버 리전 ("kr", "us-west" 등)
@@ -25,6 +25,28 @@ Match::Match(std::string match_id, std::vector<std::string> players, int average
       players_(std::move(players)),
       average_elo_(average_elo),
       created_at_(created_at),
-      region_(std::move(region)) {}
+      region_(std::move(region)),
+      mode_("1v1") {
+    teams_.reserve(players_.size());
+    for (const auto& player : players_) {
+        teams_.push_back(MatchTeam{{player}, average_elo_});
+    }
+}
+
+// [Order 2] 팀 매치 생성자 - teams 순서대로 펼친 목록이 players()
+// - mode: MatchFormat 이름 ("2v2", "5v5", "ffa8" 등)
+Match::Match(std::string match_id, std::vector<MatchTeam> teams, int average_elo,
+             std::chrono::steady_clock::time_point created_at, std::string region,
+             std::string mode)
+    : match_id_(std::move(match_id)),
+      teams_(std::move(teams)),
+      average_elo_(average_elo),
+      created_at_(created_at),
+      region_(std::move(region)),
+      mode_(std::move(mode)) {
+    for (const auto& team : teams_) {
+        players_.insert(players_.end(), team.players.begin(), team.players.end());
+    }
+}
 
 }  // namespace pvpserver
@@ -1,10 +1,77 @@
+// [FILE]
+// - 목적: 매치 생성 알림 전달 (우편함 + 비동기 구독자 팬아웃)
+// - 주요 역할: 구독자별 고정 크기 MPMC 큐, 디스패처 스레드, 일괄 전달, 백프레셔 메트릭
+// - 관련 클론 가이드 단계: [CG-v1.2.0] 매치메이킹
+// - 권장 읽는 순서: Publish → Subscribe → DispatchLoop
+//
+// [LEARN] 예전에는 RunMatching이 알림 콜백을 매칭 스레드에서 바로 호출했다.
+//         콜백이 DB 기록이나 네트워크 전송을 하면 그 시간만큼 다음 매칭 패스가 밀린다.
+//         생산자(매칭)와 소비자(알림 처리)를 큐로 분리하고, 큐를 고정 크기로 두어
+//         평소에는 고정 크기 큐만 쓰고, 소비자가 밀려 큐가 차면 구독자별 넘침 목록으로 옮긴다.
+//         매치 알림은 버릴 수 없다: 플레이어는 이미 대기열에서 빠졌으므로
+//         세션을 만드는 구독자가 알림을 놓치면 그 플레이어들은 게임 없이 매칭된 채로 남는다.
+
 #include "pvpserver/matchmaking/match_notification_channel.h"
 
+#include <exception>
+#include <iostream>
+#include <sstream>
+
 namespace pvpserver {
 
+MatchNotificationChannel::MatchNotificationChannel() : MatchNotificationChannel(Options{}) {}
+
+MatchNotificationChannel::MatchNotificationChannel(Options options)
+    : options_(options),
+      mailbox_enabled_(options.mailbox),
+      subscribers_(std::make_shared<const SubscriberList>()) {
+    if (options_.dispatcher_threads == 0) {
+        options_.dispatcher_threads = 1;
+    }
+    if (options_.max_batch == 0) {
+        options_.max_batch = 1;
+    }
+}
+
+MatchNotificationChannel::~MatchNotificationChannel() { Stop(); }
+
+// [Order 1] Publish - 우편함 + 모든 구독자 큐에 넣기 (블로킹 없음)
 void MatchNotificationChannel::Publish(const Match& match) {
-    std::lock_guard<std::mutex> lk(mutex_);
-    queue_.push(match);
+    published_total_.fetch_add(1, std::memory_order_relaxed);
+    if (mailbox_enabled_.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (queue_.size() >= options_.capacity) {
+            queue_.pop();  // 아무도 꺼내 가지 않는 우편함이 무한히 커지지 않도록
+            mailbox_dropped_total_.fetch_add(1, std::memory_order_relaxed);
+        }
+        queue_.push(match);
+    }
+
+    const auto subscribers = LoadSubscribers();
+    for (const auto& subscriber : *subscribers) {
+        // 넘침 목록이 비어 있지 않으면 큐가 비었어도 그 뒤에 붙임 (먼저 넘친 알림을 앞지르지 않게)
+        if (subscriber->overflow_size.load(std::memory_order_acquire) > 0 ||
+            !subscriber->queue.TryPush(match)) {
+            std::lock_guard<std::mutex> overflow_lock(subscriber->overflow_mutex);
+            subscriber->overflow.push_back(match);
+            subscriber->overflow_size.store(subscriber->overflow.size(), std::memory_order_release);
+            subscriber->spilled_total.fetch_add(1, std::memory_order_relaxed);
+        }
+        subscriber->enqueued_total.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t depth =
+            subscriber->queue.ApproxSize() + subscriber->overflow_size.load(std::memory_order_relaxed);
+        std::size_t high = subscriber->depth_high_watermark.load(std::memory_order_relaxed);
+        while (depth > high && !subscriber->depth_high_watermark.compare_exchange_weak(
+                                   high, depth, std::memory_order_relaxed)) {
+        }
+        // [LEARN] 디스패처가 idle을 세운 뒤 큐를 다시 확인하고, 생산자는 넣은 뒤 idle을 확인한다.
+        //         양쪽 모두 seq_cst 펜스를 두면 "둘 다 상대를 못 보는" 경우가 없어 알림이 유실되지 않는다.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Dispatcher& dispatcher = *dispatchers_[subscriber->dispatcher];
+        if (dispatcher.idle.load(std::memory_order_relaxed)) {
+            Wake(dispatcher);
+        }
+    }
 }
 
 std::optional<Match> MatchNotificationChannel::Poll() {
@@ -27,4 +94,221 @@ std::vector<Match> MatchNotificationChannel::Drain() {
     return matches;
 }
 
+void MatchNotificationChannel::SetMailboxEnabled(bool enabled) {
+    mailbox_enabled_.store(enabled);
+    if (!enabled) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        std::queue<Match>().swap(queue_);
+    }
+}
+
+// [Order 2] Subscribe - 구독자 목록을 복사해서 교체 (첫 구독 때 디스패처 시작)
+// - 구독자는 디스패처에 라운드 로빈으로 배정, 같은 구독자의 핸들러는 항상 같은 스레드에서 순서대로 호출
+void MatchNotificationChannel::Subscribe(std::string name, BatchHandler handler) {
+    std::lock_guard<std::mutex> lk(subscribe_mutex_);
+    if (dispatchers_.empty()) {
+        for (std::size_t i = 0; i < options_.dispatcher_threads; ++i) {
+            dispatchers_.push_back(std::make_unique<Dispatcher>());
+        }
+        for (std::size_t i = 0; i < dispatchers_.size(); ++i) {
+            dispatchers_[i]->thread = std::thread([this, i]() { DispatchLoop(i); });
+        }
+    }
+    auto current = LoadSubscribers();
+    auto next = std::make_shared<SubscriberList>(*current);
+    next->push_back(std::make_shared<Subscriber>(std::move(name), std::move(handler),
+                                                 options_.capacity,
+                                                 current->size() % dispatchers_.size()));
+    std::atomic_store(&subscribers_, std::shared_ptr<const SubscriberList>(std::move(next)));
+}
+
+std::shared_ptr<const MatchNotificationChannel::SubscriberList>
+MatchNotificationChannel::LoadSubscribers() const {
+    return std::atomic_load(&subscribers_);
+}
+
+void MatchNotificationChannel::Wake(Dispatcher& dispatcher) {
+    {
+        std::lock_guard<std::mutex> lk(dispatcher.mutex);
+        dispatcher.idle.store(false, std::memory_order_relaxed);
+    }
+    dispatcher.cv.notify_one();
+}
+
+bool MatchNotificationChannel::HasPending(const SubscriberList& subscribers,
+                                          std::size_t index) const {
+    for (const auto& subscriber : subscribers) {
+        if (subscriber->dispatcher == index &&
+            (subscriber->queue.ApproxSize() > 0 ||
+             subscriber->overflow_size.load(std::memory_order_relaxed) > 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// [Order 3] DispatchLoop - 담당 구독자 큐에서 max_batch개씩 꺼내 핸들러 호출
+// - 고정 크기 큐를 먼저, 자리가 남으면 넘침 목록에서 이어서 꺼냄
+// - 할 일이 없으면 idle 표시 후 대기 (Publish가 깨움, 안전장치로 100ms마다 재확인)
+// - Stop()이 호출되면 남은 알림을 모두 전달한 뒤 종료
+void MatchNotificationChannel::DispatchLoop(std::size_t index) {
+    Dispatcher& self = *dispatchers_[index];
+    std::vector<Match> batch;
+    batch.reserve(options_.max_batch);
+    while (true) {
+        const auto subscribers = LoadSubscribers();
+        bool delivered = false;
+        for (const auto& subscriber : *subscribers) {
+            if (subscriber->dispatcher != index) {
+                continue;
+            }
+            batch.clear();
+            Match match{"", {}, 0, std::chrono::steady_clock::time_point{}, ""};
+            while (batch.size() < options_.max_batch && subscriber->queue.TryPop(match)) {
+                batch.push_back(std::move(match));
+            }
+            // 큐에 든 알림이 넘침 목록보다 먼저 발행된 것이므로 큐 다음에 넘침 목록
+            if (batch.size() < options_.max_batch &&
+                subscriber->overflow_size.load(std::memory_order_acquire) > 0) {
+                std::lock_guard<std::mutex> overflow_lock(subscriber->overflow_mutex);
+                while (batch.size() < options_.max_batch && !subscriber->overflow.empty()) {
+                    batch.push_back(std::move(subscriber->overflow.front()));
+                    subscriber->overflow.pop_front();
+                }
+                subscriber->overflow_size.store(subscriber->overflow.size(),
+                                                std::memory_order_release);
+            }
+            if (batch.empty()) {
+                continue;
+            }
+            delivered = true;
+            const auto start = std::chrono::steady_clock::now();
+            try {
+                subscriber->handler(batch);
+            } catch (const std::exception& ex) {
+                std::cerr << "match notification subscriber " << subscriber->name
+                          << " failed: " << ex.what() << std::endl;
+            }
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+            subscriber->handler_us_total.fetch_add(static_cast<std::uint64_t>(elapsed.count()),
+                                                   std::memory_order_relaxed);
+            subscriber->batches_total.fetch_add(1, std::memory_order_relaxed);
+            subscriber->delivered_total.fetch_add(batch.size(), std::memory_order_relaxed);
+        }
+        if (delivered) {
+            continue;
+        }
+        if (stopping_.load()) {
+            return;
+        }
+        self.idle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (HasPending(*subscribers, index)) {
+            self.idle.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        std::unique_lock<std::mutex> lk(self.mutex);
+        self.cv.wait_for(lk, std::chrono::milliseconds(100), [this, &self]() {
+            return !self.idle.load(std::memory_order_relaxed) || stopping_.load();
+        });
+        self.idle.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool MatchNotificationChannel::Flush(std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        bool done = true;
+        for (const auto& subscriber : *LoadSubscribers()) {
+            if (subscriber->delivered_total.load() < subscriber->enqueued_total.load()) {
+                done = false;
+                break;
+            }
+        }
+        if (done) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void MatchNotificationChannel::Stop() {
+    std::lock_guard<std::mutex> lk(subscribe_mutex_);
+    if (stopping_.exchange(true)) {
+        return;
+    }
+    for (auto& dispatcher : dispatchers_) {
+        Wake(*dispatcher);
+    }
+    for (auto& dispatcher : dispatchers_) {
+        if (dispatcher->thread.joinable()) {
+            dispatcher->thread.join();
+        }
+    }
+}
+
+// [Order 4] MetricsSnapshot - 구독자별 백프레셔 지표
+// - queue_depth가 계속 높거나 spilled/overflow_depth가 늘면 해당 구독자가 처리량을 못 따라가는 것
+std::string MatchNotificationChannel::MetricsSnapshot() const {
+    const auto subscribers = LoadSubscribers();
+    std::ostringstream oss;
+    oss << "# TYPE match_notifications_published_total counter\n";
+    oss << "match_notifications_published_total "
+        << published_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE match_notification_mailbox_dropped_total counter\n";
+    oss << "match_notification_mailbox_dropped_total "
+        << mailbox_dropped_total_.load(std::memory_order_relaxed) << "\n";
+
+    const auto per_subscriber = [&](const char* name, const char* type, auto value) {
+        oss << "# TYPE " << name << " " << type << "\n";
+        for (const auto& subscriber : *subscribers) {
+            oss << name << "{subscriber=\"" << subscriber->name << "\"} " << value(*subscriber)
+                << "\n";
+        }
+    };
+    per_subscriber("match_notification_delivered_total", "counter",
+                   [](const Subscriber& s) { return s.delivered_total.load(); });
+    per_subscriber("match_notification_spilled_total", "counter",
+                   [](const Subscriber& s) { return s.spilled_total.load(); });
+    per_subscriber("match_notification_batches_total", "counter",
+                   [](const Subscriber& s) { return s.batches_total.load(); });
+    per_subscriber("match_notification_queue_depth", "gauge",
+                   [](const Subscriber& s) { return s.queue.ApproxSize(); });
+    per_subscriber("match_notification_overflow_depth", "gauge",
+                   [](const Subscriber& s) { return s.overflow_size.load(); });
+    per_subscriber("match_notification_queue_high_watermark", "gauge",
+                   [](const Subscriber& s) { return s.depth_high_watermark.load(); });
+    per_subscriber("match_notification_handler_seconds_total", "counter", [](const Subscriber& s) {
+        return static_cast<double>(s.handler_us_total.load()) / 1e6;
+    });
+    return oss.str();
+}
+
 }  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 이 파일에서 처음 등장한 개념:
+//
+// 1. 고정 크기 MPMC 큐 (Vyukov)
+//    - 슬롯마다 순번을 두어 "이 슬롯에 쓸 차례인가/읽을 차례인가"를 판단
+//    - 생산자/소비자 위치는 CAS로 예약, 잠금 없음
+//
+// 2. 백프레셔 (Backpressure)
+//    - 소비자가 느릴 때 생산자에게 미치는 압력을 어떻게 처리할지 정하는 정책
+//    - 여기서는 "생산자는 절대 기다리지 않는다, 넘치면 넘침 목록으로 옮기고 숫자로 드러낸다"
+//    - 알림을 버리면 매칭된 플레이어가 게임 없이 남으므로 버리는 선택지는 없음
+//
+// 3. 일괄 전달 (Batching)
+//    - 핸들러 호출 1회에 여러 알림 → 호출/잠금/시스템 콜 비용을 분할 상환
+//
+// 관련 설계 문서:
+// - design/v1.2.0-matchmaking.md (매치메이킹 알고리즘)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/matchmaking/sharded_matchmaker.cpp (샤드 워커 → 채널 → 구독자)
+// ================================================================================
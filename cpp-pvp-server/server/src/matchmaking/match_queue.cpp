@@ -1,27 +1,48 @@
 // [FILE]
-// - 목적: 매치메이킹 대기열 구현 (인메모리 + Redis 스텁)
+// - 목적: 매치메이킹 대기열 구현 (인메모리 + Redis)
 // - 주요 역할: 플레이어 대기열 관리, ELO 기반 버킷 정렬, 순서 보장
 // - 관련 클론 가이드 단계: [CG-v1.2.0] 매치메이킹
 // - 권장 읽는 순서: matchmaker.cpp 이후 이 파일 참고
 //
 // [LEARN] 매치메이킹 큐 자료구조:
-//         - buckets_: ELO별로 플레이어를 그룹화 (map<elo, list>)
-//         - index_: player_id로 빠른 조회를 위한 인덱스
-//         - 이중 자료구조로 O(1) 조회 + ELO 기반 정렬을 동시에 달성
+//         - slots_: 요청 본문을 담는 슬랩 (해제된 슬롯은 free_slots_로 재사용)
+//         - buckets_: ELO별 FIFO 배열 (map<elo, vector<슬롯 번호>>)
+//         - index_: player_id → 슬롯 번호
+//         - 삼중 자료구조로 O(1) 조회/추가/삭제 + ELO 기반 정렬을 동시에 달성
 //
 // [Reader Notes]
 // - InMemoryMatchQueue: 단일 서버용 인메모리 구현
-// - RedisMatchQueue: 분산 서버용 Redis 구현 (현재 스텁)
+// - RedisMatchQueue: 분산 서버용 Redis Sorted Set 구현 (RESP 클라이언트)
 // - 다음에 읽을 파일: matchmaker.cpp (이 큐를 사용하는 매칭 로직)
 
 #include "pvpserver/matchmaking/match_queue.h"
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
+#include "pvpserver/storage/redis_client.h"
+
 namespace pvpserver {
 
+// 참조를 보관했다가 순회가 끝난 뒤에 쓰는 호출자(Matchmaker의 sweep_)가 있으므로
+// 지역 변수가 아닌 멤버 버퍼에 담아 다음 순회까지 살려 둠
+void MatchQueue::ForEachOrdered(const OrderedVisitor& visitor) const {
+    fetched_ordered_ = FetchOrdered();
+    for (const auto& entry : fetched_ordered_) {
+        visitor(entry.request, entry.order);
+    }
+}
+
+void MatchQueue::ForEachInRange(int min_elo, int max_elo, const OrderedVisitor& visitor) const {
+    ForEachOrdered([&](const MatchRequest& request, std::uint64_t order) {
+        if (request.elo() >= min_elo && request.elo() <= max_elo) {
+            visitor(request, order);
+        }
+    });
+}
+
 InMemoryMatchQueue::InMemoryMatchQueue() = default;
 InMemoryMatchQueue::~InMemoryMatchQueue() = default;
 
@@ -29,31 +50,52 @@ InMemoryMatchQueue::~InMemoryMatchQueue() = default;
 // [LEARN] Upsert = Update + Insert
 //         이미 대기 중인 플레이어면 기존 항목 제거 후 새로 추가.
 //         ELO 버킷 내에서 order 순서를 유지하여 "먼저 온 사람 먼저 매칭".
+// [LEARN] 예전 구현은 버킷이 std::list라 삽입 위치를 앞에서부터 선형 탐색했고,
+//         항목마다 MatchRequest를 품은 노드를 따로 할당했다. order는 Matchmaker의
+//         카운터에서 단조 증가하므로 거의 항상 맨 뒤에 붙는다 → 끝 비교 한 번으로 O(1).
 void InMemoryMatchQueue::Upsert(const MatchRequest& request, std::uint64_t order) {
     // 기존 항목이 있으면 제거 (ELO가 변경되었을 수 있음)
     auto existing = index_.find(request.player_id());
     if (existing != index_.end()) {
-        auto bucket_it = buckets_.find(existing->second.first);
-        if (bucket_it != buckets_.end()) {
-            bucket_it->second.erase(existing->second.second);
-            if (bucket_it->second.empty()) {
-                buckets_.erase(bucket_it);
-            }
-        }
+        const std::uint32_t slot = existing->second;
         index_.erase(existing);
+        RemoveSlot(slot);
     }
 
-    auto& bucket = buckets_[request.elo()];
-    BucketEntry entry{request, order};
-    auto insert_pos = bucket.end();
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (order < it->order) {
-            insert_pos = it;
-            break;
-        }
+    std::uint32_t slot = 0;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+    Slot& target = slots_[slot];
+    target.request.emplace(request);
+    target.order = order;
+    index_.emplace(request.player_id(), slot);
+
+    Bucket& bucket = buckets_[request.elo()];
+    const BucketRef ref{slot, target.generation, order};
+    if (bucket.entries.empty() || bucket.entries.back().order <= order) {
+        bucket.entries.push_back(ref);  // 빠른 경로: 꼬리에 추가
+    } else {
+        InsertOrdered(bucket, ref);
+    }
+    ++bucket.live;
+}
+
+// 드문 경로: order가 꼬리보다 작을 때 (외부에서 order를 직접 지정한 경우) 이진 탐색 삽입
+void InMemoryMatchQueue::InsertOrdered(Bucket& bucket, const BucketRef& ref) {
+    const auto begin = bucket.entries.begin() + static_cast<std::ptrdiff_t>(bucket.head);
+    const auto pos = std::upper_bound(
+        begin, bucket.entries.end(), ref.order,
+        [](std::uint64_t order, const BucketRef& entry) { return order < entry.order; });
+    if (pos == begin && bucket.head > 0) {
+        bucket.entries[--bucket.head] = ref;  // 앞쪽 툼스톤 자리 재사용
+        return;
     }
-    auto inserted = bucket.insert(insert_pos, std::move(entry));
-    index_[inserted->request.player_id()] = {request.elo(), inserted};
+    bucket.entries.insert(pos, ref);
 }
 
 bool InMemoryMatchQueue::Remove(const std::string& player_id) {
@@ -61,79 +103,424 @@ bool InMemoryMatchQueue::Remove(const std::string& player_id) {
     if (existing == index_.end()) {
         return false;
     }
-    auto bucket_it = buckets_.find(existing->second.first);
+    const std::uint32_t slot = existing->second;
+    index_.erase(existing);
+    RemoveSlot(slot);
+    return true;
+}
+
+std::vector<bool> InMemoryMatchQueue::Claim(const std::vector<std::vector<std::string>>& groups) {
+    std::vector<bool> claimed;
+    claimed.reserve(groups.size());
+    for (const auto& group : groups) {
+        const bool all_queued = std::all_of(group.begin(), group.end(), [this](const std::string& id) {
+            return index_.count(id) > 0;
+        });
+        if (all_queued) {
+            for (const auto& player_id : group) {
+                Remove(player_id);
+            }
+        }
+        claimed.push_back(all_queued);
+    }
+    return claimed;
+}
+
+// [Order 2] RemoveSlot - 지연 삭제
+// - 슬롯의 세대 번호만 올리면 버킷에 남은 참조는 툼스톤이 됨 (버킷 탐색 없음)
+// - 버킷이 비면 통째로 제거, 툼스톤이 절반을 넘으면 압축 → 분할 상환 O(1)
+void InMemoryMatchQueue::RemoveSlot(std::uint32_t slot) {
+    Slot& target = slots_[slot];
+    const int elo = target.request->elo();
+    target.request.reset();
+    ++target.generation;
+    free_slots_.push_back(slot);
+
+    auto bucket_it = buckets_.find(elo);
     if (bucket_it == buckets_.end()) {
-        index_.erase(existing);
-        return false;
+        return;
     }
-    bucket_it->second.erase(existing->second.second);
-    if (bucket_it->second.empty()) {
+    Bucket& bucket = bucket_it->second;
+    if (--bucket.live == 0) {
         buckets_.erase(bucket_it);
+        return;
     }
-    index_.erase(existing);
-    return true;
+    while (bucket.head < bucket.entries.size() && !IsLive(bucket.entries[bucket.head])) {
+        ++bucket.head;
+    }
+    CompactIfSparse(bucket);
 }
 
-std::vector<QueuedPlayer> InMemoryMatchQueue::FetchOrdered() const {
-    std::vector<QueuedPlayer> ordered;
-    ordered.reserve(index_.size());
-    for (const auto& bucket : buckets_) {
-        for (const auto& entry : bucket.second) {
-            ordered.push_back(QueuedPlayer{entry.request, entry.order});
+void InMemoryMatchQueue::CompactIfSparse(Bucket& bucket) {
+    const std::size_t dead = bucket.entries.size() - bucket.live;
+    if (dead < 16 || dead < bucket.live) {
+        return;
+    }
+    std::size_t out = 0;
+    for (std::size_t i = bucket.head; i < bucket.entries.size(); ++i) {
+        if (IsLive(bucket.entries[i])) {
+            bucket.entries[out++] = bucket.entries[i];
         }
     }
-    std::sort(ordered.begin(), ordered.end(), [](const QueuedPlayer& lhs, const QueuedPlayer& rhs) {
-        if (lhs.request.elo() == rhs.request.elo()) {
-            return lhs.order < rhs.order;
+    bucket.entries.resize(out);
+    bucket.head = 0;
+}
+
+template <typename Visitor>
+void InMemoryMatchQueue::VisitBucket(const Bucket& bucket, Visitor&& visitor) const {
+    for (std::size_t i = bucket.head; i < bucket.entries.size(); ++i) {
+        const BucketRef& ref = bucket.entries[i];
+        if (IsLive(ref)) {
+            visitor(*slots_[ref.slot].request, ref.order);
         }
-        return lhs.request.elo() < rhs.request.elo();
+    }
+}
+
+// 버킷 맵이 ELO 오름차순, 버킷 내부가 order 오름차순이므로 재정렬 불필요
+std::vector<QueuedPlayer> InMemoryMatchQueue::FetchOrdered() const {
+    std::vector<QueuedPlayer> ordered;
+    ordered.reserve(index_.size());
+    ForEachOrdered([&ordered](const MatchRequest& request, std::uint64_t order) {
+        ordered.push_back(QueuedPlayer{request, order});
     });
     return ordered;
 }
 
+// [Order 3] ForEachOrdered - 버킷 맵을 그대로 순회 (복사·재정렬 없음)
+// [LEARN] buckets_는 ELO 오름차순 std::map, 버킷 내부는 Upsert가 order 순으로 유지하므로
+//         (ELO, order) 오름차순이 그대로 나온다. 버킷은 슬롯 번호 배열이라 순회가 연속 메모리 접근.
+void InMemoryMatchQueue::ForEachOrdered(const OrderedVisitor& visitor) const {
+    for (const auto& bucket : buckets_) {
+        VisitBucket(bucket.second, visitor);
+    }
+}
+
+void InMemoryMatchQueue::ForEachInRange(int min_elo, int max_elo,
+                                        const OrderedVisitor& visitor) const {
+    const auto end = buckets_.upper_bound(max_elo);
+    for (auto it = buckets_.lower_bound(min_elo); it != end; ++it) {
+        VisitBucket(it->second, visitor);
+    }
+}
+
 std::size_t InMemoryMatchQueue::Size() const { return index_.size(); }
 
 std::string InMemoryMatchQueue::Snapshot() const {
     std::ostringstream oss;
     bool first = true;
-    for (const auto& bucket : buckets_) {
-        for (const auto& entry : bucket.second) {
-            if (!first) {
-                oss << ",";
-            }
-            first = false;
-            oss << entry.request.player_id() << ':' << entry.request.elo();
+    ForEachOrdered([&](const MatchRequest& request, std::uint64_t /*order*/) {
+        if (!first) {
+            oss << ",";
         }
-    }
+        first = false;
+        oss << request.player_id() << ':' << request.elo();
+    });
     return oss.str();
 }
 
-RedisMatchQueue::RedisMatchQueue(std::ostream& stream) : stream_(&stream) {}
+namespace {
+
+// score = ELO × 2^32 + (order 하위 32비트), kUpsertScript에서 계산
+// [LEARN] Redis score는 double이다. ELO(0~2^20) × 2^32 + order < 2^53이면 정수로 정확히 표현되므로
+//         ZRANGEBYSCORE 한 번으로 "ELO 오름차순, 같은 ELO는 대기 순서"가 된다.
+constexpr int kMaxElo = (1 << 20) - 1;
+
+int ClampElo(int elo) { return std::clamp(elo, 0, kMaxElo); }
+
+// 대기열 추가/갱신: 순서 번호를 공유 카운터에서 받아 score와 본문 앞에 붙임
+// (KEYS = queue, requests, order / ARGV = player_id, ELO, 순서 번호를 뺀 본문)
+// [LEARN] 순서 번호를 서버마다 따로 세면 같은 ELO에서 "오래 기다린 순"이 아니라 서버 카운터 순이 되고,
+//         재시작한 서버의 새 플레이어가 몇 분씩 기다린 플레이어를 앞지른다.
+//         INCR과 ZADD를 한 스크립트로 묶어 왕복은 예전(ZADD + HSET 파이프라인)과 같은 한 번.
+//         Lua 숫자는 double이라 %.0f로 써야 2^53 미만의 score가 지수 표기 없이 정확히 전달된다.
+constexpr const char* kUpsertScript =
+    "local order = redis.call('INCR', KEYS[3])\n"
+    "local score = tonumber(ARGV[2]) * 4294967296 + order % 4294967296\n"
+    "redis.call('ZADD', KEYS[1], string.format('%.0f', score), ARGV[1])\n"
+    "local text = string.format('%.0f', order)\n"
+    "redis.call('HSET', KEYS[2], ARGV[1], string.len(text) .. ':' .. text .. ARGV[3])\n"
+    "return order\n";
+
+// 매치 하나 확보: 전원이 ZSET에 있을 때만 ZREM + HDEL (KEYS = queue, requests / ARGV = player_id...)
+// [LEARN] 한 명씩 ZREM하면 일부만 가져간 뒤 되돌리는(ZADD) 사이에 다른 서버의 취소가 끼어들어
+//         취소한 플레이어가 되살아나거나, 되돌리기 전까지 다른 서버에서 보이지 않는다.
+//         스크립트는 Redis에서 원자적으로 실행되므로 확인과 제거 사이에 끼어들 수 없다.
+constexpr const char* kClaimScript =
+    "for _, id in ipairs(ARGV) do\n"
+    "  if not redis.call('ZSCORE', KEYS[1], id) then return 0 end\n"
+    "end\n"
+    "redis.call('ZREM', KEYS[1], unpack(ARGV))\n"
+    "redis.call('HDEL', KEYS[2], unpack(ARGV))\n"
+    "return 1\n";
+
+std::int64_t WallClockMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// 필드 하나: "<길이>:<바이트>" (netstring과 같은 길이 접두)
+// [LEARN] 리전과 파티원 ID는 클라이언트가 보낸 값이라 어떤 구분자든 들어올 수 있다.
+//         구분자로 이어 붙이면 필드가 밀려 잘못 읽히거나 읽히지 않은 채 ZSET에 영원히 남으므로
+//         길이를 앞에 붙여 내용과 상관없이 잘라 낸다.
+void AppendField(std::string& out, const std::string& field) {
+    out += std::to_string(field.size());
+    out += ':';
+    out += field;
+}
+
+bool ReadField(const std::string& encoded, std::size_t& offset, std::string& field) {
+    const auto colon = encoded.find(':', offset);
+    if (colon == std::string::npos || colon == offset || colon - offset > 10) {
+        return false;
+    }
+    std::size_t length = 0;
+    for (std::size_t i = offset; i < colon; ++i) {
+        if (encoded[i] < '0' || encoded[i] > '9') {
+            return false;
+        }
+        length = length * 10 + static_cast<std::size_t>(encoded[i] - '0');
+    }
+    if (length > encoded.size() - colon - 1) {
+        return false;
+    }
+    field.assign(encoded, colon + 1, length);
+    offset = colon + 1 + length;
+    return true;
+}
+
+// 요청 본문: order, elo, enqueued_wall_ms, region, 파티원... (필드마다 길이 접두)
+// order는 kUpsertScript가 붙이므로 여기서는 나머지만 인코딩
+// [LEARN] steady_clock은 프로세스(머신)마다 기준점이 달라 다른 서버와 공유할 수 없다.
+//         벽시계(system_clock) 기준 시각으로 저장하고, 읽을 때 현재 steady 시각으로 환산한다.
+std::string EncodeRequest(const MatchRequest& request) {
+    const auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - request.enqueued_at())
+                            .count();
+    std::string encoded;
+    AppendField(encoded, std::to_string(request.elo()));
+    AppendField(encoded, std::to_string(WallClockMs() - waited));
+    AppendField(encoded, request.preferred_region());
+    for (const auto& member : request.party_members()) {
+        AppendField(encoded, member);
+    }
+    return encoded;
+}
+
+bool DecodeRequest(const std::string& player_id, const std::string& encoded,
+                   std::deque<MatchRequest>& out, std::uint64_t& order) {
+    std::string fields[4];
+    std::size_t offset = 0;
+    for (auto& field : fields) {
+        if (!ReadField(encoded, offset, field)) {
+            return false;
+        }
+    }
+    std::vector<std::string> members;
+    while (offset < encoded.size()) {
+        if (!ReadField(encoded, offset, members.emplace_back())) {
+            return false;
+        }
+    }
+    try {
+        order = std::stoull(fields[0]);
+        const int elo = std::stoi(fields[1]);
+        const auto waited = std::chrono::milliseconds(WallClockMs() - std::stoll(fields[2]));
+        out.emplace_back(player_id, elo, std::chrono::steady_clock::now() - waited, fields[3],
+                         std::move(members));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
 
-void RedisMatchQueue::Upsert(const MatchRequest& request, std::uint64_t order) {
-    if (stream_) {
-        (*stream_) << "ZADD matchmaking_queue " << request.elo() << ' ' << request.player_id()
-                   << std::endl;
+RedisMatchQueue::RedisMatchQueue(std::shared_ptr<storage::RedisClient> client,
+                                 std::string key_prefix)
+    : client_(std::move(client)),
+      queue_key_(key_prefix + ":queue"),
+      requests_key_(key_prefix + ":requests"),
+      order_key_(key_prefix + ":order") {}
+
+// [Order 4] Upsert - INCR + ZADD + HSET을 스크립트 하나(한 번의 왕복)로
+// - ZADD는 기존 member의 score를 갱신하므로 별도 삭제가 필요 없음
+// - order 인자는 쓰지 않음: 대기 순서는 서버 간 공유 카운터({prefix}:order)에서
+void RedisMatchQueue::Upsert(const MatchRequest& request, std::uint64_t /*order*/) {
+    fetched_.clear();
+    const auto reply =
+        client_->Execute({"EVAL", kUpsertScript, "3", queue_key_, requests_key_, order_key_,
+                          request.player_id(), std::to_string(ClampElo(request.elo())),
+                          EncodeRequest(request)});
+    if (!reply || reply->IsError()) {
+        std::cerr << "redis match queue upsert failed: " << request.player_id() << std::endl;
     }
-    fallback_.Upsert(request, order);
 }
 
+// [Order 5] Remove - ZREM 결과가 1인 서버만 true
+// [LEARN] 여러 서버가 동시에 같은 플레이어를 제거하려 하면 ZREM은 한 곳에서만 1을 반환한다.
 bool RedisMatchQueue::Remove(const std::string& player_id) {
-    if (stream_) {
-        (*stream_) << "ZREM matchmaking_queue " << player_id << std::endl;
+    fetched_.clear();
+    const auto replies = client_->Pipeline(
+        {{"ZREM", queue_key_, player_id}, {"HDEL", requests_key_, player_id}});
+    if (!replies) {
+        std::cerr << "redis match queue remove failed: " << player_id << std::endl;
+        return false;
     }
-    return fallback_.Remove(player_id);
+    return replies->at(0).type == storage::RespValue::Type::Integer &&
+           replies->at(0).integer == 1;
+}
+
+// Claim - 매치마다 EVAL 하나, 패스 전체를 한 번의 파이프라인으로
+std::vector<bool> RedisMatchQueue::Claim(const std::vector<std::vector<std::string>>& groups) {
+    fetched_.clear();
+    std::vector<bool> claimed(groups.size(), false);
+    if (groups.empty()) {
+        return claimed;
+    }
+    std::vector<std::vector<std::string>> commands;
+    commands.reserve(groups.size());
+    for (const auto& group : groups) {
+        std::vector<std::string> command{"EVAL", kClaimScript, "2", queue_key_, requests_key_};
+        command.insert(command.end(), group.begin(), group.end());
+        commands.push_back(std::move(command));
+    }
+    const auto replies = client_->Pipeline(std::move(commands));
+    if (!replies) {
+        std::cerr << "redis match queue claim failed" << std::endl;
+        return claimed;
+    }
+    for (std::size_t i = 0; i < replies->size() && i < groups.size(); ++i) {
+        const auto& reply = replies->at(i);
+        claimed[i] = reply.type == storage::RespValue::Type::Integer && reply.integer == 1;
+    }
+    return claimed;
 }
 
 std::vector<QueuedPlayer> RedisMatchQueue::FetchOrdered() const {
-    if (stream_) {
-        (*stream_) << "ZRANGE matchmaking_queue 0 -1 WITHSCORES" << std::endl;
+    std::vector<QueuedPlayer> ordered;
+    ForEachOrdered([&ordered](const MatchRequest& request, std::uint64_t order) {
+        ordered.push_back(QueuedPlayer{request, order});
+    });
+    return ordered;
+}
+
+void RedisMatchQueue::ForEachOrdered(const OrderedVisitor& visitor) const {
+    FetchScoreRange("-inf", "+inf", visitor);
+}
+
+// [Order 6] ForEachInRange - 담당 ELO 구간의 score 범위만 조회
+// - [min_elo × 2^32, (max_elo + 1) × 2^32) → 상한은 "(" 로 배타 범위 지정
+void RedisMatchQueue::ForEachInRange(int min_elo, int max_elo,
+                                     const OrderedVisitor& visitor) const {
+    if (max_elo < min_elo || max_elo < 0) {
+        return;
+    }
+    const auto lower = static_cast<std::uint64_t>(ClampElo(min_elo)) << 32;
+    const auto upper = static_cast<std::uint64_t>(ClampElo(max_elo) + 1) << 32;
+    FetchScoreRange(std::to_string(lower), "(" + std::to_string(upper), visitor);
+}
+
+// [Order 7] FetchScoreRange - ZRANGEBYSCORE 페이지 조회 → HMGET 일괄 파이프라인
+// [LEARN] 페이지마다 ZRANGEBYSCORE 1회, 본문은 모든 페이지의 HMGET을 한 번에 파이프라인으로 보낸다.
+//         페이지 경계는 마지막 score부터 다시 읽고(포함) 이미 본 member는 건너뛴다.
+//         (같은 score의 member가 여러 개여도 누락 없음, 오프셋 방식과 달리 동시 삭제에도 안전)
+void RedisMatchQueue::FetchScoreRange(const std::string& min_score, const std::string& max_score,
+                                      const OrderedVisitor& visitor) const {
+    fetched_.clear();
+    std::vector<std::string> ids;
+    std::string cursor = min_score;
+    std::vector<std::string> boundary;  // 직전 페이지 마지막 score와 같은 member
+    while (true) {
+        const auto reply = client_->Execute({"ZRANGEBYSCORE", queue_key_, cursor, max_score,
+                                             "WITHSCORES", "LIMIT", "0",
+                                             std::to_string(kPageSize + boundary.size())});
+        if (!reply || reply->IsError()) {
+            std::cerr << "redis match queue range fetch failed" << std::endl;
+            return;
+        }
+        const auto& items = reply->elements;
+        std::vector<std::string> next_boundary;
+        std::string last_score;
+        std::size_t added = 0;
+        for (std::size_t i = 0; i + 1 < items.size(); i += 2) {
+            const std::string& member = items[i].text;
+            const std::string& score = items[i + 1].text;
+            if (std::find(boundary.begin(), boundary.end(), member) != boundary.end()) {
+                continue;
+            }
+            if (score != last_score) {
+                next_boundary.clear();
+                last_score = score;
+            }
+            next_boundary.push_back(member);
+            ids.push_back(member);
+            ++added;
+        }
+        if (items.size() / 2 < kPageSize + boundary.size() || added == 0) {
+            break;
+        }
+        if (!boundary.empty() && last_score == cursor) {
+            next_boundary.insert(next_boundary.end(), boundary.begin(), boundary.end());
+        }
+        cursor = last_score;
+        boundary = std::move(next_boundary);
+    }
+    if (ids.empty()) {
+        return;
+    }
+
+    std::vector<std::vector<std::string>> commands;
+    for (std::size_t start = 0; start < ids.size(); start += kPageSize) {
+        std::vector<std::string> command{"HMGET", requests_key_};
+        const auto end = std::min(ids.size(), start + kPageSize);
+        command.insert(command.end(), ids.begin() + static_cast<std::ptrdiff_t>(start),
+                       ids.begin() + static_cast<std::ptrdiff_t>(end));
+        commands.push_back(std::move(command));
+    }
+    const auto replies = client_->Pipeline(std::move(commands));
+    if (!replies) {
+        std::cerr << "redis match queue request fetch failed" << std::endl;
+        return;
+    }
+
+    std::vector<std::uint64_t> orders;
+    orders.reserve(ids.size());
+    std::size_t index = 0;
+    for (const auto& page : *replies) {
+        for (const auto& value : page.elements) {
+            std::uint64_t order = 0;
+            // 다른 서버가 그 사이 제거한 항목은 본문이 없음 (건너뜀)
+            if (!value.IsNull() && DecodeRequest(ids[index], value.text, fetched_, order)) {
+                orders.push_back(order);
+            }
+            ++index;
+        }
+    }
+    for (std::size_t i = 0; i < fetched_.size(); ++i) {
+        visitor(fetched_[i], orders[i]);
     }
-    return fallback_.FetchOrdered();
 }
 
-std::size_t RedisMatchQueue::Size() const { return fallback_.Size(); }
+std::size_t RedisMatchQueue::Size() const {
+    const auto reply = client_->Execute({"ZCARD", queue_key_});
+    if (!reply || reply->type != storage::RespValue::Type::Integer) {
+        return 0;
+    }
+    return static_cast<std::size_t>(reply->integer);
+}
 
-std::string RedisMatchQueue::Snapshot() const { return fallback_.Snapshot(); }
+std::string RedisMatchQueue::Snapshot() const {
+    std::ostringstream oss;
+    bool first = true;
+    ForEachOrdered([&](const MatchRequest& request, std::uint64_t /*order*/) {
+        if (!first) {
+            oss << ",";
+        }
+        first = false;
+        oss << request.player_id() << ':' << request.elo();
+    });
+    return oss.str();
+}
 
 }  // namespace pvpserver
@@ -12,11 +12,13 @@ constexpr double kStepSeconds = 5.0;
 
 MatchRequest::MatchRequest(std::string player_id, int elo,
                            std::chrono::steady_clock::time_point enqueued_at,
-                           std::string preferred_region)
+                           std::string preferred_region,
+                           std::vector<std::string> party_members)
     : player_id_(std::move(player_id)),
       elo_(elo),
       enqueued_at_(enqueued_at),
-      preferred_region_(std::move(preferred_region)) {}
+      preferred_region_(std::move(preferred_region)),
+      party_members_(std::move(party_members)) {}
 
 double MatchRequest::WaitSeconds(std::chrono::steady_clock::time_point now) const noexcept {
     return std::chrono::duration<double>(now - enqueued_at_).count();
@@ -9,25 +9,41 @@
 
 #include "pvpserver/matchmaking/matchmaker.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 #include <sstream>
-#include <unordered_set>
+#include <utility>
 
 namespace pvpserver {
 
 // [Order 1] 생성자 - 매치메이킹 큐 연결
 // - queue_: MatchQueue 인터페이스 (InMemory 또는 Redis 구현)
-Matchmaker::Matchmaker(std::shared_ptr<MatchQueue> queue) : queue_(std::move(queue)) {}
+// - format: 매치 구성 (기본 1:1, 팀전/개인전은 MatchFormat 참고)
+Matchmaker::Matchmaker(std::shared_ptr<MatchQueue> queue, MatchFormat format)
+    : queue_(std::move(queue)), format_(std::move(format)) {}
 
 void Matchmaker::SetMatchCreatedCallback(std::function<void(const Match&)> callback) {
     std::lock_guard<std::mutex> lk(mutex_);
     callback_ = std::move(callback);
 }
 
+void Matchmaker::SetEloBand(int min_elo, int max_elo) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    elo_band_ = std::make_pair(min_elo, max_elo);
+}
+
 // [Order 2] Enqueue - 플레이어를 매칭 대기열에 추가
 // - 플레이어 ID, ELO 레이팅, 대기 시작 시간 저장
-void Matchmaker::Enqueue(const MatchRequest& request) {
+// - 파티는 하나의 요청으로 대기 (팀 하나에 통째로 배정되므로 팀 인원을 넘을 수 없음)
+bool Matchmaker::Enqueue(const MatchRequest& request) {
+    if (request.party_size() > format_.max_party_size) {
+        std::cerr << "matchmaking reject " << request.player_id()
+                  << " party_size=" << request.party_size() << " format=" << format_.name
+                  << std::endl;
+        return false;
+    }
     std::size_t queue_size = 0;
     {
         std::lock_guard<std::mutex> lk(mutex_);
@@ -37,6 +53,7 @@ void Matchmaker::Enqueue(const MatchRequest& request) {
     }
     std::cout << "matchmaking enqueue " << request.player_id() << " elo=" << request.elo()
               << " size=" << queue_size << std::endl;
+    return true;
 }
 
 // [Order 3] Cancel - 매칭 대기열에서 플레이어 제거
@@ -56,87 +73,70 @@ bool Matchmaker::Cancel(const std::string& player_id) {
     return removed;
 }
 
-// [Order 4] RunMatching - 핵심 매칭 알고리즘 실행
-// - 대기열의 모든 플레이어를 순회하며 호환되는 상대 찾기
+// [Order 4] RunMatching - ELO 윈도우 스윕 매칭
 // - 200ms마다 main.cpp의 타이머에서 호출됨
 // - 클론 가이드 단계: [v1.2.0]
+// [LEARN] 예전 구현은 FetchOrdered()로 전체 요청을 복사·재정렬하고,
+//         unordered_set<string>으로 "이미 매칭됨"을 확인하며, 매칭마다 큐에서 즉시 제거했다.
+//         대기열이 5만 명이면 한 패스에 수 초가 걸린다. 여기서는
+//         1) 큐의 정렬 순서를 그대로 포인터 배열로 받고 (복사 없음)
+//         2) 매칭된 항목은 툼스톤 + 건너뛰기 링크로 표시하고 (문자열 해시 없음)
+//         3) 허용 범위는 실제로 비교할 때 한 번만 계산하고
+//         4) 큐에서의 제거는 패스가 끝난 뒤 한꺼번에 수행한다.
+//         매칭 결과(누가 누구와 매칭되는지)는 이전 구현과 동일하다.
 std::vector<Match> Matchmaker::RunMatching(std::chrono::steady_clock::time_point now) {
     std::vector<Match> matches;
     std::function<void(const Match&)> callback;
+    std::size_t dropped = 0;
     {
         std::lock_guard<std::mutex> lk(mutex_);
-        auto ordered = queue_->FetchOrdered();  // 대기 순서대로 정렬된 목록
-        std::unordered_set<std::string> used;   // 이번 라운드에서 매칭된 플레이어
-
-        // O(N²) 알고리즘: 각 플레이어에 대해 호환되는 상대 탐색
-        // [LEARN] 대규모 서비스에서는 ELO 버킷으로 분류하여 O(N) 근사 가능
-        for (std::size_t i = 0; i < ordered.size(); ++i) {
-            const auto& candidate = ordered[i];
-            const auto& request = candidate.request;
-            if (used.find(request.player_id()) != used.end()) {
-                continue;  // 이미 매칭됨
-            }
+        const auto pass_start = std::chrono::steady_clock::now();
 
-            // 현재 플레이어의 ELO 허용 범위 계산
-            // [LEARN] CurrentTolerance: 대기 시간에 따라 허용 범위 확대
-            //         초기 ±100 → 5초마다 ±25씩 증가
-            const int tolerance_a = request.CurrentTolerance(now);
-            std::size_t partner_index = ordered.size();
-
-            // 호환되는 상대 탐색
-            for (std::size_t j = i + 1; j < ordered.size(); ++j) {
-                const auto& other = ordered[j];
-                if (used.find(other.request.player_id()) != used.end()) {
-                    continue;  // 이미 매칭됨
-                }
-                // 리전 호환성 체크 (같은 서버 지역)
-                if (!RegionsCompatible(request, other.request)) {
-                    continue;
-                }
-                // ELO 차이 계산 + 양쪽 허용 범위 모두 만족해야 함
-                const int diff = std::abs(request.elo() - other.request.elo());
-                const int tolerance_b = other.request.CurrentTolerance(now);
-                if (diff <= tolerance_a && diff <= tolerance_b) {
-                    partner_index = j;
-                    break;  // 첫 번째 호환 상대 선택 (가장 오래 대기한 순)
-                }
-                // 조기 종료: ELO 정렬되어 있으면 더 이상 볼 필요 없음
-                if (other.request.elo() - request.elo() > tolerance_a) {
-                    break;
-                }
-            }
-            if (partner_index >= ordered.size()) {
-                continue;  // 호환 상대 없음
-            }
-            const auto& partner = ordered[partner_index].request;
+        // ELO 오름차순 인덱스 (같은 ELO는 대기 순서)
+        sweep_.clear();
+        match_entries_.clear();
+        match_entry_ends_.clear();
+        const auto collect = [this](const MatchRequest& request, std::uint64_t /*order*/) {
+            sweep_.push_back(SweepEntry{&request, request.elo(), kToleranceUnknown});
+        };
+        if (elo_band_) {
+            queue_->ForEachInRange(elo_band_->first, elo_band_->second, collect);
+        } else {
+            queue_->ForEachOrdered(collect);
+        }
+        const std::size_t count = sweep_.size();
+        next_live_.resize(count + 1);
+        std::iota(next_live_.begin(), next_live_.end(), std::size_t{0});
 
-            // 매칭 성사: 양쪽 큐에서 제거 + 사용 표시
-            queue_->Remove(request.player_id());
-            queue_->Remove(partner.player_id());
-            used.insert(request.player_id());
-            used.insert(partner.player_id());
+        if (format_.IsDuel()) {
+            MatchPairsLocked(now, matches);
+        } else {
+            MatchGroupsLocked(now, matches);
+        }
 
-            // Match 객체 생성
-            ++matches_created_;
-            const int average_elo = (request.elo() + partner.elo()) / 2;
-            std::ostringstream id_stream;
-            id_stream << "match-" << ++match_counter_;
-            Match match(id_stream.str(), {request.player_id(), partner.player_id()}, average_elo,
-                        now, ResolveRegion(request, partner));
-            matches.push_back(match);
+        // 패스 종료 후 일괄 제거 (이 시점부터 sweep_의 포인터는 무효)
+        dropped = ClaimMatchesLocked(now, matches);
+        sweep_.clear();
 
-            // 대기 시간 히스토그램 기록 (Prometheus 메트릭용)
-            ObserveWaitLocked(request.WaitSeconds(now));
-            ObserveWaitLocked(partner.WaitSeconds(now));
-        }
+        last_pass_seconds_ =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - pass_start).count();
         last_queue_size_ = queue_->Size();
         callback = callback_;
     }
 
+    if (dropped > 0) {
+        std::cout << "matchmaking dropped " << dropped
+                  << " match(es): player already claimed by another matchmaker" << std::endl;
+    }
+
     // 생성된 매치 알림 (잠금 해제 후)
     for (const auto& match : matches) {
-        std::cout << "matchmaking match " << match.match_id() << " players=" << match.players()[0]
-                  << ',' << match.players()[1] << " elo=" << match.average_elo() << std::endl;
+        std::cout << "matchmaking match " << match.match_id() << " mode=" << match.mode()
+                  << " players=";
+        for (std::size_t i = 0; i < match.players().size(); ++i) {
+            std::cout << (i > 0 ? "," : "") << match.players()[i];
+        }
+        std::cout << " elo=" << match.average_elo() << std::endl;
         notifications_.Publish(match);  // 옵저버 패턴으로 알림
         if (callback) {
             callback(match);
@@ -146,24 +146,324 @@ std::vector<Match> Matchmaker::RunMatching(std::chrono::steady_clock::time_point
     return matches;
 }
 
-std::string Matchmaker::MetricsSnapshot() const {
+// [Order 5] MatchPairsLocked - 1:1 두 포인터 스윕
+void Matchmaker::MatchPairsLocked(std::chrono::steady_clock::time_point now,
+                                  std::vector<Match>& matches) {
+    const std::size_t count = sweep_.size();
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    std::uint64_t scanned = 0;
+    for (std::size_t i = NextLiveLocked(0); i < count; i = NextLiveLocked(i + 1)) {
+        SweepEntry& entry = sweep_[i];
+        const int tolerance_a = ToleranceLocked(entry, now);
+        const int upper_elo = entry.elo + tolerance_a;
+
+        // 두 번째 포인터: i 다음의 살아있는 항목부터 ELO 상한까지만 전진
+        // (정렬되어 있으므로 상한을 넘으면 이후 항목은 모두 범위 밖)
+        std::size_t partner_index = count;
+        for (std::size_t j = NextLiveLocked(i + 1); j < count && sweep_[j].elo <= upper_elo;
+             j = NextLiveLocked(j + 1)) {
+            ++scanned;
+            SweepEntry& other = sweep_[j];
+            // 리전 호환성 체크 (같은 서버 지역)
+            if (!RegionsCompatible(*entry.request, *other.request)) {
+                continue;
+            }
+            // 양쪽 허용 범위 모두 만족해야 함 (상대 허용 범위는 여기서 처음 계산)
+            if (other.elo - entry.elo <= ToleranceLocked(other, now)) {
+                partner_index = j;
+                break;  // 첫 번째 호환 상대 선택 (가장 오래 대기한 순)
+            }
+        }
+        if (partner_index >= count) {
+            continue;  // 호환 상대 없음
+        }
+
+        // 툼스톤: 이후 스윕에서 건너뛰도록 다음 항목을 가리키게 함
+        next_live_[i] = i + 1;
+        next_live_[partner_index] = partner_index + 1;
+        pairs.emplace_back(i, partner_index);
+    }
+
+    matches.reserve(pairs.size());
+    for (const auto& pair : pairs) {
+        const MatchRequest& request = *sweep_[pair.first].request;
+        const MatchRequest& partner = *sweep_[pair.second].request;
+
+        const int average_elo = (request.elo() + partner.elo()) / 2;
+        std::ostringstream id_stream;
+        id_stream << "match-" << ++match_counter_;
+        matches.emplace_back(id_stream.str(),
+                             std::vector<std::string>{request.player_id(), partner.player_id()},
+                             average_elo, now, ResolveRegion(request, partner));
+        match_entries_.push_back(pair.first);
+        match_entries_.push_back(pair.second);
+        match_entry_ends_.push_back(match_entries_.size());
+    }
+    pass_scanned_total_ += scanned;
+}
+
+// [Order 6] MatchGroupsLocked - 팀전/개인전 그룹 편성 스윕
+// [LEARN] 가장 낮은 ELO의 살아있는 항목을 앵커로 잡고, 앵커의 윈도우 안에서
+//         (ELO 순으로) 인원이 찰 때까지 후보를 모은다. 조합 탐색은 하지 않고
+//         앵커당 최대 kGroupScanFactor × 인원수까지만 살펴보므로 전체 비용은
+//         O(N × 매치 인원)으로 대기열 크기에 선형이다.
+void Matchmaker::MatchGroupsLocked(std::chrono::steady_clock::time_point now,
+                                   std::vector<Match>& matches) {
+    const std::size_t count = sweep_.size();
+    for (std::size_t i = NextLiveLocked(0); i < count; i = NextLiveLocked(i + 1)) {
+        if (!CollectGroupLocked(i, now)) {
+            continue;  // 앵커 기준으로 인원을 채우지 못함 → 다음 패스에서 재시도
+        }
+        for (const auto& member : group_) {
+            next_live_[member.entry] = member.entry + 1;  // 툼스톤
+        }
+        BalanceTeamsLocked();
+        matches.push_back(BuildGroupMatchLocked(now));
+        for (const auto& member : group_) {
+            match_entries_.push_back(member.entry);
+        }
+        match_entry_ends_.push_back(match_entries_.size());
+    }
+}
+
+// ClaimMatchesLocked - 매칭된 요청을 큐에서 가져감 (매치별 전부 아니면 전무)
+// [LEARN] 대기열을 여러 매치메이커가 공유하면(Redis) 같은 플레이어를 동시에 매칭할 수 있다.
+//         매치 하나를 MatchQueue::Claim의 원자적 그룹으로 보내 전원을 가져간 매치만 남긴다.
+//         실패한 매치의 나머지 요청은 큐에서 빠진 적이 없으므로 되돌릴 필요가 없다.
+//         파티원은 큐 키가 아니므로 요청(파티장) 단위로 가져간다.
+//         매치 수와 대기 시간 히스토그램도 확보한 매치만 기록 (버린 매치의 플레이어는 아직 대기 중).
+std::size_t Matchmaker::ClaimMatchesLocked(std::chrono::steady_clock::time_point now,
+                                           std::vector<Match>& matches) {
+    std::vector<std::vector<std::string>> groups(matches.size());
+    std::vector<std::pair<double, std::size_t>> waits;  // 요청별 (대기 시간, 인원)
+    waits.reserve(match_entries_.size());
+    std::size_t begin = 0;
+    for (std::size_t m = 0; m < matches.size(); ++m) {
+        const std::size_t end = match_entry_ends_[m];
+        for (std::size_t i = begin; i < end; ++i) {
+            const MatchRequest& request = *sweep_[match_entries_[i]].request;
+            groups[m].push_back(request.player_id());
+            waits.emplace_back(request.WaitSeconds(now), request.party_size());
+        }
+        begin = end;
+    }
+    const auto claimed = queue_->Claim(groups);  // 이 시점부터 sweep_의 포인터는 무효
+
+    std::size_t kept = 0;
+    begin = 0;
+    for (std::size_t m = 0; m < matches.size(); ++m) {
+        const std::size_t end = match_entry_ends_[m];
+        if (m < claimed.size() && claimed[m]) {
+            ++matches_created_;
+            // 대기 시간 히스토그램 기록 (Prometheus 메트릭용, 파티원 포함)
+            for (std::size_t i = begin; i < end; ++i) {
+                for (std::size_t k = 0; k < waits[i].second; ++k) {
+                    ObserveWaitLocked(waits[i].first);
+                }
+            }
+            if (kept != m) {
+                matches[kept] = std::move(matches[m]);
+            }
+            ++kept;
+        }
+        begin = end;
+    }
+    const std::size_t dropped = matches.size() - kept;
+    matches.erase(matches.begin() + static_cast<std::ptrdiff_t>(kept), matches.end());
+    return dropped;
+}
+
+// CollectGroupLocked - 앵커의 ELO 윈도우 안에서 인원 채우기
+// - 그룹의 ELO 폭(최고 - 앵커)이 모든 멤버의 허용 범위 이내여야 함
+// - 파티는 쪼개지 않음: 남은 자리가 가장 적으면서 들어갈 수 있는 팀에 배정 (best-fit)
+bool Matchmaker::CollectGroupLocked(std::size_t anchor,
+                                    std::chrono::steady_clock::time_point now) {
+    const std::size_t count = sweep_.size();
+    const std::size_t capacity = format_.PlayersPerMatch();
+    const std::size_t scan_limit = capacity * kGroupScanFactor;
+    group_.clear();
+    team_load_.assign(format_.team_count, 0);
+
+    auto place = [this](std::size_t entry) {
+        const std::size_t size = sweep_[entry].request->party_size();
+        std::size_t best = format_.team_count;
+        for (std::size_t team = 0; team < format_.team_count; ++team) {
+            if (team_load_[team] + size > format_.team_size) {
+                continue;
+            }
+            if (best == format_.team_count || team_load_[team] > team_load_[best]) {
+                best = team;
+            }
+        }
+        if (best == format_.team_count) {
+            return false;
+        }
+        team_load_[best] += size;
+        group_.push_back(GroupMember{entry, best});
+        return true;
+    };
+
+    SweepEntry& head = sweep_[anchor];
+    if (!place(anchor)) {
+        return false;
+    }
+    int min_tolerance = ToleranceLocked(head, now);
+    const MatchRequest* region_ref = head.request;  // "any"가 아닌 첫 멤버의 리전이 기준
+    std::size_t filled = head.request->party_size();
+
+    std::size_t scanned = 0;
+    for (std::size_t j = NextLiveLocked(anchor + 1);
+         j < count && filled < capacity && scanned < scan_limit; j = NextLiveLocked(j + 1)) {
+        ++scanned;
+        SweepEntry& other = sweep_[j];
+        const int spread = other.elo - head.elo;
+        if (spread > min_tolerance) {
+            break;  // 정렬되어 있으므로 이후 항목은 모두 누군가의 허용 범위 밖
+        }
+        if (!RegionsCompatible(*region_ref, *other.request)) {
+            continue;
+        }
+        const int tolerance = ToleranceLocked(other, now);
+        if (spread > tolerance || !place(j)) {
+            continue;
+        }
+        filled += other.request->party_size();
+        min_tolerance = std::min(min_tolerance, tolerance);
+        if (region_ref->preferred_region() == "any") {
+            region_ref = other.request;
+        }
+    }
+    pass_scanned_total_ += scanned;
+    return filled == capacity;
+}
+
+// BalanceTeamsLocked - 팀 평균 ELO 균형 맞추기
+// - 큰 파티부터, 같은 크기면 높은 ELO부터 "현재 ELO 합이 가장 낮은 팀"에 배정
+// - 이 배정으로 인원이 맞지 않으면 CollectGroupLocked의 best-fit 배정을 그대로 사용
+void Matchmaker::BalanceTeamsLocked() {
+    if (format_.team_size == 1) {
+        return;  // 개인전: 팀 = 플레이어
+    }
+    std::vector<GroupMember> balanced = group_;
+    std::sort(balanced.begin(), balanced.end(), [this](const GroupMember& lhs, const GroupMember& rhs) {
+        const auto& a = *sweep_[lhs.entry].request;
+        const auto& b = *sweep_[rhs.entry].request;
+        if (a.party_size() != b.party_size()) {
+            return a.party_size() > b.party_size();
+        }
+        if (a.elo() != b.elo()) {
+            return a.elo() > b.elo();
+        }
+        return lhs.entry < rhs.entry;
+    });
+
+    team_load_.assign(format_.team_count, 0);
+    team_elo_sum_.assign(format_.team_count, 0);
+    for (auto& member : balanced) {
+        const auto& request = *sweep_[member.entry].request;
+        const std::size_t size = request.party_size();
+        std::size_t best = format_.team_count;
+        for (std::size_t team = 0; team < format_.team_count; ++team) {
+            if (team_load_[team] + size > format_.team_size) {
+                continue;
+            }
+            if (best == format_.team_count || team_elo_sum_[team] < team_elo_sum_[best]) {
+                best = team;
+            }
+        }
+        if (best == format_.team_count) {
+            return;
+        }
+        member.team = best;
+        team_load_[best] += size;
+        team_elo_sum_[best] += static_cast<long long>(request.elo()) * static_cast<long long>(size);
+    }
+    group_.swap(balanced);
+}
+
+// BuildGroupMatchLocked - 편성된 그룹으로 Match 생성 (파티원 포함)
+Match Matchmaker::BuildGroupMatchLocked(std::chrono::steady_clock::time_point now) {
+    std::vector<MatchTeam> teams(format_.team_count);
+    std::vector<long long> sums(format_.team_count, 0);
+    long long total = 0;
+    const MatchRequest* region_ref = sweep_[group_.front().entry].request;
+    for (const auto& member : group_) {
+        const MatchRequest& request = *sweep_[member.entry].request;
+        auto& players = teams[member.team].players;
+        players.push_back(request.player_id());
+        players.insert(players.end(), request.party_members().begin(),
+                       request.party_members().end());
+        const long long weighted =
+            static_cast<long long>(request.elo()) * static_cast<long long>(request.party_size());
+        sums[member.team] += weighted;
+        total += weighted;
+        if (region_ref->preferred_region() == "any") {
+            region_ref = &request;
+        }
+    }
+    for (std::size_t team = 0; team < teams.size(); ++team) {
+        teams[team].average_elo = static_cast<int>(sums[team] / static_cast<long long>(format_.team_size));
+    }
+
+    std::ostringstream id_stream;
+    id_stream << "match-" << ++match_counter_;
+    return Match(id_stream.str(), std::move(teams),
+                 static_cast<int>(total / static_cast<long long>(format_.PlayersPerMatch())), now,
+                 region_ref->preferred_region(), format_.name);
+}
+
+std::string Matchmaker::MetricsSnapshot() const { return RenderMetrics(GetMetricsTotals()); }
+
+Matchmaker::MetricsTotals Matchmaker::GetMetricsTotals() const {
     std::lock_guard<std::mutex> lk(mutex_);
+    MetricsTotals totals;
+    totals.queue_size = last_queue_size_;
+    totals.matches_created = matches_created_;
+    totals.wait_bucket_counts = wait_bucket_counts_;
+    totals.wait_overflow_count = wait_overflow_count_;
+    totals.wait_sum = wait_sum_;
+    totals.wait_count = wait_count_;
+    totals.pass_scanned_total = pass_scanned_total_;
+    totals.last_pass_seconds = last_pass_seconds_;
+    return totals;
+}
+
+// 합산: 카운터/게이지는 더하고, 마지막 패스 시간은 가장 느린 값
+Matchmaker::MetricsTotals& Matchmaker::MetricsTotals::operator+=(const MetricsTotals& other) {
+    queue_size += other.queue_size;
+    matches_created += other.matches_created;
+    for (std::size_t i = 0; i < wait_bucket_counts.size(); ++i) {
+        wait_bucket_counts[i] += other.wait_bucket_counts[i];
+    }
+    wait_overflow_count += other.wait_overflow_count;
+    wait_sum += other.wait_sum;
+    wait_count += other.wait_count;
+    pass_scanned_total += other.pass_scanned_total;
+    last_pass_seconds = std::max(last_pass_seconds, other.last_pass_seconds);
+    return *this;
+}
+
+std::string Matchmaker::RenderMetrics(const MetricsTotals& totals) {
     std::ostringstream oss;
     oss << "# TYPE matchmaking_queue_size gauge\n";
-    oss << "matchmaking_queue_size " << last_queue_size_ << "\n";
+    oss << "matchmaking_queue_size " << totals.queue_size << "\n";
     oss << "# TYPE matchmaking_matches_total counter\n";
-    oss << "matchmaking_matches_total " << matches_created_ << "\n";
+    oss << "matchmaking_matches_total " << totals.matches_created << "\n";
     oss << "# TYPE matchmaking_wait_seconds histogram\n";
     std::uint64_t cumulative = 0;
     for (std::size_t i = 0; i < kWaitBuckets.size(); ++i) {
-        cumulative += wait_bucket_counts_[i];
+        cumulative += totals.wait_bucket_counts[i];
         oss << "matchmaking_wait_seconds_bucket{le=\"" << kWaitBuckets[i] << "\"} " << cumulative
             << "\n";
     }
-    cumulative += wait_overflow_count_;
+    cumulative += totals.wait_overflow_count;
     oss << "matchmaking_wait_seconds_bucket{le=\"+Inf\"} " << cumulative << "\n";
-    oss << "matchmaking_wait_seconds_sum " << wait_sum_ << "\n";
-    oss << "matchmaking_wait_seconds_count " << wait_count_ << "\n";
+    oss << "matchmaking_wait_seconds_sum " << totals.wait_sum << "\n";
+    oss << "matchmaking_wait_seconds_count " << totals.wait_count << "\n";
+    oss << "# TYPE matchmaking_pass_scanned_total counter\n";
+    oss << "matchmaking_pass_scanned_total " << totals.pass_scanned_total << "\n";
+    oss << "# TYPE matchmaking_last_pass_seconds gauge\n";
+    oss << "matchmaking_last_pass_seconds " << totals.last_pass_seconds << "\n";
     return oss.str();
 }
 
@@ -183,6 +483,25 @@ void Matchmaker::ObserveWaitLocked(double seconds) {
     }
 }
 
+// 허용 범위 지연 계산: 스윕 중 비교 대상이 된 항목만 계산하고 결과를 캐시
+int Matchmaker::ToleranceLocked(SweepEntry& entry, std::chrono::steady_clock::time_point now) {
+    if (entry.tolerance == kToleranceUnknown) {
+        entry.tolerance = entry.request->CurrentTolerance(now);
+    }
+    return entry.tolerance;
+}
+
+// 툼스톤 건너뛰기: index 이상에서 첫 번째로 살아있는 항목 (경로 절반 압축)
+// [LEARN] Union-Find의 find와 같은 기법. 매칭된 구간을 여러 번 건너뛰어도
+//         링크가 점점 짧아져 전체 비용이 거의 선형으로 유지된다.
+std::size_t Matchmaker::NextLiveLocked(std::size_t index) {
+    while (next_live_[index] != index) {
+        next_live_[index] = next_live_[next_live_[index]];
+        index = next_live_[index];
+    }
+    return index;
+}
+
 std::string Matchmaker::ResolveRegion(const MatchRequest& lhs, const MatchRequest& rhs) {
     if (lhs.preferred_region() == rhs.preferred_region()) {
         return lhs.preferred_region();
@@ -212,7 +531,11 @@ std::string Matchmaker::ResolveRegion(const MatchRequest& lhs, const MatchReques
 //    - 5초마다: ±25씩 허용 범위 확대
 //    - 오래 기다릴수록 넓은 실력 범위에서 매칭
 //
-// 3. Prometheus 히스토그램
+// 3. 툼스톤 + 스윕 (Tombstone Sweep)
+//    - 정렬된 배열에서 삭제 대신 "삭제됨" 표시만 하고, 패스가 끝난 뒤 일괄 정리
+//    - 삭제로 인한 재배치/반복자 무효화 없이 두 포인터 스윕을 유지
+//
+// 4. Prometheus 히스토그램
 //    - 대기 시간 분포를 버킷으로 기록
 //    - kWaitBuckets: [1, 5, 10, 30, 60, 120, 300] 초
 //    - 서비스 품질(QoS) 모니터링에 활용
@@ -0,0 +1,352 @@
+// [FILE]
+// - 목적: 리전 × 모드 샤드별 병렬 매치메이킹
+// - 주요 역할: 락 없는 제출 큐, 샤드별 워커 스레드, 샤드별 패스 지연 히스토그램
+// - 관련 클론 가이드 단계: [CG-v1.2.0] 매치메이킹
+// - 권장 읽는 순서: 생성자 → Enqueue/Cancel → WorkerLoop → RunShardPass → ShardQueue::Claim
+//
+// [LEARN] 단일 Matchmaker는 mutex_ 하나로 대기열 전체를 보호한다. RunMatching이
+//         잠금을 잡고 있는 동안 접속 핸들러의 Enqueue/Cancel이 모두 블로킹되고,
+//         매칭 자체도 io 스레드의 200ms 타이머에서 돌아간다.
+//         kr 플레이어와 us 플레이어는 어차피 서로 매칭되지 않으므로, 리전(+모드)별로
+//         대기열을 나누면 샤드끼리는 공유 상태가 전혀 없어 각자 스레드에서 돌릴 수 있다.
+//         예외는 "any" 하나뿐이라, 그 요청만 모든 리전 샤드에 복사하고 작은 장부로 중복을 막는다.
+
+#include "pvpserver/matchmaking/sharded_matchmaker.h"
+
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace pvpserver {
+
+// [Order 1] 생성자 - 리전 × 모드 조합마다 샤드 생성
+// - regions[0]이 기본 리전 (알 수 없는 리전)
+ShardedMatchmaker::ShardedMatchmaker(std::vector<std::string> regions,
+                                     std::vector<MatchFormat> formats,
+                                     std::chrono::milliseconds interval)
+    : regions_(std::move(regions)),
+      formats_(std::move(formats)),
+      interval_(interval),
+      notifications_(MatchNotificationChannel::Options{8192, 2, 64, false}) {
+    if (regions_.empty()) {
+        regions_.push_back("global");
+    }
+    if (formats_.empty()) {
+        formats_.push_back(MatchFormat::Duel());
+    }
+    for (const auto& region : regions_) {
+        for (const auto& format : formats_) {
+            auto shard = std::make_unique<Shard>();
+            shard->key = region + "/" + format.name;
+            shard->format = format;
+            shard->queue = std::make_shared<ShardQueue>(*this, shard->key, format.name);
+            shard->matchmaker = std::make_unique<Matchmaker>(shard->queue, format);
+            // 샤드 내부 우편함은 쓰지 않고, 공용 채널에 넣기만 함 (블로킹 없음)
+            shard->matchmaker->notification_channel().SetMailboxEnabled(false);
+            shard->matchmaker->SetMatchCreatedCallback(
+                [this](const Match& match) { notifications_.Publish(match); });
+            shard_index_[shard->key] = shard.get();
+            shards_.push_back(std::move(shard));
+        }
+    }
+}
+
+ShardedMatchmaker::~ShardedMatchmaker() { Stop(); }
+
+void ShardedMatchmaker::SetMatchCreatedCallback(std::function<void(const Match&)> callback) {
+    notifications_.Subscribe("match_created",
+                             [callback = std::move(callback)](const std::vector<Match>& batch) {
+                                 for (const auto& match : batch) {
+                                     callback(match);
+                                 }
+                             });
+}
+
+// [Order 2] Enqueue - 샤드 선택 후 제출 큐에 넣기만 함 ("any" 장부만 짧게 잠금)
+// - 알 수 없는 리전은 리전을 바꾸지 않음: 기본 리전 샤드 안에서도 같은 리전/"any"와만 매칭
+// - "any"는 같은 모드의 모든 리전 샤드에 복사 (표는 장부와 제출 순서가 어긋나지 않게 잠금 안에서 제출)
+bool ShardedMatchmaker::Enqueue(const MatchRequest& request, const std::string& mode) {
+    Shard* shard = FindShard(request.preferred_region(), mode);
+    if (!shard || request.party_size() > shard->format.max_party_size) {
+        return false;
+    }
+    const std::string key = FanoutKey(mode, request.player_id());
+    std::lock_guard<std::mutex> lk(fanout_mutex_);
+    if (request.preferred_region() != "any") {
+        if (fanout_tickets_.erase(key) > 0) {
+            // 이전 "any" 요청의 다른 샤드 복사본 정리 (대상 샤드 복사본은 Upsert로 교체됨)
+            CancelFanoutCopiesLocked(mode, request.player_id(), shard->key);
+        }
+        shard->submissions.Push(Command{Command::Kind::Enqueue, request, {}, 0});
+        shard->submitted_total.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    const std::uint64_t ticket = ++next_ticket_;
+    fanout_tickets_[key] = ticket;
+    for (auto& target : shards_) {
+        if (target->format.name != mode) {
+            continue;
+        }
+        target->submissions.Push(Command{Command::Kind::Enqueue, request, {}, ticket});
+        target->submitted_total.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+// [Order 3] Cancel - 모든 샤드에 전달 (해당 샤드가 아니면 워커에서 무시됨)
+// [LEARN] player → shard 맵을 두면 그 맵 자체에 잠금이 필요하다.
+//         샤드 수는 (리전 수 × 모드 수)로 작으므로 브로드캐스트가 더 싸다.
+void ShardedMatchmaker::Cancel(const std::string& player_id) {
+    std::lock_guard<std::mutex> lk(fanout_mutex_);
+    for (const auto& format : formats_) {
+        fanout_tickets_.erase(FanoutKey(format.name, player_id));
+    }
+    for (auto& shard : shards_) {
+        shard->submissions.Push(Command{Command::Kind::Cancel, std::nullopt, player_id});
+        shard->submitted_total.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ShardedMatchmaker::Start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    for (auto& shard : shards_) {
+        Shard* target = shard.get();
+        shard->worker = std::thread([this, target]() { WorkerLoop(*target); });
+    }
+}
+
+void ShardedMatchmaker::Stop() {
+    {
+        std::lock_guard<std::mutex> lk(wake_mutex_);
+        if (!running_.exchange(false)) {
+            return;
+        }
+    }
+    wake_cv_.notify_all();
+    for (auto& shard : shards_) {
+        if (shard->worker.joinable()) {
+            shard->worker.join();
+        }
+    }
+}
+
+std::size_t ShardedMatchmaker::RunOnce(std::chrono::steady_clock::time_point now) {
+    std::size_t matches = 0;
+    for (auto& shard : shards_) {
+        matches += RunShardPass(*shard, now);
+    }
+    return matches;
+}
+
+// [Order 4] WorkerLoop - 샤드 전용 스레드
+// - interval_마다 한 번 패스 실행, 패스가 길어져도 밀린 만큼 연속 실행하지 않음
+void ShardedMatchmaker::WorkerLoop(Shard& shard) {
+    auto next = std::chrono::steady_clock::now();
+    while (running_.load(std::memory_order_acquire)) {
+        RunShardPass(shard, std::chrono::steady_clock::now());
+        next += interval_;
+        const auto now = std::chrono::steady_clock::now();
+        if (next < now) {
+            next = now;
+        }
+        std::unique_lock<std::mutex> lk(wake_mutex_);
+        wake_cv_.wait_until(lk, next, [this]() { return !running_.load(); });
+    }
+}
+
+// [Order 5] RunShardPass - 제출분 반영 → 매칭 → 지연 시간 기록
+std::size_t ShardedMatchmaker::RunShardPass(Shard& shard, std::chrono::steady_clock::time_point now) {
+    const auto start = std::chrono::steady_clock::now();
+    shard.submissions.Drain([&shard](Command& command) {
+        if (command.kind == Command::Kind::Enqueue) {
+            shard.queue->SetTicket(command.request->player_id(), command.ticket);
+            shard.matchmaker->Enqueue(*command.request);
+        } else {
+            shard.matchmaker->Cancel(command.player_id);
+        }
+    });
+    const auto matches = shard.matchmaker->RunMatching(now);
+
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    shard.pass_count.fetch_add(1, std::memory_order_relaxed);
+    shard.pass_sum_us.fetch_add(static_cast<std::uint64_t>(seconds * 1e6),
+                                std::memory_order_relaxed);
+    bool bucket_found = false;
+    for (std::size_t i = 0; i < kPassBuckets.size(); ++i) {
+        if (seconds <= kPassBuckets[i]) {
+            shard.pass_bucket_counts[i].fetch_add(1, std::memory_order_relaxed);
+            bucket_found = true;
+            break;
+        }
+    }
+    if (!bucket_found) {
+        shard.pass_overflow_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    return matches.size();
+}
+
+ShardedMatchmaker::Shard* ShardedMatchmaker::FindShard(const std::string& region,
+                                                       const std::string& mode) const {
+    auto it = shard_index_.find(region + "/" + mode);
+    if (it == shard_index_.end()) {
+        it = shard_index_.find(regions_.front() + "/" + mode);  // 기본 리전
+    }
+    return it == shard_index_.end() ? nullptr : it->second;
+}
+
+void ShardedMatchmaker::CancelFanoutCopiesLocked(const std::string& mode,
+                                                 const std::string& player_id,
+                                                 const std::string& except_key) {
+    for (auto& shard : shards_) {
+        if (shard->format.name != mode || shard->key == except_key) {
+            continue;
+        }
+        shard->submissions.Push(Command{Command::Kind::Cancel, std::nullopt, player_id, 0});
+        shard->submitted_total.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+ShardedMatchmaker::ShardQueue::ShardQueue(ShardedMatchmaker& owner, std::string key,
+                                          std::string mode)
+    : owner_(owner), key_(std::move(key)), mode_(std::move(mode)) {}
+
+void ShardedMatchmaker::ShardQueue::SetTicket(const std::string& player_id,
+                                              std::uint64_t ticket) {
+    auto it = tickets_.find(player_id);
+    if (ticket == 0) {
+        if (it != tickets_.end()) {
+            tickets_.erase(it);
+            fanout_copies_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    } else if (it == tickets_.end()) {
+        tickets_.emplace(player_id, ticket);
+        fanout_copies_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        it->second = ticket;
+    }
+}
+
+bool ShardedMatchmaker::ShardQueue::Remove(const std::string& player_id) {
+    const bool removed = InMemoryMatchQueue::Remove(player_id);
+    if (tickets_.erase(player_id) > 0) {
+        fanout_copies_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return removed;
+}
+
+// [Order 6] ShardQueue::Claim - "any" 복사본이 섞인 매치는 장부의 표가 그대로일 때만 가져감
+// [LEARN] Cancel만으로는 부족하다. 다른 샤드가 Cancel을 반영하기 전에 같은 패스 안에서
+//         같은 "any" 플레이어로 매치를 만들 수 있기 때문이다. 표 확인 + 삭제를 장부 잠금 안에서
+//         한 번에 하므로 먼저 Claim한 샤드만 성공하고, 늦은 샤드의 매치는 Matchmaker가 버린다.
+std::vector<bool> ShardedMatchmaker::ShardQueue::Claim(
+    const std::vector<std::vector<std::string>>& groups) {
+    std::vector<bool> claimed;
+    claimed.reserve(groups.size());
+    std::vector<std::string> fanout;
+    std::lock_guard<std::mutex> lk(owner_.fanout_mutex_);
+    for (const auto& group : groups) {
+        fanout.clear();
+        bool valid = true;
+        for (const auto& player_id : group) {
+            auto ticket = tickets_.find(player_id);
+            if (ticket == tickets_.end()) {
+                continue;
+            }
+            auto current = owner_.fanout_tickets_.find(FanoutKey(mode_, player_id));
+            if (current == owner_.fanout_tickets_.end() || current->second != ticket->second) {
+                valid = false;  // 다른 샤드가 먼저 가져갔거나 취소됨 (Cancel 도착 전)
+                break;
+            }
+            fanout.push_back(player_id);
+        }
+        const bool ok = valid && InMemoryMatchQueue::Claim({group}).front();
+        if (ok) {
+            for (const auto& player_id : fanout) {
+                owner_.fanout_tickets_.erase(FanoutKey(mode_, player_id));
+                owner_.CancelFanoutCopiesLocked(mode_, player_id, key_);
+            }
+        }
+        claimed.push_back(ok);
+    }
+    return claimed;
+}
+
+// [Order 7] MetricsSnapshot - 기존 matchmaking_* 메트릭(전체 합산) + 샤드별 메트릭
+std::string ShardedMatchmaker::MetricsSnapshot() const {
+    Matchmaker::MetricsTotals totals;
+    std::size_t fanout_copies = 0;
+    for (const auto& shard : shards_) {
+        totals += shard->matchmaker->GetMetricsTotals();
+        fanout_copies += shard->queue->FanoutCopies();
+    }
+    // "any" 복사본은 플레이어당 한 번만 셈
+    std::size_t fanout_players = 0;
+    {
+        std::lock_guard<std::mutex> lk(fanout_mutex_);
+        fanout_players = fanout_tickets_.size();
+    }
+    totals.queue_size = totals.queue_size >= fanout_copies
+                            ? totals.queue_size - fanout_copies + fanout_players
+                            : fanout_players;
+    std::ostringstream oss;
+    oss << Matchmaker::RenderMetrics(totals);
+
+    oss << "# TYPE matchmaking_shard_queue_size gauge\n";
+    for (const auto& shard : shards_) {
+        oss << "matchmaking_shard_queue_size{shard=\"" << shard->key << "\"} "
+            << shard->matchmaker->GetMetricsTotals().queue_size << "\n";
+    }
+    oss << "# TYPE matchmaking_shard_submissions_total counter\n";
+    for (const auto& shard : shards_) {
+        oss << "matchmaking_shard_submissions_total{shard=\"" << shard->key << "\"} "
+            << shard->submitted_total.load(std::memory_order_relaxed) << "\n";
+    }
+    oss << "# TYPE matchmaking_shard_pass_seconds histogram\n";
+    for (const auto& shard : shards_) {
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < kPassBuckets.size(); ++i) {
+            cumulative += shard->pass_bucket_counts[i].load(std::memory_order_relaxed);
+            oss << "matchmaking_shard_pass_seconds_bucket{shard=\"" << shard->key << "\",le=\""
+                << kPassBuckets[i] << "\"} " << cumulative << "\n";
+        }
+        cumulative += shard->pass_overflow_count.load(std::memory_order_relaxed);
+        oss << "matchmaking_shard_pass_seconds_bucket{shard=\"" << shard->key
+            << "\",le=\"+Inf\"} " << cumulative << "\n";
+        oss << "matchmaking_shard_pass_seconds_sum{shard=\"" << shard->key << "\"} "
+            << static_cast<double>(shard->pass_sum_us.load(std::memory_order_relaxed)) / 1e6
+            << "\n";
+        oss << "matchmaking_shard_pass_seconds_count{shard=\"" << shard->key << "\"} "
+            << shard->pass_count.load(std::memory_order_relaxed) << "\n";
+    }
+    oss << notifications_.MetricsSnapshot();
+    return oss.str();
+}
+
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 이 파일에서 처음 등장한 개념:
+//
+// 1. 락 없는 제출 큐 (Treiber 스택 + 일괄 뒤집기)
+//    - 생산자: compare_exchange로 머리에 노드 추가 (실패하면 재시도)
+//    - 소비자: exchange(nullptr)로 전체를 한 번에 가져와 뒤집으면 FIFO
+//    - 소비자가 하나뿐이라 ABA 문제가 생기지 않음
+//
+// 2. 샤딩 (Sharding)
+//    - 서로 상호작용하지 않는 데이터를 나누면 잠금 없이 병렬 처리 가능
+//    - 리전이 다른 플레이어는 원래 매칭되지 않으므로 샤드 경계가 자연스러움
+//
+// 3. 팬아웃 + 취소 (Fan-out with cancel-on-claim)
+//    - 여러 샤드에 걸친 요청("any")은 모든 샤드에 복사하고, 처음 가져간 샤드만 인정
+//    - 표(ticket)를 두면 재등록 전의 오래된 복사본과 새 요청을 구별할 수 있음
+//
+// 관련 설계 문서:
+// - design/v1.2.0-matchmaking.md (매치메이킹 알고리즘)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/matchmaking/matchmaker.cpp (샤드 내부 매칭 로직)
+// ================================================================================
@@ -0,0 +1,133 @@
+// [FILE]
+// - 목적: 할당 없는 고정 용량 클라이언트 예측 (봇/부하 생성기용)
+// - 주요 역할: 링 버퍼 기반 입력/예측 히스토리, 연속 메모리 뷰 반환
+// - 관련 클론 가이드 단계: [v1.4.1] 클라이언트 예측/리컨실리에이션
+// - 권장 읽는 순서: Simulate → Predict → AcknowledgeUpTo → GetUnacknowledgedInputs
+//
+// [LEARN] ClientPrediction은 std::deque<PredictedState>에 PlayerState(문자열 포함)를
+//         통째로 저장하고, 리컨실리에이션마다 새 vector를 만들어 반환한다.
+//         플레이어 한 명이면 문제없지만, 수천 명을 돌리는 봇 프로세스에서는
+//         할당기가 병목이 된다. 여기서는 고정 크기 배열 + 미러링 링 버퍼로
+//         입력 한 건당 할당 0회를 보장한다.
+
+#include "pvpserver/netcode/fixed_client_prediction.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace pvpserver::netcode {
+
+namespace {
+
+std::uint64_t CurrentTimeMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace
+
+// [Order 1] Simulate - ClientPrediction의 SimulateInput과 동일한 물리
+PredictedPose FixedClientPrediction::Simulate(const PredictedPose& pose, const InputCommand& input,
+                                              float delta_time) {
+    constexpr float SPEED = 5.0f;  // 초당 이동 거리 (서버와 동일값!)
+
+    PredictedPose result = pose;
+    result.x += input.move_x * SPEED * delta_time;
+    result.y += input.move_y * SPEED * delta_time;
+    result.facing_radians = input.aim_radians;
+    result.input_sequence = input.sequence;
+    return result;
+}
+
+// [Order 2] Predict - 예측 실행 + 입력 히스토리 기록 (복사 1회, 할당 없음)
+PredictedPose FixedClientPrediction::Predict(const PredictedPose& current,
+                                             const InputCommand& input, float delta_time) {
+    PredictedPose prediction = Simulate(current, input, delta_time);
+    prediction.timestamp = CurrentTimeMs();
+    input_history_.PushBack(input);
+    return prediction;
+}
+
+void FixedClientPrediction::SavePrediction(const PredictedPose& prediction) {
+    predictions_.PushBack(prediction);
+    stats_.total_predictions++;
+}
+
+// [Order 3] AcknowledgeUpTo - 링 버퍼 head만 전진
+void FixedClientPrediction::AcknowledgeUpTo(std::uint32_t server_sequence) {
+    last_acknowledged_ = server_sequence;
+    while (!predictions_.Empty() && predictions_.Front().input_sequence <= server_sequence) {
+        predictions_.PopFront();
+    }
+    while (!input_history_.Empty() && input_history_.Front().sequence <= server_sequence) {
+        input_history_.PopFront();
+    }
+}
+
+// [Order 4] GetUnacknowledgedInputs - 시퀀스는 단조 증가하므로 이진 탐색 후 꼬리 구간 반환
+ConstSpan<InputCommand> FixedClientPrediction::GetUnacknowledgedInputs(
+    std::uint32_t after_sequence) const {
+    const auto all = input_history_.View();
+    const InputCommand* first =
+        std::upper_bound(all.begin(), all.end(), after_sequence,
+                         [](std::uint32_t sequence, const InputCommand& input) {
+                             return sequence < input.sequence;
+                         });
+    return ConstSpan<InputCommand>(first, static_cast<std::size_t>(all.end() - first));
+}
+
+std::optional<PredictedPose> FixedClientPrediction::GetLatestPrediction() const {
+    if (predictions_.Empty()) {
+        return std::nullopt;
+    }
+    return predictions_.Back();
+}
+
+std::optional<PredictedPose> FixedClientPrediction::GetPrediction(std::uint32_t sequence) const {
+    const auto all = predictions_.View();
+    const PredictedPose* it = std::lower_bound(
+        all.begin(), all.end(), sequence,
+        [](const PredictedPose& pose, std::uint32_t value) { return pose.input_sequence < value; });
+    if (it == all.end() || it->input_sequence != sequence) {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+void FixedClientPrediction::RecordPredictionResult(bool accurate) {
+    if (accurate) {
+        stats_.accurate_predictions++;
+    }
+}
+
+PredictedPose FixedClientPrediction::PoseFromState(const PlayerState& state) {
+    PredictedPose pose;
+    pose.input_sequence = static_cast<std::uint32_t>(state.last_sequence);
+    pose.x = state.x;
+    pose.y = state.y;
+    pose.facing_radians = state.facing_radians;
+    return pose;
+}
+
+}  // namespace pvpserver::netcode
+
+// [Reader Notes]
+// ================================================================================
+// 이 파일에서 처음 등장한 개념:
+//
+// 1. 미러링 링 버퍼 (Mirrored Ring Buffer)
+//    - 원소를 [i], [i + N]에 두 번 기록 → 어떤 N개 구간도 연속 메모리
+//    - 일반 링 버퍼는 랩어라운드 때문에 뷰를 두 조각으로 나눠야 함
+//    - 쓰기 비용 2배 대신 읽기는 포인터 + 길이 하나로 끝
+//
+// 2. 뷰 반환 (Span-returning Accessor)
+//    - 복사본 vector 대신 내부 버퍼를 가리키는 (포인터, 길이) 반환
+//    - 다음 변경 호출 전까지만 유효하다는 수명 규칙을 호출자가 지켜야 함
+//
+// 관련 설계 문서:
+// - design/v1.4.1-prediction.md (클라이언트 예측 상세)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/netcode/reconciliation.cpp (Reconcile 오버로드)
+// ================================================================================
@@ -11,6 +11,7 @@
 
 #include "pvpserver/netcode/reconciliation.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace pvpserver::netcode {
@@ -81,7 +82,9 @@ ReconciliationResult Reconciliation::Reconcile(
         // [핵심] 미확인 입력 재시뮬레이션
         // - 서버가 확인한 시점부터 현재까지의 입력을 다시 적용
         auto unacked_inputs = prediction.GetUnacknowledgedInputs(server_input_sequence);
-        result.corrected_state = Resimulate(server_state, unacked_inputs, delta_time);
+        result.corrected_state = Resimulate(
+            server_state, ConstSpan<InputCommand>(unacked_inputs.data(), unacked_inputs.size()),
+            delta_time);
         
         // 예측 정확도 기록 (통계용)
         prediction.RecordPredictionResult(false);
@@ -93,14 +96,52 @@ ReconciliationResult Reconciliation::Reconcile(
     // 확인된 시퀀스까지 버퍼 정리
     prediction.AcknowledgeUpTo(server_input_sequence);
     
-    // 평균 오차 업데이트 (런닝 평균)
-    stats_.avg_position_error = 
-        (stats_.avg_position_error * (stats_.total_reconciliations - 1) + result.position_error) 
-        / stats_.total_reconciliations;
+    RecordError(result.position_error);
     
     return result;
 }
 
+// [Order 1-1] Reconcile (FixedClientPrediction) - 같은 흐름, 뷰 기반 재시뮬레이션
+// [LEARN] 미확인 입력을 vector로 복사하지 않고 링 버퍼 뷰를 그대로 순회.
+//         PredictedPose에는 문자열이 없어서 결과 반환도 할당 없이 끝난다.
+PoseReconciliationResult Reconciliation::Reconcile(
+    const PredictedPose& server_pose,
+    FixedClientPrediction& prediction,
+    float delta_time
+) {
+    PoseReconciliationResult result;
+    stats_.total_reconciliations++;
+
+    auto predicted = prediction.GetPrediction(server_pose.input_sequence);
+    if (!predicted) {
+        result.corrected_pose = server_pose;
+        return result;
+    }
+
+    const float dx = static_cast<float>(server_pose.x - predicted->x);
+    const float dy = static_cast<float>(server_pose.y - predicted->y);
+    result.position_error = std::sqrt(dx * dx + dy * dy);
+
+    if (result.position_error > POSITION_THRESHOLD) {
+        result.mismatch_detected = true;
+        stats_.mismatches++;
+
+        PredictedPose pose = server_pose;
+        for (const auto& input : prediction.GetUnacknowledgedInputs(server_pose.input_sequence)) {
+            pose = FixedClientPrediction::Simulate(pose, input, delta_time);
+        }
+        result.corrected_pose = pose;
+        prediction.RecordPredictionResult(false);
+    } else {
+        result.corrected_pose = *predicted;
+        prediction.RecordPredictionResult(true);
+    }
+
+    prediction.AcknowledgeUpTo(server_pose.input_sequence);
+    RecordError(result.position_error);
+    return result;
+}
+
 // [Order 2] SmoothCorrection - 부드러운 보정 (갑작스러운 튕김 방지)
 // [LEARN] 선형 보간(Lerp)으로 점진적 위치 수정.
 //         즉각 보정 = 눈에 띄는 텔레포트 → 나쁜 UX
@@ -129,7 +170,7 @@ PlayerState Reconciliation::SmoothCorrection(
 
 PlayerState Reconciliation::Resimulate(
     const PlayerState& server_state,
-    const std::vector<InputCommand>& inputs,
+    ConstSpan<InputCommand> inputs,
     float delta_time
 ) {
     PlayerState state = server_state;
@@ -141,4 +182,11 @@ PlayerState Reconciliation::Resimulate(
     return state;
 }
 
+// 평균 오차 업데이트 (런닝 평균)
+void Reconciliation::RecordError(float position_error) {
+    stats_.avg_position_error =
+        (stats_.avg_position_error * (stats_.total_reconciliations - 1) + position_error) /
+        stats_.total_reconciliations;
+}
+
 }  // namespace pvpserver::netcode
@@ -0,0 +1,415 @@
+// [FILE]
+// - 목적: 서버 측 롤백 & 재시뮬레이션 (늦게 도착한 입력 처리)
+// - 주요 역할: 틱별 GameSession 체크포인트/입력 기록, 늦은 입력 삽입 후 결정론적 재실행
+// - 관련 클론 가이드 단계: [v1.4.1] 클라이언트 예측/리컨실리에이션
+// - 권장 읽는 순서: SubmitInput → AdvanceTick → ResimulateLocked
+//
+// [LEARN] 기존 서버는 last_sequence보다 오래된 입력을 그냥 버렸다.
+//         그러면 클라이언트 예측(ClientPrediction)과 서버 결과가 어긋나 보정이 발생.
+//         롤백 서버는 N틱 분량의 체크포인트를 보관하다가, 늦은 입력이 오면
+//         해당 틱으로 되돌린 뒤 현재 틱까지 다시 시뮬레이션한다.
+//         모든 플레이어에게 입력 지연을 추가하지 않고도 예측 오차를 없앨 수 있다.
+
+#include "pvpserver/netcode/rollback_engine.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+namespace pvpserver::netcode {
+
+namespace {
+
+constexpr double kTickCostSmoothing = 0.1;  // EWMA 가중치
+
+// 히스토리 직렬화 (빅엔디언, double은 비트 패턴 그대로)
+void WriteU64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+void WriteDouble(std::vector<std::uint8_t>& out, double value) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteU64(out, bits);
+}
+
+void WriteString(std::vector<std::uint8_t>& out, const std::string& value) {
+    WriteU64(out, value.size());
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+std::uint64_t ReadU64(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    if (data.size() < 8 || offset > data.size() - 8) {
+        throw std::runtime_error("Rollback history truncated");
+    }
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | data[offset++];
+    }
+    return value;
+}
+
+double ReadDouble(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint64_t bits = ReadU64(data, offset);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::string ReadString(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint64_t size = ReadU64(data, offset);
+    if (size > data.size() - offset) {
+        throw std::runtime_error("Rollback history truncated");
+    }
+    std::string value(data.begin() + static_cast<std::ptrdiff_t>(offset),
+                      data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+    offset += size;
+    return value;
+}
+
+// 방향키/발사 비트 플래그
+std::uint64_t PackButtons(const MovementInput& input) {
+    return (input.up ? 1u : 0u) | (input.down ? 2u : 0u) | (input.left ? 4u : 0u) |
+           (input.right ? 8u : 0u) | (input.fire ? 16u : 0u);
+}
+
+}  // namespace
+
+// [Order 1] 생성자 - 링 버퍼 할당 + 첫 프레임 체크포인트
+RollbackEngine::RollbackEngine(GameSession& session, RollbackConfig config)
+    : session_(session), config_(config) {
+    frames_.resize(std::max<std::size_t>(config_.history_ticks, 2));
+    BeginFrameLocked();
+}
+
+// [Order 2] SubmitInput - 입력 분류 및 적용
+// - 같은 플레이어의 더 큰 시퀀스가 이미 기록된 경우 = 늦은 입력
+// - 늦은 입력은 "그 다음 시퀀스가 적용된 프레임"에 삽입 (클럭 동기화 불필요)
+// [LEARN] 늦은 입력을 다음 시퀀스 바로 앞에 끼워 넣으면 입력 순서가 보존되어
+//         GameSession::ApplyInput의 시퀀스 검사(순서 역전 거부)를 그대로 통과한다.
+InputDisposition RollbackEngine::SubmitInput(const std::string& player_id,
+                                             const MovementInput& input, double delta_seconds) {
+    std::lock_guard<std::mutex> lk(mutex_);
+
+    const std::uint64_t oldest = OldestFrameLocked();
+    bool found_higher = false;
+    std::uint64_t target = current_frame_;
+    for (std::uint64_t index = oldest; index <= current_frame_ && !found_higher; ++index) {
+        for (const auto& logged : FrameAt(index).inputs) {
+            if (logged.player_id != player_id) {
+                continue;
+            }
+            if (logged.input.sequence == input.sequence) {
+                ++stats_.duplicate_inputs;
+                return InputDisposition::Duplicate;
+            }
+            if (logged.input.sequence > input.sequence) {
+                found_higher = true;
+                target = index;
+                break;
+            }
+        }
+    }
+
+    if (!found_higher) {
+        // 최신 입력: 히스토리 이전에 이미 더 큰 시퀀스가 적용됐는지 확인
+        try {
+            const auto state = session_.GetPlayer(player_id);
+            if (state.last_sequence != 0 && input.sequence <= state.last_sequence) {
+                ++stats_.late_inputs_dropped;
+                return InputDisposition::TooOld;
+            }
+        } catch (const std::exception&) {
+            return InputDisposition::TooOld;  // 존재하지 않는 플레이어
+        }
+        FrameAt(current_frame_).inputs.push_back(LoggedInput{player_id, input, delta_seconds});
+        session_.ApplyInput(player_id, input, delta_seconds);
+        ++stats_.inputs_applied;
+        return InputDisposition::Applied;
+    }
+
+    // 확정된 사망 이벤트(이미 브로드캐스트됨)를 되돌리는 롤백은 거부
+    if (FrameAt(target).start_state.players_dead_total() != session_.PlayersDeadTotal()) {
+        ++stats_.late_inputs_dropped;
+        return InputDisposition::TooOld;
+    }
+
+    // 예산 판정: 가장 이른 dirty 프레임부터 현재까지 재실행 비용 추정
+    const std::uint64_t start = rollback_pending_ ? std::min(dirty_frame_, target) : target;
+    const double estimated = avg_tick_seconds_ * static_cast<double>(current_frame_ - start);
+    if (estimated > std::chrono::duration<double>(config_.tick_budget).count()) {
+        ++stats_.rollbacks_over_budget;
+        ++stats_.late_inputs_dropped;
+        return InputDisposition::TooOld;
+    }
+
+    InsertOrdered(FrameAt(target).inputs, LoggedInput{player_id, input, delta_seconds});
+    dirty_frame_ = start;
+    rollback_pending_ = true;
+    ++stats_.late_inputs_accepted;
+    return InputDisposition::RolledBack;
+}
+
+// [Order 3] AdvanceTick - 대기 중인 롤백 처리 후 한 틱 진행
+void RollbackEngine::AdvanceTick(std::uint64_t tick, double delta_seconds) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (rollback_pending_) {
+        ResimulateLocked();
+    }
+
+    Frame& frame = FrameAt(current_frame_);
+    frame.loop_tick = tick;
+    frame.delta_seconds = delta_seconds;
+
+    const auto start = std::chrono::steady_clock::now();
+    session_.Tick(tick, delta_seconds);
+    const double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    avg_tick_seconds_ = avg_tick_seconds_ == 0.0
+                            ? elapsed
+                            : avg_tick_seconds_ + kTickCostSmoothing * (elapsed - avg_tick_seconds_);
+
+    ++current_frame_;
+    BeginFrameLocked();
+}
+
+void RollbackEngine::ResetHistory() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    ResetHistoryLocked();
+}
+
+void RollbackEngine::ResetHistoryLocked() {
+    // 현재 프레임의 입력은 새 체크포인트에 이미 반영되어 있으므로 기록을 비운다
+    history_floor_ = current_frame_;
+    rollback_pending_ = false;
+    BeginFrameLocked();
+}
+
+void RollbackEngine::AddPlayer(const std::string& player_id) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    session_.UpsertPlayer(player_id);
+    ResetHistoryLocked();
+}
+
+void RollbackEngine::RemovePlayer(const std::string& player_id) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    session_.RemovePlayer(player_id);
+    ResetHistoryLocked();
+}
+
+// [Order 3-1] ExportHistory / ImportHistory - 라이브 매치 이전
+// - 형식: 현재 프레임 번호, 가장 오래된 프레임 번호, 틱 비용 EWMA,
+//         이후 프레임마다 (loop_tick, delta, 시작 체크포인트, 입력 목록)
+// - 대상 노드의 링 버퍼가 더 작으면 오래된 프레임부터 버림
+// [LEARN] 프레임 번호를 그대로 유지하면 FrameAt(index)의 슬롯 계산이 양쪽에서 같아지고,
+//         현재 프레임의 시작 체크포인트 + 입력이 GameSession 상태와 짝을 이룬다.
+std::vector<std::uint8_t> RollbackEngine::ExportHistory() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<std::uint8_t> out;
+    const std::uint64_t oldest = OldestFrameLocked();
+    WriteU64(out, current_frame_);
+    WriteU64(out, oldest);
+    WriteDouble(out, avg_tick_seconds_);
+    for (std::uint64_t index = oldest; index <= current_frame_; ++index) {
+        const Frame& frame = frames_[index % frames_.size()];
+        WriteU64(out, frame.loop_tick);
+        WriteDouble(out, frame.delta_seconds);
+        frame.start_state.Encode(out);
+        WriteU64(out, frame.inputs.size());
+        for (const auto& logged : frame.inputs) {
+            WriteString(out, logged.player_id);
+            WriteU64(out, logged.input.sequence);
+            WriteU64(out, PackButtons(logged.input));
+            WriteDouble(out, logged.input.mouse_x);
+            WriteDouble(out, logged.input.mouse_y);
+            WriteDouble(out, logged.delta_seconds);
+        }
+    }
+    return out;
+}
+
+RollbackEngine::DecodedHistory RollbackEngine::DecodeHistory(const std::vector<std::uint8_t>& data) {
+    DecodedHistory history;
+    std::size_t offset = 0;
+    history.current_frame = ReadU64(data, offset);
+    const std::uint64_t oldest = ReadU64(data, offset);
+    history.avg_tick_seconds = ReadDouble(data, offset);
+    if (oldest > history.current_frame) {
+        throw std::runtime_error("Rollback history: invalid frame range");
+    }
+
+    for (std::uint64_t index = oldest; index <= history.current_frame; ++index) {
+        Frame frame;
+        frame.index = index;
+        frame.loop_tick = ReadU64(data, offset);
+        frame.delta_seconds = ReadDouble(data, offset);
+        frame.start_state = GameSession::Checkpoint::Decode(data, offset);
+        const std::uint64_t input_count = ReadU64(data, offset);
+        if (input_count > data.size() - offset) {
+            throw std::runtime_error("Rollback history: input count out of range");
+        }
+        for (std::uint64_t i = 0; i < input_count; ++i) {
+            LoggedInput logged;
+            logged.player_id = ReadString(data, offset);
+            logged.input.sequence = ReadU64(data, offset);
+            const std::uint64_t buttons = ReadU64(data, offset);
+            logged.input.up = (buttons & 1u) != 0;
+            logged.input.down = (buttons & 2u) != 0;
+            logged.input.left = (buttons & 4u) != 0;
+            logged.input.right = (buttons & 8u) != 0;
+            logged.input.fire = (buttons & 16u) != 0;
+            logged.input.mouse_x = ReadDouble(data, offset);
+            logged.input.mouse_y = ReadDouble(data, offset);
+            logged.delta_seconds = ReadDouble(data, offset);
+            frame.inputs.push_back(std::move(logged));
+        }
+        history.frames.push_back(std::move(frame));
+    }
+    if (offset != data.size()) {
+        throw std::runtime_error("Rollback history: trailing bytes");
+    }
+    return history;
+}
+
+void RollbackEngine::CommitHistoryLocked(DecodedHistory history) {
+    const std::size_t keep = std::min(history.frames.size(), frames_.size());
+    for (std::size_t i = history.frames.size() - keep; i < history.frames.size(); ++i) {
+        FrameAt(history.frames[i].index) = std::move(history.frames[i]);
+    }
+    current_frame_ = history.current_frame;
+    history_floor_ = history.current_frame + 1 - keep;
+    rollback_pending_ = false;
+    avg_tick_seconds_ = history.avg_tick_seconds;
+}
+
+void RollbackEngine::ImportHistory(const std::vector<std::uint8_t>& data) {
+    // 끝까지 검증한 뒤에 교체 (중간에 실패하면 기존 히스토리 유지)
+    DecodedHistory history = DecodeHistory(data);
+    std::lock_guard<std::mutex> lk(mutex_);
+    CommitHistoryLocked(std::move(history));
+}
+
+// 히스토리 검증 → 세션 복원(자체 검증 후 적용) → 히스토리 교체
+// 어느 단계에서 실패해도 세션과 히스토리 모두 이전 상태 그대로
+void RollbackEngine::ImportMatch(const std::vector<std::uint8_t>& session_state,
+                                 const std::vector<std::uint8_t>& history_data) {
+    std::optional<DecodedHistory> history;
+    if (!history_data.empty()) {
+        history = DecodeHistory(history_data);
+    }
+    std::lock_guard<std::mutex> lk(mutex_);
+    session_.ImportState(session_state);
+    if (history) {
+        CommitHistoryLocked(std::move(*history));
+    } else {
+        ResetHistoryLocked();  // 원본이 롤백 미사용: 여기서부터 새로 기록
+    }
+}
+
+RollbackEngine::Stats RollbackEngine::GetStats() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return stats_;
+}
+
+std::string RollbackEngine::MetricsSnapshot() const {
+    const Stats stats = GetStats();
+    std::ostringstream oss;
+    oss << "# TYPE rollback_total counter\n";
+    oss << "rollback_total " << stats.rollbacks << "\n";
+    oss << "# TYPE rollback_resimulated_ticks_total counter\n";
+    oss << "rollback_resimulated_ticks_total " << stats.resimulated_ticks << "\n";
+    oss << "# TYPE rollback_late_inputs_total counter\n";
+    oss << "rollback_late_inputs_total{result=\"accepted\"} " << stats.late_inputs_accepted
+        << "\n";
+    oss << "rollback_late_inputs_total{result=\"dropped\"} " << stats.late_inputs_dropped << "\n";
+    oss << "# TYPE rollback_over_budget_total counter\n";
+    oss << "rollback_over_budget_total " << stats.rollbacks_over_budget << "\n";
+    oss << "# TYPE rollback_last_duration_seconds gauge\n";
+    oss << "rollback_last_duration_seconds " << stats.last_rollback_seconds << "\n";
+    return oss.str();
+}
+
+std::uint64_t RollbackEngine::OldestFrameLocked() const {
+    const std::uint64_t capacity = frames_.size();
+    const std::uint64_t ring_oldest =
+        current_frame_ + 1 >= capacity ? current_frame_ + 1 - capacity : 0;
+    return std::max(ring_oldest, history_floor_);
+}
+
+// 새 프레임 시작: 가장 오래된 슬롯을 재사용하여 현재 상태를 저장
+void RollbackEngine::BeginFrameLocked() {
+    Frame& frame = FrameAt(current_frame_);
+    frame.index = current_frame_;
+    frame.loop_tick = 0;
+    frame.delta_seconds = 0.0;
+    frame.inputs.clear();
+    session_.SaveCheckpoint(frame.start_state);
+}
+
+// [Order 4] ResimulateLocked - 체크포인트 복원 후 현재 프레임까지 재실행
+// - 각 프레임의 시작 체크포인트도 새 결과로 갱신 (다음 롤백의 기준점)
+// [LEARN] 결정론의 조건: 같은 시작 상태 + 같은 입력 순서 + 같은 delta.
+//         그래서 프레임마다 원래의 loop_tick/delta_seconds를 함께 기록해 둔다.
+void RollbackEngine::ResimulateLocked() {
+    const auto start = std::chrono::steady_clock::now();
+    rollback_pending_ = false;
+
+    session_.RestoreCheckpoint(FrameAt(dirty_frame_).start_state);
+    for (std::uint64_t index = dirty_frame_; index <= current_frame_; ++index) {
+        Frame& frame = FrameAt(index);
+        if (index != dirty_frame_) {
+            session_.SaveCheckpoint(frame.start_state);
+        }
+        for (const auto& logged : frame.inputs) {
+            session_.ApplyInput(logged.player_id, logged.input, logged.delta_seconds);
+        }
+        if (index != current_frame_) {
+            session_.Tick(frame.loop_tick, frame.delta_seconds);
+            ++stats_.resimulated_ticks;
+        }
+    }
+
+    ++stats_.rollbacks;
+    stats_.last_rollback_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 같은 프레임 내에서는 (플레이어별) 시퀀스 순서를 유지하도록 삽입
+void RollbackEngine::InsertOrdered(std::vector<LoggedInput>& inputs, LoggedInput logged) {
+    auto position = std::find_if(inputs.begin(), inputs.end(), [&](const LoggedInput& existing) {
+        return existing.player_id == logged.player_id &&
+               existing.input.sequence > logged.input.sequence;
+    });
+    inputs.insert(position, std::move(logged));
+}
+
+}  // namespace pvpserver::netcode
+
+// [Reader Notes]
+// ================================================================================
+// 이 파일에서 처음 등장한 넷코드 개념:
+//
+// 1. 서버 측 롤백 (Authoritative Rollback)
+//    - 틱 시작 시점 상태를 N틱 분량 보관 (링 버퍼, 슬롯 재사용)
+//    - 늦은 입력 도착 → 해당 틱 체크포인트 복원 → 현재 틱까지 재실행
+//    - 같은 틱에 여러 늦은 입력이 와도 가장 이른 틱에서 한 번만 재실행
+//
+// 2. CPU 예산 (Tick Budget)
+//    - 틱 1회 비용을 EWMA로 추정, 재실행 틱 수 × 비용이 예산을 넘으면 입력을 버림
+//    - 롤백 때문에 게임 루프가 밀리면 모든 플레이어가 손해
+//
+// 3. 확정 이벤트 (Committed Events)
+//    - 사망 이벤트는 이미 클라이언트/통계로 나갔으므로 되돌리지 않음
+//    - 구간 내에 사망이 있으면 그 이전으로의 롤백은 거부
+//
+// 관련 설계 문서:
+// - design/v1.4.1-prediction.md (클라이언트 예측/리컨실리에이션)
+//
+// 이 파일을 이해한 다음, 이어서 보면 좋은 파일:
+// - server/src/game/game_session.cpp (SaveCheckpoint/RestoreCheckpoint)
+// - server/src/network/udp_game_server.cpp (HandleInput → SubmitInput)
+// ================================================================================
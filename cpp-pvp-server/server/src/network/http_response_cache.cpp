@@ -0,0 +1,127 @@
+// [FILE]
+// 목적: HTTP 응답 캐시 - 자주 폴링되는 /leaderboard, /profiles 응답 바이트를 재사용
+// - 관련 클론 가이드 단계: [v1.3.0] Statistics & Ranking
+// - 이 파일을 읽기 전에: profile_http_router.cpp, player_profile_service.cpp 참고
+// - 학습 포인트:
+//   [Order 1] 버전 태그: 원본이 바뀔 때마다 올라가는 숫자로 무효화 판단 (TTL 추측 불필요)
+//   [Order 2] 갱신 간격 제한: 버전이 바뀌어도 max_staleness 동안은 이전 바이트 사용
+//   [Order 3] 불변 공유 버퍼: shared_ptr<const string>을 연결마다 참조만 늘려 전송
+// - [LEARN] 웹사이트가 초당 수천 번 리더보드를 폴링해도, 직렬화는 갱신 간격마다 한 번.
+//           매치는 수 초마다 끝나므로 수백 ms 지연된 순위는 사용자에게 구분되지 않는다.
+// - [Reader Notes] 생성은 잠금 밖에서 하므로, 동시에 만료되면 여러 스레드가 같이 만들 수 있다.
+//                 결과는 같고 마지막 것이 남는다 (single-flight가 필요할 만큼 비싸지 않음).
+// - 다음에 읽을 파일: profile_http_router.cpp (캐시 사용처)
+
+#include "pvpserver/network/http_response_cache.h"
+
+#include <sstream>
+#include <utility>
+
+namespace pvpserver {
+
+HttpResponseCache::HttpResponseCache(std::string name, std::size_t max_entries)
+    : name_(std::move(name)), max_entries_(max_entries == 0 ? 1 : max_entries) {}
+
+// [Order 1] GetOrBuild - 같은 버전이면 즉시 반환, 아니면 갱신 간격 확인 후 재생성
+HttpResponseCache::Body HttpResponseCache::GetOrBuild(const std::string& key,
+                                                      std::uint64_t version,
+                                                      std::chrono::milliseconds max_staleness,
+                                                      const Builder& builder) {
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        const auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            if (it->second.version == version) {
+                ++hits_total_;
+                return it->second.body;
+            }
+            // [Order 2] 버전은 바뀌었지만 아직 갱신 간격 안쪽이면 이전 바이트 사용
+            if (now - it->second.built_at < max_staleness) {
+                ++stale_hits_total_;
+                return it->second.body;
+            }
+        }
+        ++misses_total_;
+    }
+
+    // 직렬화는 잠금 밖에서 (다른 키 조회를 막지 않음)
+    auto built = builder();
+    if (!built) {
+        return nullptr;
+    }
+    // [Order 3] 한 번 만든 바이트는 수정하지 않음
+    Body body = std::make_shared<const std::string>(std::move(*built));
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    ++builds_total_;
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        if (entries_.size() >= max_entries_) {
+            EvictUnsafe(version);
+        }
+        entries_.emplace(key, Entry{body, version, now});
+    } else if (it->second.version <= version) {
+        it->second = Entry{body, version, now};
+    }
+    return body;
+}
+
+// 이전 버전 항목부터 버리고, 그래도 가득 차 있으면 전부 비움
+void HttpResponseCache::EvictUnsafe(std::uint64_t current_version) {
+    const auto before = entries_.size();
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.version != current_version) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (entries_.size() >= max_entries_) {
+        entries_.clear();
+    }
+    evictions_total_ += before - entries_.size();
+}
+
+void HttpResponseCache::Clear() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    entries_.clear();
+}
+
+std::size_t HttpResponseCache::Size() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return entries_.size();
+}
+
+std::string HttpResponseCache::MetricsSnapshot() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::ostringstream oss;
+    const std::string label = "{cache=\"" + name_ + "\"}";
+    oss << "# TYPE http_response_cache_hits_total counter\n";
+    oss << "http_response_cache_hits_total" << label << " " << hits_total_ << "\n";
+    oss << "# TYPE http_response_cache_stale_hits_total counter\n";
+    oss << "http_response_cache_stale_hits_total" << label << " " << stale_hits_total_ << "\n";
+    oss << "# TYPE http_response_cache_misses_total counter\n";
+    oss << "http_response_cache_misses_total" << label << " " << misses_total_ << "\n";
+    oss << "# TYPE http_response_cache_builds_total counter\n";
+    oss << "http_response_cache_builds_total" << label << " " << builds_total_ << "\n";
+    oss << "# TYPE http_response_cache_evictions_total counter\n";
+    oss << "http_response_cache_evictions_total" << label << " " << evictions_total_ << "\n";
+    oss << "# TYPE http_response_cache_entries gauge\n";
+    oss << "http_response_cache_entries" << label << " " << entries_.size() << "\n";
+    return oss.str();
+}
+
+}  // namespace pvpserver
+
+// ================================================================================
+// [Reader Notes] HTTP 응답 캐시
+// ================================================================================
+// 1. 왜 TTL 캐시가 아니라 버전 캐시인가
+//    - TTL만 쓰면 변화가 없어도 주기마다 다시 만들고, 변화 직후에도 TTL까지 옛값을 보냄
+//    - 버전 + 최소 갱신 간격: 변화 없으면 영원히 재사용, 변화 있으면 최대 N ms 안에 반영
+//
+// 2. 프로필은 max_staleness = 0
+//    - 한 플레이어 조회는 싸고, 경기 직후 내 프로필이 안 바뀌어 보이면 어색함
+//    - 리더보드는 상위 N명 직렬화 + 전역 잠금이라 간격 제한의 효과가 큼
+// ================================================================================
@@ -6,6 +6,7 @@
 //   [Order 1] Boost.Beast HTTP: 게임 서버 내장 HTTP 서버 (별도 웹서버 불필요)
 //   [Order 2] enable_shared_from_this: 비동기 콜백에서 객체 수명 관리
 //   [Order 3] RequestHandler 콜백: 라우팅 로직을 외부에서 주입 (의존성 역전)
+//   [Order 4] HTTP/1.1 keep-alive: 폴링 클라이언트가 요청마다 TCP 핸드셰이크를 반복하지 않음
 // - [LEARN] Prometheus는 Pull 모델: 메트릭 서버가 주기적으로 /metrics를 폴링
 // - [Reader Notes] 게임 서버가 9090 포트에서 메트릭 노출 → Grafana 대시보드 연동
 // - 다음에 읽을 파일: profile_http_router.cpp (실제 라우팅 로직)
@@ -17,6 +18,7 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <string>
 
 namespace pvpserver {
 
@@ -26,17 +28,22 @@ using tcp = boost::asio::ip::tcp;
 class MetricsHttpServer::Session : public std::enable_shared_from_this<MetricsHttpServer::Session> {
    public:
     Session(std::shared_ptr<MetricsHttpServer> server, tcp::socket socket)
-        : server_(std::move(server)), socket_(std::move(socket)) {}
+        : server_(std::move(server)), stream_(std::move(socket)) {}
 
     void Start() { ReadRequest(); }
 
    private:
+    // [Order 4] keep-alive: 응답 후 같은 연결에서 다음 요청을 읽음 (유휴 시간 초과 시 종료)
     void ReadRequest() {
+        request_ = {};
+        stream_.expires_after(kIdleTimeout);
         auto self = shared_from_this();
-        http::async_read(socket_, buffer_, request_,
+        http::async_read(stream_, buffer_, request_,
                          [self](boost::system::error_code ec, std::size_t /*bytes_transferred*/) {
                              if (ec) {
-                                 if (ec != http::error::end_of_stream) {
+                                 if (ec != http::error::end_of_stream &&
+                                     ec != boost::beast::error::timeout &&
+                                     ec != boost::asio::error::connection_reset) {
                                      std::cerr << "metrics read error: " << ec.message()
                                                << std::endl;
                                  }
@@ -56,36 +63,53 @@ class MetricsHttpServer::Session : public std::enable_shared_from_this<MetricsHt
             response_.keep_alive(false);
             response_.result(http::status::not_found);
             response_.set(http::field::content_type, "text/plain");
-            response_.body() = "Not Found";
+            response_.body() = std::make_shared<const std::string>("Not Found");
             response_.prepare_payload();
         }
 
         auto self = shared_from_this();
-        http::async_write(socket_, response_,
+        http::async_write(stream_, response_,
                           [self](boost::system::error_code ec, std::size_t /*bytes_transferred*/) {
+                              const bool keep_alive = !ec && self->response_.keep_alive();
                               if (ec) {
                                   std::cerr << "metrics write error: " << ec.message() << std::endl;
                               }
                               self->response_ = {};
-                              self->Close();
+                              if (keep_alive) {
+                                  self->ReadRequest();
+                              } else {
+                                  self->Close();
+                              }
                           });
     }
 
     void Close() {
         boost::system::error_code ec;
-        socket_.shutdown(tcp::socket::shutdown_send, ec);
-        socket_.close(ec);
+        stream_.socket().shutdown(tcp::socket::shutdown_send, ec);
+        stream_.socket().close(ec);
     }
 
     std::shared_ptr<MetricsHttpServer> server_;
-    tcp::socket socket_;
+    boost::beast::tcp_stream stream_;
     boost::beast::flat_buffer buffer_;
-    http::request<http::string_body> request_;
-    http::response<http::string_body> response_;
+    Request request_;
+    Response response_;
 };
 
 MetricsHttpServer::MetricsHttpServer(boost::asio::io_context& io_context, std::uint16_t port,
                                      RequestHandler handler)
+    : MetricsHttpServer(
+          io_context, port,
+          SharedRequestHandler([handler = std::move(handler)](const Request& request) {
+              // 기존 string_body 핸들러: 본문 문자열을 공유 버퍼로 옮김 (복사 없음)
+              auto legacy = handler(request);
+              Response response{std::move(legacy.base())};
+              response.body() = std::make_shared<const std::string>(std::move(legacy.body()));
+              return response;
+          })) {}
+
+MetricsHttpServer::MetricsHttpServer(boost::asio::io_context& io_context, std::uint16_t port,
+                                     SharedRequestHandler handler)
     : io_context_(io_context), acceptor_(io_context), handler_(std::move(handler)) {
     boost::system::error_code ec;
     tcp::endpoint endpoint(tcp::v4(), port);
@@ -169,6 +169,24 @@ ConnectAckPacket ConnectAckPacket::Deserialize(const std::vector<std::uint8_t>&
     return packet;
 }
 
+// RedirectPacket
+std::vector<std::uint8_t> RedirectPacket::Serialize() const {
+    std::vector<std::uint8_t> buffer;
+    WriteString(buffer, host);
+    WriteUint16BE(buffer, port);
+    WriteUint32BE(buffer, server_tick);
+    return buffer;
+}
+
+RedirectPacket RedirectPacket::Deserialize(const std::vector<std::uint8_t>& payload) {
+    std::size_t offset = 0;
+    RedirectPacket packet;
+    packet.host = ReadString(payload, offset);
+    packet.port = ReadUint16BE(payload, offset);
+    packet.server_tick = ReadUint32BE(payload, offset);
+    return packet;
+}
+
 // InputCommand
 std::vector<std::uint8_t> InputCommand::Serialize() const {
     std::vector<std::uint8_t> buffer;
@@ -4,8 +4,9 @@
 // - 이 파일을 읽기 전에: design/v1.3.0-stats.md, metrics_http_server.cpp 참고
 // - 학습 포인트:
 //   [Order 1] 경로 기반 라우팅: target 문자열 파싱으로 엔드포인트 분기
-//   [Order 2] 쿼리 파라미터 파싱: ?limit=100 형태의 GET 파라미터 추출
+//   [Order 2] 쿼리 파라미터 파싱: ?limit=50&offset=10000 형태의 GET 파라미터 추출
 //   [Order 3] JSON 응답: application/json Content-Type으로 API 응답
+//   [Order 4] keep-alive 응답 + [Order 5/6] 버전 캐시된 JSON 바이트 (http_response_cache.cpp)
 // - [LEARN] REST API 패턴: GET /profiles/{id}는 특정 플레이어 조회
 // - [Reader Notes] 프로덕션에서는 OpenAPI/Swagger 문서화 권장
 // - 다음에 읽을 파일: player_profile_service.cpp (실제 프로필 로직)
@@ -14,29 +15,57 @@
 
 #include <algorithm>
 #include <cctype>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace pvpserver {
 
 namespace http = boost::beast::http;
 
+namespace {
+// 고정 오류 응답은 한 번만 만들어 공유
+HttpResponseCache::Body ConstantBody(const char* text) {
+    return std::make_shared<const std::string>(text);
+}
+const HttpResponseCache::Body& NotFoundJson() {
+    static const auto body = ConstantBody("{\"error\":\"not found\"}");
+    return body;
+}
+const HttpResponseCache::Body& UnavailableJson() {
+    static const auto body = ConstantBody("{\"error\":\"profiles unavailable\"}");
+    return body;
+}
+}  // namespace
+
 ProfileHttpRouter::ProfileHttpRouter(MetricsProvider metrics_provider,
                                      std::shared_ptr<PlayerProfileService> profile_service)
-    : metrics_provider_(std::move(metrics_provider)),
-      profile_service_(std::move(profile_service)) {}
+    : ProfileHttpRouter(std::move(metrics_provider), std::move(profile_service), Options{}) {}
 
-http::response<http::string_body> ProfileHttpRouter::Handle(
-    const http::request<http::string_body>& request) const {
-    http::response<http::string_body> response;
-    response.version(request.version());
-    response.keep_alive(false);
+ProfileHttpRouter::ProfileHttpRouter(MetricsProvider metrics_provider,
+                                     std::shared_ptr<PlayerProfileService> profile_service,
+                                     Options options)
+    : metrics_provider_(std::move(metrics_provider)),
+      profile_service_(std::move(profile_service)),
+      options_(options),
+      leaderboard_cache_("leaderboard", 256),
+      profile_cache_("profile", options.max_cached_profiles) {}
+
+http::response<http::string_body> ProfileHttpRouter::Handle(const Request& request) const {
+    auto shared = HandleShared(request);
+    http::response<http::string_body> response{std::move(shared.base())};
+    if (shared.body()) {
+        response.body() = *shared.body();
+    }
+    return response;
+}
 
+// [Order 1] HandleShared - 경로별 분기, 본문은 공유 버퍼
+ProfileHttpRouter::SharedResponse ProfileHttpRouter::HandleShared(const Request& request) const {
     if (request.method() != http::verb::get) {
-        response.result(http::status::method_not_allowed);
-        response.set(http::field::content_type, "text/plain");
-        response.body() = "Method Not Allowed";
-        response.prepare_payload();
-        return response;
+        static const auto body = ConstantBody("Method Not Allowed");
+        return MakeResponse(request, http::status::method_not_allowed, "text/plain", body);
     }
 
     const std::string target{request.target()};
@@ -51,11 +80,8 @@ http::response<http::string_body> ProfileHttpRouter::Handle(
             remainder = remainder.substr(0, query_pos);
         }
         if (remainder.empty()) {
-            response.result(http::status::not_found);
-            response.set(http::field::content_type, "application/json");
-            response.body() = "{\"error\":\"not found\"}";
-            response.prepare_payload();
-            return response;
+            return MakeResponse(request, http::status::not_found, "application/json",
+                                NotFoundJson());
         }
         return HandleProfile(request, remainder);
     }
@@ -67,80 +93,91 @@ http::response<http::string_body> ProfileHttpRouter::Handle(
             query = target.substr(query_pos + 1);
         }
         const auto limit = ParseLimit(query);
-        return HandleLeaderboard(request, limit);
+        return HandleLeaderboard(request, limit, ParseOffset(query));
     }
 
-    response.result(http::status::not_found);
-    response.set(http::field::content_type, "text/plain");
-    response.body() = "Not Found";
-    response.prepare_payload();
-    return response;
+    static const auto body = ConstantBody("Not Found");
+    return MakeResponse(request, http::status::not_found, "text/plain", body);
 }
 
-http::response<http::string_body> ProfileHttpRouter::HandleMetrics(
-    const http::request<http::string_body>& request) const {
-    http::response<http::string_body> response;
+// [Order 4] MakeResponse - 클라이언트가 원하면 연결 유지 (HTTP/1.1 기본값)
+ProfileHttpRouter::SharedResponse ProfileHttpRouter::MakeResponse(const Request& request,
+                                                                  http::status status,
+                                                                  const char* content_type,
+                                                                  HttpResponseCache::Body body) {
+    SharedResponse response;
     response.version(request.version());
-    response.keep_alive(false);
-    response.result(http::status::ok);
-    response.set(http::field::content_type, "text/plain; version=0.0.4");
-    if (metrics_provider_) {
-        response.body() = metrics_provider_();
-    }
+    response.keep_alive(request.keep_alive());
+    response.result(status);
+    response.set(http::field::content_type, content_type);
+    response.body() = std::move(body);
     response.prepare_payload();
     return response;
 }
 
-http::response<http::string_body> ProfileHttpRouter::HandleProfile(
-    const http::request<http::string_body>& request, const std::string& player_id) const {
-    http::response<http::string_body> response;
-    response.version(request.version());
-    response.keep_alive(false);
+ProfileHttpRouter::SharedResponse ProfileHttpRouter::HandleMetrics(const Request& request) const {
+    std::string payload = metrics_provider_ ? metrics_provider_() : std::string{};
+    payload += MetricsSnapshot();
+    return MakeResponse(request, http::status::ok, "text/plain; version=0.0.4",
+                        std::make_shared<const std::string>(std::move(payload)));
+}
 
+// [Order 5] HandleProfile - 프로필 JSON은 버전이 바뀌면 바로 다시 만듦
+ProfileHttpRouter::SharedResponse ProfileHttpRouter::HandleProfile(
+    const Request& request, const std::string& player_id) const {
     if (!profile_service_) {
-        response.result(http::status::service_unavailable);
-        response.set(http::field::content_type, "application/json");
-        response.body() = "{\"error\":\"profiles unavailable\"}";
-        response.prepare_payload();
-        return response;
+        return MakeResponse(request, http::status::service_unavailable, "application/json",
+                            UnavailableJson());
     }
 
-    auto profile = profile_service_->GetProfile(player_id);
-    if (!profile) {
-        response.result(http::status::not_found);
-        response.set(http::field::content_type, "application/json");
-        response.body() = "{\"error\":\"not found\"}";
-        response.prepare_payload();
-        return response;
+    auto build = [this, &player_id]() -> std::optional<std::string> {
+        auto profile = profile_service_->GetProfile(player_id);
+        if (!profile) {
+            return std::nullopt;
+        }
+        return profile_service_->SerializeProfile(*profile);
+    };
+    HttpResponseCache::Body body;
+    if (options_.cache_enabled) {
+        // 버전은 만들기 전에 읽음 (만든 내용이 그 버전보다 오래될 수 없음)
+        body = profile_cache_.GetOrBuild(player_id, profile_service_->Version(),
+                                         std::chrono::milliseconds(0), build);
+    } else if (auto built = build()) {
+        body = std::make_shared<const std::string>(std::move(*built));
     }
-
-    response.result(http::status::ok);
-    response.set(http::field::content_type, "application/json");
-    response.body() = profile_service_->SerializeProfile(*profile);
-    response.prepare_payload();
-    return response;
+    if (!body) {
+        return MakeResponse(request, http::status::not_found, "application/json", NotFoundJson());
+    }
+    return MakeResponse(request, http::status::ok, "application/json", std::move(body));
 }
 
-http::response<http::string_body> ProfileHttpRouter::HandleLeaderboard(
-    const http::request<http::string_body>& request, std::size_t limit) const {
-    http::response<http::string_body> response;
-    response.version(request.version());
-    response.keep_alive(false);
-
+// [Order 6] HandleLeaderboard - 리더보드 JSON은 최대 leaderboard_refresh마다 한 번 생성
+// [LEARN] 캐시 적중 시 전역 프로필 잠금도, JSON 직렬화도 없이 shared_ptr 복사 한 번.
+ProfileHttpRouter::SharedResponse ProfileHttpRouter::HandleLeaderboard(const Request& request,
+                                                                       std::size_t limit,
+                                                                       std::size_t offset) const {
     if (!profile_service_) {
-        response.result(http::status::service_unavailable);
-        response.set(http::field::content_type, "application/json");
-        response.body() = "{\"error\":\"profiles unavailable\"}";
-        response.prepare_payload();
-        return response;
+        return MakeResponse(request, http::status::service_unavailable, "application/json",
+                            UnavailableJson());
     }
 
-    auto profiles = profile_service_->TopProfiles(limit);
-    response.result(http::status::ok);
-    response.set(http::field::content_type, "application/json");
-    response.body() = profile_service_->SerializeLeaderboard(profiles);
-    response.prepare_payload();
-    return response;
+    auto build = [this, limit, offset]() -> std::optional<std::string> {
+        return profile_service_->SerializeLeaderboard(
+            profile_service_->TopProfiles(limit, offset));
+    };
+    HttpResponseCache::Body body;
+    if (options_.cache_enabled) {
+        const auto key = std::to_string(limit) + ":" + std::to_string(offset);
+        body = leaderboard_cache_.GetOrBuild(key, profile_service_->Version(),
+                                             options_.leaderboard_refresh, build);
+    } else {
+        body = std::make_shared<const std::string>(*build());
+    }
+    return MakeResponse(request, http::status::ok, "application/json", std::move(body));
+}
+
+std::string ProfileHttpRouter::MetricsSnapshot() const {
+    return leaderboard_cache_.MetricsSnapshot() + profile_cache_.MetricsSnapshot();
 }
 
 std::size_t ProfileHttpRouter::ParseLimit(const std::string& query) {
@@ -172,4 +209,25 @@ std::size_t ProfileHttpRouter::ParseLimit(const std::string& query) {
     }
 }
 
+std::size_t ProfileHttpRouter::ParseOffset(const std::string& query) {
+    const std::string prefix = "offset=";
+    auto pos = query.find(prefix);
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    pos += prefix.size();
+    std::size_t end = pos;
+    while (end < query.size() && std::isdigit(static_cast<unsigned char>(query[end]))) {
+        ++end;
+    }
+    if (end == pos) {
+        return 0;
+    }
+    try {
+        return static_cast<std::size_t>(std::stoull(query.substr(pos, end - pos)));
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
 }  // namespace pvpserver
@@ -13,9 +13,11 @@
 
 #include "pvpserver/network/udp_game_server.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
 
 #include "pvpserver/core/game_loop.h"
 
@@ -30,6 +32,40 @@ std::size_t EndpointHash(const boost::asio::ip::udp::endpoint& ep) {
     return h1 ^ (h2 << 1);  // XOR + 시프트로 조합
 }
 
+// 매치 이전 번들 직렬화 (빅엔디언, 길이 접두 블록)
+void WriteU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+void WriteBlock(std::vector<std::uint8_t>& out, const std::vector<std::uint8_t>& block) {
+    WriteU32(out, static_cast<std::uint32_t>(block.size()));
+    out.insert(out.end(), block.begin(), block.end());
+}
+
+std::uint32_t ReadU32(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    if (data.size() < 4 || offset > data.size() - 4) {
+        throw std::runtime_error("Migration bundle truncated");
+    }
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value = (value << 8) | data[offset++];
+    }
+    return value;
+}
+
+std::vector<std::uint8_t> ReadBlock(const std::vector<std::uint8_t>& data, std::size_t& offset) {
+    const std::uint32_t size = ReadU32(data, offset);
+    if (size > data.size() - offset) {
+        throw std::runtime_error("Migration bundle truncated");
+    }
+    std::vector<std::uint8_t> block(data.begin() + static_cast<std::ptrdiff_t>(offset),
+                                    data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+    offset += size;
+    return block;
+}
+
 }  // namespace
 
 // [Order 1] 생성자 - 소켓 초기화
@@ -114,6 +150,9 @@ std::string UdpGameServer::MetricsSnapshot() const {
     result += "# HELP pvp_udp_clients_connected Connected clients\n";
     result += "# TYPE pvp_udp_clients_connected gauge\n";
     result += "pvp_udp_clients_connected " + std::to_string(ClientCount()) + "\n";
+    if (rollback_) {
+        result += rollback_->MetricsSnapshot();
+    }
     return result;
 }
 
@@ -129,6 +168,10 @@ void UdpGameServer::SetMatchCompletedCallback(MatchCompletedCallback callback) {
     match_completed_callback_ = std::move(callback);
 }
 
+void UdpGameServer::EnableRollback(netcode::RollbackConfig config) {
+    rollback_ = std::make_unique<netcode::RollbackEngine>(session_, config);
+}
+
 void UdpGameServer::OnPacketReceived(
     const std::vector<std::uint8_t>& data,
     const Endpoint& sender
@@ -139,6 +182,13 @@ void UdpGameServer::OnPacketReceived(
 
     try {
         auto header = PacketHeader::Deserialize(data);
+        // 이전 완료 후에는 어떤 패킷이든 새 주소를 알려줌 (REDIRECT 유실 대비)
+        if (migration_phase_ == MigrationPhase::REDIRECTED) {
+            if (header.type != PacketType::DISCONNECT) {
+                SendRedirect(sender);
+            }
+            return;
+        }
         std::vector<std::uint8_t> payload(
             data.begin() + PacketHeader::SIZE,
             data.end()
@@ -179,12 +229,22 @@ void UdpGameServer::HandleConnect(
         if (clients_.find(connect.player_id) != clients_.end()) {
             // 재연결 처리: 엔드포인트 업데이트
             auto& info = clients_[connect.player_id];
+            if (info.reconnect_deadline != 0) {
+                info.reconnect_deadline = 0;  // 이전된 매치로 재접속 완료
+                --awaiting_reconnect_;
+            }
             auto old_hash = EndpointHash(info.endpoint);
             endpoint_to_player_.erase(old_hash);
+            socket_->UnregisterClient(info.endpoint);
+            socket_->RegisterClient(sender);  // 새 주소로 브로드캐스트 (이전된 매치 재접속 포함)
             
             info.endpoint = sender;
             info.last_heartbeat = CurrentTimeMs();
             endpoint_to_player_[EndpointHash(sender)] = connect.player_id;
+        } else if (migration_phase_ == MigrationPhase::FROZEN) {
+            // 이미 내보낸 상태에 들어갈 수 없으므로 거절 (ACK 없음 → 클라이언트 재시도,
+            // 이전이 끝나면 REDIRECT를 받고 대상 노드로 접속)
+            return;
         } else {
             // 새 연결
             ClientInfo info;
@@ -197,7 +257,11 @@ void UdpGameServer::HandleConnect(
             endpoint_to_player_[EndpointHash(sender)] = connect.player_id;
             
             socket_->RegisterClient(sender);
-            session_.UpsertPlayer(connect.player_id);
+            if (rollback_) {
+                rollback_->AddPlayer(connect.player_id);  // 로스터 변경 이전으로는 롤백 불가
+            } else {
+                session_.UpsertPlayer(connect.player_id);
+            }
             
             if (on_join_) {
                 on_join_(connect.player_id);
@@ -223,6 +287,10 @@ void UdpGameServer::HandleConnect(
 
 void UdpGameServer::HandleDisconnect(const Endpoint& sender) {
     std::lock_guard<std::mutex> lock(clients_mutex_);
+    if (migration_phase_ == MigrationPhase::FROZEN) {
+        deferred_leaves_.push_back(sender);  // 재개 시 적용
+        return;
+    }
     
     auto hash = EndpointHash(sender);
     auto it = endpoint_to_player_.find(hash);
@@ -235,7 +303,11 @@ void UdpGameServer::HandleDisconnect(const Endpoint& sender) {
     clients_.erase(player_id);
     
     socket_->UnregisterClient(sender);
-    session_.RemovePlayer(player_id);
+    if (rollback_) {
+        rollback_->RemovePlayer(player_id);
+    } else {
+        session_.RemovePlayer(player_id);
+    }
     
     if (on_leave_) {
         on_leave_(player_id);
@@ -265,6 +337,10 @@ void UdpGameServer::HandleInput(
 ) {
     try {
         auto input_cmd = InputCommand::Deserialize(payload);
+        // 이전 중 도착한 입력은 버림 (UDP 유실과 같게 취급, 클라이언트는 다음 입력으로 이어감)
+        if (migration_phase_ != MigrationPhase::NONE) {
+            return;
+        }
         
         std::string player_id;
         {
@@ -274,12 +350,12 @@ void UdpGameServer::HandleInput(
                 return;
             }
             
-            // 중복/오래된 입력 무시
-            if (input_cmd.sequence <= client->last_input_sequence) {
+            // 중복/오래된 입력 무시 (롤백 활성 시 판정은 롤백 엔진이 담당)
+            if (!rollback_ && input_cmd.sequence <= client->last_input_sequence) {
                 return;
             }
             
-            client->last_input_sequence = input_cmd.sequence;
+            client->last_input_sequence = std::max(client->last_input_sequence, input_cmd.sequence);
             player_id = client->player_id;
         }
         
@@ -290,12 +366,23 @@ void UdpGameServer::HandleInput(
         movement.down = input_cmd.move_y < -0.5f;
         movement.left = input_cmd.move_x < -0.5f;
         movement.right = input_cmd.move_x > 0.5f;
-        movement.mouse_x = std::cos(input_cmd.aim_radians);
-        movement.mouse_y = std::sin(input_cmd.aim_radians);
+        if (session_.simulation_mode() == SimulationMode::FixedPoint) {
+            // libm cos/sin은 빌드마다 마지막 비트가 다를 수 있음 → CORDIC (Fixed→double은 손실 없음)
+            const FixedVec2 aim = FixedDirection(Fixed::FromDouble(input_cmd.aim_radians));
+            movement.mouse_x = aim.x.ToDouble();
+            movement.mouse_y = aim.y.ToDouble();
+        } else {
+            movement.mouse_x = std::cos(input_cmd.aim_radians);
+            movement.mouse_y = std::sin(input_cmd.aim_radians);
+        }
         movement.fire = input_cmd.fire;
         
         // 게임 세션에 입력 적용
-        session_.ApplyInput(player_id, movement, 1.0 / 60.0);
+        if (rollback_) {
+            rollback_->SubmitInput(player_id, movement, 1.0 / 60.0);
+        } else {
+            session_.ApplyInput(player_id, movement, 1.0 / 60.0);
+        }
         
         // InputAck 전송 (선택적)
         // SendPacket(sender, PacketType::INPUT_ACK, input_cmd.sequence, {});
@@ -305,8 +392,22 @@ void UdpGameServer::HandleInput(
     }
 }
 
-void UdpGameServer::BroadcastState(std::uint64_t tick, double /*delta_seconds*/) {
+void UdpGameServer::BroadcastState(std::uint64_t loop_tick, double delta_seconds) {
+    std::lock_guard<std::mutex> tick_lock(tick_mutex_);
+    next_loop_tick_ = loop_tick + 1;
+    if (migration_phase_ != MigrationPhase::NONE) {
+        return;  // 이전 중/이후: 매치는 대상 노드가 진행
+    }
+    const auto tick = static_cast<std::uint64_t>(static_cast<std::int64_t>(loop_tick) + tick_offset_);
     current_tick_ = static_cast<std::uint32_t>(tick);
+    if (awaiting_reconnect_ > 0) {
+        ExpireMigratedClients();
+    }
+
+    // 롤백 활성 시: 늦은 입력 재시뮬레이션 + 틱 진행
+    if (rollback_) {
+        rollback_->AdvanceTick(tick, delta_seconds);
+    }
     
     // 플레이어 상태 스냅샷
     auto players = session_.Snapshot();
@@ -354,6 +455,148 @@ void UdpGameServer::BroadcastState(std::uint64_t tick, double /*delta_seconds*/)
     }
 }
 
+// [Order 3] 라이브 매치 이전 (원본 노드)
+// - 번들: 틱 + GameSession 상태 + 롤백 히스토리 + 클라이언트(player_id, 마지막 입력 시퀀스)
+// - tick_mutex_를 잡으므로 진행 중인 틱이 끝난 직후, 다음 틱 전에 멈춤
+// [LEARN] 멈춘 시점부터 대상 노드가 ack할 때까지가 플레이어가 느끼는 정지 시간.
+//         상태가 수 KB 수준이라 사전 복사(pre-copy) 없이 stop-and-copy로도 한두 틱 안에 끝남.
+std::vector<std::uint8_t> UdpGameServer::FreezeForMigration() {
+    std::lock_guard<std::mutex> tick_lock(tick_mutex_);
+    // 로스터 변경(HandleConnect/HandleDisconnect)과 겹치지 않게 상태를 내보내는 동안 잠금 유지
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    MigrationPhase expected = MigrationPhase::NONE;
+    if (!migration_phase_.compare_exchange_strong(expected, MigrationPhase::FROZEN)) {
+        throw std::runtime_error("Match migration already in progress");
+    }
+
+    std::vector<std::uint8_t> bundle;
+    WriteU32(bundle, current_tick_);
+    WriteBlock(bundle, session_.ExportState());
+    WriteBlock(bundle, rollback_ ? rollback_->ExportHistory() : std::vector<std::uint8_t>{});
+
+    WriteU32(bundle, static_cast<std::uint32_t>(clients_.size()));
+    for (const auto& [player_id, info] : clients_) {
+        WriteBlock(bundle, std::vector<std::uint8_t>(player_id.begin(), player_id.end()));
+        WriteU32(bundle, info.last_input_sequence);
+    }
+    return bundle;
+}
+
+void UdpGameServer::CompleteMigration(const std::string& host, std::uint16_t port) {
+    RedirectPacket redirect;
+    redirect.host = host;
+    redirect.port = port;
+    redirect.server_tick = current_tick_;
+    redirect_payload_ = redirect.Serialize();
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex_);
+        deferred_leaves_.clear();  // 대상 노드에서 재접속 유예 시간이 지나면 정리됨
+        migration_phase_ = MigrationPhase::REDIRECTED;
+    }
+
+    BroadcastPacket(PacketType::REDIRECT, server_sequence_++, redirect_payload_);
+    std::cout << "Match migrated to " << host << ":" << port << std::endl;
+}
+
+void UdpGameServer::ResumeAfterMigrationFailure() {
+    std::vector<Endpoint> leaves;
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex_);
+        MigrationPhase expected = MigrationPhase::FROZEN;
+        if (!migration_phase_.compare_exchange_strong(expected, MigrationPhase::NONE)) {
+            return;
+        }
+        leaves.swap(deferred_leaves_);
+    }
+    for (const auto& sender : leaves) {
+        HandleDisconnect(sender);
+    }
+}
+
+// [Order 4] ImportMigratedMatch - 대상 노드에서 번들 복원
+// - 클라이언트는 주소를 모르는 상태로 등록 → 재접속(CONNECT) 경로에서 주소가 채워짐
+// - 롤백 히스토리가 없으면(원본이 롤백 미사용) 여기서부터 새로 기록
+void UdpGameServer::ImportMigratedMatch(const std::vector<std::uint8_t>& data) {
+    std::size_t offset = 0;
+    const std::uint32_t tick = ReadU32(data, offset);
+    const auto session_state = ReadBlock(data, offset);
+    const auto history = ReadBlock(data, offset);
+    const std::uint32_t client_count = ReadU32(data, offset);
+    std::vector<std::pair<std::string, std::uint32_t>> clients;
+    for (std::uint32_t i = 0; i < client_count; ++i) {
+        const auto id = ReadBlock(data, offset);
+        clients.emplace_back(std::string(id.begin(), id.end()), ReadU32(data, offset));
+    }
+    if (offset != data.size()) {
+        throw std::runtime_error("Migration bundle: trailing bytes");
+    }
+
+    std::lock_guard<std::mutex> tick_lock(tick_mutex_);
+    if (rollback_) {
+        rollback_->ImportMatch(session_state, history);  // 둘 다 검증된 뒤에만 적용
+    } else {
+        session_.ImportState(session_state);
+    }
+    // 다음 루프 틱이 원본의 다음 틱(tick + 1)이 되도록 맞춤 (세션/롤백/브로드캐스트 틱 모두 적용)
+    tick_offset_ = static_cast<std::int64_t>(tick) + 1 - static_cast<std::int64_t>(next_loop_tick_);
+    current_tick_ = tick;
+
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    const auto now = CurrentTimeMs();
+    for (const auto& [player_id, last_input_sequence] : clients) {
+        ClientInfo& info = clients_[player_id];
+        info.player_id = player_id;
+        info.last_input_sequence = last_input_sequence;
+        info.connect_time = now;
+        info.last_heartbeat = now;
+        if (info.reconnect_deadline == 0) {
+            ++awaiting_reconnect_;
+        }
+        info.reconnect_deadline = now + static_cast<std::uint64_t>(reconnect_grace_.count());
+    }
+}
+
+void UdpGameServer::SetMigrationReconnectGrace(std::chrono::milliseconds grace) {
+    std::lock_guard<std::mutex> tick_lock(tick_mutex_);
+    reconnect_grace_ = grace;
+}
+
+// 이전된 매치에서 유예 시간 안에 재접속하지 않은 플레이어 정리
+// (REDIRECT를 받지 못하고 떠났거나, 원본이 멈춘 동안 DISCONNECT를 보낸 경우)
+void UdpGameServer::ExpireMigratedClients() {
+    std::vector<std::string> expired;
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex_);
+        const auto now = CurrentTimeMs();
+        for (auto it = clients_.begin(); it != clients_.end();) {
+            if (it->second.reconnect_deadline != 0 && it->second.reconnect_deadline <= now) {
+                expired.push_back(it->first);
+                --awaiting_reconnect_;
+                it = clients_.erase(it);  // 주소 없이 등록된 상태라 엔드포인트 정리는 불필요
+            } else {
+                ++it;
+            }
+        }
+        for (const auto& player_id : expired) {
+            if (rollback_) {
+                rollback_->RemovePlayer(player_id);
+            } else {
+                session_.RemovePlayer(player_id);
+            }
+        }
+    }
+    for (const auto& player_id : expired) {
+        if (on_leave_) {
+            on_leave_(player_id);
+        }
+        std::cout << "Migrated client did not reconnect: " << player_id << std::endl;
+    }
+}
+
+void UdpGameServer::SendRedirect(const Endpoint& target) {
+    SendPacket(target, PacketType::REDIRECT, server_sequence_++, redirect_payload_);
+}
+
 void UdpGameServer::SendPacket(
     const Endpoint& target,
     PacketType type,
@@ -5,8 +5,10 @@
 // - 권장 읽는 순서: Upsert → TopN → InMemory vs Redis 구현
 //
 // [LEARN] 리더보드 자료구조:
-//         - InMemory: std::map (점수→플레이어 집합) + unordered_map (플레이어→점수)
+//         - InMemory: 스팬(span) 스킵 리스트 + unordered_map (플레이어→노드)
 //         - Redis: Sorted Set (ZADD, ZREVRANGE) - 대규모 분산 환경용
+//         예전 InMemory 구현(map<점수, set<플레이어>>)은 "X의 순위"나 "10,000~10,050위"를
+//         알려면 앞에서부터 세어야 했다 (O(N)). 스팬을 더해 가며 내려가면 O(log N).
 //
 // 두 가지 구현을 제공하여 환경에 따라 선택:
 //         - 단일 서버: InMemoryLeaderboardStore
@@ -16,82 +18,296 @@
 
 #include <algorithm>
 #include <iostream>
+#include <new>
 
 namespace pvpserver {
 
-// [Order 1] RemoveFromOrdered - 정렬된 맵에서 플레이어 제거
-// [LEARN] 점수 변경 시 기존 점수에서 먼저 제거해야 함
-void InMemoryLeaderboardStore::RemoveFromOrdered(const std::string& player_id, int score) {
-    auto ordered_it = ordered_.find(score);
-    if (ordered_it == ordered_.end()) {
-        return;
+void LeaderboardStore::UpsertBatch(const std::vector<std::pair<std::string, int>>& entries) {
+    for (const auto& entry : entries) {
+        Upsert(entry.first, entry.second);
+    }
+}
+
+InMemoryLeaderboardStore::InMemoryLeaderboardStore()
+    : header_(CreateNode(kMaxLevel, 0, std::string{})) {}
+
+InMemoryLeaderboardStore::~InMemoryLeaderboardStore() {
+    Node* node = header_;
+    while (node) {
+        Node* next = node->levels()[0].forward;
+        DestroyNode(node);
+        node = next;
+    }
+}
+
+// [Order 1] CreateNode - 노드 + 레벨 배열을 한 번에 할당
+InMemoryLeaderboardStore::Node* InMemoryLeaderboardStore::CreateNode(
+    int level_count, int score, const std::string& player_id) {
+    void* memory = ::operator new(sizeof(Node) + sizeof(Level) * static_cast<std::size_t>(level_count));
+    Node* node = new (memory) Node{player_id, score, level_count};
+    Level* levels = node->levels();
+    for (int i = 0; i < level_count; ++i) {
+        new (&levels[i]) Level{nullptr, 0};
+    }
+    return node;
+}
+
+void InMemoryLeaderboardStore::DestroyNode(Node* node) {
+    node->~Node();
+    ::operator delete(node);
+}
+
+// 정렬 기준: 점수 내림차순, 동점이면 player_id 오름차순
+bool InMemoryLeaderboardStore::Before(int score, const std::string& player_id,
+                                      const Node* node) noexcept {
+    return node->score > score || (node->score == score && node->player_id < player_id);
+}
+
+// [LEARN] 레벨 k일 확률 = (1/4)^(k-1). 평균 레벨 1.33 → 노드당 링크 1.33개 (Redis와 동일한 p)
+int InMemoryLeaderboardStore::RandomLevel() {
+    int level = 1;
+    while (level < kMaxLevel && (random_() & 0x3) == 0) {
+        ++level;
+    }
+    return level;
+}
+
+// [Order 2] Insert - 위에서부터 내려오며 레벨별 직전 노드(update)와 그 순위(rank) 기록
+// [LEARN] span 갱신: 새 노드가 끼어들면 직전 노드의 span은 둘로 나뉜다.
+//         update[i]→new = (rank[0] - rank[i]) + 1, new→기존 다음 = 원래 span - 그 값 + 1
+InMemoryLeaderboardStore::Node* InMemoryLeaderboardStore::Insert(int score,
+                                                                 const std::string& player_id) {
+    Node* update[kMaxLevel];
+    std::size_t rank[kMaxLevel];
+    Node* x = header_;
+    for (int i = level_count_ - 1; i >= 0; --i) {
+        rank[i] = i == level_count_ - 1 ? 0 : rank[i + 1];
+        while (x->levels()[i].forward && Before(score, player_id, x->levels()[i].forward)) {
+            rank[i] += x->levels()[i].span;
+            x = x->levels()[i].forward;
+        }
+        update[i] = x;
+    }
+
+    const int level = RandomLevel();
+    if (level > level_count_) {
+        for (int i = level_count_; i < level; ++i) {
+            rank[i] = 0;
+            update[i] = header_;
+            update[i]->levels()[i].span = length_;
+        }
+        level_count_ = level;
+    }
+
+    Node* node = CreateNode(level, score, player_id);
+    for (int i = 0; i < level; ++i) {
+        Level& prev = update[i]->levels()[i];
+        node->levels()[i].forward = prev.forward;
+        prev.forward = node;
+        node->levels()[i].span = prev.span - (rank[0] - rank[i]);
+        prev.span = (rank[0] - rank[i]) + 1;
+    }
+    // 새 노드보다 높은 레벨의 링크는 노드 하나를 더 건너뜀
+    for (int i = level; i < level_count_; ++i) {
+        ++update[i]->levels()[i].span;
+    }
+    ++length_;
+    return node;
+}
+
+// [Order 3] Unlink - target 직전 노드들을 찾아 링크/스팬 정리 (노드 해제는 호출자)
+void InMemoryLeaderboardStore::Unlink(const Node* target) {
+    Node* update[kMaxLevel];
+    Node* x = header_;
+    for (int i = level_count_ - 1; i >= 0; --i) {
+        while (x->levels()[i].forward &&
+               Before(target->score, target->player_id, x->levels()[i].forward)) {
+            x = x->levels()[i].forward;
+        }
+        update[i] = x;
     }
-    ordered_it->second.erase(player_id);
-    // 해당 점수에 플레이어가 없으면 점수 엔트리도 삭제
-    if (ordered_it->second.empty()) {
-        ordered_.erase(ordered_it);
+    for (int i = 0; i < level_count_; ++i) {
+        Level& prev = update[i]->levels()[i];
+        if (prev.forward == target) {
+            prev.span += target->levels()[i].span - 1;
+            prev.forward = target->levels()[i].forward;
+        } else {
+            --prev.span;
+        }
     }
+    while (level_count_ > 1 && header_->levels()[level_count_ - 1].forward == nullptr) {
+        --level_count_;
+    }
+    --length_;
 }
 
-// [Order 2] Upsert - 점수 삽입/갱신
+// [Order 4] Upsert - 점수 삽입/갱신
 // [LEARN] upsert = update + insert. 있으면 갱신, 없으면 삽입.
-//         두 자료구조 동기화 필요 (scores_, ordered_)
+//         두 자료구조 동기화 필요 (index_, 스킵 리스트)
 void InMemoryLeaderboardStore::Upsert(const std::string& player_id, int score) {
-    const auto existing = scores_.find(player_id);
-    if (existing != scores_.end()) {
-        if (existing->second == score) {
+    const auto existing = index_.find(player_id);
+    if (existing != index_.end()) {
+        if (existing->second->score == score) {
             return;  // 점수 변화 없음
         }
-        // 기존 점수에서 제거
-        RemoveFromOrdered(player_id, existing->second);
+        Node* old = existing->second;
+        index_.erase(existing);
+        Unlink(old);
+        DestroyNode(old);
+    }
+    Node* node = Insert(score, player_id);
+    index_.emplace(std::string_view{node->player_id}, node);
+}
+
+// [Order 4-1] UpsertBatch - 대량 갱신 (시즌 초기화, 감쇠)
+// [LEARN] 100만 명을 하나씩 Unlink/Insert하면 매번 O(log N) 탐색 + 노드 재할당.
+//         배치가 크면 노드 점수만 바꾸고 전체를 정렬한 뒤 레벨 0부터 순서대로 다시 잇는 편이 빠르다.
+//         노드(와 player_id 문자열)는 그대로 재사용 → index_도 그대로 유효.
+void InMemoryLeaderboardStore::UpsertBatch(
+    const std::vector<std::pair<std::string, int>>& entries) {
+    if (entries.size() * 8 < length_) {
+        LeaderboardStore::UpsertBatch(entries);
+        return;
+    }
+    std::vector<Node*> nodes;
+    nodes.reserve(length_ + entries.size());
+    for (Node* x = header_->levels()[0].forward; x; x = x->levels()[0].forward) {
+        nodes.push_back(x);
+    }
+    for (const auto& entry : entries) {
+        const auto existing = index_.find(entry.first);
+        if (existing != index_.end()) {
+            existing->second->score = entry.second;
+            continue;
+        }
+        Node* node = CreateNode(RandomLevel(), entry.second, entry.first);
+        index_.emplace(std::string_view{node->player_id}, node);
+        nodes.push_back(node);
+    }
+    // 점수를 옆에 복사해 두면 동점이 아닐 때는 노드를 읽지 않고 비교 (캐시 미스 감소)
+    std::vector<std::pair<int, Node*>> keyed;
+    keyed.reserve(nodes.size());
+    for (Node* node : nodes) {
+        keyed.emplace_back(node->score, node);
+    }
+    std::sort(keyed.begin(), keyed.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.first != rhs.first) {
+            return lhs.first > rhs.first;
+        }
+        return lhs.second->player_id < rhs.second->player_id;
+    });
+    for (std::size_t i = 0; i < keyed.size(); ++i) {
+        nodes[i] = keyed[i].second;
+    }
+    Rebuild(nodes);
+}
+
+// 레벨마다 마지막으로 연결한 노드와 그 순위를 들고 앞에서부터 이어 붙임
+void InMemoryLeaderboardStore::Rebuild(std::vector<Node*>& nodes) {
+    Node* last[kMaxLevel];
+    std::size_t last_rank[kMaxLevel];
+    for (int i = 0; i < kMaxLevel; ++i) {
+        last[i] = header_;
+        last_rank[i] = 0;
+        header_->levels()[i] = Level{nullptr, 0};
+    }
+    level_count_ = 1;
+    for (std::size_t index = 0; index < nodes.size(); ++index) {
+        Node* node = nodes[index];
+        const std::size_t rank = index + 1;
+        for (int i = 0; i < node->level_count; ++i) {
+            last[i]->levels()[i] = Level{node, rank - last_rank[i]};
+            last[i] = node;
+            last_rank[i] = rank;
+        }
+        level_count_ = std::max(level_count_, node->level_count);
+    }
+    // 끝 노드의 span = 뒤에 남은 노드 수 (Insert와 같은 규칙)
+    for (int i = 0; i < level_count_; ++i) {
+        last[i]->levels()[i] = Level{nullptr, nodes.size() - last_rank[i]};
     }
-    scores_[player_id] = score;
-    ordered_[score].insert(player_id);  // 새 점수에 추가
+    length_ = nodes.size();
 }
 
 void InMemoryLeaderboardStore::Erase(const std::string& player_id) {
-    const auto existing = scores_.find(player_id);
-    if (existing == scores_.end()) {
+    const auto existing = index_.find(player_id);
+    if (existing == index_.end()) {
         return;
     }
-    RemoveFromOrdered(player_id, existing->second);
-    scores_.erase(existing);
+    Node* node = existing->second;
+    index_.erase(existing);
+    Unlink(node);
+    DestroyNode(node);
 }
 
-// [Order 3] TopN - 상위 N명 조회
-// [LEARN] std::map은 키(점수) 기준 정렬됨.
-//         역순으로 순회하면 높은 점수부터 조회.
-//         C++17 structured binding: auto& [score, players]
-std::vector<std::pair<std::string, int>> InMemoryLeaderboardStore::TopN(std::size_t limit) const {
-    std::vector<std::pair<std::string, int>> result;
-    result.reserve(std::min(limit, scores_.size()));
-    std::size_t remaining = limit;
-    
-    // 역순 반복 (높은 점수부터)
-    for (const auto& [score, players] : ordered_) {
-        for (const auto& player : players) {
-            if (remaining == 0) {
-                return result;
-            }
-            result.emplace_back(player, score);
-            --remaining;
+// [Order 5] Rank - 내려가며 지나친 span 합 = 순위
+std::optional<std::size_t> InMemoryLeaderboardStore::Rank(const std::string& player_id) const {
+    const auto it = index_.find(player_id);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    const Node* target = it->second;
+    std::size_t rank = 0;
+    const Node* x = header_;
+    for (int i = level_count_ - 1; i >= 0; --i) {
+        while (x->levels()[i].forward &&
+               (x->levels()[i].forward == target ||
+                Before(target->score, target->player_id, x->levels()[i].forward))) {
+            rank += x->levels()[i].span;
+            x = x->levels()[i].forward;
+        }
+        if (x == target) {
+            return rank - 1;
+        }
+    }
+    return std::nullopt;
+}
+
+const InMemoryLeaderboardStore::Node* InMemoryLeaderboardStore::NodeAtRank(
+    std::size_t rank) const {
+    std::size_t traversed = 0;
+    const Node* x = header_;
+    for (int i = level_count_ - 1; i >= 0; --i) {
+        while (x->levels()[i].forward && traversed + x->levels()[i].span <= rank) {
+            traversed += x->levels()[i].span;
+            x = x->levels()[i].forward;
         }
-        if (remaining == 0) {
-            break;
+        if (traversed == rank) {
+            return x;
         }
     }
+    return nullptr;
+}
+
+// [Order 6] Range - offset번째 노드까지 O(log N)으로 내려간 뒤 레벨 0을 따라 count개
+std::vector<std::pair<std::string, int>> InMemoryLeaderboardStore::Range(std::size_t offset,
+                                                                         std::size_t count) const {
+    std::vector<std::pair<std::string, int>> result;
+    if (offset >= length_ || count == 0) {
+        return result;
+    }
+    result.reserve(std::min(count, length_ - offset));
+    for (const Node* x = NodeAtRank(offset + 1); x && result.size() < count;
+         x = x->levels()[0].forward) {
+        result.emplace_back(x->player_id, x->score);
+    }
     return result;
 }
 
+// [Order 7] TopN - 상위 N명 조회 (스킵 리스트가 이미 점수 내림차순)
+std::vector<std::pair<std::string, int>> InMemoryLeaderboardStore::TopN(std::size_t limit) const {
+    return Range(0, limit);
+}
+
 std::optional<int> InMemoryLeaderboardStore::Get(const std::string& player_id) const {
-    const auto it = scores_.find(player_id);
-    if (it == scores_.end()) {
+    const auto it = index_.find(player_id);
+    if (it == index_.end()) {
         return std::nullopt;
     }
-    return it->second;
+    return it->second->score;
 }
 
-std::size_t InMemoryLeaderboardStore::Size() const { return scores_.size(); }
+std::size_t InMemoryLeaderboardStore::Size() const { return length_; }
 
 // ========================================================================
 // [Redis 구현] - 분산 환경용 (스텁)
@@ -107,6 +323,17 @@ void RedisLeaderboardStore::Upsert(const std::string& player_id, int score) {
     std::cout << "redis zadd leaderboard " << score << ' ' << player_id << std::endl;
 }
 
+void RedisLeaderboardStore::UpsertBatch(const std::vector<std::pair<std::string, int>>& entries) {
+    // MULTI / ZADD leaderboard s1 p1 s2 p2 ... / EXEC → 다른 클라이언트는 중간 상태를 못 봄
+    std::cout << "redis multi" << std::endl;
+    std::cout << "redis zadd leaderboard";
+    for (const auto& entry : entries) {
+        std::cout << ' ' << entry.second << ' ' << entry.first;
+    }
+    std::cout << std::endl;
+    std::cout << "redis exec" << std::endl;
+}
+
 void RedisLeaderboardStore::Erase(const std::string& player_id) {
     // ZREM leaderboard player_id
     std::cout << "redis zrem leaderboard " << player_id << std::endl;
@@ -119,6 +346,20 @@ std::vector<std::pair<std::string, int>> RedisLeaderboardStore::TopN(std::size_t
     return {};  // 스텁: 실제 구현 시 파싱 필요
 }
 
+std::optional<std::size_t> RedisLeaderboardStore::Rank(const std::string& player_id) const {
+    // ZREVRANK leaderboard player_id
+    std::cout << "redis zrevrank leaderboard " << player_id << std::endl;
+    return std::nullopt;  // 스텁
+}
+
+std::vector<std::pair<std::string, int>> RedisLeaderboardStore::Range(std::size_t offset,
+                                                                      std::size_t count) const {
+    // ZREVRANGE leaderboard offset (offset+count-1) WITHSCORES
+    std::cout << "redis zrevrange leaderboard " << offset << ' '
+              << (count ? offset + count - 1 : offset) << " withscores" << std::endl;
+    return {};  // 스텁
+}
+
 std::optional<int> RedisLeaderboardStore::Get(const std::string& player_id) const {
     // ZSCORE leaderboard player_id
     std::cout << "redis zscore leaderboard " << player_id << std::endl;
@@ -130,9 +371,9 @@ std::size_t RedisLeaderboardStore::Size() const { return 0; }
 // ========================================================================
 // [Reader Notes] 리더보드 구현
 // ========================================================================
-// 1. InMemory 자료구조
-//    - scores_: player_id → score (O(1) 조회)
-//    - ordered_: score → set<player_id> (정렬된 순회)
+// 1. InMemory 자료구조 (순위 통계 스킵 리스트)
+//    - index_: player_id → 노드 (O(1) 조회)
+//    - 스킵 리스트: 점수 내림차순 연결 + 레벨별 span (순위 계산)
 //    - 두 자료구조 동기화 필수!
 //
 // 2. Redis Sorted Set
@@ -63,9 +63,26 @@ MatchResult::MatchResult(std::string match_id, std::string winner_id, std::strin
     : match_id_(std::move(match_id)),
       winner_id_(std::move(winner_id)),
       loser_id_(std::move(loser_id)),
+      placements_{{winner_id_}, {loser_id_}},
       completed_at_(completed_at),
       player_stats_(std::move(player_stats)) {}
 
+// 팀전/개인전 결과 - winner_id/loser_id는 1위 팀/최하위 팀의 첫 번째 플레이어
+MatchResult::MatchResult(std::string match_id, std::vector<std::vector<std::string>> placements,
+                         std::chrono::system_clock::time_point completed_at,
+                         std::vector<PlayerMatchStats> player_stats)
+    : match_id_(std::move(match_id)),
+      placements_(std::move(placements)),
+      completed_at_(completed_at),
+      player_stats_(std::move(player_stats)) {
+    if (!placements_.empty() && !placements_.front().empty()) {
+        winner_id_ = placements_.front().front();
+    }
+    if (placements_.size() > 1 && !placements_.back().empty()) {
+        loser_id_ = placements_.back().front();
+    }
+}
+
 // [Order 3] Collect - 매치 종료 시 통계 수집
 // [LEARN] 게임 세션 + 전투 로그에서 플레이어별 통계 집계
 MatchResult MatchStatsCollector::Collect(const CombatEvent& death_event, const GameSession& session,
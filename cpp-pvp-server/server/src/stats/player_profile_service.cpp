@@ -8,29 +8,49 @@
 //         - 기대 승률 = 1 / (1 + 10^((상대점수-내점수)/400))
 //         - 새 점수 = 기존 점수 + K * (실제결과 - 기대승률)
 //         - K=25: 변동폭 상수 (높을수록 변동 큼)
+//
+// [LEARN] 동시성 구조 (예전: 전체 프로필 map 하나 + mutex 하나):
+//         - 스트라이프 32개: 서로 다른 플레이어의 매치는 대부분 서로 다른 잠금을 잡음
+//         - 여러 스트라이프는 항상 번호 오름차순으로 잠금 (교착 방지)
+//         - 읽기는 seqlock: HTTP 폴링이 매치 기록을 막지 않음
 
 #include "pvpserver/stats/player_profile_service.h"
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <sstream>
+#include <thread>
+
+#include "pvpserver/stats/rating_batch_job.h"
 
 namespace pvpserver {
 
-// [Order 1] EloRatingCalculator::Update - ELO 점수 계산
+// [Order 1] ExpectedScoreTable - 기대 승률 표 (프로세스당 한 번 계산)
+// [LEARN] pow(10, x)는 수십 ns. 정수 차이 4001개뿐이므로 표(32KB)로 바꾸면 L1/L2 조회 한 번.
+ExpectedScoreTable::ExpectedScoreTable() {
+    for (int difference = -kMaxDifference; difference <= kMaxDifference; ++difference) {
+        table_[static_cast<std::size_t>(difference + kMaxDifference)] =
+            1.0 / (1.0 + std::pow(10.0, difference / 400.0));
+    }
+}
+
+const ExpectedScoreTable& ExpectedScoreTable::Instance() {
+    static const ExpectedScoreTable table;  // C++11부터 스레드 안전 초기화
+    return table;
+}
+
+// [Order 1-1] EloRatingCalculator::Update - ELO 점수 계산
 // [LEARN] 표준 ELO 공식:
 //         - 기대 승률: E = 1 / (1 + 10^((상대-나)/400))
 //         - 점수 변화: ΔR = K * (S - E)  (S=1:승, S=0:패)
 EloRatingUpdate EloRatingCalculator::Update(int winner_rating, int loser_rating) const {
-    // 기대 승률 계산
-    const double expected_winner =
-        1.0 / (1.0 + std::pow(10.0, (loser_rating - winner_rating) / 400.0));
-    const double expected_loser =
-        1.0 / (1.0 + std::pow(10.0, (winner_rating - loser_rating) / 400.0));
-    
-    constexpr double kFactor = 25.0;  // K 상수: 변동폭 결정
-    
+    // 기대 승률 (표 조회)
+    const auto& table = ExpectedScoreTable::Instance();
+    const double expected_winner = table.Expected(winner_rating, loser_rating);
+    const double expected_loser = table.Expected(loser_rating, winner_rating);
+
     // 새 레이팅 계산 (승자: S=1.0, 패자: S=0.0)
     const int winner_new =
         static_cast<int>(std::lround(winner_rating + kFactor * (1.0 - expected_winner)));
@@ -39,6 +59,36 @@ EloRatingUpdate EloRatingCalculator::Update(int winner_rating, int loser_rating)
     return {winner_new, loser_new};
 }
 
+// [Order 1-2] EloRatingCalculator::TeamDeltas - 팀전/개인전 ELO
+// [LEARN] 순위가 높은 팀은 아래 순위 모든 팀에게 "이긴" 것으로 본다.
+//         8인 개인전이면 1위는 7번 이기고, 8위는 7번 진다.
+//         K를 (팀 수 - 1)로 나누어 한 경기의 총 변동폭을 1:1과 비슷하게 유지.
+std::vector<int> EloRatingCalculator::TeamDeltas(const std::vector<int>& ratings_by_placement) const {
+    const auto& table = ExpectedScoreTable::Instance();
+    const std::size_t teams = ratings_by_placement.size();
+    std::vector<int> deltas(teams, 0);
+    if (teams < 2) {
+        return deltas;
+    }
+    for (std::size_t i = 0; i < teams; ++i) {
+        double score = 0.0;  // Σ(실제 - 기대)
+        for (std::size_t j = 0; j < teams; ++j) {
+            if (i == j) {
+                continue;
+            }
+            const double expected =
+                table.Expected(ratings_by_placement[i], ratings_by_placement[j]);
+            const double actual = i < j ? 1.0 : 0.0;
+            score += actual - expected;
+        }
+        // 합산 후 한 번만 나눔 (쌍마다 K/(n-1)을 곱하면 .5 경계에서 오차가 생김)
+        const double delta = kFactor * score / static_cast<double>(teams - 1);
+        // Update()의 lround(rating + delta)와 같은 반올림 (음수 .5도 올림)
+        deltas[i] = static_cast<int>(std::floor(delta + 0.5));
+    }
+    return deltas;
+}
+
 // PlayerProfile::Accuracy - 누적 정확도
 double PlayerProfile::Accuracy() const noexcept {
     if (shots_fired == 0) {
@@ -52,17 +102,154 @@ double PlayerProfile::Accuracy() const noexcept {
 PlayerProfileService::PlayerProfileService(std::shared_ptr<LeaderboardStore> leaderboard_store)
     : leaderboard_(std::move(leaderboard_store)) {}
 
+void PlayerProfileService::SetPersistenceSink(PersistenceSink sink) {
+    persistence_sink_ = std::move(sink);
+}
+
+// [Order 2-2] ProfileSlot - seqlock
+// [LEARN] 쓰는 쪽: 순번을 홀수로 → 값 기록 → 짝수로.
+//         읽는 쪽: 순번(짝수) → 값 복사 → 순번 재확인. 바뀌었으면 쓰는 도중이었으므로 재시도.
+//         읽기가 쓰기를 막지 않고, 쓰기도 읽기를 기다리지 않는다 (프로필 조회 폴링에 적합).
+//         값은 relaxed 원자 변수로 두어 찢어진 읽기가 "정의되지 않은 동작"이 아닌 재시도 대상이 됨.
+PlayerProfileService::AggregateStats PlayerProfileService::ProfileSlot::Read() const noexcept {
+    AggregateStats stats;
+    for (unsigned attempt = 1;; ++attempt) {
+        if (attempt % 64 == 0) {
+            std::this_thread::yield();  // 쓰는 스레드가 선점된 경우 (코어가 적을 때) 양보
+        }
+        const auto before = sequence_.load(std::memory_order_acquire);
+        if (before & 1U) {
+            continue;  // 쓰는 중
+        }
+        stats.matches = words_[0].load(std::memory_order_relaxed);
+        stats.wins = words_[1].load(std::memory_order_relaxed);
+        stats.losses = words_[2].load(std::memory_order_relaxed);
+        stats.kills = words_[3].load(std::memory_order_relaxed);
+        stats.deaths = words_[4].load(std::memory_order_relaxed);
+        stats.shots_fired = words_[5].load(std::memory_order_relaxed);
+        stats.hits_landed = words_[6].load(std::memory_order_relaxed);
+        stats.damage_dealt = words_[7].load(std::memory_order_relaxed);
+        stats.damage_taken = words_[8].load(std::memory_order_relaxed);
+        stats.rating = static_cast<int>(
+            static_cast<std::int64_t>(words_[9].load(std::memory_order_relaxed)));
+        stats.last_match_ms = static_cast<std::int64_t>(words_[10].load(std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == before) {
+            return stats;
+        }
+    }
+}
+
+void PlayerProfileService::ProfileSlot::Write(const AggregateStats& stats) noexcept {
+    const auto sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    words_[0].store(stats.matches, std::memory_order_relaxed);
+    words_[1].store(stats.wins, std::memory_order_relaxed);
+    words_[2].store(stats.losses, std::memory_order_relaxed);
+    words_[3].store(stats.kills, std::memory_order_relaxed);
+    words_[4].store(stats.deaths, std::memory_order_relaxed);
+    words_[5].store(stats.shots_fired, std::memory_order_relaxed);
+    words_[6].store(stats.hits_landed, std::memory_order_relaxed);
+    words_[7].store(stats.damage_dealt, std::memory_order_relaxed);
+    words_[8].store(stats.damage_taken, std::memory_order_relaxed);
+    words_[9].store(static_cast<std::uint64_t>(static_cast<std::int64_t>(stats.rating)),
+                    std::memory_order_relaxed);
+    words_[10].store(static_cast<std::uint64_t>(stats.last_match_ms), std::memory_order_relaxed);
+    sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+std::size_t PlayerProfileService::StripeIndex(const std::string& player_id) noexcept {
+    return std::hash<std::string>{}(player_id) & (kStripes - 1);
+}
+
+// [Order 2-3] LockStripes - 참가자 스트라이프를 번호 오름차순으로 잠금
+// [LEARN] 두 매치가 (A, B)와 (B, A)를 동시에 기록해도 둘 다 작은 번호부터 잡으므로
+//         서로 상대 잠금을 기다리는 교착이 생기지 않는다.
+std::vector<std::unique_lock<std::mutex>> PlayerProfileService::LockStripes(
+    const std::vector<const std::string*>& player_ids) {
+    std::vector<std::size_t> indices;
+    indices.reserve(player_ids.size());
+    for (const auto* player_id : player_ids) {
+        indices.push_back(StripeIndex(*player_id));
+    }
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(indices.size());
+    for (const auto index : indices) {
+        locks.emplace_back(stripes_[index].write_mutex);
+    }
+    return locks;
+}
+
+std::vector<std::unique_lock<std::mutex>> PlayerProfileService::LockAllStripes() {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(kStripes);
+    for (auto& stripe : stripes_) {
+        locks.emplace_back(stripe.write_mutex);
+    }
+    return locks;
+}
+
+PlayerProfileService::ProfileSlot* PlayerProfileService::FindSlot(
+    const std::string& player_id) const {
+    const auto& stripe = stripes_[StripeIndex(player_id)];
+    std::shared_lock<std::shared_mutex> lk(stripe.index_mutex);
+    const auto it = stripe.slots.find(player_id);
+    return it == stripe.slots.end() ? nullptr : it->second.get();
+}
+
+// 첫 매치 플레이어 추가 (write_mutex를 잡고 있으므로 사이에 같은 플레이어가 추가될 수 없음)
+PlayerProfileService::ProfileSlot& PlayerProfileService::CreateSlot(const std::string& player_id) {
+    auto& stripe = stripes_[StripeIndex(player_id)];
+    std::unique_lock<std::shared_mutex> lk(stripe.index_mutex);
+    auto& slot = stripe.slots[player_id];
+    slot = std::make_unique<ProfileSlot>();
+    profiles_total_.fetch_add(1, std::memory_order_relaxed);
+    return *slot;
+}
+
+// 이번 매치 작업본: 처음 만질 때 현재 값을 복사 (스트라이프 잠금 안에서만 호출)
+PlayerProfileService::AggregateStats& PlayerProfileService::Working(
+    WorkingSet& working, const std::string& player_id) const {
+    for (auto& entry : working) {
+        if (*entry.player_id == player_id) {
+            return entry.stats;
+        }
+    }
+    // 참가자 수만큼 reserve 되어 있으므로 재할당 없음 (앞서 받은 참조 유지)
+    auto* slot = FindSlot(player_id);
+    working.push_back(WorkingEntry{&player_id, slot, slot ? slot->Read() : AggregateStats{}});
+    return working.back().stats;
+}
+
 // [Order 3] RecordMatch - 매치 결과 기록
 // [LEARN] 매치 종료 시 호출:
-//         1. 플레이어별 통계 누적
-//         2. ELO 레이팅 업데이트
-//         3. 리더보드 갱신
+//         1. 참가자 스트라이프 잠금 (고정 순서)
+//         2. 작업본에서 통계 누적 + ELO 레이팅 계산
+//         3. 작업본을 seqlock으로 반영, 리더보드 갱신
+//         4. 영구 저장 대기열로 전달 (설정된 경우)
 void PlayerProfileService::RecordMatch(const MatchResult& result) {
-    std::lock_guard<std::mutex> lk(mutex_);  // 멀티스레드 보호
+    std::vector<const std::string*> participants;
+    for (const auto& stats : result.player_stats()) {
+        participants.push_back(&stats.player_id());
+    }
+    for (const auto& team : result.placements()) {
+        for (const auto& player_id : team) {
+            participants.push_back(&player_id);
+        }
+    }
+    const auto locks = LockStripes(participants);
+
+    WorkingSet working;
+    working.reserve(participants.size());
+    std::vector<const std::string*> rated;  // 레이팅이 바뀐 플레이어 (리더보드 갱신 대상)
 
     // 모든 플레이어 통계 누적
     for (const auto& stats : result.player_stats()) {
-        auto& aggregate = aggregates_[stats.player_id()];
+        auto& aggregate = Working(working, stats.player_id());
         aggregate.matches += 1;
         aggregate.shots_fired += stats.shots_fired();
         aggregate.hits_landed += stats.hits_landed();
@@ -72,46 +259,115 @@ void PlayerProfileService::RecordMatch(const MatchResult& result) {
         aggregate.deaths += stats.deaths();
     }
 
-    // 승/패 기록
-    auto& winner = aggregates_[result.winner_id()];
-    auto& loser = aggregates_[result.loser_id()];
-    winner.wins += 1;
-    loser.losses += 1;
+    const auto& placements = result.placements();
+    const bool duel = placements.size() == 2 && placements[0].size() == 1 && placements[1].size() == 1;
+    if (!duel) {
+        RecordTeamResultUnsafe(result, working, rated);
+    } else {
+        // 승/패 기록
+        auto& winner = Working(working, result.winner_id());
+        auto& loser = Working(working, result.loser_id());
+        winner.wins += 1;
+        loser.losses += 1;
 
-    // ELO 레이팅 업데이트
-    const auto update = calculator_.Update(winner.rating, loser.rating);
-    winner.rating = update.winner_new;
-    loser.rating = update.loser_new;
-    rating_updates_total_ += 2;
+        // ELO 레이팅 업데이트
+        const auto update = calculator_.Update(winner.rating, loser.rating);
+        winner.rating = update.winner_new;
+        loser.rating = update.loser_new;
+        rating_updates_total_.fetch_add(2, std::memory_order_relaxed);
+        rated.push_back(&result.winner_id());
+        rated.push_back(&result.loser_id());
+    }
 
-    // 리더보드 갱신 (있으면)
-    if (leaderboard_) {
-        leaderboard_->Upsert(result.winner_id(), winner.rating);
-        leaderboard_->Upsert(result.loser_id(), loser.rating);
+    // 작업본 반영 (각 프로필은 seqlock 한 번으로 통째로 바뀜)
+    const auto completed_at_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     result.completed_at().time_since_epoch())
+                                     .count();
+    for (auto& entry : working) {
+        entry.stats.last_match_ms = std::max(entry.stats.last_match_ms, completed_at_ms);
+        auto& slot = entry.slot ? *entry.slot : CreateSlot(*entry.player_id);
+        slot.Write(entry.stats);
+    }
+
+    // 리더보드 갱신 (있으면). 스트라이프 → 리더보드 순서로만 잠금
+    if (leaderboard_ && !rated.empty()) {
+        std::lock_guard<std::mutex> lk(leaderboard_mutex_);
+        for (const auto* player_id : rated) {
+            leaderboard_->Upsert(*player_id, Working(working, *player_id).rating);
+        }
     }
 
-    ++matches_recorded_total_;
+    // 영구 저장 대기열로 전달 (잠금 안: 같은 플레이어의 스냅샷이 기록 순서대로 들어감)
+    if (persistence_sink_) {
+        std::vector<PlayerProfile> snapshot;
+        snapshot.reserve(working.size());
+        for (const auto& entry : working) {
+            snapshot.push_back(BuildProfileUnsafe(*entry.player_id, entry.stats));
+        }
+        persistence_sink_(result, snapshot);
+    }
+
+    matches_recorded_total_.fetch_add(1, std::memory_order_relaxed);
+    // 응답 캐시 무효화: 반영이 끝난 뒤에 올려야 새 버전을 본 독자가 새 데이터를 읽음
+    version_.fetch_add(1, std::memory_order_release);
 }
 
-// GetProfile - 플레이어 프로필 조회
+// [Order 3-2] RecordTeamResultUnsafe - 팀전/개인전 승패 + ELO
+// - 팀 레이팅 = 팀원 현재 레이팅 평균, 팀 변화량을 팀원 모두에게 동일하게 적용
+// - 1위 팀은 승, 나머지는 패
+void PlayerProfileService::RecordTeamResultUnsafe(const MatchResult& result, WorkingSet& working,
+                                                  std::vector<const std::string*>& rated) {
+    const auto& placements = result.placements();
+    std::vector<int> team_ratings;
+    team_ratings.reserve(placements.size());
+    for (const auto& team : placements) {
+        long long sum = 0;
+        for (const auto& player_id : team) {
+            sum += Working(working, player_id).rating;
+        }
+        team_ratings.push_back(
+            team.empty() ? 0 : static_cast<int>(sum / static_cast<long long>(team.size())));
+    }
+
+    const auto deltas = calculator_.TeamDeltas(team_ratings);
+    for (std::size_t placement = 0; placement < placements.size(); ++placement) {
+        for (const auto& player_id : placements[placement]) {
+            auto& aggregate = Working(working, player_id);
+            if (placement == 0) {
+                aggregate.wins += 1;
+            } else {
+                aggregate.losses += 1;
+            }
+            aggregate.rating += deltas[placement];
+            rating_updates_total_.fetch_add(1, std::memory_order_relaxed);
+            rated.push_back(&player_id);
+        }
+    }
+}
+
+// GetProfile - 플레이어 프로필 조회 (쓰기 잠금 없이 seqlock 읽기)
 std::optional<PlayerProfile> PlayerProfileService::GetProfile(const std::string& player_id) const {
-    std::lock_guard<std::mutex> lk(mutex_);
-    const auto it = aggregates_.find(player_id);
-    if (it == aggregates_.end()) {
+    const auto* slot = FindSlot(player_id);
+    if (!slot) {
         return std::nullopt;  // 프로필 없음
     }
-    return BuildProfileUnsafe(player_id, it->second);
+    return BuildProfileUnsafe(player_id, slot->Read());
 }
 
 // TopProfiles - 상위 플레이어 목록
-std::vector<PlayerProfile> PlayerProfileService::TopProfiles(std::size_t limit) const {
-    std::lock_guard<std::mutex> lk(mutex_);
+// - 리더보드 잠금은 순위 조회 동안만. 프로필은 각자 seqlock으로 읽으므로
+//   같은 페이지 안에서 서로 다른 시점의 값이 섞일 수 있음 (경기 하나 차이)
+std::vector<PlayerProfile> PlayerProfileService::TopProfiles(std::size_t limit,
+                                                             std::size_t offset) const {
     std::vector<PlayerProfile> profiles;
     if (!leaderboard_) {
         // 리더보드 없으면 전체 스캔
-        profiles.reserve(std::min(limit, aggregates_.size()));
-        for (const auto& kv : aggregates_) {
-            profiles.push_back(BuildProfileUnsafe(kv.first, kv.second));
+        profiles.reserve(profiles_total_.load(std::memory_order_relaxed));
+        for (const auto& stripe : stripes_) {
+            std::shared_lock<std::shared_mutex> lk(stripe.index_mutex);
+            for (const auto& kv : stripe.slots) {
+                profiles.push_back(BuildProfileUnsafe(kv.first, kv.second->Read()));
+            }
         }
         std::sort(profiles.begin(), profiles.end(),
                   [](const PlayerProfile& lhs, const PlayerProfile& rhs) {
@@ -120,23 +376,129 @@ std::vector<PlayerProfile> PlayerProfileService::TopProfiles(std::size_t limit)
                       }
                       return lhs.player_id < rhs.player_id;
                   });
+        if (offset >= profiles.size()) {
+            return {};
+        }
+        profiles.erase(profiles.begin(),
+                       profiles.begin() + static_cast<std::ptrdiff_t>(offset));
         if (profiles.size() > limit) {
             profiles.resize(limit);
         }
         return profiles;
     }
 
-    const auto ordered = leaderboard_->TopN(limit);
+    std::vector<std::pair<std::string, int>> ordered;
+    {
+        std::lock_guard<std::mutex> lk(leaderboard_mutex_);
+        ordered = leaderboard_->Range(offset, limit);
+    }
     profiles.reserve(ordered.size());
     for (const auto& entry : ordered) {
-        const auto it = aggregates_.find(entry.first);
-        if (it != aggregates_.end()) {
-            profiles.push_back(BuildProfileUnsafe(entry.first, it->second));
+        if (const auto* slot = FindSlot(entry.first)) {
+            profiles.push_back(BuildProfileUnsafe(entry.first, slot->Read()));
         }
     }
     return profiles;
 }
 
+// [Order 4] ApplyRatingJob - 스냅샷 → 병렬 계산 → 한 번에 반영
+// [LEARN] 계산(수백 ms)은 잠금 밖에서, 스트라이프 잠금 구간은 슬롯 반영만.
+//         리더보드 재구성은 스트라이프를 푼 뒤 리더보드 잠금 안에서 (매치 기록은 이미 재개).
+//         계산 중 매치를 치른 플레이어는 matches가 달라졌으므로 최신 값으로 다시 계산해
+//         매치 결과를 덮어쓰지 않는다. 스냅샷 이후 처음 등장한 플레이어는 이번 작업 대상이 아님.
+RatingJobReport PlayerProfileService::ApplyRatingJob(
+    RatingBatchEngine& engine, const std::function<int(const RatingRecord&)>& transform) {
+    RatingJobReport report;
+    const auto compute_start = std::chrono::steady_clock::now();
+
+    std::vector<const std::string*> ids;
+    std::vector<ProfileSlot*> slots;
+    std::vector<RatingRecord> records;
+    const auto expected = profiles_total_.load(std::memory_order_relaxed);
+    ids.reserve(expected);
+    slots.reserve(expected);
+    records.reserve(expected);
+    for (const auto& stripe : stripes_) {
+        std::shared_lock<std::shared_mutex> lk(stripe.index_mutex);
+        for (const auto& kv : stripe.slots) {
+            const auto stats = kv.second->Read();
+            ids.push_back(&kv.first);  // 노드 기반 map + 삭제 없음 → 키 주소 고정
+            slots.push_back(kv.second.get());
+            records.push_back(RatingRecord{stats.rating, stats.matches, stats.last_match_ms});
+        }
+    }
+    auto ratings = engine.Transform(records, transform);
+    report.profiles = records.size();
+
+    const auto apply_start = std::chrono::steady_clock::now();
+    report.compute_seconds = std::chrono::duration<double>(apply_start - compute_start).count();
+    // changed: 0 = 그대로, 1 = 변경
+    std::vector<std::uint8_t> changed(records.size(), 0);
+    std::unique_lock<std::mutex> leaderboard_lock(leaderboard_mutex_, std::defer_lock);
+    {
+        const auto locks = LockAllStripes();  // 매치 기록 잠시 정지
+
+        // 슬롯 반영은 서로 다른 슬롯만 쓰므로 병렬
+        std::atomic<std::size_t> refreshed{0};
+        std::atomic<std::size_t> changed_total{0};
+        engine.ParallelFor(records.size(), [&](std::size_t begin, std::size_t end) {
+            std::size_t local_refreshed = 0;
+            std::size_t local_changed = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                auto stats = slots[i]->Read();
+                int rating = ratings[i];
+                if (stats.matches != records[i].matches) {
+                    rating = transform(RatingRecord{stats.rating, stats.matches,
+                                                    stats.last_match_ms});
+                    ratings[i] = rating;
+                    ++local_refreshed;
+                }
+                if (rating != stats.rating) {
+                    stats.rating = rating;
+                    slots[i]->Write(stats);
+                    changed[i] = 1;
+                    ++local_changed;
+                }
+            }
+            refreshed.fetch_add(local_refreshed, std::memory_order_relaxed);
+            changed_total.fetch_add(local_changed, std::memory_order_relaxed);
+        });
+        report.refreshed = refreshed.load(std::memory_order_relaxed);
+        report.changed = changed_total.load(std::memory_order_relaxed);
+
+        // 스트라이프를 풀기 전에 리더보드 잠금을 잡는다: 이후 매치의 리더보드 갱신은
+        // 이 배치 뒤에 적용되므로 옛 값으로 덮어쓰는 일이 없음 (잠금 순서도 스트라이프 → 리더보드)
+        if (leaderboard_ && report.changed > 0) {
+            leaderboard_lock.lock();
+        }
+    }
+    report.apply_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - apply_start).count();
+
+    if (leaderboard_lock.owns_lock()) {
+        const auto leaderboard_start = std::chrono::steady_clock::now();
+        std::vector<std::pair<std::string, int>> entries;
+        entries.reserve(report.changed);
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            if (changed[i]) {
+                entries.emplace_back(*ids[i], ratings[i]);
+            }
+        }
+        leaderboard_->UpsertBatch(entries);
+        leaderboard_lock.unlock();
+        report.leaderboard_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - leaderboard_start)
+                .count();
+    }
+    rating_updates_total_.fetch_add(report.changed, std::memory_order_relaxed);
+    version_.fetch_add(1, std::memory_order_release);
+
+    rating_jobs_total_.fetch_add(1, std::memory_order_relaxed);
+    rating_job_profiles_total_.fetch_add(report.profiles, std::memory_order_relaxed);
+    rating_job_last_apply_seconds_.store(report.apply_seconds, std::memory_order_relaxed);
+    return report;
+}
+
 std::string PlayerProfileService::SerializeProfile(const PlayerProfile& profile) const {
     std::ostringstream oss;
     oss << "{";
@@ -171,17 +533,31 @@ std::string PlayerProfileService::SerializeLeaderboard(
 }
 
 std::string PlayerProfileService::MetricsSnapshot() const {
-    std::lock_guard<std::mutex> lk(mutex_);
+    const auto profiles_total = profiles_total_.load(std::memory_order_relaxed);
+    std::size_t leaderboard_size = profiles_total;
+    if (leaderboard_) {
+        std::lock_guard<std::mutex> lk(leaderboard_mutex_);
+        leaderboard_size = leaderboard_->Size();
+    }
     std::ostringstream oss;
     oss << "# TYPE player_profiles_total gauge\n";
-    oss << "player_profiles_total " << aggregates_.size() << "\n";
-    const std::size_t leaderboard_size = leaderboard_ ? leaderboard_->Size() : aggregates_.size();
+    oss << "player_profiles_total " << profiles_total << "\n";
     oss << "# TYPE leaderboard_entries_total gauge\n";
     oss << "leaderboard_entries_total " << leaderboard_size << "\n";
     oss << "# TYPE matches_recorded_total counter\n";
-    oss << "matches_recorded_total " << matches_recorded_total_ << "\n";
+    oss << "matches_recorded_total " << matches_recorded_total_.load(std::memory_order_relaxed)
+        << "\n";
     oss << "# TYPE rating_updates_total counter\n";
-    oss << "rating_updates_total " << rating_updates_total_ << "\n";
+    oss << "rating_updates_total " << rating_updates_total_.load(std::memory_order_relaxed)
+        << "\n";
+    oss << "# TYPE rating_jobs_total counter\n";
+    oss << "rating_jobs_total " << rating_jobs_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE rating_job_profiles_total counter\n";
+    oss << "rating_job_profiles_total "
+        << rating_job_profiles_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE rating_job_last_apply_seconds gauge\n";
+    oss << "rating_job_last_apply_seconds "
+        << rating_job_last_apply_seconds_.load(std::memory_order_relaxed) << "\n";
     return oss.str();
 }
 
@@ -0,0 +1,204 @@
+// [FILE]
+// - 목적: 레이팅 일괄 작업 (시즌 초기화, 비활성 감쇠, 매치 기록 재계산)
+// - 주요 역할: 수백만 명 레이팅을 스레드 풀로 나눠 계산
+// - 관련 클론 가이드 단계: [v1.3.0] 통계 시스템
+// - 권장 읽는 순서: 정책(Apply) → ParallelFor → Transform → ReplayDuels
+//
+// [LEARN] 매치 하나씩 RecordMatch로 처리하던 방식은 일괄 작업에 맞지 않는다:
+//         - 프로필마다 잠금 + pow 두 번
+//         - 감쇠/초기화는 프로필끼리 독립 → 나눠서 동시에 계산하면 코어 수만큼 빨라짐
+//         - 매치 재계산은 순서 의존이지만, 서로 다른 플레이어의 매치는 동시에 처리해도 같은 결과
+
+#include "pvpserver/stats/rating_batch_job.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace pvpserver {
+
+// [Order 1] 정책 - 프로필 하나의 새 레이팅 (순수 함수)
+int RatingDecayPolicy::Apply(const RatingRecord& record, std::int64_t now_ms) const noexcept {
+    if (record.matches == 0 || record.rating <= floor) {
+        return record.rating;
+    }
+    const auto grace_ms = std::chrono::duration_cast<std::chrono::milliseconds>(grace).count();
+    if (now_ms - record.last_match_ms < grace_ms) {
+        return record.rating;
+    }
+    return std::max(floor, record.rating - points_per_run);
+}
+
+int SeasonResetPolicy::Apply(const RatingRecord& record) const noexcept {
+    return anchor +
+           static_cast<int>(std::lround((record.rating - anchor) * keep_fraction));
+}
+
+// [Order 2] 스레드 풀
+RatingBatchEngine::RatingBatchEngine(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i) {
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+RatingBatchEngine::~RatingBatchEngine() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void RatingBatchEngine::WorkerLoop() {
+    std::uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            work_cv_.wait(lk, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+        }
+        RunChunks();
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            ++workers_done_;
+        }
+        done_cv_.notify_one();
+    }
+}
+
+// 남은 청크를 하나씩 가져가며 처리 (빨리 끝난 스레드가 더 많이 가져감)
+void RatingBatchEngine::RunChunks() {
+    while (true) {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        const std::function<void(std::size_t, std::size_t)>* body = nullptr;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if (next_ >= count_) {
+                return;
+            }
+            begin = next_;
+            end = std::min(count_, begin + kChunk);
+            next_ = end;
+            body = body_;
+        }
+        (*body)(begin, end);
+    }
+}
+
+// [Order 3] ParallelFor - 호출 스레드도 청크를 처리하고, 워커가 모두 끝날 때까지 대기
+void RatingBatchEngine::ParallelFor(
+    std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& body) {
+    if (count == 0) {
+        return;
+    }
+    if (workers_.empty() || count <= kChunk) {
+        body(0, count);  // 작으면 깨우는 비용이 더 큼
+        return;
+    }
+    std::lock_guard<std::mutex> run(run_mutex_);
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        body_ = &body;
+        count_ = count;
+        next_ = 0;
+        workers_done_ = 0;
+        ++generation_;
+    }
+    work_cv_.notify_all();
+    RunChunks();
+    std::unique_lock<std::mutex> lk(mutex_);
+    done_cv_.wait(lk, [this] { return workers_done_ == workers_.size(); });
+    body_ = nullptr;
+    count_ = 0;
+}
+
+std::vector<int> RatingBatchEngine::Transform(const std::vector<RatingRecord>& records,
+                                              const RatingTransform& transform) {
+    std::vector<int> ratings(records.size());
+    ParallelFor(records.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            ratings[i] = transform(records[i]);
+        }
+    });
+    return ratings;
+}
+
+// [Order 4] ReplayDuels - 라운드 배정 → 라운드별 병렬 적용
+// [LEARN] round(매치) = max(승자의 직전 라운드, 패자의 직전 라운드) + 1
+//         매치가 읽는 두 레이팅은 앞선 라운드에서 확정된 값 → 순차 적용과 결과가 같다.
+//         라운드 내 매치는 플레이어가 겹치지 않으므로 잠금 없이 동시에 써도 안전.
+std::size_t RatingBatchEngine::ReplayDuels(std::vector<int>& ratings,
+                                           const std::vector<DuelOutcome>& duels) {
+    std::vector<std::uint32_t> last_round(ratings.size(), 0);
+    std::vector<std::uint32_t> round_of(duels.size());
+    std::uint32_t rounds = 0;
+    for (std::size_t i = 0; i < duels.size(); ++i) {
+        const auto& duel = duels[i];
+        const auto round = std::max(last_round[duel.winner], last_round[duel.loser]) + 1;
+        last_round[duel.winner] = round;
+        last_round[duel.loser] = round;
+        round_of[i] = round;
+        rounds = std::max(rounds, round);
+    }
+
+    // 라운드별로 모으기 (계수 정렬, 라운드 안 순서 유지)
+    std::vector<std::size_t> offsets(static_cast<std::size_t>(rounds) + 2, 0);
+    for (const auto round : round_of) {
+        ++offsets[round + 1];
+    }
+    for (std::size_t r = 1; r < offsets.size(); ++r) {
+        offsets[r] += offsets[r - 1];
+    }
+    std::vector<DuelOutcome> ordered(duels.size());
+    {
+        auto cursor = offsets;
+        for (std::size_t i = 0; i < duels.size(); ++i) {
+            ordered[cursor[round_of[i]]++] = duels[i];
+        }
+    }
+
+    for (std::uint32_t round = 1; round <= rounds; ++round) {
+        const auto first = offsets[round];
+        const auto count = offsets[round + 1] - first;
+        ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = first + begin; i < first + end; ++i) {
+                const auto& duel = ordered[i];
+                const auto update = calculator_.Update(ratings[duel.winner], ratings[duel.loser]);
+                ratings[duel.winner] = update.winner_new;
+                ratings[duel.loser] = update.loser_new;
+            }
+        });
+    }
+    return rounds;
+}
+
+// ========================================================================
+// [Reader Notes] 레이팅 일괄 작업
+// ========================================================================
+// 1. 기대 승률 표 (ExpectedScoreTable)
+//    - 레이팅 차이는 정수 → 4001칸 배열에 미리 계산, pow 호출 없음
+//    - RecordMatch의 EloRatingCalculator도 같은 표를 쓰므로 결과가 일치
+//
+// 2. 스레드 풀
+//    - 워커는 생성 시 한 번만 만들고 작업마다 깨움 (스레드 생성 비용 없음)
+//    - 청크(4096개) 단위로 가져가므로 느린 스레드가 있어도 전체가 기다리지 않음
+//
+// 3. 재계산 병렬화
+//    - 라운드 수 = 가장 매치를 많이 한 플레이어의 매치 수 정도
+//    - 플레이어가 많고 고르게 분포할수록 라운드당 매치가 많아 병렬 효과가 큼
+//
+// 4. 적용은 PlayerProfileService::ApplyRatingJob
+//    - 계산은 잠금 밖, 반영은 스트라이프 전체 + 리더보드 잠금 안에서 한 번에
+// ========================================================================
+
+}  // namespace pvpserver
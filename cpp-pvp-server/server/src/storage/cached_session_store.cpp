@@ -0,0 +1,351 @@
+// [FILE]
+// - 목적: 세션 저장소 near-cache (프로세스 내 캐시 계층)
+// - 주요 역할: 반복되는 세션/플레이어 조회를 백엔드(Redis) 왕복 없이 처리
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템 - 세션 스토어
+// - 권장 읽는 순서: GetSession → Insert/Lookup → SaveSession → OnRemoteMessage
+//
+// [LEARN] 매 패킷/매 요청마다 세션을 Redis에서 읽으면 조회 하나 = 네트워크 왕복 하나.
+//         같은 세션을 짧은 시간에 여러 번 읽는 경우가 대부분이므로 가까운 곳에 잠시 보관한다.
+//         캐시의 어려운 부분은 "언제 버리느냐":
+//         - 내가 바꾼 것: Save/Delete 직후 바로 무효화
+//         - 다른 노드가 바꾼 것: pub/sub 무효화 (유실 가능) + TTL (최종 안전망)
+//
+// 데코레이터: SessionStore를 감싸므로 InMemory/Redis 어느 쪽 앞에도 둘 수 있음
+
+#include "pvpserver/storage/cached_session_store.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+namespace pvpserver {
+namespace storage {
+
+namespace {
+
+constexpr char kFieldSeparator = '\n';  // ID에는 개행이 없음
+
+double Ratio(std::uint64_t hits, std::uint64_t misses) {
+    const auto total = hits + misses;
+    return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+}
+
+}  // namespace
+
+double NearCacheStats::SessionHitRatio() const noexcept {
+    return Ratio(session_hits, session_misses);
+}
+
+double NearCacheStats::PlayerHitRatio() const noexcept {
+    return Ratio(player_hits, player_misses);
+}
+
+// [Order 1] 생성자 - 샤드 준비, 버스가 있으면 구독
+CachedSessionStore::CachedSessionStore(std::shared_ptr<SessionStore> backend,
+                                       NearCacheOptions options,
+                                       std::shared_ptr<SessionInvalidationBus> bus)
+    : backend_(std::move(backend))
+    , options_(options)
+    , bus_(std::move(bus))
+    , node_tag_(GenerateSessionId())
+    , bus_link_(std::make_shared<BusLink>()) {
+    options_.shards = std::max<std::size_t>(1, options_.shards);
+    shard_capacity_ = std::max<std::size_t>(1, options_.capacity / options_.shards);
+    for (std::size_t i = 0; i < options_.shards; ++i) {
+        sessions_.push_back(std::make_unique<Shard<SessionData>>());
+        players_.push_back(std::make_unique<Shard<std::string>>());
+    }
+    bus_link_->owner = this;
+    if (bus_) {
+        bus_->Subscribe([link = bus_link_](const std::string& message) {
+            std::lock_guard<std::mutex> lk(link->mutex);
+            if (link->owner) {
+                link->owner->OnRemoteMessage(message);
+            }
+        });
+    }
+}
+
+// 진행 중인 핸들러가 끝날 때까지 기다린 뒤 끊음
+CachedSessionStore::~CachedSessionStore() {
+    std::lock_guard<std::mutex> lk(bus_link_->mutex);
+    bus_link_->owner = nullptr;
+}
+
+// [Order 2] 샤드 연산 - 샤드 잠금 하나 안에서 O(1)
+template <typename V>
+CachedSessionStore::Shard<V>& CachedSessionStore::ShardFor(ShardSet<V>& shards,
+                                                           const std::string& key) {
+    return *shards[std::hash<std::string>{}(key) % shards.size()];
+}
+
+// 적중이면 LRU 맨 앞으로, 만료됐으면 지우고 nullopt
+template <typename V>
+std::optional<V> CachedSessionStore::Lookup(ShardSet<V>& shards, const std::string& key) {
+    auto& shard = ShardFor(shards, key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    const auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        return std::nullopt;
+    }
+    if (it->second->expires <= Clock::now()) {
+        shard.lru.erase(it->second);
+        shard.index.erase(it);
+        expirations_.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    return it->second->value;
+}
+
+template <typename V>
+std::uint64_t CachedSessionStore::Epoch(ShardSet<V>& shards, const std::string& key) {
+    auto& shard = ShardFor(shards, key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    return shard.epoch;
+}
+
+// [LEARN] 조회-무효화 경합:
+//         A가 백엔드에서 옛 값을 읽는 사이 B가 Save + 무효화를 끝내면,
+//         A가 나중에 넣는 옛 값이 TTL 동안 남는다.
+//         조회 전에 읽은 epoch가 그대로일 때만 넣으면 이 경우를 버린다 (다음 조회가 다시 읽음).
+template <typename V>
+void CachedSessionStore::Insert(ShardSet<V>& shards, const std::string& key, V value,
+                                std::uint64_t epoch) {
+    auto& shard = ShardFor(shards, key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    if (shard.epoch != epoch) {
+        return;
+    }
+    const auto expires = Clock::now() + options_.ttl;
+    const auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        it->second->value = std::move(value);
+        it->second->expires = expires;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+    shard.lru.push_front({key, std::move(value), expires});
+    shard.index.emplace(key, shard.lru.begin());
+    if (shard.lru.size() > shard_capacity_) {
+        shard.index.erase(shard.lru.back().key);
+        shard.lru.pop_back();
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename V>
+std::optional<V> CachedSessionStore::Erase(ShardSet<V>& shards, const std::string& key) {
+    auto& shard = ShardFor(shards, key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    ++shard.epoch;
+    const auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        return std::nullopt;
+    }
+    auto value = std::move(it->second->value);
+    shard.lru.erase(it->second);
+    shard.index.erase(it);
+    return value;
+}
+
+// [Order 3] 조회 - 적중이면 백엔드를 건드리지 않음
+std::optional<SessionData> CachedSessionStore::GetSession(const std::string& session_id) {
+    if (auto cached = Lookup(sessions_, session_id)) {
+        session_hits_.fetch_add(1, std::memory_order_relaxed);
+        return cached;
+    }
+    session_misses_.fetch_add(1, std::memory_order_relaxed);
+    const auto epoch = Epoch(sessions_, session_id);
+    auto data = backend_->GetSession(session_id);
+    if (data) {
+        Insert(sessions_, session_id, *data, epoch);
+    }
+    return data;
+}
+
+std::optional<std::string> CachedSessionStore::GetSessionByPlayerId(
+    const std::string& player_id) {
+    if (auto cached = Lookup(players_, player_id)) {
+        player_hits_.fetch_add(1, std::memory_order_relaxed);
+        return cached;
+    }
+    player_misses_.fetch_add(1, std::memory_order_relaxed);
+    const auto epoch = Epoch(players_, player_id);
+    auto session_id = backend_->GetSessionByPlayerId(player_id);
+    if (session_id) {
+        Insert(players_, player_id, *session_id, epoch);
+    }
+    return session_id;
+}
+
+// 없는 세션은 캐시하지 않음 (곧 생길 세션이 TTL 동안 안 보이는 것을 막음)
+bool CachedSessionStore::SessionExists(const std::string& session_id) {
+    return GetSession(session_id).has_value();
+}
+
+// [Order 4] 쓰기 - 백엔드 먼저, 그다음 무효화 (반대 순서면 그 사이 조회가 옛 값을 다시 넣음)
+bool CachedSessionStore::SaveSession(const std::string& session_id, const SessionData& data) {
+    const bool ok = backend_->SaveSession(session_id, data);
+    // 세션의 플레이어가 바뀌었으면 이전 플레이어 매핑도 버림
+    const auto previous = Erase(sessions_, session_id);
+    if (previous && previous->player_id != data.player_id) {
+        InvalidateAndPublish("", previous->player_id);
+    }
+    InvalidateAndPublish(session_id, data.player_id);
+    return ok;
+}
+
+// player 매핑까지 지우려면 player_id가 필요 → 캐시에 없으면 삭제 전에 백엔드에서 한 번 읽음
+bool CachedSessionStore::DeleteSession(const std::string& session_id) {
+    auto cached = Erase(sessions_, session_id);
+    if (!cached) {
+        cached = backend_->GetSession(session_id);
+    }
+    const bool ok = backend_->DeleteSession(session_id);
+    InvalidateAndPublish(session_id, cached ? cached->player_id : "");
+    return ok;
+}
+
+bool CachedSessionStore::RefreshSession(const std::string& session_id) {
+    return backend_->RefreshSession(session_id);
+}
+
+std::vector<std::string> CachedSessionStore::GetAllSessionIds() {
+    return backend_->GetAllSessionIds();
+}
+
+size_t CachedSessionStore::GetActiveSessionCount() {
+    return backend_->GetActiveSessionCount();
+}
+
+// [Order 5] 무효화 - 로컬 제거 후 다른 노드에 "tag\nsession_id\nplayer_id" 발행
+void CachedSessionStore::InvalidateAndPublish(const std::string& session_id,
+                                              const std::string& player_id) {
+    if (!session_id.empty()) {
+        InvalidateSession(session_id);
+    }
+    if (!player_id.empty()) {
+        InvalidatePlayer(player_id);
+    }
+    local_invalidations_.fetch_add(1, std::memory_order_relaxed);
+    if (bus_) {
+        bus_->Publish(node_tag_ + kFieldSeparator + session_id + kFieldSeparator + player_id);
+    }
+}
+
+void CachedSessionStore::InvalidateSession(const std::string& session_id) {
+    Erase(sessions_, session_id);
+}
+
+void CachedSessionStore::InvalidatePlayer(const std::string& player_id) {
+    Erase(players_, player_id);
+}
+
+void CachedSessionStore::OnRemoteMessage(const std::string& message) {
+    const auto first = message.find(kFieldSeparator);
+    const auto second =
+        first == std::string::npos ? std::string::npos : message.find(kFieldSeparator, first + 1);
+    if (second == std::string::npos) {
+        return;  // 형식이 다른 메시지
+    }
+    if (message.compare(0, first, node_tag_) == 0) {
+        return;  // 내가 보낸 것 (이미 로컬에서 무효화함)
+    }
+    const auto session_id = message.substr(first + 1, second - first - 1);
+    const auto player_id = message.substr(second + 1);
+    if (!session_id.empty()) {
+        InvalidateSession(session_id);
+    }
+    if (!player_id.empty()) {
+        InvalidatePlayer(player_id);
+    }
+    remote_invalidations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CachedSessionStore::Clear() {
+    auto clear = [](auto& shards) {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lk(shard->mutex);
+            ++shard->epoch;
+            shard->lru.clear();
+            shard->index.clear();
+        }
+    };
+    clear(sessions_);
+    clear(players_);
+}
+
+// [Order 6] 지표 - 적중률로 capacity/ttl 크기 조정
+NearCacheStats CachedSessionStore::Stats() const {
+    NearCacheStats stats;
+    stats.session_hits = session_hits_.load(std::memory_order_relaxed);
+    stats.session_misses = session_misses_.load(std::memory_order_relaxed);
+    stats.player_hits = player_hits_.load(std::memory_order_relaxed);
+    stats.player_misses = player_misses_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    stats.expirations = expirations_.load(std::memory_order_relaxed);
+    stats.local_invalidations = local_invalidations_.load(std::memory_order_relaxed);
+    stats.remote_invalidations = remote_invalidations_.load(std::memory_order_relaxed);
+    auto count = [](const auto& shards) {
+        std::size_t total = 0;
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lk(shard->mutex);
+            total += shard->lru.size();
+        }
+        return total;
+    };
+    stats.entries = count(sessions_) + count(players_);
+    return stats;
+}
+
+std::string CachedSessionStore::MetricsSnapshot() const {
+    const auto stats = Stats();
+    std::ostringstream oss;
+    oss << "# TYPE session_near_cache_requests_total counter\n";
+    oss << "session_near_cache_requests_total{cache=\"session\",result=\"hit\"} "
+        << stats.session_hits << "\n";
+    oss << "session_near_cache_requests_total{cache=\"session\",result=\"miss\"} "
+        << stats.session_misses << "\n";
+    oss << "session_near_cache_requests_total{cache=\"player\",result=\"hit\"} "
+        << stats.player_hits << "\n";
+    oss << "session_near_cache_requests_total{cache=\"player\",result=\"miss\"} "
+        << stats.player_misses << "\n";
+    oss << "# TYPE session_near_cache_hit_ratio gauge\n";
+    oss << "session_near_cache_hit_ratio{cache=\"session\"} " << stats.SessionHitRatio() << "\n";
+    oss << "session_near_cache_hit_ratio{cache=\"player\"} " << stats.PlayerHitRatio() << "\n";
+    oss << "# TYPE session_near_cache_evictions_total counter\n";
+    oss << "session_near_cache_evictions_total{reason=\"capacity\"} " << stats.evictions << "\n";
+    oss << "session_near_cache_evictions_total{reason=\"ttl\"} " << stats.expirations << "\n";
+    oss << "# TYPE session_near_cache_invalidations_total counter\n";
+    oss << "session_near_cache_invalidations_total{source=\"local\"} "
+        << stats.local_invalidations << "\n";
+    oss << "session_near_cache_invalidations_total{source=\"remote\"} "
+        << stats.remote_invalidations << "\n";
+    oss << "# TYPE session_near_cache_entries gauge\n";
+    oss << "session_near_cache_entries " << stats.entries << "\n";
+    oss << "# TYPE session_near_cache_capacity gauge\n";
+    oss << "session_near_cache_capacity " << shard_capacity_ * options_.shards * 2 << "\n";
+    return oss.str();
+}
+
+// ========================================================================
+// [Reader Notes] Near-cache
+// ========================================================================
+// 1. 구조
+//    - 세션 캐시(session_id → SessionData) + 플레이어 캐시(player_id → session_id)
+//    - 각각 샤드 16개, 샤드마다 mutex + LRU 리스트 + 해시맵 (조회도 LRU 순서를 바꾸므로 mutex)
+//    - 한도 초과 시 샤드에서 가장 오래 안 쓴 엔트리 하나 제거
+//
+// 2. 일관성
+//    - 이 노드의 쓰기: 백엔드 반영 직후 무효화 → 다음 조회는 새 값
+//    - 다른 노드의 쓰기: 버스 메시지가 오면 즉시, 유실되면 ttl 뒤
+//    - Refresh는 캐시를 건드리지 않음 (last_activity만 바뀌고 호출 빈도가 높음)
+//
+// 3. 크기 정하기
+//    - session_near_cache_hit_ratio가 낮고 evictions{reason="capacity"}가 많으면 capacity 증가
+//    - evictions{reason="ttl"}이 대부분이면 ttl이 접근 간격보다 짧은 것
+// ========================================================================
+
+}  // namespace storage
+}  // namespace pvpserver
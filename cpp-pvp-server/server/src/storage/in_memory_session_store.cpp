@@ -2,28 +2,46 @@
 // - 목적: 인메모리 세션 저장소 (단일 서버용)
 // - 주요 역할: 세션 데이터를 메모리에 저장, TTL 기반 자동 만료
 // - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템 - 세션 관리
-// - 권장 읽는 순서: SaveSession → GetSession → CleanupLoop
+// - 권장 읽는 순서: SaveSession → GetSession → RefreshSession → CleanExpiredSessions
 //
 // [LEARN] 인메모리 vs Redis 세션:
 //         - 인메모리: 단일 서버, 빠름, 서버 재시작 시 소실
 //         - Redis: 분산 서버, 공유 가능, 영속성 옵션
 //
-// 백그라운드 정리 스레드: 주기적으로 만료 세션 삭제
+// [LEARN] 뮤텍스 하나 + 전체 스캔의 문제:
+//         - 모든 Get/Refresh가 같은 잠금에서 줄을 섬 (읽기끼리도)
+//         - 정리 스레드가 세션 전체를 도는 동안 조회가 전부 멈춤
+//         → 샤드 32개 (shared_mutex) + 샤드별 타이밍 휠로 만료 예약
+//
+// 백그라운드 정리 스레드: 주기적으로 각 샤드의 휠을 현재 틱까지 진행
 
 #include "pvpserver/storage/in_memory_session_store.h"
 
-#include <chrono>
+#include <algorithm>
+#include <functional>
 
 namespace pvpserver {
 namespace storage {
 
-// [Order 1] 생성자 - 백그라운드 정리 스레드 시작
+// [Order 1] 생성자 - 샤드 준비 후 백그라운드 정리 스레드 시작
 // [LEARN] std::thread 생성 시 멤버 함수 바인딩:
 //         std::thread(&Class::Method, this)
 InMemorySessionStore::InMemorySessionStore(int ttl_seconds,
                                            int cleanup_interval_seconds)
-    : ttl_seconds_(ttl_seconds)
-    , cleanup_interval_seconds_(cleanup_interval_seconds) {
+    : InMemorySessionStore(std::chrono::seconds(ttl_seconds),
+                           std::chrono::seconds(cleanup_interval_seconds)) {}
+
+InMemorySessionStore::InMemorySessionStore(std::chrono::milliseconds ttl,
+                                           std::chrono::milliseconds cleanup_interval,
+                                           std::chrono::milliseconds tick)
+    : ttl_ms_(ttl.count())
+    , cleanup_interval_(cleanup_interval)
+    , tick_ms_(std::max<int64_t>(1, tick.count())) {
+    const auto start_tick = static_cast<std::uint64_t>(GetCurrentTimestamp() / tick_ms_);
+    shards_.reserve(kShards);
+    for (std::size_t i = 0; i < kShards; ++i) {
+        shards_.push_back(std::make_unique<Shard>(start_tick));
+    }
     // 백그라운드 정리 스레드 시작
     cleanup_thread_ = std::thread(&InMemorySessionStore::CleanupLoop, this);
 }
@@ -34,191 +52,258 @@ InMemorySessionStore::~InMemorySessionStore() {
 }
 
 // StopCleanup - 스레드 안전하게 종료
-// [LEARN] atomic 플래그로 루프 종료 신호, join()으로 대기
+// [LEARN] 조건 변수로 깨우므로 정리 주기가 길어도 바로 종료
 void InMemorySessionStore::StopCleanup() {
-    running_.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        running_.store(false, std::memory_order_release);
+    }
+    stop_cv_.notify_all();
     if (cleanup_thread_.joinable()) {
         cleanup_thread_.join();  // 스레드 종료 대기
     }
 }
 
 // [Order 2] CleanupLoop - 백그라운드 정리 루프
-// [LEARN] 주기적으로 만료 세션 삭제.
-//         sleep_for: 비동기 대기 (CPU 점유 안 함)
 void InMemorySessionStore::CleanupLoop() {
+    std::unique_lock<std::mutex> lock(stop_mutex_);
     while (running_.load(std::memory_order_acquire)) {
-        std::this_thread::sleep_for(
-            std::chrono::seconds(cleanup_interval_seconds_));
-
-        if (running_.load(std::memory_order_acquire)) {
-            CleanExpiredSessions();
+        stop_cv_.wait_for(lock, cleanup_interval_, [this] {
+            return !running_.load(std::memory_order_acquire);
+        });
+        if (!running_.load(std::memory_order_acquire)) {
+            break;
         }
+        lock.unlock();
+        CleanExpiredSessions();
+        lock.lock();
     }
 }
 
-// IsExpired - 만료 여부 확인
-bool InMemorySessionStore::IsExpired(const SessionEntry& entry) const {
-    return GetCurrentTimestamp() > entry.expiry_time;
+// IsExpired - 만료 여부 확인 (휠이 아직 치우지 않은 세션은 조회 시 여기서 걸러짐)
+bool InMemorySessionStore::IsExpired(const SessionEntry& entry, int64_t now) const {
+    return now > entry.expiry_time;
 }
 
-// [Order 3] SaveSession - 세션 저장
-// [LEARN] mutex로 동시성 보호.
-//         player_to_session: 역방향 조회 맵 (플레이어 → 세션)
-bool InMemorySessionStore::SaveSession(const std::string& session_id,
-                                       const SessionData& data) {
-    std::lock_guard<std::mutex> lock(mutex_);
+InMemorySessionStore::Shard& InMemorySessionStore::ShardFor(const std::string& key) const {
+    return *shards_[std::hash<std::string>{}(key) % kShards];
+}
+
+// 만료 시각이 속한 틱의 다음 틱: 휠이 그 틱을 처리할 때는 이미 만료가 확실
+std::uint64_t InMemorySessionStore::TickFor(int64_t expiry_ms) const {
+    return static_cast<std::uint64_t>(expiry_ms / tick_ms_) + 1;
+}
 
-    SessionEntry entry;
-    entry.data = data;
-    entry.expiry_time = GetCurrentTimestamp() + (ttl_seconds_ * 1000);
+void InMemorySessionStore::SetPlayerMapping(const std::string& player_id,
+                                            const std::string& session_id) {
+    Shard& shard = ShardFor(player_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.players[player_id] = session_id;
+}
 
-    // 기존 세션이 있으면 player_to_session 맵 정리
-    auto existing = sessions_.find(session_id);
-    if (existing != sessions_.end()) {
-        player_to_session_.erase(existing->second.data.player_id);
+void InMemorySessionStore::RemovePlayerMapping(const std::string& player_id,
+                                               const std::string& session_id) {
+    Shard& shard = ShardFor(player_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.players.find(player_id);
+    if (it != shard.players.end() && it->second == session_id) {
+        shard.players.erase(it);
     }
+}
+
+std::pair<std::string, std::string> InMemorySessionStore::EraseLocked(
+    Shard& shard, std::unordered_map<std::string, SessionEntry>::iterator it) {
+    shard.wheel.Cancel(it->second);
+    std::pair<std::string, std::string> mapping{std::move(it->second.data.player_id), it->first};
+    shard.sessions.erase(it);
+    return mapping;
+}
 
-    sessions_[session_id] = entry;
-    player_to_session_[data.player_id] = session_id;
+// [Order 3] SaveSession - 세션 저장
+// [LEARN] player_to_session(역방향 맵)은 player_id 샤드에 있으므로
+//         세션 샤드 잠금을 푼 뒤 따로 잡는다 → 잠금 두 개를 동시에 잡지 않아 교착 없음
+bool InMemorySessionStore::SaveSession(const std::string& session_id,
+                                       const SessionData& data) {
+    const int64_t expiry_time = GetCurrentTimestamp() + ttl_ms_;
+    std::string previous_player;
+    {
+        Shard& shard = ShardFor(session_id);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto [it, inserted] = shard.sessions.try_emplace(session_id);
+        SessionEntry& entry = it->second;
+        if (inserted) {
+            entry.session_id = &it->first;
+        } else if (entry.data.player_id != data.player_id) {
+            previous_player = entry.data.player_id;
+        }
+        entry.data = data;
+        entry.expiry_time = expiry_time;
+        shard.wheel.Schedule(entry, TickFor(expiry_time));
+    }
 
+    SetPlayerMapping(data.player_id, session_id);
+    if (!previous_player.empty()) {
+        RemovePlayerMapping(previous_player, session_id);
+    }
     return true;
 }
 
 // [Order 4] GetSession - 세션 조회
-// [LEARN] 조회 시 만료 체크 → 만료됐으면 삭제 후 nullopt 반환
+// [LEARN] 공유 잠금: 같은 샤드의 조회끼리는 기다리지 않음.
+//         만료됐지만 아직 휠이 치우지 않은 세션은 nullopt (삭제는 휠 몫)
 std::optional<SessionData> InMemorySessionStore::GetSession(
     const std::string& session_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = ShardFor(session_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
 
-    auto it = sessions_.find(session_id);
-    if (it == sessions_.end()) {
+    auto it = shard.sessions.find(session_id);
+    if (it == shard.sessions.end() || IsExpired(it->second, GetCurrentTimestamp())) {
         return std::nullopt;
     }
-
-    if (IsExpired(it->second)) {
-        // 만료된 세션 제거
-        player_to_session_.erase(it->second.data.player_id);
-        sessions_.erase(it);
-        return std::nullopt;
-    }
-
     return it->second.data;
 }
 
 bool InMemorySessionStore::DeleteSession(const std::string& session_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto it = sessions_.find(session_id);
-    if (it == sessions_.end()) {
-        return false;
+    std::pair<std::string, std::string> mapping;
+    {
+        Shard& shard = ShardFor(session_id);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(session_id);
+        if (it == shard.sessions.end()) {
+            return false;
+        }
+        mapping = EraseLocked(shard, it);
     }
-
-    player_to_session_.erase(it->second.data.player_id);
-    sessions_.erase(it);
+    RemovePlayerMapping(mapping.first, mapping.second);
     return true;
 }
 
+// [Order 5] RefreshSession - TTL 연장 = 휠 슬롯만 옮김 (O(1), 할당 없음)
 bool InMemorySessionStore::RefreshSession(const std::string& session_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto it = sessions_.find(session_id);
-    if (it == sessions_.end()) {
-        return false;
-    }
-
-    if (IsExpired(it->second)) {
-        player_to_session_.erase(it->second.data.player_id);
-        sessions_.erase(it);
-        return false;
+    std::pair<std::string, std::string> mapping;
+    {
+        Shard& shard = ShardFor(session_id);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(session_id);
+        if (it == shard.sessions.end()) {
+            return false;
+        }
+        const int64_t now = GetCurrentTimestamp();
+        if (!IsExpired(it->second, now)) {
+            // TTL 갱신
+            it->second.expiry_time = now + ttl_ms_;
+            shard.wheel.Schedule(it->second, TickFor(it->second.expiry_time));
+            it->second.data.Touch();
+            return true;
+        }
+        mapping = EraseLocked(shard, it);
     }
-
-    // TTL 갱신
-    it->second.expiry_time = GetCurrentTimestamp() + (ttl_seconds_ * 1000);
-    it->second.data.Touch();
-    return true;
+    RemovePlayerMapping(mapping.first, mapping.second);
+    return false;
 }
 
 std::vector<std::string> InMemorySessionStore::GetAllSessionIds() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     std::vector<std::string> ids;
-    ids.reserve(sessions_.size());
-
-    auto now = GetCurrentTimestamp();
-    for (const auto& [id, entry] : sessions_) {
-        if (now <= entry.expiry_time) {
-            ids.push_back(id);
+    const auto now = GetCurrentTimestamp();
+    for (const auto& shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        for (const auto& [id, entry] : shard->sessions) {
+            if (!IsExpired(entry, now)) {
+                ids.push_back(id);
+            }
         }
     }
-
     return ids;
 }
 
 std::optional<std::string> InMemorySessionStore::GetSessionByPlayerId(
     const std::string& player_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto it = player_to_session_.find(player_id);
-    if (it == player_to_session_.end()) {
-        return std::nullopt;
+    std::string session_id;
+    {
+        Shard& shard = ShardFor(player_id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.players.find(player_id);
+        if (it == shard.players.end()) {
+            return std::nullopt;
+        }
+        session_id = it->second;
     }
 
-    // 세션이 유효한지 확인
-    auto session_it = sessions_.find(it->second);
-    if (session_it == sessions_.end() || IsExpired(session_it->second)) {
-        player_to_session_.erase(it);
-        if (session_it != sessions_.end()) {
-            sessions_.erase(session_it);
+    // 세션이 유효한지 확인 (매핑은 잠금 밖에서 갱신되므로 player_id도 대조)
+    {
+        Shard& shard = ShardFor(session_id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(session_id);
+        if (it != shard.sessions.end() && it->second.data.player_id == player_id &&
+            !IsExpired(it->second, GetCurrentTimestamp())) {
+            return session_id;
         }
-        return std::nullopt;
     }
-
-    return it->second;
+    return std::nullopt;
 }
 
 size_t InMemorySessionStore::GetActiveSessionCount() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
+    CleanExpiredSessions();
     size_t count = 0;
-    auto now = GetCurrentTimestamp();
-    for (const auto& [id, entry] : sessions_) {
-        if (now <= entry.expiry_time) {
-            ++count;
-        }
+    for (const auto& shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        count += shard->sessions.size();
     }
     return count;
 }
 
 bool InMemorySessionStore::SessionExists(const std::string& session_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = ShardFor(session_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
 
-    auto it = sessions_.find(session_id);
-    if (it == sessions_.end()) {
-        return false;
-    }
-    return !IsExpired(it->second);
+    auto it = shard.sessions.find(session_id);
+    return it != shard.sessions.end() && !IsExpired(it->second, GetCurrentTimestamp());
 }
 
+// [Order 6] CleanExpiredSessions - 샤드마다 휠을 현재 틱까지 진행
+// [LEARN] 한 번에 샤드 하나만 배타 잠금 → 다른 샤드 조회는 그대로 진행.
+//         잠금 시간은 그 샤드에서 실제로 만료된 세션 수에 비례.
 void InMemorySessionStore::CleanExpiredSessions() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto now = GetCurrentTimestamp();
-    std::vector<std::string> expired_ids;
-
-    for (const auto& [id, entry] : sessions_) {
-        if (now > entry.expiry_time) {
-            expired_ids.push_back(id);
+    const auto now_tick = static_cast<std::uint64_t>(GetCurrentTimestamp() / tick_ms_);
+    std::vector<std::pair<std::string, std::string>> mappings;
+
+    for (auto& shard_ptr : shards_) {
+        Shard& shard = *shard_ptr;
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            if (shard.wheel.Size() == 0 && shard.wheel.CurrentTick() > now_tick) {
+                continue;
+            }
+            shard.wheel.Advance(now_tick, [&](TimerWheel::Node& node) {
+                auto& entry = static_cast<SessionEntry&>(node);
+                auto it = shard.sessions.find(*entry.session_id);
+                mappings.emplace_back(std::move(entry.data.player_id), it->first);
+                shard.sessions.erase(it);
+            });
         }
-    }
-
-    for (const auto& id : expired_ids) {
-        auto it = sessions_.find(id);
-        if (it != sessions_.end()) {
-            player_to_session_.erase(it->second.data.player_id);
-            sessions_.erase(it);
+        for (const auto& [player_id, session_id] : mappings) {
+            RemovePlayerMapping(player_id, session_id);
         }
+        mappings.clear();
     }
 }
 
+// ========================================================================
+// [Reader Notes] 세션 저장소 샤딩 + 타이밍 휠
+// ========================================================================
+// 1. 샤드
+//    - session_id 해시 % 32 → 샤드 하나의 shared_mutex만 잡음
+//    - player → session 역방향 맵은 player_id 해시 샤드에 (잠금은 하나씩만)
+//    - 역방향 맵은 잠시 어긋날 수 있으므로 조회 시 세션 쪽 player_id로 확인
+//
+// 2. 타이밍 휠 (TimerWheel)
+//    - 엔트리 자체가 휠 노드 → Refresh는 리스트 연결만 바꿈
+//    - 정리 비용 = 지나간 틱 수 + 만료된 세션 수 (살아 있는 세션은 보지 않음)
+//
+// 3. 만료 정확도
+//    - 조회는 expiry_time으로 바로 판단 (정리 주기와 무관)
+//    - 메모리에서 실제 제거는 정리 주기(또는 GetActiveSessionCount)마다
+// ========================================================================
+
 }  // namespace storage
 }  // namespace pvpserver
@@ -0,0 +1,565 @@
+// [FILE]
+// - 목적: libpq 비동기 연결 풀 (io 스레드를 막지 않는 DB 쓰기)
+// - 주요 역할: N개 연결 유지/재연결, 파이프라인 전송, 쿼리별 지연 히스토그램
+// - 관련 클론 가이드 단계: [v1.0.0] 기본 서버 - 데이터 계층
+// - 권장 읽는 순서: Execute → Dispatch → Send/Flush → ProcessResults → Fail
+//
+// [LEARN] libpq 비동기 API를 Asio에 붙이는 법:
+//         - PQconnectStart/PQconnectPoll: 연결도 논블로킹으로 (폴링 결과가 읽기/쓰기 대기를 알려줌)
+//         - PQsocket의 fd를 posix::stream_descriptor로 감싸 async_wait(read/write)
+//         - 읽기 가능 → PQconsumeInput → PQisBusy가 false인 동안 PQgetResult
+//         - PQflush가 1이면 커널 버퍼가 찼다는 뜻 → 쓰기 가능을 기다렸다 다시 flush
+//
+// [LEARN] 파이프라인 모드 (libpq 14+):
+//         응답을 기다리지 않고 쿼리를 연달아 보낸다. 왕복 시간(RTT)이 쿼리 수만큼 쌓이지 않음.
+//         쿼리마다 PQpipelineSync를 붙여 각자 독립 트랜잭션으로 실행 (하나가 실패해도 나머지는 진행).
+
+#include "pvpserver/storage/postgres_connection_pool.h"
+
+#include <algorithm>
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/post.hpp>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace pvpserver {
+
+namespace {
+using descriptor_base = boost::asio::posix::descriptor_base;
+}  // namespace
+
+// [Order 1] QueryLatencyHistogram - 라벨별 누적 버킷
+void QueryLatencyHistogram::Observe(const std::string& query, double seconds, bool ok) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto& series = series_[query];
+    const auto it = std::lower_bound(kBuckets.begin(), kBuckets.end(), seconds);
+    if (it == kBuckets.end()) {
+        ++series.overflow;
+    } else {
+        ++series.buckets[static_cast<std::size_t>(it - kBuckets.begin())];
+    }
+    ++series.count;
+    series.sum += seconds;
+    if (!ok) {
+        ++series.errors;
+    }
+}
+
+std::string QueryLatencyHistogram::Snapshot(const std::string& metric_name) const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::ostringstream oss;
+    oss << "# TYPE " << metric_name << " histogram\n";
+    for (const auto& [query, series] : series_) {
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < kBuckets.size(); ++i) {
+            cumulative += series.buckets[i];
+            oss << metric_name << "_bucket{query=\"" << query << "\",le=\"" << kBuckets[i]
+                << "\"} " << cumulative << "\n";
+        }
+        oss << metric_name << "_bucket{query=\"" << query << "\",le=\"+Inf\"} "
+            << cumulative + series.overflow << "\n";
+        oss << metric_name << "_sum{query=\"" << query << "\"} " << series.sum << "\n";
+        oss << metric_name << "_count{query=\"" << query << "\"} " << series.count << "\n";
+    }
+    oss << "# TYPE database_query_errors_total counter\n";
+    for (const auto& [query, series] : series_) {
+        oss << "database_query_errors_total{query=\"" << query << "\"} " << series.errors << "\n";
+    }
+    return oss.str();
+}
+
+PostgresConnectionPool::PostgresConnectionPool(boost::asio::io_context& io_context,
+                                               std::string dsn, PostgresPoolOptions options,
+                                               std::shared_ptr<QueryLatencyHistogram> latency)
+    : io_context_(io_context),
+      strand_(boost::asio::make_strand(io_context)),
+      dsn_(std::move(dsn)),
+      options_([&] {
+          options.connections = std::max<std::size_t>(1, options.connections);
+          options.max_in_flight_per_connection =
+              std::max<std::size_t>(1, options.max_in_flight_per_connection);
+          return options;
+      }()),
+      latency_(latency ? std::move(latency) : std::make_shared<QueryLatencyHistogram>()) {
+    connections_.reserve(options_.connections);
+    for (std::size_t i = 0; i < options_.connections; ++i) {
+        connections_.push_back(std::make_unique<Connection>(io_context_, i));
+    }
+}
+
+// io_context가 먼저 멈춰 Stop의 정리 작업이 실행되지 못한 경우 여기서 연결만 닫는다
+PostgresConnectionPool::~PostgresConnectionPool() {
+    for (auto& conn : connections_) {
+        if (conn->descriptor.is_open()) {
+            conn->descriptor.release();  // fd는 libpq 소유 → PQfinish가 닫음
+        }
+        if (conn->pg) {
+            PQfinish(conn->pg);
+            conn->pg = nullptr;
+        }
+    }
+}
+
+// [Order 2] Start / Stop
+void PostgresConnectionPool::Start() {
+    if (started_.exchange(true)) {
+        return;
+    }
+    boost::asio::post(strand_, [self = shared_from_this()] {
+        for (auto& conn : self->connections_) {
+            self->Connect(*conn);
+        }
+    });
+}
+
+void PostgresConnectionPool::Stop() {
+    if (!started_.exchange(false)) {
+        return;
+    }
+    boost::asio::post(strand_, [self = shared_from_this()] {
+        self->stopping_ = true;
+        for (auto& conn : self->connections_) {
+            conn->reconnect_timer.cancel();
+            self->Fail(*conn, "pool stopped");
+        }
+        auto waiting = std::move(self->waiting_);
+        self->waiting_.clear();
+        for (auto& query : waiting) {
+            query.ok = false;
+            query.error = "pool stopped";
+            self->Complete(query);
+        }
+    });
+}
+
+// [Order 3] Execute - 어느 스레드에서나 호출, strand로 넘기고 즉시 반환
+// [LEARN] 대기열이 가득 차면 기다리지 않고 거절 (DB 장애가 접속 처리로 번지지 않게)
+bool PostgresConnectionPool::Execute(std::string label, std::string sql,
+                                     std::vector<std::string> params, Callback callback) {
+    if (!started_.load(std::memory_order_acquire)) {
+        rejected_total_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (queued_.fetch_add(1, std::memory_order_acq_rel) >= options_.max_queued) {
+        queued_.fetch_sub(1, std::memory_order_acq_rel);
+        rejected_total_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Query query;
+    query.label = std::move(label);
+    query.sql = std::move(sql);
+    query.params = std::move(params);
+    query.callback = std::move(callback);
+    query.enqueued_at = std::chrono::steady_clock::now();
+
+    boost::asio::post(strand_, [self = shared_from_this(), query = std::move(query)]() mutable {
+        if (self->stopping_) {
+            query.ok = false;
+            query.error = "pool stopped";
+            self->Complete(query);
+            return;
+        }
+        // 연결 중인 것도 없이 전부 백오프 대기 중이면 기다리지 않고 실패 처리
+        const bool any_alive =
+            std::any_of(self->connections_.begin(), self->connections_.end(),
+                        [](const auto& conn) { return conn->connected || conn->connecting; });
+        if (!any_alive) {
+            query.ok = false;
+            query.error = "no postgres connection";
+            self->Complete(query);
+            return;
+        }
+        self->waiting_.push_back(std::move(query));
+        self->Dispatch();
+    });
+    return true;
+}
+
+// [Order 4] Connect - PQconnectStart + PQconnectPoll 상태 기계
+void PostgresConnectionPool::Connect(Connection& conn) {
+    if (stopping_ || conn.pg) {
+        return;
+    }
+    conn.connecting = true;
+    conn.pg = PQconnectStart(dsn_.c_str());
+    if (!conn.pg || PQstatus(conn.pg) == CONNECTION_BAD) {
+        Fail(conn, conn.pg ? PQerrorMessage(conn.pg) : "out of memory");
+        return;
+    }
+    // libpq 문서: 처음에는 PGRES_POLLING_WRITING을 받은 것처럼 쓰기 가능을 기다린다
+    PollConnect(conn, PGRES_POLLING_WRITING);
+}
+
+void PostgresConnectionPool::PollConnect(Connection& conn, PostgresPollingStatusType status) {
+    switch (status) {
+        case PGRES_POLLING_OK:
+            OnConnected(conn);
+            return;
+        case PGRES_POLLING_FAILED:
+            Fail(conn, PQerrorMessage(conn.pg));
+            return;
+        default:
+            break;
+    }
+    AssignSocket(conn);
+    const auto wait =
+        status == PGRES_POLLING_READING ? descriptor_base::wait_read : descriptor_base::wait_write;
+    conn.descriptor.async_wait(
+        wait, boost::asio::bind_executor(
+                  strand_, [self = shared_from_this(), &conn,
+                            generation = conn.generation](const boost::system::error_code& ec) {
+                      if (self->stopping_ || generation != conn.generation) {
+                          return;
+                      }
+                      if (ec) {
+                          self->Fail(conn, ec.message());
+                          return;
+                      }
+                      self->PollConnect(conn, PQconnectPoll(conn.pg));
+                  }));
+}
+
+void PostgresConnectionPool::OnConnected(Connection& conn) {
+    conn.connecting = false;
+    conn.connected = true;
+    conn.backoff = std::chrono::milliseconds(0);
+    connections_up_.fetch_add(1, std::memory_order_relaxed);
+    PQsetnonblocking(conn.pg, 1);
+#ifdef LIBPQ_HAS_PIPELINING
+    if (options_.pipeline && PQenterPipelineMode(conn.pg) == 1) {
+        conn.pipeline = true;
+        pipelined_connections_.fetch_add(1, std::memory_order_relaxed);
+    }
+#endif
+    AssignSocket(conn);
+    ArmRead(conn);
+    Dispatch();
+}
+
+// [LEARN] 연결 과정에서 libpq가 소켓을 바꿀 수 있다 (호스트 여러 개, SSL 재시도 등)
+void PostgresConnectionPool::AssignSocket(Connection& conn) {
+    const int fd = PQsocket(conn.pg);
+    if (conn.descriptor.is_open()) {
+        if (conn.descriptor.native_handle() == fd) {
+            return;
+        }
+        conn.descriptor.release();
+    }
+    if (fd >= 0) {
+        conn.descriptor.assign(fd);
+    }
+}
+
+// [Order 5] ArmRead - 연결된 동안 항상 읽기 대기 (응답 + 서버 종료 감지)
+void PostgresConnectionPool::ArmRead(Connection& conn) {
+    if (conn.read_armed || !conn.connected) {
+        return;
+    }
+    conn.read_armed = true;
+    conn.descriptor.async_wait(
+        descriptor_base::wait_read,
+        boost::asio::bind_executor(
+            strand_, [self = shared_from_this(), &conn,
+                      generation = conn.generation](const boost::system::error_code& ec) {
+                if (self->stopping_ || generation != conn.generation) {
+                    return;
+                }
+                conn.read_armed = false;
+                if (ec) {
+                    self->Fail(conn, ec.message());
+                    return;
+                }
+                if (PQconsumeInput(conn.pg) == 0) {
+                    self->Fail(conn, PQerrorMessage(conn.pg));
+                    return;
+                }
+                self->ProcessResults(conn);
+                if (conn.connected) {
+                    self->ArmRead(conn);
+                }
+                self->Dispatch();
+            }));
+}
+
+// [Order 6] Dispatch - 대기 쿼리를 가장 한가한 연결로
+// [LEARN] 파이프라인이면 연결당 여러 개, 아니면 한 번에 하나 (Capacity).
+//         같은 연결에 보낸 쿼리는 루프가 끝난 뒤 한 번에 flush → 작은 쓰기 여러 번 대신 한 번.
+void PostgresConnectionPool::Dispatch() {
+    std::vector<Connection*> touched;
+    while (!waiting_.empty()) {
+        Connection* best = nullptr;
+        for (auto& conn : connections_) {
+            if (!conn->connected || conn->in_flight.size() >= Capacity(*conn)) {
+                continue;
+            }
+            if (!best || conn->in_flight.size() < best->in_flight.size()) {
+                best = conn.get();
+            }
+        }
+        if (!best) {
+            break;
+        }
+        Query query = std::move(waiting_.front());
+        waiting_.pop_front();
+        if (!Send(*best, std::move(query))) {
+            // query는 Send 실패 시 이동되지 않음
+            query.ok = false;
+            query.error = PQerrorMessage(best->pg);
+            Complete(query);
+            Fail(*best, query.error);
+            continue;
+        }
+        if (std::find(touched.begin(), touched.end(), best) == touched.end()) {
+            touched.push_back(best);
+        }
+    }
+    for (auto* conn : touched) {
+        if (conn->connected) {
+            Flush(*conn);
+        }
+    }
+}
+
+bool PostgresConnectionPool::Send(Connection& conn, Query&& query) {
+    std::vector<const char*> values;
+    values.reserve(query.params.size());
+    for (const auto& param : query.params) {
+        values.push_back(param.c_str());
+    }
+    if (PQsendQueryParams(conn.pg, query.sql.c_str(), static_cast<int>(values.size()), nullptr,
+                          values.empty() ? nullptr : values.data(), nullptr, nullptr, 0) == 0) {
+        return false;
+    }
+#ifdef LIBPQ_HAS_PIPELINING
+    if (conn.pipeline && PQpipelineSync(conn.pg) == 0) {
+        return false;
+    }
+#endif
+    conn.in_flight.push_back(std::move(query));
+    return true;
+}
+
+void PostgresConnectionPool::Flush(Connection& conn) {
+    if (conn.write_armed) {
+        return;  // 이미 쓰기 가능을 기다리는 중 → 그때 남은 것까지 함께 flush
+    }
+    const int result = PQflush(conn.pg);
+    if (result == 0) {
+        return;
+    }
+    if (result < 0) {
+        Fail(conn, PQerrorMessage(conn.pg));
+        return;
+    }
+    conn.write_armed = true;
+    conn.descriptor.async_wait(
+        descriptor_base::wait_write,
+        boost::asio::bind_executor(
+            strand_, [self = shared_from_this(), &conn,
+                      generation = conn.generation](const boost::system::error_code& ec) {
+                if (self->stopping_ || generation != conn.generation) {
+                    return;
+                }
+                conn.write_armed = false;
+                if (ec) {
+                    self->Fail(conn, ec.message());
+                    return;
+                }
+                self->Flush(conn);
+            }));
+}
+
+// [Order 7] ProcessResults - 도착한 결과를 보낸 순서대로 매칭
+// [LEARN] 결과 순서:
+//         - 일반 모드: 결과 … NULL (= 쿼리 끝)
+//         - 파이프라인: 결과 … NULL, 그 다음 PGRES_PIPELINE_SYNC (= 동기화 지점, 쿼리 끝)
+void PostgresConnectionPool::ProcessResults(Connection& conn) {
+    while (conn.connected && !conn.in_flight.empty() && !PQisBusy(conn.pg)) {
+        PGresult* result = PQgetResult(conn.pg);
+        auto& front = conn.in_flight.front();
+        if (!result) {
+            if (conn.pipeline) {
+                front.results_done = true;
+                continue;
+            }
+            Query done = std::move(front);
+            conn.in_flight.pop_front();
+            Complete(done);
+            continue;
+        }
+        const auto status = PQresultStatus(result);
+#ifdef LIBPQ_HAS_PIPELINING
+        if (status == PGRES_PIPELINE_SYNC) {
+            PQclear(result);
+            Query done = std::move(front);
+            conn.in_flight.pop_front();
+            Complete(done);
+            continue;
+        }
+#endif
+        if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK && front.ok) {
+            front.ok = false;
+            front.error = PQresultErrorMessage(result);
+        }
+        PQclear(result);
+    }
+    if (conn.connected && PQstatus(conn.pg) == CONNECTION_BAD) {
+        Fail(conn, PQerrorMessage(conn.pg));
+    }
+}
+
+void PostgresConnectionPool::Complete(Query& query) {
+    queued_.fetch_sub(1, std::memory_order_acq_rel);
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - query.enqueued_at)
+            .count();
+    latency_->Observe(query.label, seconds, query.ok);
+    (query.ok ? queries_ok_total_ : queries_failed_total_).fetch_add(1, std::memory_order_relaxed);
+    if (query.callback) {
+        query.callback(query.ok, query.error);
+    }
+}
+
+// [Order 8] Fail - 연결 폐기, 보낸 쿼리 실패 처리, 백오프 후 재연결
+// [LEARN] 보낸 쿼리는 서버에서 실행됐는지 알 수 없으므로 재전송하지 않는다 (중복 INSERT 방지).
+void PostgresConnectionPool::Fail(Connection& conn, const std::string& error) {
+    const bool was_connected = conn.connected;
+    const bool was_connecting = conn.connecting;
+    auto in_flight = std::move(conn.in_flight);
+    conn.in_flight.clear();
+    Close(conn);
+    for (auto& query : in_flight) {
+        query.ok = false;
+        query.error = error;
+        Complete(query);
+    }
+    if (stopping_) {
+        return;
+    }
+    if (was_connecting) {
+        connect_failures_total_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (was_connected || was_connecting) {
+        std::cerr << "postgres pool connection " << conn.index << " failed: " << error;
+        if (error.empty() || error.back() != '\n') {
+            std::cerr << '\n';
+        }
+    }
+    conn.backoff = was_connected
+                       ? options_.reconnect_backoff
+                       : std::min(std::max(conn.backoff * 2, options_.reconnect_backoff),
+                                  options_.max_reconnect_backoff);
+    ScheduleReconnect(conn);
+    FailWaitingIfAllDown(error);
+}
+
+void PostgresConnectionPool::Close(Connection& conn) {
+    ++conn.generation;
+    conn.read_armed = false;
+    conn.write_armed = false;
+    conn.connecting = false;
+    if (conn.connected) {
+        conn.connected = false;
+        connections_up_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (conn.pipeline) {
+        conn.pipeline = false;
+        pipelined_connections_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (conn.descriptor.is_open()) {
+        conn.descriptor.release();  // 대기 중인 async_wait 취소, fd는 닫지 않음
+    }
+    if (conn.pg) {
+        PQfinish(conn.pg);
+        conn.pg = nullptr;
+    }
+}
+
+void PostgresConnectionPool::ScheduleReconnect(Connection& conn) {
+    conn.reconnect_timer.expires_after(conn.backoff);
+    conn.reconnect_timer.async_wait(boost::asio::bind_executor(
+        strand_, [self = shared_from_this(), &conn,
+                  generation = conn.generation](const boost::system::error_code& ec) {
+            if (ec || self->stopping_ || generation != conn.generation) {
+                return;
+            }
+            self->Connect(conn);
+        }));
+}
+
+void PostgresConnectionPool::FailWaitingIfAllDown(const std::string& error) {
+    const bool any_connected = std::any_of(connections_.begin(), connections_.end(),
+                                           [](const auto& conn) { return conn->connected; });
+    if (any_connected) {
+        return;
+    }
+    auto waiting = std::move(waiting_);
+    waiting_.clear();
+    for (auto& query : waiting) {
+        query.ok = false;
+        query.error = error;
+        Complete(query);
+    }
+}
+
+std::size_t PostgresConnectionPool::Capacity(const Connection& conn) const {
+    return conn.pipeline ? options_.max_in_flight_per_connection : 1;
+}
+
+// [Order 9] MetricsSnapshot
+std::string PostgresConnectionPool::MetricsSnapshot() const {
+    std::ostringstream oss;
+    oss << "# TYPE postgres_pool_connections gauge\n";
+    oss << "postgres_pool_connections " << options_.connections << "\n";
+    oss << "# TYPE postgres_pool_connections_up gauge\n";
+    oss << "postgres_pool_connections_up " << connections_up_.load(std::memory_order_relaxed)
+        << "\n";
+    oss << "# TYPE postgres_pool_pipelined_connections gauge\n";
+    oss << "postgres_pool_pipelined_connections "
+        << pipelined_connections_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_pool_pending gauge\n";
+    oss << "postgres_pool_pending " << queued_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_pool_queries_total counter\n";
+    oss << "postgres_pool_queries_total{result=\"ok\"} "
+        << queries_ok_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "postgres_pool_queries_total{result=\"error\"} "
+        << queries_failed_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_pool_rejected_total counter\n";
+    oss << "postgres_pool_rejected_total " << rejected_total_.load(std::memory_order_relaxed)
+        << "\n";
+    oss << "# TYPE postgres_pool_connect_failures_total counter\n";
+    oss << "postgres_pool_connect_failures_total "
+        << connect_failures_total_.load(std::memory_order_relaxed) << "\n";
+    return oss.str();
+}
+
+// ========================================================================
+// [Reader Notes] libpq 비동기 연결 풀
+// ========================================================================
+// 1. 왜 필요한가
+//    - PQexecParams는 응답이 올 때까지 호출 스레드를 멈춘다
+//    - on_join/on_leave는 io 스레드에서 실행 → DB가 느리면 모든 플레이어의 accept/브로드캐스트가 멈춤
+//
+// 2. 스레드 모델
+//    - 연결 상태, 대기열, 진행 중 쿼리는 strand 위에서만 접근 (락 없음)
+//    - Execute는 원자 카운터로 용량만 확인하고 post
+//    - 콜백도 strand에서 실행되므로 블로킹 작업 금지
+//
+// 3. 수명
+//    - 모든 핸들러가 shared_from_this()를 잡아 풀이 먼저 사라지지 않음
+//    - Close마다 generation 증가 → 이전 연결의 취소된 대기가 새 연결 상태를 건드리지 않음
+//    - descriptor.release(): fd 소유권은 libpq에 있으므로 asio가 닫지 않게 놓아준다
+//
+// 4. 장애 처리
+//    - 보낸 쿼리는 실패로 완료 (재전송하면 중복 기록 위험)
+//    - 살아 있는 연결이 없으면 대기 쿼리도 즉시 실패 → 대기열이 끝없이 쌓이지 않음
+//    - 재연결은 연결별 지수 백오프
+//
+// 5. 관측
+//    - database_query_duration_seconds{query=...}: 대기열 + 실행 시간 히스토그램
+//    - 평균 하나(게이지)는 꼬리 지연을 숨긴다 → p99는 histogram_quantile로
+// ========================================================================
+
+}  // namespace pvpserver
@@ -2,19 +2,26 @@
 // - 목적: PostgreSQL 스토리지 (영구 데이터 저장)
 // - 주요 역할: 세션 이벤트, 플레이어 데이터 등 영구 저장
 // - 관련 클론 가이드 단계: [v1.0.0] 기본 서버 - 데이터 계층
-// - 권장 읽는 순서: Connect → RecordSessionEvent → MetricsSnapshot
+// - 권장 읽는 순서: Connect → RecordSessionEvent → EnqueueMatch → WriteBehindLoop → MetricsSnapshot
 //
 // [LEARN] PostgreSQL 특징:
 //         - ACID 보장: 게임 결과, 결제 등 중요 데이터
 //         - 관계형: 플레이어-매치 관계 등 복잡한 쿼리
 //         - libpq: C API (C++에서도 사용 가능)
 //         - RAII 패턴: unique_ptr + custom deleter로 연결 관리
+//
+// [LEARN] 쓰기 지연(write-behind):
+//         매치가 끝날 때마다 INSERT를 동기로 보내면 DB 왕복 시간이 게임 스레드에 그대로 얹힌다.
+//         대기열에 넣고 즉시 반환 → 전용 스레드가 모아서 트랜잭션 하나, 여러 행 INSERT 두 개로 기록.
 
 #include "pvpserver/storage/postgres_storage.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
 
 namespace pvpserver {
 
@@ -27,9 +34,19 @@ void PostgresStorage::ConnDeleter::operator()(PGconn* conn) const noexcept {
     }
 }
 
-PostgresStorage::PostgresStorage(std::string dsn) : dsn_(std::move(dsn)) {}
+namespace {
+constexpr const char* kSessionEventSql =
+    "INSERT INTO session_events(player_id, event_type, created_at) VALUES($1, $2, NOW())";
+}  // namespace
+
+PostgresStorage::PostgresStorage(std::string dsn)
+    : dsn_(std::move(dsn)), latency_(std::make_shared<QueryLatencyHistogram>()) {}
 
-PostgresStorage::~PostgresStorage() { Disconnect(); }
+PostgresStorage::~PostgresStorage() {
+    StopAsync();
+    StopWriteBehind();
+    Disconnect();
+}
 
 // [Order 2] Connect - 데이터베이스 연결
 // [LEARN] DSN(Data Source Name): "host=localhost dbname=game user=..." 형식
@@ -57,6 +74,9 @@ bool PostgresStorage::IsConnected() const noexcept { return connection_ != nullp
 //         - param_values: 바인딩할 값 배열
 //         - 쿼리 시간 측정 → 모니터링용
 bool PostgresStorage::RecordSessionEvent(const std::string& player_id, const std::string& event) {
+    if (pool_) {
+        return RecordSessionEventAsync(player_id, event);
+    }
     if (!connection_) {
         std::cerr << "postgres write skipped: no connection" << std::endl;
         return false;
@@ -70,32 +90,358 @@ bool PostgresStorage::RecordSessionEvent(const std::string& player_id, const std
     const int param_formats[2] = {0, 0};  // 0 = 텍스트 형식
 
     // PQexecParams: 파라미터화된 쿼리 실행
-    PGresult* result = PQexecParams(connection_.get(),
-                                    "INSERT INTO session_events(player_id, event_type, created_at)"
-                                    " VALUES($1, $2, NOW())",
-                                    2, nullptr, param_values, param_lengths, param_formats, 0);
+    PGresult* result = PQexecParams(connection_.get(), kSessionEventSql, 2, nullptr,
+                                    param_values, param_lengths, param_formats, 0);
     const auto finish = std::chrono::steady_clock::now();
     const double duration = std::chrono::duration<double>(finish - start).count();
     last_query_seconds_.store(duration, std::memory_order_relaxed);
-    
-    if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+
+    const bool ok = PQresultStatus(result) == PGRES_COMMAND_OK;
+    latency_->Observe("session_event", duration, ok);
+    if (!ok) {
         std::cerr << "postgres insert failed: " << PQerrorMessage(connection_.get());
-        PQclear(result);
-        return false;
     }
     PQclear(result);  // 결과 객체 해제 (필수!)
+    return ok;
+}
+
+// [Order 3-1] RecordSessionEventAsync - 풀에 맡기고 바로 반환
+// [LEARN] 지연 시간은 풀이 대기열 대기 + 실행을 합쳐 같은 히스토그램(query="session_event")에 기록.
+bool PostgresStorage::RecordSessionEventAsync(const std::string& player_id,
+                                              const std::string& event,
+                                              PostgresConnectionPool::Callback done) {
+    if (!pool_) {
+        return false;
+    }
+    return pool_->Execute("session_event", kSessionEventSql, {player_id, event}, std::move(done));
+}
+
+void PostgresStorage::StartAsync(boost::asio::io_context& io_context, PostgresPoolOptions options) {
+    if (pool_) {
+        return;
+    }
+    pool_ = std::make_shared<PostgresConnectionPool>(io_context, dsn_, options, latency_);
+    pool_->Start();
+}
+
+void PostgresStorage::StopAsync() {
+    if (pool_) {
+        pool_->Stop();
+    }
+}
+
+// [Order 4] StartWriteBehind - 작성 스레드 시작
+void PostgresStorage::StartWriteBehind(WriteBehindOptions options) {
+    std::lock_guard<std::mutex> lk(wb_mutex_);
+    if (wb_running_) {
+        return;
+    }
+    options.max_batch = std::max<std::size_t>(1, options.max_batch);
+    options.max_attempts = std::max(1, options.max_attempts);
+    wb_options_ = options;
+    wb_running_ = true;
+    wb_stopping_ = false;
+    wb_thread_ = std::thread([this] { WriteBehindLoop(); });
+}
+
+void PostgresStorage::StopWriteBehind() {
+    {
+        std::lock_guard<std::mutex> lk(wb_mutex_);
+        if (!wb_running_) {
+            return;
+        }
+        wb_stopping_ = true;
+    }
+    wb_cv_.notify_all();
+    if (wb_thread_.joinable()) {
+        wb_thread_.join();
+    }
+    std::lock_guard<std::mutex> lk(wb_mutex_);
+    wb_running_ = false;
+    wb_connection_.reset();
+}
+
+// [Order 5] EnqueueMatch - 대기열에 넣고 즉시 반환
+// [LEARN] 대기열 용량을 넘으면 기다리지 않고 버린다 (게임 스레드가 DB 장애에 끌려가지 않음).
+//         버린 개수는 postgres_write_behind_dropped_total로 드러남.
+bool PostgresStorage::EnqueueMatch(MatchResultRecord match, std::vector<ProfileRecord> profiles) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lk(wb_mutex_);
+        if (!wb_running_ || wb_stopping_ || wb_pending_.size() >= wb_options_.capacity) {
+            wb_dropped_total_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        wb_pending_.push_back(PendingMatch{std::move(match), std::move(profiles)});
+        wb_queue_depth_.store(wb_pending_.size(), std::memory_order_relaxed);
+        wake = wb_pending_.size() >= wb_options_.max_batch;
+    }
+    wb_enqueued_total_.fetch_add(1, std::memory_order_relaxed);
+    if (wake) {
+        wb_cv_.notify_one();
+    }
+    return true;
+}
+
+bool PostgresStorage::FlushWriteBehind(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lk(wb_mutex_);
+    wb_cv_.notify_one();  // flush_interval을 기다리지 않고 바로 기록
+    return wb_idle_cv_.wait_for(lk, timeout,
+                                [this] { return wb_pending_.empty() && wb_in_flight_ == 0; });
+}
+
+// [Order 6] WriteBehindLoop - 배치가 차거나 flush_interval이 지나면 기록
+void PostgresStorage::WriteBehindLoop() {
+    std::unique_lock<std::mutex> lk(wb_mutex_);
+    while (true) {
+        wb_cv_.wait_for(lk, wb_options_.flush_interval, [this] {
+            return wb_stopping_ || wb_pending_.size() >= wb_options_.max_batch;
+        });
+        if (wb_pending_.empty()) {
+            wb_idle_cv_.notify_all();
+            if (wb_stopping_) {
+                return;
+            }
+            continue;
+        }
+
+        const auto count = std::min(wb_options_.max_batch, wb_pending_.size());
+        std::vector<PendingMatch> batch;
+        batch.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            batch.push_back(std::move(wb_pending_.front()));
+            wb_pending_.pop_front();
+        }
+        wb_in_flight_ = batch.size();
+        wb_queue_depth_.store(wb_pending_.size(), std::memory_order_relaxed);
+
+        lk.unlock();
+        WriteWithRetry(batch);
+        lk.lock();
+        wb_in_flight_ = 0;
+        if (wb_pending_.empty()) {
+            wb_idle_cv_.notify_all();
+        }
+    }
+}
+
+// [Order 7] WriteWithRetry - 실패하면 지수 백오프로 재시도
+// [LEARN] 같은 배치를 다시 보내도 안전해야 재시도할 수 있다 (멱등성):
+//         - match_results: match_id 충돌 시 무시 (ON CONFLICT DO NOTHING)
+//         - player_profiles: 누적 매치 수가 같거나 많을 때만 덮어씀
+bool PostgresStorage::WriteWithRetry(const std::vector<PendingMatch>& batch) {
+    auto backoff = wb_options_.initial_backoff;
+    for (int attempt = 1; attempt <= wb_options_.max_attempts; ++attempt) {
+        if (!wb_connection_) {
+            PGconn* raw = PQconnectdb(dsn_.c_str());
+            if (PQstatus(raw) == CONNECTION_OK && EnsureSchema(raw)) {
+                wb_connection_.reset(raw);
+            } else {
+                std::cerr << "postgres write-behind connect failed: " << PQerrorMessage(raw);
+                PQfinish(raw);
+            }
+        }
+
+        if (wb_connection_) {
+            const auto start = std::chrono::steady_clock::now();
+            const bool written = WriteBatch(wb_connection_.get(), batch);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            latency_->Observe("write_behind_batch", std::chrono::duration<double>(elapsed).count(),
+                              written);
+            if (written) {
+                wb_last_batch_seconds_.store(std::chrono::duration<double>(elapsed).count(),
+                                             std::memory_order_relaxed);
+                wb_write_us_total_.fetch_add(
+                    static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()),
+                    std::memory_order_relaxed);
+                wb_batches_total_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            if (PQstatus(wb_connection_.get()) != CONNECTION_OK) {
+                wb_connection_.reset();  // 다음 시도에서 다시 연결
+            }
+        }
+
+        if (attempt == wb_options_.max_attempts) {
+            break;
+        }
+        wb_retries_total_.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock<std::mutex> lk(wb_mutex_);
+        // 종료 중이면 더 기다리지 않음 (남은 시도는 바로 진행)
+        wb_cv_.wait_for(lk, backoff, [this] { return wb_stopping_; });
+        backoff = std::min(backoff * 2, wb_options_.max_backoff);
+    }
+    wb_failed_batches_total_.fetch_add(1, std::memory_order_relaxed);
+    std::cerr << "postgres write-behind dropped batch of " << batch.size() << " matches"
+              << std::endl;
+    return false;
+}
+
+// [Order 8] WriteBatch - 트랜잭션 하나에 여러 행 INSERT 두 번
+bool PostgresStorage::WriteBatch(PGconn* conn, const std::vector<PendingMatch>& batch) {
+    // 같은 플레이어가 배치에 여러 번 나오면 가장 최근 값만 (한 INSERT가 같은 행을 두 번 갱신 불가)
+    std::vector<const ProfileRecord*> profiles;
+    std::unordered_map<std::string, std::size_t> profile_index;
+    for (const auto& pending : batch) {
+        for (const auto& profile : pending.profiles) {
+            const auto inserted = profile_index.emplace(profile.player_id, profiles.size());
+            if (inserted.second) {
+                profiles.push_back(&profile);
+            } else if (profiles[inserted.first->second]->matches <= profile.matches) {
+                profiles[inserted.first->second] = &profile;
+            }
+        }
+    }
+
+    std::vector<std::string> params;
+    std::ostringstream match_sql;
+    match_sql << "INSERT INTO match_results(match_id, winner_id, loser_id, placements, completed_at)"
+                 " VALUES ";
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        const auto& match = batch[i].match;
+        const auto base = params.size();
+        match_sql << (i ? "," : "") << "($" << base + 1 << ",$" << base + 2 << ",$" << base + 3
+                  << ",$" << base + 4 << ",to_timestamp($" << base + 5 << "::bigint / 1000.0))";
+        params.push_back(match.match_id);
+        params.push_back(match.winner_id);
+        params.push_back(match.loser_id);
+        params.push_back(match.placements);
+        params.push_back(std::to_string(match.completed_at_ms));
+    }
+    match_sql << " ON CONFLICT (match_id) DO NOTHING";
+
+    if (!Exec(conn, "BEGIN", {})) {
+        return false;
+    }
+    bool ok = Exec(conn, match_sql.str(), params);
+
+    // 바인딩 파라미터는 문장당 65535개까지 → 프로필 11열 기준 5000행씩 나눔
+    constexpr std::size_t kProfileRowsPerInsert = 5000;
+    for (std::size_t first = 0; ok && first < profiles.size(); first += kProfileRowsPerInsert) {
+        const auto last = std::min(profiles.size(), first + kProfileRowsPerInsert);
+        params.clear();
+        std::ostringstream profile_sql;
+        profile_sql << "INSERT INTO player_profiles(player_id, rating, matches, wins, losses, kills,"
+                       " deaths, shots_fired, hits_landed, damage_dealt, damage_taken, updated_at)"
+                       " VALUES ";
+        for (std::size_t i = first; i < last; ++i) {
+            const auto& profile = *profiles[i];
+            profile_sql << (i > first ? "," : "") << "(";
+            for (std::size_t column = 1; column <= 11; ++column) {
+                profile_sql << "$" << params.size() + column << ",";
+            }
+            profile_sql << "NOW())";
+            params.push_back(profile.player_id);
+            params.push_back(std::to_string(profile.rating));
+            params.push_back(std::to_string(profile.matches));
+            params.push_back(std::to_string(profile.wins));
+            params.push_back(std::to_string(profile.losses));
+            params.push_back(std::to_string(profile.kills));
+            params.push_back(std::to_string(profile.deaths));
+            params.push_back(std::to_string(profile.shots_fired));
+            params.push_back(std::to_string(profile.hits_landed));
+            params.push_back(std::to_string(profile.damage_dealt));
+            params.push_back(std::to_string(profile.damage_taken));
+        }
+        profile_sql << " ON CONFLICT (player_id) DO UPDATE SET rating = EXCLUDED.rating,"
+                       " matches = EXCLUDED.matches, wins = EXCLUDED.wins,"
+                       " losses = EXCLUDED.losses, kills = EXCLUDED.kills,"
+                       " deaths = EXCLUDED.deaths, shots_fired = EXCLUDED.shots_fired,"
+                       " hits_landed = EXCLUDED.hits_landed, damage_dealt = EXCLUDED.damage_dealt,"
+                       " damage_taken = EXCLUDED.damage_taken, updated_at = EXCLUDED.updated_at"
+                       " WHERE player_profiles.matches <= EXCLUDED.matches";
+        ok = Exec(conn, profile_sql.str(), params);
+    }
+
+    if (!ok) {
+        Exec(conn, "ROLLBACK", {});
+        return false;
+    }
+    if (!Exec(conn, "COMMIT", {})) {
+        return false;
+    }
+    wb_match_rows_total_.fetch_add(batch.size(), std::memory_order_relaxed);
+    wb_profile_rows_total_.fetch_add(profiles.size(), std::memory_order_relaxed);
     return true;
 }
 
-// [Order 4] MetricsSnapshot - Prometheus 메트릭 출력
+bool PostgresStorage::EnsureSchema(PGconn* conn) {
+    return Exec(conn,
+                "CREATE TABLE IF NOT EXISTS match_results("
+                " match_id TEXT PRIMARY KEY, winner_id TEXT NOT NULL, loser_id TEXT NOT NULL,"
+                " placements TEXT NOT NULL, completed_at TIMESTAMPTZ NOT NULL)",
+                {}) &&
+           Exec(conn,
+                "CREATE TABLE IF NOT EXISTS player_profiles("
+                " player_id TEXT PRIMARY KEY, rating INTEGER NOT NULL, matches BIGINT NOT NULL,"
+                " wins BIGINT NOT NULL, losses BIGINT NOT NULL, kills BIGINT NOT NULL,"
+                " deaths BIGINT NOT NULL, shots_fired BIGINT NOT NULL,"
+                " hits_landed BIGINT NOT NULL, damage_dealt BIGINT NOT NULL,"
+                " damage_taken BIGINT NOT NULL, updated_at TIMESTAMPTZ NOT NULL)",
+                {});
+}
+
+bool PostgresStorage::Exec(PGconn* conn, const std::string& sql,
+                           const std::vector<std::string>& params) {
+    std::vector<const char*> values;
+    values.reserve(params.size());
+    for (const auto& param : params) {
+        values.push_back(param.c_str());
+    }
+    PGresult* result = PQexecParams(conn, sql.c_str(), static_cast<int>(values.size()), nullptr,
+                                    values.empty() ? nullptr : values.data(), nullptr, nullptr, 0);
+    const bool ok = PQresultStatus(result) == PGRES_COMMAND_OK;
+    if (!ok) {
+        std::cerr << "postgres write-behind query failed: " << PQerrorMessage(conn);
+    }
+    PQclear(result);
+    return ok;
+}
+
+// [Order 9] MetricsSnapshot - Prometheus 메트릭 출력
 // [LEARN] Prometheus 텍스트 형식:
 //         # TYPE metric_name gauge
 //         metric_name value
 std::string PostgresStorage::MetricsSnapshot() const {
     std::ostringstream oss;
-    oss << "# TYPE database_query_duration_seconds gauge\n";
-    oss << "database_query_duration_seconds " << last_query_seconds_.load(std::memory_order_relaxed)
+    // 쿼리 종류별 히스토그램 (예전 마지막 값 게이지 대체)
+    oss << latency_->Snapshot("database_query_duration_seconds");
+    if (pool_) {
+        oss << pool_->MetricsSnapshot();
+    }
+
+    // write-behind 처리량: rate(postgres_write_behind_*_rows_total)로 초당 행 수
+    oss << "# TYPE postgres_write_behind_enqueued_total counter\n";
+    oss << "postgres_write_behind_enqueued_total "
+        << wb_enqueued_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_dropped_total counter\n";
+    oss << "postgres_write_behind_dropped_total "
+        << wb_dropped_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_queue_depth gauge\n";
+    oss << "postgres_write_behind_queue_depth " << wb_queue_depth_.load(std::memory_order_relaxed)
         << "\n";
+    oss << "# TYPE postgres_write_behind_batches_total counter\n";
+    oss << "postgres_write_behind_batches_total "
+        << wb_batches_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_failed_batches_total counter\n";
+    oss << "postgres_write_behind_failed_batches_total "
+        << wb_failed_batches_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_retries_total counter\n";
+    oss << "postgres_write_behind_retries_total "
+        << wb_retries_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_match_rows_total counter\n";
+    oss << "postgres_write_behind_match_rows_total "
+        << wb_match_rows_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_profile_rows_total counter\n";
+    oss << "postgres_write_behind_profile_rows_total "
+        << wb_profile_rows_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE postgres_write_behind_write_seconds_total counter\n";
+    oss << "postgres_write_behind_write_seconds_total "
+        << static_cast<double>(wb_write_us_total_.load(std::memory_order_relaxed)) / 1e6 << "\n";
+    oss << "# TYPE postgres_write_behind_last_batch_seconds gauge\n";
+    oss << "postgres_write_behind_last_batch_seconds "
+        << wb_last_batch_seconds_.load(std::memory_order_relaxed) << "\n";
     return oss.str();
 }
 
@@ -122,8 +468,17 @@ double PostgresStorage::LastQueryDurationSeconds() const noexcept {
 //    - memory_order_relaxed: 최소 동기화 (성능 우선)
 //
 // 4. 메트릭 수집
-//    - 쿼리 시간 측정 → 슬로우 쿼리 감지
-//    - Prometheus + Grafana로 시각화
+//    - 쿼리 종류별 지연 히스토그램 (session_event, write_behind_batch)
+//    - Prometheus + Grafana로 시각화, histogram_quantile로 p99
+//
+// 4-1. 비동기 모드 (StartAsync)
+//    - 세션 이벤트는 PostgresConnectionPool로 → io 스레드는 대기열에 넣고 바로 반환
+//    - 동기 경로(Connect + PQexecParams)는 풀 없이 쓰는 도구/테스트용으로 남김
+//
+// 5. 쓰기 지연 (write-behind)
+//    - 대기열(용량 제한) → 배치 → BEGIN / 여러 행 INSERT ×2 / COMMIT
+//    - 재시도는 지수 백오프, 멱등 UPSERT라 같은 배치를 다시 보내도 결과가 같음
+//    - 서버가 죽으면 대기열에 남은 매치는 잃는다 (메모리가 원본, DB는 사본)
 //
 // [v1.0.0] 데이터 계층 - PostgreSQL 영구 저장소
 // ========================================================================
@@ -0,0 +1,558 @@
+// [FILE]
+// - 목적: 연결 풀 + 슬롯 라우팅 Redis 클라이언트 (세션 저장소/서비스 디스커버리 공용)
+// - 주요 역할: 키 → 슬롯 → 노드 선택, MOVED/ASK 리다이렉트, 노드별 MULTI/EXEC 묶음 전송
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템 - 세션 스토어
+// - 권장 읽는 순서: KeySlot → Send → BatchAsync → RefreshSlots
+//
+// [LEARN] Redis Cluster는 키 공간을 16384개 슬롯으로 나누고 슬롯마다 담당 노드가 있다.
+//         클라이언트가 슬롯 표를 들고 있으면 바로 담당 노드로 보내고,
+//         표가 낡았으면 노드가 "MOVED 슬롯 새주소"로 알려 준다 (표 갱신 후 재전송).
+//         "ASK"는 슬롯 이전 중 임시 안내 → 표는 그대로, 그 명령만 ASKING과 함께 보냄.
+//
+// [LEARN] 세션 저장 = SET 세션 + SET 플레이어 매핑 + SADD 집합.
+//         명령마다 왕복하면 RTT × 3, 한 번의 write로 묶으면 RTT × 1.
+
+#include "pvpserver/storage/redis_cluster_client.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace pvpserver {
+namespace storage {
+
+namespace {
+
+// CRC16-CCITT (XMODEM): 다항식 0x1021, 초깃값 0 - Redis Cluster 규격
+constexpr std::array<std::uint16_t, 256> MakeCrc16Table() {
+    std::array<std::uint16_t, 256> table{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t crc = i << 8;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+        }
+        table[i] = static_cast<std::uint16_t>(crc & 0xFFFF);
+    }
+    return table;
+}
+
+constexpr auto kCrc16Table = MakeCrc16Table();
+
+std::pair<std::string, std::uint16_t> SplitAddress(const std::string& address) {
+    const auto colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        return {address, 6379};
+    }
+    return {address.substr(0, colon),
+            static_cast<std::uint16_t>(std::stoi(address.substr(colon + 1)))};
+}
+
+}  // namespace
+
+// [Order 1] KeySlot - {tag}가 있으면 tag만 해시 → 관련 키를 같은 슬롯에 모을 수 있음
+std::uint16_t RedisClusterClient::KeySlot(std::string_view key) noexcept {
+    const auto open = key.find('{');
+    if (open != std::string_view::npos) {
+        const auto close = key.find('}', open + 1);
+        if (close != std::string_view::npos && close != open + 1) {
+            key = key.substr(open + 1, close - open - 1);
+        }
+    }
+    std::uint16_t crc = 0;
+    for (const char c : key) {
+        crc = static_cast<std::uint16_t>((crc << 8) ^
+                                         kCrc16Table[((crc >> 8) ^ static_cast<std::uint8_t>(c)) &
+                                                     0xFF]);
+    }
+    return static_cast<std::uint16_t>(crc % kSlots);
+}
+
+std::uint16_t RedisClusterClient::CommandSlot(const std::vector<std::string>& args) noexcept {
+    return args.size() > 1 ? KeySlot(args[1]) : 0;
+}
+
+// "MOVED 3999 127.0.0.1:6381" / "ASK 3999 127.0.0.1:6381"
+std::optional<RedisClusterClient::Redirect> RedisClusterClient::ParseRedirect(
+    const RespValue& reply) {
+    if (!reply.IsError()) {
+        return std::nullopt;
+    }
+    Redirect redirect;
+    std::istringstream iss(reply.text);
+    std::string kind;
+    int slot = -1;
+    iss >> kind >> slot >> redirect.address;
+    if ((kind != "MOVED" && kind != "ASK") || slot < 0 ||
+        slot >= static_cast<int>(kSlots) || redirect.address.empty()) {
+        return std::nullopt;
+    }
+    redirect.ask = kind == "ASK";
+    redirect.slot = static_cast<std::uint16_t>(slot);
+    return redirect;
+}
+
+// [Order 2] 생성자 - 설정된 노드마다 연결 풀, io 스레드 하나, 슬롯 표 요청
+RedisClusterClient::RedisClusterClient(const RedisConfig& config)
+    : config_(config),
+      work_guard_(std::make_unique<
+                  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+          io_context_.get_executor())) {
+    client_config_.password = config_.password;
+    client_config_.command_timeout_ms = config_.command_timeout_ms;
+    client_config_.connect_timeout_ms = config_.connection_timeout_ms;
+    if (config_.cluster_nodes.empty()) {
+        config_.cluster_nodes.push_back("127.0.0.1:6379");
+    }
+    for (const auto& address : config_.cluster_nodes) {
+        NodeForAddress(address);
+    }
+    // 노드를 여러 개 지정했으면 클러스터로 가정 (CLUSTER SLOTS 응답으로 확정)
+    cluster_enabled_.store(nodes_.size() > 1);
+    io_thread_ = std::thread([this]() { io_context_.run(); });
+    RefreshSlots();
+}
+
+// io 스레드를 멈춘 뒤 연결 정리 (각 RedisClient가 남은 요청을 실패 처리)
+RedisClusterClient::~RedisClusterClient() {
+    work_guard_.reset();
+    io_context_.stop();
+    if (io_thread_.joinable()) {
+        io_thread_.join();
+    }
+    std::vector<std::unique_ptr<Node>> nodes;
+    {
+        std::unique_lock<std::shared_mutex> lock(topology_mutex_);
+        nodes.swap(nodes_);
+    }
+    nodes.clear();  // 실패 핸들러가 잠금을 다시 잡을 수 있으므로 잠금 밖에서
+    std::unique_ptr<RedisClient> subscriber;
+    {
+        std::lock_guard<std::mutex> lock(subscriber_mutex_);
+        subscriber.swap(subscriber_);
+    }
+}
+
+std::size_t RedisClusterClient::NodeForSlot(std::uint16_t slot) const {
+    std::shared_lock<std::shared_mutex> lock(topology_mutex_);
+    return slot_owner_[slot];
+}
+
+std::size_t RedisClusterClient::NodeForAddress(const std::string& address) {
+    {
+        std::shared_lock<std::shared_mutex> lock(topology_mutex_);
+        for (std::size_t i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i]->address == address) {
+                return i;
+            }
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(topology_mutex_);
+    for (std::size_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i]->address == address) {
+            return i;
+        }
+    }
+    auto node = std::make_unique<Node>();
+    node->address = address;
+    RedisClientConfig client_config = client_config_;
+    std::tie(client_config.host, client_config.port) = SplitAddress(address);
+    const int pool_size = std::max(1, config_.connection_pool_size);
+    for (int i = 0; i < pool_size; ++i) {
+        node->connections.push_back(std::make_unique<RedisClient>(client_config, io_context_));
+    }
+    nodes_.push_back(std::move(node));
+    return nodes_.size() - 1;
+}
+
+// 라운드 로빈: 연결마다 요청이 몰리면 그 연결의 파이프라인이 길어질 뿐, 순서는 연결 안에서만 보장
+RedisClient& RedisClusterClient::Pick(std::size_t node) {
+    std::shared_lock<std::shared_mutex> lock(topology_mutex_);
+    Node& target = *nodes_[node];
+    const auto index = target.next.fetch_add(1, std::memory_order_relaxed);
+    return *target.connections[index % target.connections.size()];
+}
+
+// [Order 3] Send - 명령 하나 전송, MOVED/ASK면 다른 노드로 재전송 (최대 kMaxRedirects)
+// [LEARN] 리다이렉트 응답은 명령이 실행되지 않았다는 뜻이므로 재전송해도 중복 실행이 없다.
+void RedisClusterClient::Send(std::size_t node, std::vector<std::string> args,
+                              ReplyHandler handler, int redirects, bool asking) {
+    RedisClient& client = Pick(node);
+    auto on_reply = [this, args, handler = std::move(handler), redirects](
+                        std::optional<RespValue> reply, const std::string& error) mutable {
+        if (reply && redirects < kMaxRedirects) {
+            if (auto redirect = ParseRedirect(*reply)) {
+                const auto target = NodeForAddress(redirect->address);
+                if (redirect->ask) {
+                    ask_total_.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    moved_total_.fetch_add(1, std::memory_order_relaxed);
+                    {
+                        std::unique_lock<std::shared_mutex> lock(topology_mutex_);
+                        slot_owner_[redirect->slot] = static_cast<std::uint16_t>(target);
+                    }
+                    cluster_enabled_.store(true);
+                    RefreshSlots();  // 한 슬롯이 옮겨졌으면 다른 슬롯도 옮겨졌을 가능성이 큼
+                }
+                Send(target, std::move(args), std::move(handler), redirects + 1, redirect->ask);
+                return;
+            }
+        }
+        handler(std::move(reply), error);
+    };
+    if (!asking) {
+        client.ExecuteAsync(std::move(args), std::move(on_reply));
+        return;
+    }
+    // ASKING은 바로 다음 명령 하나에만 적용 → 같은 연결에 붙여서 전송
+    client.PipelineAsync({{"ASKING"}, args},
+                         [on_reply = std::move(on_reply)](
+                             std::optional<std::vector<RespValue>> replies,
+                             const std::string& error) mutable {
+                             if (!replies) {
+                                 on_reply(std::nullopt, error);
+                                 return;
+                             }
+                             on_reply(std::move(replies->back()), "");
+                         });
+}
+
+void RedisClusterClient::ExecuteAsync(std::vector<std::string> args, ReplyHandler handler) {
+    commands_total_.fetch_add(1, std::memory_order_relaxed);
+    const auto node = NodeForSlot(CommandSlot(args));
+    Send(node, std::move(args), std::move(handler), 0, false);
+}
+
+std::future<RespValue> RedisClusterClient::ExecuteAsync(std::vector<std::string> args) {
+    auto promise = std::make_shared<std::promise<RespValue>>();
+    auto future = promise->get_future();
+    ExecuteAsync(std::move(args),
+                 [promise](std::optional<RespValue> reply, const std::string& error) {
+                     if (reply) {
+                         promise->set_value(std::move(*reply));
+                     } else {
+                         promise->set_exception(
+                             std::make_exception_ptr(std::runtime_error(error)));
+                     }
+                 });
+    return future;
+}
+
+// [Order 4] BatchAsync - 노드별로 나눠 각각 한 번의 write
+// [LEARN] MULTI ... EXEC: 사이의 명령은 큐에 쌓였다가 EXEC 때 한꺼번에 실행 (중간에 다른 클라이언트 명령 없음).
+//         클러스터에서는 한 트랜잭션의 키가 모두 같은 슬롯이어야 하므로 (CROSSSLOT 오류)
+//         슬롯이 섞인 묶음은 트랜잭션 없이 파이프라인으로만 보낸다.
+void RedisClusterClient::BatchAsync(std::vector<std::vector<std::string>> commands,
+                                    BatchHandler handler) {
+    batches_total_.fetch_add(1, std::memory_order_relaxed);
+    commands_total_.fetch_add(commands.size(), std::memory_order_relaxed);
+    if (commands.empty()) {
+        handler(std::vector<RespValue>{}, "");
+        return;
+    }
+
+    struct State {
+        std::vector<std::vector<std::string>> commands;
+        std::vector<RespValue> replies;
+        BatchHandler handler;
+        std::atomic<std::size_t> pending{0};
+        std::atomic<bool> failed{false};
+    };
+    auto state = std::make_shared<State>();
+    state->replies.resize(commands.size());
+    state->handler = std::move(handler);
+
+    // 노드별 묶기 (노드 수는 보통 몇 개 → 선형 탐색)
+    struct Group {
+        std::size_t node;
+        std::vector<std::size_t> indices;
+        bool same_slot{true};
+        std::uint16_t slot{0};
+    };
+    std::vector<Group> groups;
+    for (std::size_t i = 0; i < commands.size(); ++i) {
+        const auto slot = CommandSlot(commands[i]);
+        const auto node = NodeForSlot(slot);
+        auto it = std::find_if(groups.begin(), groups.end(),
+                               [node](const Group& group) { return group.node == node; });
+        if (it == groups.end()) {
+            groups.push_back(Group{node, {}, true, slot});
+            it = groups.end() - 1;
+        }
+        it->same_slot = it->same_slot && it->slot == slot;
+        it->indices.push_back(i);
+    }
+    state->commands = std::move(commands);
+    state->pending.store(groups.size());
+
+    const auto finish_one = [state]() {
+        if (state->pending.fetch_sub(1) == 1 && !state->failed.load()) {
+            state->handler(std::move(state->replies), "");
+        }
+    };
+    const auto fail = [state](const std::string& error) {
+        if (!state->failed.exchange(true)) {
+            state->handler(std::nullopt, error);
+        }
+    };
+    // 리다이렉트/트랜잭션 실패 시 명령 하나씩 Send로 (리다이렉트를 따라감)
+    const auto resend = [this, state, finish_one, fail](std::size_t index) {
+        const auto node = NodeForSlot(CommandSlot(state->commands[index]));
+        Send(node, state->commands[index],
+             [state, index, finish_one, fail](std::optional<RespValue> reply,
+                                              const std::string& error) {
+                 if (!reply) {
+                     fail(error);
+                     return;
+                 }
+                 state->replies[index] = std::move(*reply);
+                 finish_one();
+             },
+             0, false);
+    };
+
+    const bool cluster = cluster_enabled_.load();
+    for (auto& group : groups) {
+        const bool transaction = group.indices.size() > 1 && (!cluster || group.same_slot);
+        std::vector<std::vector<std::string>> pipeline;
+        pipeline.reserve(group.indices.size() + 2);
+        if (transaction) {
+            transactions_total_.fetch_add(1, std::memory_order_relaxed);
+            pipeline.push_back({"MULTI"});
+        }
+        for (const auto index : group.indices) {
+            pipeline.push_back(state->commands[index]);
+        }
+        if (transaction) {
+            pipeline.push_back({"EXEC"});
+        }
+        Pick(group.node).PipelineAsync(
+            std::move(pipeline),
+            [state, indices = std::move(group.indices), transaction, finish_one, fail, resend](
+                std::optional<std::vector<RespValue>> replies, const std::string& error) {
+                if (!replies) {
+                    fail(error);
+                    return;
+                }
+                std::vector<std::size_t> redirected;
+                if (transaction) {
+                    auto& exec = replies->back();
+                    if (exec.type == RespValue::Type::Array &&
+                        exec.elements.size() == indices.size()) {
+                        for (std::size_t k = 0; k < indices.size(); ++k) {
+                            state->replies[indices[k]] = std::move(exec.elements[k]);
+                        }
+                    } else {
+                        // EXECABORT (큐에 넣다가 MOVED 등) → 원자성을 포기하고 하나씩 재전송
+                        redirected = indices;
+                    }
+                } else {
+                    for (std::size_t k = 0; k < indices.size(); ++k) {
+                        if (ParseRedirect((*replies)[k])) {
+                            redirected.push_back(indices[k]);
+                        } else {
+                            state->replies[indices[k]] = std::move((*replies)[k]);
+                        }
+                    }
+                }
+                state->pending.fetch_add(redirected.size());
+                for (const auto index : redirected) {
+                    resend(index);
+                }
+                finish_one();
+            });
+    }
+}
+
+std::optional<RespValue> RedisClusterClient::Execute(std::vector<std::string> args) {
+    auto future = ExecuteAsync(std::move(args));
+    if (future.wait_for(std::chrono::milliseconds(config_.command_timeout_ms)) !=
+        std::future_status::ready) {
+        return std::nullopt;
+    }
+    try {
+        return future.get();
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::vector<RespValue>> RedisClusterClient::Batch(
+    std::vector<std::vector<std::string>> commands) {
+    auto promise = std::make_shared<std::promise<std::optional<std::vector<RespValue>>>>();
+    auto future = promise->get_future();
+    BatchAsync(std::move(commands),
+               [promise](std::optional<std::vector<RespValue>> replies, const std::string&) {
+                   promise->set_value(std::move(replies));
+               });
+    if (future.wait_for(std::chrono::milliseconds(config_.command_timeout_ms)) !=
+        std::future_status::ready) {
+        return std::nullopt;
+    }
+    return future.get();
+}
+
+bool RedisClusterClient::Ping() {
+    auto reply = Execute({"PING"});
+    return reply && !reply->IsError() && reply->text == "PONG";
+}
+
+// [Order 5] RefreshSlots - CLUSTER SLOTS로 슬롯 표 전체 갱신 (동시에 하나만)
+// - 단일 Redis는 오류 응답 → 클러스터 아님 (모든 슬롯 = 첫 노드, 트랜잭션 자유)
+void RedisClusterClient::RefreshSlots() {
+    if (refreshing_.exchange(true)) {
+        return;
+    }
+    Pick(0).ExecuteAsync({"CLUSTER", "SLOTS"}, [this](std::optional<RespValue> reply,
+                                                      const std::string&) {
+        if (reply) {
+            if (reply->IsError()) {
+                cluster_enabled_.store(false);
+            } else if (reply->type == RespValue::Type::Array) {
+                ApplySlots(*reply);
+            }
+        }
+        refreshing_.store(false);
+    });
+}
+
+// [[start, end, [host, port, id], 복제본...], ...]
+void RedisClusterClient::ApplySlots(const RespValue& reply) {
+    std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> ranges;
+    for (const auto& range : reply.elements) {
+        if (range.elements.size() < 3 || range.elements[2].elements.size() < 2) {
+            continue;
+        }
+        const auto& master = range.elements[2];
+        std::string host = master.elements[0].text;
+        if (host.empty()) {
+            host = SplitAddress(config_.cluster_nodes.front()).first;  // 자기 주소를 모르는 노드
+        }
+        const auto node = NodeForAddress(host + ":" + std::to_string(master.elements[1].integer));
+        const auto start = static_cast<std::size_t>(range.elements[0].integer);
+        const auto end = static_cast<std::size_t>(range.elements[1].integer);
+        if (start <= end && end < kSlots) {
+            ranges.emplace_back(start, end, node);
+        }
+    }
+    if (ranges.empty()) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(topology_mutex_);
+    for (const auto& [start, end, node] : ranges) {
+        for (std::size_t slot = start; slot <= end; ++slot) {
+            slot_owner_[slot] = static_cast<std::uint16_t>(node);
+        }
+    }
+    cluster_enabled_.store(true);
+}
+
+std::size_t RedisClusterClient::NodeCount() const {
+    std::shared_lock<std::shared_mutex> lock(topology_mutex_);
+    return nodes_.size();
+}
+
+// [Order 6] Pub/Sub - 발행은 풀 연결로 (fire-and-forget), 구독은 전용 연결
+void RedisClusterClient::Publish(const std::string& channel, const std::string& message) {
+    published_total_.fetch_add(1, std::memory_order_relaxed);
+    ExecuteAsync({"PUBLISH", channel, message}, [](std::optional<RespValue>, const std::string&) {});
+}
+
+void RedisClusterClient::Subscribe(const std::string& channel, MessageHandler handler) {
+    std::lock_guard<std::mutex> lock(subscriber_mutex_);
+    channel_handlers_[channel].push_back(std::move(handler));
+    if (!subscriber_) {
+        RedisClientConfig client_config = client_config_;
+        client_config.use_resp3 = true;  // RESP3: 구독 중에도 push와 응답이 구분됨
+        std::tie(client_config.host, client_config.port) =
+            SplitAddress(config_.cluster_nodes.front());
+        subscriber_ = std::make_unique<RedisClient>(client_config, io_context_);
+    }
+    subscriber_->Subscribe({channel}, [this](const RespValue& push) { DispatchMessage(push); });
+}
+
+// push ["message", channel, payload]만 전달 (구독 확인 등은 무시)
+void RedisClusterClient::DispatchMessage(const RespValue& push) {
+    if (push.elements.size() < 3 || push.elements[0].text != "message") {
+        return;
+    }
+    received_total_.fetch_add(1, std::memory_order_relaxed);
+    std::vector<MessageHandler> handlers;
+    {
+        std::lock_guard<std::mutex> lock(subscriber_mutex_);
+        const auto it = channel_handlers_.find(push.elements[1].text);
+        if (it == channel_handlers_.end()) {
+            return;
+        }
+        handlers = it->second;
+    }
+    for (const auto& handler : handlers) {
+        handler(push.elements[2].text);
+    }
+}
+
+std::string RedisClusterClient::MetricsSnapshot() const {
+    std::size_t connections = 0;
+    std::size_t connected = 0;
+    std::size_t nodes = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(topology_mutex_);
+        nodes = nodes_.size();
+        for (const auto& node : nodes_) {
+            connections += node->connections.size();
+            for (const auto& connection : node->connections) {
+                connected += connection->IsConnected() ? 1 : 0;
+            }
+        }
+    }
+    std::ostringstream oss;
+    oss << "# TYPE redis_cluster_commands_total counter\n";
+    oss << "redis_cluster_commands_total " << commands_total_.load(std::memory_order_relaxed)
+        << "\n";
+    oss << "# TYPE redis_cluster_batches_total counter\n";
+    oss << "redis_cluster_batches_total " << batches_total_.load(std::memory_order_relaxed)
+        << "\n";
+    oss << "# TYPE redis_cluster_transactions_total counter\n";
+    oss << "redis_cluster_transactions_total "
+        << transactions_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE redis_cluster_redirects_total counter\n";
+    oss << "redis_cluster_redirects_total{type=\"moved\"} "
+        << moved_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "redis_cluster_redirects_total{type=\"ask\"} "
+        << ask_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE redis_cluster_pubsub_messages_total counter\n";
+    oss << "redis_cluster_pubsub_messages_total{direction=\"published\"} "
+        << published_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "redis_cluster_pubsub_messages_total{direction=\"received\"} "
+        << received_total_.load(std::memory_order_relaxed) << "\n";
+    oss << "# TYPE redis_cluster_nodes gauge\n";
+    oss << "redis_cluster_nodes " << nodes << "\n";
+    oss << "# TYPE redis_cluster_connections gauge\n";
+    oss << "redis_cluster_connections{state=\"open\"} " << connected << "\n";
+    oss << "redis_cluster_connections{state=\"pooled\"} " << connections << "\n";
+    return oss.str();
+}
+
+}  // namespace storage
+}  // namespace pvpserver
+
+// [Reader Notes]
+// ================================================================================
+// 1. 연결 풀
+//    - 노드당 connection_pool_size개 연결, 모두 io 스레드 하나에서 동작 (RedisClient 외부 context)
+//    - 연결마다 파이프라인이 따로 → Redis 쪽에서 여러 연결의 명령을 번갈아 처리
+//
+// 2. 슬롯 라우팅
+//    - 시작 시 CLUSTER SLOTS, 이후 MOVED를 받을 때마다 해당 슬롯 갱신 + 전체 재조회
+//    - ASK는 일시적 → 표를 바꾸지 않고 ASKING + 명령만 새 노드로
+//
+// 3. 묶음 전송 (BatchAsync)
+//    - 노드별로 한 번의 write, 같은 슬롯(또는 단일 Redis)이면 MULTI/EXEC로 원자적 실행
+//    - 트랜잭션이 리다이렉트로 중단되면 명령별 재전송 (토폴로지 변경 중에만 발생)
+//
+// 4. Pub/Sub
+//    - 구독 연결은 명령 응답 대신 push만 받으므로 풀과 분리된 전용 연결 (RESP3)
+//    - 전달 보장 없음 (끊긴 동안의 메시지는 유실) → 받는 쪽은 TTL 같은 안전망을 함께 둘 것
+// ================================================================================
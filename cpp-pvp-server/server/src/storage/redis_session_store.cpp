@@ -10,86 +10,17 @@
 //         - 분산: 여러 서버가 동일 세션 접근
 //         - 데이터 구조: String, Set, Hash 등 다양한 타입
 //
-// 이 구현은 스텁(stub)입니다. 실제로는 redis-plus-plus 라이브러리 필요.
+// 외부 라이브러리 없이 RedisClusterClient(RESP over Boost.Asio) 위에서 동작
 
 #include "pvpserver/storage/redis_session_store.h"
 
-// Note: 이 구현은 redis-plus-plus 또는 hiredis 라이브러리가 필요합니다.
-// 현재는 스텁 구현으로, 실제 Redis 연동은 의존성 추가 후 구현됩니다.
-
 namespace pvpserver {
 namespace storage {
 
-// [Order 1] RedisClusterClient 스텁
-// [LEARN] 실제 구현 시 redis-plus-plus 사용:
-//         #include <sw/redis++/redis++.h>
-//         auto redis = sw::redis::RedisCluster("redis://127.0.0.1:6379");
-class RedisClusterClient {
-public:
-    explicit RedisClusterClient(const RedisConfig& /*config*/) {}
-    ~RedisClusterClient() = default;
-
-    // SET key value EX ttl
-    bool set(const std::string& /*key*/, const std::string& /*value*/,
-             int /*ttl_seconds*/) {
-        return true;
-    }
-
-    // GET key
-    std::optional<std::string> get(const std::string& /*key*/) {
-        return std::nullopt;
-    }
-
-    // DEL key
-    bool del(const std::string& /*key*/) {
-        return true;
-    }
-
-    // EXPIRE key seconds
-    bool expire(const std::string& /*key*/, int /*seconds*/) {
-        return true;
-    }
-
-    // EXISTS key
-    bool exists(const std::string& /*key*/) {
-        return false;
-    }
-
-    // SCAN 0 MATCH pattern
-    std::vector<std::string> scan(const std::string& /*pattern*/) {
-        return {};
-    }
-
-    // SADD key member (Set에 추가)
-    bool sadd(const std::string& /*key*/, const std::string& /*member*/) {
-        return true;
-    }
-
-    // SREM key member (Set에서 제거)
-    bool srem(const std::string& /*key*/, const std::string& /*member*/) {
-        return true;
-    }
-
-    // SMEMBERS key (Set 전체 조회)
-    std::vector<std::string> smembers(const std::string& /*key*/) {
-        return {};
-    }
-
-    // SCARD key (Set 크기)
-    size_t scard(const std::string& /*key*/) {
-        return 0;
-    }
-
-    // PING - 연결 확인
-    bool ping() {
-        return true;
-    }
-};
-
-// [Order 2] RedisSessionStore 생성자
+// [Order 1] 생성자 - 연결 풀 + 슬롯 라우팅 클라이언트 (RedisClusterClient)
 RedisSessionStore::RedisSessionStore(const RedisConfig& config)
     : config_(config)
-    , client_(std::make_unique<RedisClusterClient>(config)) {}
+    , client_(std::make_shared<RedisClusterClient>(config)) {}
 
 RedisSessionStore::~RedisSessionStore() = default;
 
@@ -102,96 +33,164 @@ std::string RedisSessionStore::MakePlayerSessionKey(const std::string& player_id
     return std::string(PLAYER_SESSION_PREFIX) + player_id;  // "player_session:" + id
 }
 
-// [Order 3] SaveSession - 세션 저장
+// [Order 2] SaveSession - 세션 저장
 // [LEARN] 여러 키를 함께 저장:
-//         - session:{id} → 세션 데이터 (JSON)
+//         - session:{id} → 세션 데이터 (바이너리, 이전 값은 JSON일 수 있음)
 //         - player_session:{player_id} → session_id (역방향 조회용)
 //         - sessions (Set) → 활성 세션 ID 집합
+//         세 명령을 한 번에 보냄 (단일 Redis면 MULTI/EXEC로 원자적)
+std::vector<std::vector<std::string>> RedisSessionStore::MakeSaveCommands(
+    const std::string& session_id, const SessionData& data) const {
+    const std::string ttl = std::to_string(config_.session_ttl_seconds);
+    return {
+        {"SET", MakeSessionKey(session_id), data.Serialize(), "EX", ttl},  // TTL로 자동 만료
+        {"SET", MakePlayerSessionKey(data.player_id), session_id, "EX", ttl},
+        {"SADD", SESSION_SET_KEY, session_id},
+    };
+}
+
 bool RedisSessionStore::SaveSession(const std::string& session_id,
                                     const SessionData& data) {
     if (!client_) return false;
 
-    std::string key = MakeSessionKey(session_id);
-    std::string value = data.Serialize();  // JSON 직렬화
-
-    // TTL 설정으로 자동 만료
-    bool success = client_->set(key, value, config_.session_ttl_seconds);
-    if (success) {
-        // player_id → session_id 매핑 저장 (플레이어로 세션 찾기용)
-        client_->set(MakePlayerSessionKey(data.player_id),
-                    session_id, config_.session_ttl_seconds);
-        // 세션 집합에 추가 (활성 세션 목록 관리)
-        client_->sadd(SESSION_SET_KEY, session_id);
+    auto replies = client_->Batch(MakeSaveCommands(session_id, data));
+    return replies && !replies->front().IsError();
+}
+
+void RedisSessionStore::SaveSessionAsync(const std::string& session_id,
+                                         const SessionData& data,
+                                         std::function<void(bool ok)> done) {
+    if (!client_) {
+        done(false);
+        return;
     }
-    return success;
+    client_->BatchAsync(MakeSaveCommands(session_id, data),
+                        [done = std::move(done)](std::optional<std::vector<RespValue>> replies,
+                                                 const std::string&) {
+                            done(replies && !replies->front().IsError());
+                        });
 }
 
-// [Order 4] GetSession - 세션 조회
+// [Order 3] GetSession - 세션 조회
 std::optional<SessionData> RedisSessionStore::GetSession(
     const std::string& session_id) {
     if (!client_) return std::nullopt;
 
-    std::string key = MakeSessionKey(session_id);
-    auto value = client_->get(key);
+    auto reply = client_->Execute({"GET", MakeSessionKey(session_id)});
+    if (!reply || reply->type != RespValue::Type::BulkString) return std::nullopt;
 
-    if (!value) return std::nullopt;
+    return SessionData::Deserialize(reply->text);
+}
 
-    return SessionData::Deserialize(*value);
+void RedisSessionStore::GetSessionAsync(
+    const std::string& session_id,
+    std::function<void(std::optional<SessionData>)> done) {
+    if (!client_) {
+        done(std::nullopt);
+        return;
+    }
+    client_->ExecuteAsync({"GET", MakeSessionKey(session_id)},
+                          [done = std::move(done)](std::optional<RespValue> reply,
+                                                   const std::string&) {
+                              if (!reply || reply->type != RespValue::Type::BulkString) {
+                                  done(std::nullopt);
+                                  return;
+                              }
+                              done(SessionData::Deserialize(reply->text));
+                          });
 }
 
 bool RedisSessionStore::DeleteSession(const std::string& session_id) {
     if (!client_) return false;
 
     // 먼저 세션 데이터를 가져와서 player_id 확인
-    auto session = GetSession(session_id);
-    if (session) {
-        client_->del(MakePlayerSessionKey(session->player_id));
+    // [LEARN] player_id만 필요 → 바이너리 값은 뷰로 읽어 나머지 필드 복사를 생략
+    std::vector<std::vector<std::string>> commands;
+    auto value = client_->Execute({"GET", MakeSessionKey(session_id)});
+    if (value && value->type == RespValue::Type::BulkString) {
+        if (auto view = SessionDataView::Parse(value->text)) {
+            commands.push_back({"DEL", MakePlayerSessionKey(std::string(view->player_id))});
+        } else if (auto legacy = SessionData::Deserialize(value->text)) {
+            commands.push_back({"DEL", MakePlayerSessionKey(legacy->player_id)});
+        }
     }
+    commands.push_back({"SREM", SESSION_SET_KEY, session_id});
+    commands.push_back({"DEL", MakeSessionKey(session_id)});
 
-    client_->srem(SESSION_SET_KEY, session_id);
-    return client_->del(MakeSessionKey(session_id));
+    auto replies = client_->Batch(std::move(commands));
+    return replies && replies->back().integer > 0;
 }
 
 bool RedisSessionStore::RefreshSession(const std::string& session_id) {
     if (!client_) return false;
 
-    std::string key = MakeSessionKey(session_id);
-    return client_->expire(key, config_.session_ttl_seconds);
+    auto reply = client_->Execute(
+        {"EXPIRE", MakeSessionKey(session_id), std::to_string(config_.session_ttl_seconds)});
+    return reply && reply->integer == 1;
 }
 
 std::vector<std::string> RedisSessionStore::GetAllSessionIds() {
     if (!client_) return {};
 
-    return client_->smembers(SESSION_SET_KEY);
+    std::vector<std::string> ids;
+    auto reply = client_->Execute({"SMEMBERS", SESSION_SET_KEY});
+    if (reply) {
+        for (auto& element : reply->elements) {
+            ids.push_back(std::move(element.text));
+        }
+    }
+    return ids;
 }
 
 std::optional<std::string> RedisSessionStore::GetSessionByPlayerId(
     const std::string& player_id) {
     if (!client_) return std::nullopt;
 
-    return client_->get(MakePlayerSessionKey(player_id));
+    auto reply = client_->Execute({"GET", MakePlayerSessionKey(player_id)});
+    if (!reply || reply->type != RespValue::Type::BulkString) return std::nullopt;
+    return std::move(reply->text);
 }
 
 size_t RedisSessionStore::GetActiveSessionCount() {
     if (!client_) return 0;
 
-    return client_->scard(SESSION_SET_KEY);
+    auto reply = client_->Execute({"SCARD", SESSION_SET_KEY});
+    return reply ? static_cast<size_t>(reply->integer) : 0;
 }
 
 bool RedisSessionStore::SessionExists(const std::string& session_id) {
     if (!client_) return false;
 
-    return client_->exists(MakeSessionKey(session_id));
+    auto reply = client_->Execute({"EXISTS", MakeSessionKey(session_id)});
+    return reply && reply->integer > 0;
 }
 
 bool RedisSessionStore::IsConnected() const {
     if (!client_) return false;
 
-    return client_->ping();
+    return client_->Ping();
 }
 
 void RedisSessionStore::Reconnect() {
-    client_ = std::make_unique<RedisClusterClient>(config_);
+    client_ = std::make_shared<RedisClusterClient>(config_);
+}
+
+std::string RedisSessionStore::MetricsSnapshot() const {
+    return client_ ? client_->MetricsSnapshot() : std::string{};
+}
+
+// [Order 4] 무효화 채널 - 발행은 fire-and-forget, 수신 핸들러는 Redis io 스레드에서 호출
+RedisSessionInvalidationBus::RedisSessionInvalidationBus(std::shared_ptr<RedisClusterClient> client,
+                                                         std::string channel)
+    : client_(std::move(client))
+    , channel_(std::move(channel)) {}
+
+void RedisSessionInvalidationBus::Publish(const std::string& message) {
+    client_->Publish(channel_, message);
+}
+
+void RedisSessionInvalidationBus::Subscribe(Handler handler) {
+    client_->Subscribe(channel_, std::move(handler));
 }
 
 }  // namespace storage
@@ -1,8 +1,8 @@
 // [FILE]
 // - 목적: 세션 데이터 및 기본 직렬화
-// - 주요 역할: SessionData 구조체 정의, JSON 직렬화/역직렬화
+// - 주요 역할: SessionData 구조체 정의, 바이너리 직렬화/역직렬화 (이전 JSON 읽기 지원)
 // - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템 - 세션 관리
-// - 권장 읽는 순서: SessionData → Serialize → Deserialize
+// - 권장 읽는 순서: SessionData → Serialize → Deserialize → SessionDataView::Parse
 //
 // [LEARN] 세션 데이터:
 //         - player_id: 고유 식별자
@@ -16,6 +16,7 @@
 #include "pvpserver/storage/session_store.h"
 
 #include <chrono>
+#include <cstdint>
 #include <random>
 #include <sstream>
 #include <iomanip>
@@ -23,29 +24,62 @@
 namespace pvpserver {
 namespace storage {
 
-// [Order 1] Serialize - JSON 형식 직렬화
-// [LEARN] 간단한 JSON 생성. 실제로는 nlohmann/json 권장:
-//         json j = {{"player_id", player_id}, {"elo_rating", elo_rating}};
-//         return j.dump();
-std::string SessionData::Serialize() const {
-    std::ostringstream oss;
-    oss << "{";
-    oss << "\"player_id\":\"" << player_id << "\",";
-    oss << "\"player_name\":\"" << player_name << "\",";
-    oss << "\"server_id\":\"" << server_id << "\",";
-    oss << "\"created_at\":" << created_at << ",";
-    oss << "\"last_activity\":" << last_activity << ",";
-    oss << "\"elo_rating\":" << elo_rating << ",";
-    oss << "\"match_id\":\"" << match_id << "\"";
-    oss << "}";
-    return oss.str();
+namespace {
+
+// [LEARN] varint: 7비트씩 끊어 쓰고 최상위 비트로 "다음 바이트 있음" 표시
+//         ELO 1500 → 2바이트, 길이 12 → 1바이트 (고정 8바이트 대비)
+//         zigzag: 음수를 작은 양수로 (-1 → 1, 1 → 2) 바꿔 varint가 짧아지게
+void PutVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+std::uint64_t ZigZag(int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(std::uint64_t value) {
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
 }
 
-// [Order 2] Deserialize - JSON 역직렬화
-// [LEARN] 문자열에서 값 추출. 실제로는:
-//         auto j = json::parse(data);
-//         session.player_id = j["player_id"];
-std::optional<SessionData> SessionData::Deserialize(const std::string& data) {
+void PutString(std::string& out, const std::string& value) {
+    PutVarint(out, value.size());
+    out.append(value);
+}
+
+// 읽기 커서: 범위를 벗어나면 false (예외 없음)
+struct Reader {
+    std::string_view data;
+    std::size_t offset{0};
+
+    bool Varint(std::uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && offset < data.size(); shift += 7) {
+            const auto byte = static_cast<std::uint8_t>(data[offset++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool String(std::string_view& value) {
+        std::uint64_t length = 0;
+        if (!Varint(length) || length > data.size() - offset) {
+            return false;
+        }
+        value = data.substr(offset, static_cast<std::size_t>(length));
+        offset += static_cast<std::size_t>(length);
+        return true;
+    }
+};
+
+// 이전 JSON 형식 파서 (마이그레이션 기간에 Redis에 남아 있는 값)
+std::optional<SessionData> DeserializeJson(std::string_view data) {
     // 간단한 JSON 파싱 (실제로는 nlohmann/json 등 사용 권장)
     SessionData session;
 
@@ -53,37 +87,23 @@ std::optional<SessionData> SessionData::Deserialize(const std::string& data) {
     auto extract_string = [&data](const std::string& key) -> std::string {
         std::string search = "\"" + key + "\":\"";
         auto pos = data.find(search);
-        if (pos == std::string::npos) return "";
+        if (pos == std::string_view::npos) return "";
         pos += search.length();
-        auto end = data.find("\"", pos);
-        if (end == std::string::npos) return "";
-        return data.substr(pos, end - pos);
+        auto end = data.find('"', pos);
+        if (end == std::string_view::npos) return "";
+        return std::string(data.substr(pos, end - pos));
     };
 
     // 정수 값 추출 헬퍼
     auto extract_int64 = [&data](const std::string& key) -> int64_t {
         std::string search = "\"" + key + "\":";
         auto pos = data.find(search);
-        if (pos == std::string::npos) return 0;
-        pos += search.length();
-        auto end = data.find_first_of(",}", pos);
-        if (end == std::string::npos) return 0;
-        try {
-            return std::stoll(data.substr(pos, end - pos));
-        } catch (...) {
-            return 0;
-        }
-    };
-
-    auto extract_int = [&data](const std::string& key) -> int {
-        std::string search = "\"" + key + "\":";
-        auto pos = data.find(search);
-        if (pos == std::string::npos) return 0;
+        if (pos == std::string_view::npos) return 0;
         pos += search.length();
         auto end = data.find_first_of(",}", pos);
-        if (end == std::string::npos) return 0;
+        if (end == std::string_view::npos) return 0;
         try {
-            return std::stoi(data.substr(pos, end - pos));
+            return std::stoll(std::string(data.substr(pos, end - pos)));
         } catch (...) {
             return 0;
         }
@@ -95,7 +115,7 @@ std::optional<SessionData> SessionData::Deserialize(const std::string& data) {
     session.server_id = extract_string("server_id");
     session.created_at = extract_int64("created_at");
     session.last_activity = extract_int64("last_activity");
-    session.elo_rating = extract_int("elo_rating");
+    session.elo_rating = static_cast<int>(extract_int64("elo_rating"));
     session.match_id = extract_string("match_id");
 
     // 필수 필드 검증
@@ -106,6 +126,104 @@ std::optional<SessionData> SessionData::Deserialize(const std::string& data) {
     return session;
 }
 
+}  // namespace
+
+// [Order 1] Serialize - 바이너리 직렬화
+// [LEARN] JSON 대비: 키 이름/따옴표/숫자 문자열이 없어 크기가 절반 이하,
+//         읽을 때도 문자열 검색(find) 없이 앞에서부터 한 번만 훑음
+std::string SessionData::Serialize() const {
+    std::string out;
+    SerializeTo(out);
+    return out;
+}
+
+void SessionData::SerializeTo(std::string& out) const {
+    out.reserve(out.size() + 2 + player_id.size() + player_name.size() + server_id.size() +
+                match_id.size() + 4 * 5 + 3 * 10);
+    out.push_back(static_cast<char>(SessionDataView::kMagic));
+    out.push_back(static_cast<char>(SessionDataView::kVersion));
+    PutString(out, player_id);
+    PutString(out, player_name);
+    PutString(out, server_id);
+    PutVarint(out, ZigZag(created_at));
+    // last_activity는 created_at과의 차이로 (보통 몇 바이트)
+    PutVarint(out, ZigZag(static_cast<int64_t>(static_cast<std::uint64_t>(last_activity) -
+                                               static_cast<std::uint64_t>(created_at))));
+    PutVarint(out, ZigZag(elo_rating));
+    PutString(out, match_id);
+}
+
+std::string SessionData::SerializeJson() const {
+    std::ostringstream oss;
+    oss << "{";
+    oss << "\"player_id\":\"" << player_id << "\",";
+    oss << "\"player_name\":\"" << player_name << "\",";
+    oss << "\"server_id\":\"" << server_id << "\",";
+    oss << "\"created_at\":" << created_at << ",";
+    oss << "\"last_activity\":" << last_activity << ",";
+    oss << "\"elo_rating\":" << elo_rating << ",";
+    oss << "\"match_id\":\"" << match_id << "\"";
+    oss << "}";
+    return oss.str();
+}
+
+// [Order 2] Deserialize - 첫 바이트로 형식 구분
+// [LEARN] JSON은 항상 '{'로 시작, 바이너리는 0xB5 → 배포 중 두 형식이 섞여도 읽힘.
+//         새로 저장(SaveSession)되는 순간 바이너리로 바뀌므로 별도 변환 작업이 필요 없다.
+std::optional<SessionData> SessionData::Deserialize(std::string_view data) {
+    if (SessionDataView::IsBinary(data)) {
+        auto view = SessionDataView::Parse(data);
+        if (!view) {
+            return std::nullopt;
+        }
+        return view->ToSessionData();
+    }
+    return DeserializeJson(data);
+}
+
+bool SessionDataView::IsBinary(std::string_view data) noexcept {
+    return !data.empty() && static_cast<std::uint8_t>(data[0]) == kMagic;
+}
+
+// [Order 3] SessionDataView::Parse - 복사 없는 파싱
+// [LEARN] 버전은 앞으로 필드를 뒤에 덧붙이는 방식으로만 올림
+//         → 상위 버전 값도 아는 필드까지 읽고 나머지는 무시
+std::optional<SessionDataView> SessionDataView::Parse(std::string_view data) {
+    if (data.size() < 2 || !IsBinary(data) || static_cast<std::uint8_t>(data[1]) < 1) {
+        return std::nullopt;
+    }
+    Reader reader{data, 2};
+    SessionDataView view;
+    std::uint64_t created = 0;
+    std::uint64_t activity_delta = 0;
+    std::uint64_t elo = 0;
+    if (!reader.String(view.player_id) || !reader.String(view.player_name) ||
+        !reader.String(view.server_id) || !reader.Varint(created) ||
+        !reader.Varint(activity_delta) || !reader.Varint(elo) || !reader.String(view.match_id)) {
+        return std::nullopt;
+    }
+    if (view.player_id.empty()) {
+        return std::nullopt;  // 필수 필드 (JSON 경로와 같은 규칙)
+    }
+    view.created_at = UnZigZag(created);
+    view.last_activity = static_cast<int64_t>(static_cast<std::uint64_t>(view.created_at) +
+                                              static_cast<std::uint64_t>(UnZigZag(activity_delta)));
+    view.elo_rating = static_cast<int>(UnZigZag(elo));
+    return view;
+}
+
+SessionData SessionDataView::ToSessionData() const {
+    SessionData session;
+    session.player_id = std::string(player_id);
+    session.player_name = std::string(player_name);
+    session.server_id = std::string(server_id);
+    session.created_at = created_at;
+    session.last_activity = last_activity;
+    session.elo_rating = elo_rating;
+    session.match_id = std::string(match_id);
+    return session;
+}
+
 void SessionData::Touch() {
     last_activity = GetCurrentTimestamp();
 }
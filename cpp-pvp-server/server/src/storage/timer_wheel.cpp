@@ -0,0 +1,143 @@
+// [FILE]
+// - 목적: 계층형 타이밍 휠 (세션 만료 예약)
+// - 주요 역할: O(1) 등록/재등록/취소, 만료된 것만 꺼내는 진행(Advance)
+// - 관련 클론 가이드 단계: [CG-02.00] 분산 시스템 - 세션 관리
+// - 권장 읽는 순서: Link → Advance → Cascade
+//
+// [LEARN] 왜 휠인가:
+//         "만료된 세션 찾기"를 전체 스캔으로 하면 세션 50만 개면 매번 50만 번 비교.
+//         만료 시각별 버킷(슬롯)에 미리 넣어 두면 지금 틱의 슬롯만 보면 된다.
+//         먼 미래는 상위 레벨의 굵은 슬롯에 넣었다가, 가까워지면 아래 레벨로 내려보낸다(cascade).
+//         리눅스 커널 타이머와 같은 구조.
+
+#include "pvpserver/storage/timer_wheel.h"
+
+namespace pvpserver {
+namespace storage {
+
+namespace {
+constexpr std::uint64_t kSlotMask = TimerWheel::kSlots - 1;
+
+constexpr std::uint64_t LevelSpan(int level) {
+    return std::uint64_t{1} << (TimerWheel::kSlotBits * (level + 1));
+}
+}  // namespace
+
+TimerWheel::TimerWheel(std::uint64_t start_tick) : current_tick_(start_tick) {
+    for (auto& level : slots_) {
+        for (auto& head : level) {
+            head.prev = &head;
+            head.next = &head;
+        }
+    }
+}
+
+// [Order 1] Link - 남은 틱 수로 레벨 결정, 만료 틱의 해당 자리로 슬롯 결정
+// [LEARN] 남은 틱 < 64 → 레벨 0 (틱 단위 슬롯)
+//         남은 틱 < 64² → 레벨 1 (64틱 단위 슬롯) ...
+//         표현 범위를 넘으면 레벨 3 끝에 넣어 두고 내려올 때 다시 판단
+void TimerWheel::Link(Node& node) {
+    std::uint64_t tick = node.expiry_tick < current_tick_ ? current_tick_ : node.expiry_tick;
+    int level = 0;
+    while (level < kLevels && tick - current_tick_ >= LevelSpan(level)) {
+        ++level;
+    }
+    if (level == kLevels) {
+        level = kLevels - 1;
+        tick = current_tick_ + LevelSpan(level) - 1;
+    }
+    Node& head = slots_[level][(tick >> (kSlotBits * level)) & kSlotMask];
+    node.prev = head.prev;
+    node.next = &head;
+    head.prev->next = &node;
+    head.prev = &node;
+}
+
+void TimerWheel::Unlink(Node& node) {
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = nullptr;
+    node.next = nullptr;
+}
+
+void TimerWheel::Schedule(Node& node, std::uint64_t expiry_tick) {
+    if (node.scheduled) {
+        Unlink(node);
+    } else {
+        node.scheduled = true;
+        ++size_;
+    }
+    node.expiry_tick = expiry_tick;
+    Link(node);
+}
+
+void TimerWheel::Cancel(Node& node) {
+    if (!node.scheduled) {
+        return;
+    }
+    Unlink(node);
+    node.scheduled = false;
+    --size_;
+}
+
+TimerWheel::Node* TimerWheel::Detach(Node& head) {
+    if (head.next == &head) {
+        return nullptr;
+    }
+    Node* first = head.next;
+    head.prev->next = nullptr;
+    head.prev = &head;
+    head.next = &head;
+    return first;
+}
+
+// [Order 2] Cascade - 상위 레벨 슬롯 하나를 통째로 다시 배치 (대부분 한 단계 아래로)
+void TimerWheel::Cascade(int level, std::size_t slot) {
+    for (Node* node = Detach(slots_[level][slot]); node;) {
+        Node* next = node->next;
+        Link(*node);
+        node = next;
+    }
+}
+
+// [Order 3] Advance - 지나간 틱마다 (필요하면 cascade 후) 레벨 0 슬롯 하나 처리
+std::size_t TimerWheel::Advance(std::uint64_t now_tick,
+                                const std::function<void(Node&)>& on_expire) {
+    std::size_t expired = 0;
+    while (current_tick_ <= now_tick) {
+        if (size_ == 0) {
+            current_tick_ = now_tick + 1;  // 빈 휠은 틱을 하나씩 돌 필요 없음
+            break;
+        }
+        const std::size_t index = current_tick_ & kSlotMask;
+        if (index == 0) {
+            // 64틱 경계: 레벨 1의 다음 슬롯을 내려보냄 (그 자리도 0이면 레벨 2도 …)
+            for (int level = 1; level < kLevels; ++level) {
+                const std::size_t slot = (current_tick_ >> (kSlotBits * level)) & kSlotMask;
+                Cascade(level, slot);
+                if (slot != 0) {
+                    break;
+                }
+            }
+        }
+        for (Node* node = Detach(slots_[0][index]); node;) {
+            Node* next = node->next;
+            if (node->expiry_tick <= current_tick_) {
+                node->prev = nullptr;
+                node->next = nullptr;
+                node->scheduled = false;
+                --size_;
+                ++expired;
+                on_expire(*node);  // 여기서 노드가 해제될 수 있음 → 이후 접근 금지
+            } else {
+                Link(*node);  // 범위 밖이라 끝자리에 있던 노드
+            }
+            node = next;
+        }
+        ++current_tick_;
+    }
+    return expired;
+}
+
+}  // namespace storage
+}  // namespace pvpserver
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/distributed/gossip_membership.h"
+#include "pvpserver/distributed/load_balancer.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using pvpserver::distributed::GossipMembership;
+using pvpserver::distributed::GossipOptions;
+using pvpserver::distributed::LoadBalancer;
+using pvpserver::distributed::MemberState;
+using pvpserver::distributed::ServerInfo;
+
+struct Node {
+    std::shared_ptr<LoadBalancer> balancer = std::make_shared<LoadBalancer>();
+    std::unique_ptr<GossipMembership> gossip;
+    std::string id;
+};
+
+GossipOptions FastOptions() {
+    GossipOptions options;
+    options.protocol_period = 100ms;
+    options.ack_timeout = 40ms;
+    options.suspicion_periods = 4;
+    return options;
+}
+
+// 루프백에 노드 count개, 0번이 시드
+std::vector<Node> StartCluster(int count) {
+    std::vector<Node> nodes(count);
+    for (int i = 0; i < count; ++i) {
+        auto& node = nodes[i];
+        node.id = "game-" + std::to_string(i);
+        node.gossip = std::make_unique<GossipMembership>(FastOptions(), node.balancer);
+        ServerInfo self;
+        self.server_id = node.id;
+        self.host = "10.0.0." + std::to_string(i);
+        self.udp_port = 7000 + i;
+        node.gossip->Register(self);
+    }
+    const auto seed = "127.0.0.1:" + std::to_string(nodes[0].gossip->Port());
+    for (int i = 1; i < count; ++i) {
+        nodes[i].gossip->Join({seed});
+    }
+    return nodes;
+}
+
+bool WaitUntil(const std::function<bool()>& condition, std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(10ms);
+    }
+    return condition();
+}
+
+bool AllSee(const std::vector<Node>& nodes, std::size_t alive) {
+    for (const auto& node : nodes) {
+        if (node.gossip->GetAvailableServers().size() != alive) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(GossipMembershipTest, JoinConvergesAndPiggybacksLoad) {
+    auto nodes = StartCluster(4);
+    ASSERT_TRUE(WaitUntil([&] { return AllSee(nodes, 4); }, 3s));
+    for (const auto& node : nodes) {
+        EXPECT_EQ(4u, node.balancer->GetAllServers().size());
+    }
+    EXPECT_EQ("10.0.0.2", nodes[1].gossip->GetServer("game-2")->host);
+
+    ServerInfo load;
+    load.server_id = "game-2";
+    load.host = "10.0.0.2";
+    load.udp_port = 7002;
+    load.current_connections = 77;
+    load.tick_p99_ms = 9.5;
+    load.cpu_utilization = 0.4;
+    nodes[2].gossip->UpdateServerInfo(load);
+
+    // 가십으로 다른 노드의 로드 밸런서까지 도달
+    ASSERT_TRUE(WaitUntil(
+        [&] {
+            for (const auto& node : nodes) {
+                const auto server = node.balancer->GetServer("game-2");
+                if (!server || server->current_connections != 77) {
+                    return false;
+                }
+            }
+            return true;
+        },
+        3s));
+    EXPECT_NEAR(9.5, nodes[0].balancer->GetServer("game-2")->tick_p99_ms, 1e-3);
+    EXPECT_NE(std::string::npos,
+              nodes[0].gossip->MetricsSnapshot().find("gossip_members{state=\"alive\"} 3"));
+}
+
+TEST(GossipMembershipTest, CrashedNodeIsDetectedWithinOneSecond) {
+    auto nodes = StartCluster(4);
+    ASSERT_TRUE(WaitUntil([&] { return AllSee(nodes, 4); }, 3s));
+
+    const auto crashed_at = std::chrono::steady_clock::now();
+    nodes[3].gossip->Stop();  // LEFT 알림 없이 중지
+
+    ASSERT_TRUE(WaitUntil(
+        [&] {
+            for (int i = 0; i < 3; ++i) {
+                if (nodes[i].gossip->GetState("game-3") != MemberState::DEAD) {
+                    return false;
+                }
+            }
+            return true;
+        },
+        3s));
+    const auto detected =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                              crashed_at);
+    // 주기 100ms × (한 바퀴 3 + 의심 4) + 전파 여유
+    EXPECT_LT(detected.count(), 1500);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto server = nodes[i].balancer->GetServer("game-3");
+        ASSERT_TRUE(server.has_value());
+        EXPECT_FALSE(server->healthy);
+        EXPECT_EQ(3u, nodes[i].gossip->GetAvailableServers().size());
+    }
+    // 나머지는 서로 의심하지 않음
+    EXPECT_EQ(MemberState::ALIVE, nodes[0].gossip->GetState("game-1"));
+}
+
+TEST(GossipMembershipTest, GracefulLeaveUnregistersFromBalancers) {
+    auto nodes = StartCluster(3);
+    ASSERT_TRUE(WaitUntil([&] { return AllSee(nodes, 3); }, 3s));
+
+    std::vector<std::string> removed;
+    std::mutex removed_mutex;
+    nodes[0].gossip->OnServerRemoved([&](const std::string& id) {
+        std::lock_guard<std::mutex> lock(removed_mutex);
+        removed.push_back(id);
+    });
+
+    nodes[2].gossip->Unregister();
+    ASSERT_TRUE(WaitUntil(
+        [&] {
+            return !nodes[0].balancer->GetServer("game-2").has_value() &&
+                   !nodes[1].balancer->GetServer("game-2").has_value();
+        },
+        500ms));
+    EXPECT_EQ(MemberState::LEFT, nodes[0].gossip->GetState("game-2"));
+    std::lock_guard<std::mutex> lock(removed_mutex);
+    EXPECT_EQ(std::vector<std::string>{"game-2"}, removed);
+}
+
+TEST(GossipMembershipTest, MalformedDatagramsAreCountedAndIgnored) {
+    auto nodes = StartCluster(2);
+    ASSERT_TRUE(WaitUntil([&] { return AllSee(nodes, 2); }, 3s));
+
+    boost::asio::io_context io;
+    boost::asio::ip::udp::socket socket(io, boost::asio::ip::udp::v4());
+    const boost::asio::ip::udp::endpoint target(boost::asio::ip::make_address("127.0.0.1"),
+                                                nodes[0].gossip->Port());
+    const std::vector<std::uint8_t> garbage = {0x53, 0x57, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x09};
+    socket.send_to(boost::asio::buffer(garbage), target);
+    socket.send_to(boost::asio::buffer(std::string("hello")), target);
+
+    EXPECT_TRUE(WaitUntil(
+        [&] {
+            return nodes[0].gossip->MetricsSnapshot().find("gossip_decode_errors_total 2") !=
+                   std::string::npos;
+        },
+        1s));
+    EXPECT_EQ(2u, nodes[0].gossip->GetAvailableServers().size());
+}
+
+TEST(GossipMembershipTest, AdvertisesReachableAddressWhenBoundToAnyAddress) {
+    auto nodes = StartCluster(1);
+    Node advertised;
+    advertised.id = "game-advertised";
+    auto options = FastOptions();
+    options.bind_address = "0.0.0.0";
+    options.advertise_host = "127.0.0.1";
+    advertised.gossip = std::make_unique<GossipMembership>(options, advertised.balancer);
+    ServerInfo self;
+    self.server_id = advertised.id;
+    self.host = "10.0.0.50";
+    advertised.gossip->Register(self);
+
+    Node fallback;
+    fallback.id = "game-fallback";
+    options.advertise_host.clear();
+    fallback.gossip = std::make_unique<GossipMembership>(options, fallback.balancer);
+    self.server_id = fallback.id;
+    self.host = "10.0.0.51";
+    fallback.gossip->Register(self);
+
+    const auto seed = "127.0.0.1:" + std::to_string(nodes[0].gossip->Port());
+    advertised.gossip->Join({seed});
+    fallback.gossip->Join({seed});
+    ASSERT_TRUE(WaitUntil([&] { return nodes[0].gossip->GetAvailableServers().size() == 3; }, 3s));
+
+    // 0.0.0.0 대신 advertise_host, 없으면 게임 주소를 알림
+    for (const auto& member : nodes[0].gossip->Members()) {
+        if (member.info.server_id == "game-advertised") {
+            EXPECT_EQ("127.0.0.1", member.gossip_host);
+        } else if (member.info.server_id == "game-fallback") {
+            EXPECT_EQ("10.0.0.51", member.gossip_host);
+        }
+    }
+}
+
+TEST(GossipMembershipTest, SyncOfLargeRecordsFitsInDatagrams) {
+    // 긴 ID/리전으로 레코드 하나가 ~400바이트 → 개수 기준 분할이면 1500바이트를 넘음
+    std::vector<Node> nodes(10);
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        auto& node = nodes[i];
+        node.id = "game-" + std::to_string(i) + "-" + std::string(180, 'x');
+        node.gossip = std::make_unique<GossipMembership>(FastOptions(), node.balancer);
+        ServerInfo self;
+        self.server_id = node.id;
+        self.host = "10.0.0." + std::to_string(i);
+        self.region = std::string(180, 'r');
+        node.gossip->Register(self);
+    }
+    const auto seed = "127.0.0.1:" + std::to_string(nodes[0].gossip->Port());
+    for (std::size_t i = 1; i + 1 < nodes.size(); ++i) {
+        nodes[i].gossip->Join({seed});
+    }
+    ASSERT_TRUE(WaitUntil([&] { return nodes[0].gossip->GetAvailableServers().size() == 9; }, 3s));
+
+    // 늦게 가입한 노드는 시드의 SYNC 패킷 여러 개로 전체 목록을 받음
+    auto& late = nodes.back();
+    late.gossip->Join({seed});
+    ASSERT_TRUE(WaitUntil([&] { return late.gossip->GetAvailableServers().size() == 10; }, 3s));
+    EXPECT_NE(std::string::npos,
+              late.gossip->MetricsSnapshot().find("gossip_decode_errors_total 0"));
+    EXPECT_NE(std::string::npos,
+              nodes[0].gossip->MetricsSnapshot().find("gossip_decode_errors_total 0"));
+}
@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/core/game_loop.h"
+#include "pvpserver/distributed/inter_node_service.h"
+#include "pvpserver/distributed/rpc.h"
+#include "pvpserver/game/game_session.h"
+#include "pvpserver/network/packet_types.h"
+#include "pvpserver/network/udp_game_server.h"
+#include "pvpserver/storage/in_memory_session_store.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using pvpserver::distributed::InterNodeClient;
+using pvpserver::distributed::InterNodeMethods;
+using pvpserver::distributed::InterNodeService;
+using pvpserver::distributed::LoadBalancer;
+using pvpserver::distributed::MigrationTarget;
+using pvpserver::distributed::RpcClient;
+using pvpserver::distributed::RpcCode;
+using pvpserver::distributed::RpcServer;
+using pvpserver::distributed::RpcServerOptions;
+using pvpserver::distributed::RpcStatus;
+using pvpserver::distributed::ServerInfo;
+
+// 요청 본문 = 잠들 ms (문자열), 응답 = 같은 문자열
+RpcServer::RawHandler SleepEcho() {
+    return [](const std::string& request, std::string& response) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::stoi(request)));
+        response = request;
+        return RpcStatus::Ok();
+    };
+}
+
+std::unique_ptr<RpcServer> StartEchoServer(std::size_t workers) {
+    RpcServerOptions options;
+    options.worker_threads = workers;
+    auto server = std::make_unique<RpcServer>(options);
+    server->RegisterMethod("Test/Sleep", SleepEcho());
+    server->Start();
+    return server;
+}
+
+// 노드 하나의 RPC 면: 세션 저장소 + 로드 밸런서 + InterNode 서비스
+struct RpcNode {
+    explicit RpcNode(std::string id,
+                     pvpserver::distributed::MatchMigrationReceiver::ImportHandler handler = nullptr)
+        : sessions(std::make_shared<pvpserver::storage::InMemorySessionStore>()),
+          balancer(std::make_shared<LoadBalancer>(
+              pvpserver::distributed::LoadBalanceStrategy::LEAST_CONNECTIONS)),
+          service(id, sessions, balancer, std::move(handler)) {
+        service.Register(server);
+        server.Start();
+        info.server_id = std::move(id);
+        info.host = "127.0.0.1";
+        info.grpc_port = server.Port();
+    }
+
+    std::shared_ptr<pvpserver::storage::InMemorySessionStore> sessions;
+    std::shared_ptr<LoadBalancer> balancer;
+    InterNodeService service;
+    RpcServer server;
+    ServerInfo info;
+};
+
+}  // namespace
+
+TEST(InterNodeRpcTest, ConcurrentCallsMultiplexOnOneConnection) {
+    auto server = StartEchoServer(4);
+    RpcClient client;
+
+    // 느린 호출이 먼저 가도 빠른 호출의 응답이 먼저 옴 (연결 하나, 순서 무관)
+    std::promise<std::string> slow_done;
+    std::promise<std::string> fast_done;
+    const auto start = std::chrono::steady_clock::now();
+    client.CallAsync("127.0.0.1", server->Port(), "Test/Sleep", "150", 1s,
+                     [&](const RpcStatus& status, std::string response) {
+                         EXPECT_TRUE(status.ok()) << status.message;
+                         slow_done.set_value(response);
+                     });
+    client.CallAsync("127.0.0.1", server->Port(), "Test/Sleep", "10", 1s,
+                     [&](const RpcStatus& status, std::string response) {
+                         EXPECT_TRUE(status.ok()) << status.message;
+                         fast_done.set_value(response);
+                     });
+    auto fast = fast_done.get_future();
+    auto slow = slow_done.get_future();
+    ASSERT_EQ(std::future_status::ready, fast.wait_for(1s));
+    EXPECT_EQ(std::future_status::timeout, slow.wait_for(0ms));
+    EXPECT_EQ("10", fast.get());
+    EXPECT_EQ("150", slow.get());
+
+    // 4개 동시 호출: 직렬이면 400ms, 다중화면 ~100ms
+    std::vector<std::future<RpcStatus>> calls;
+    const auto batch_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 4; ++i) {
+        calls.push_back(std::async(std::launch::async, [&] {
+            std::string response;
+            return client.Call("127.0.0.1", server->Port(), "Test/Sleep", "100", response, 1s);
+        }));
+    }
+    for (auto& call : calls) {
+        EXPECT_TRUE(call.get().ok());
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - batch_start, 300ms);
+    EXPECT_GT(std::chrono::steady_clock::now() - start, 150ms);
+
+    EXPECT_EQ(1u, client.ConnectionCount());
+    const auto metrics = client.MetricsSnapshot();
+    EXPECT_NE(std::string::npos, metrics.find("rpc_client_connects_total 1\n"));
+    EXPECT_NE(std::string::npos,
+              metrics.find("rpc_client_requests_total{method=\"Test/Sleep\",code=\"OK\"} 6"));
+    EXPECT_NE(std::string::npos,
+              metrics.find("rpc_client_latency_seconds_count{method=\"Test/Sleep\"} 6"));
+    EXPECT_NE(std::string::npos, server->MetricsSnapshot().find(
+                                     "rpc_server_latency_seconds_bucket{method=\"Test/Sleep\",le=\"+Inf\"} 6"));
+}
+
+TEST(InterNodeRpcTest, DeadlineExceededLeavesConnectionUsable) {
+    auto server = StartEchoServer(2);
+    RpcClient client;
+
+    std::string response;
+    const auto start = std::chrono::steady_clock::now();
+    const RpcStatus late = client.Call("127.0.0.1", server->Port(), "Test/Sleep", "300", response, 50ms);
+    EXPECT_EQ(RpcCode::DEADLINE_EXCEEDED, late.code);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 250ms);
+
+    // 늦은 응답은 버려지고 같은 연결로 다음 호출이 정상 처리됨
+    const RpcStatus ok = client.Call("127.0.0.1", server->Port(), "Test/Sleep", "1", response, 1s);
+    EXPECT_TRUE(ok.ok()) << ok.message;
+    EXPECT_EQ("1", response);
+    std::this_thread::sleep_for(300ms);
+    EXPECT_TRUE(client.Call("127.0.0.1", server->Port(), "Test/Sleep", "1", response, 1s).ok());
+    EXPECT_NE(std::string::npos, client.MetricsSnapshot().find("rpc_client_connects_total 1\n"));
+    EXPECT_NE(std::string::npos,
+              client.MetricsSnapshot().find(
+                  "rpc_client_requests_total{method=\"Test/Sleep\",code=\"DEADLINE_EXCEEDED\"} 1"));
+}
+
+TEST(InterNodeRpcTest, UnknownMethodAndUnreachablePeerReportStatus) {
+    auto server = StartEchoServer(1);
+    RpcClient client;
+    std::string response;
+
+    EXPECT_EQ(RpcCode::UNIMPLEMENTED,
+              client.Call("127.0.0.1", server->Port(), "Test/Missing", "", response, 1s).code);
+
+    // 상대가 내려가면 UNAVAILABLE (기한까지 기다리지 않음), 이후 호출은 재연결 시도
+    const std::uint16_t port = server->Port();
+    server->Stop();
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(RpcCode::UNAVAILABLE, client.Call("127.0.0.1", port, "Test/Sleep", "1", response, 2s).code);
+    EXPECT_EQ(RpcCode::UNAVAILABLE, client.Call("127.0.0.1", port, "Test/Sleep", "1", response, 2s).code);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+    EXPECT_EQ(0u, client.ConnectionCount());
+}
+
+TEST(InterNodeRpcTest, NodesLookUpSessionsAndReportLoadAcrossLoopback) {
+    RpcNode a("node-a");
+    RpcNode b("node-b");
+    RpcNode c("node-c");
+    auto rpc = std::make_shared<RpcClient>();
+    InterNodeClient from_a(rpc, "node-a");
+
+    pvpserver::storage::SessionData session;
+    session.player_id = "alice";
+    session.player_name = "Alice";
+    session.server_id = "node-b";
+    session.created_at = 1000;
+    session.last_activity = 2000;
+    session.elo_rating = 1500;
+    session.match_id = "room-7";
+    b.sessions->SaveSession("s-1", session);
+
+    std::optional<pvpserver::storage::SessionData> found;
+    ASSERT_TRUE(from_a.LookupSession(b.info, "s-1", found).ok());
+    ASSERT_TRUE(found);
+    EXPECT_EQ("alice", found->player_id);
+    EXPECT_EQ(1500, found->elo_rating);
+    EXPECT_EQ("room-7", found->match_id);
+    EXPECT_EQ(RpcCode::NOT_FOUND, from_a.LookupSession(c.info, "s-1", found).code);
+    EXPECT_FALSE(found);
+
+    // b, c가 a에 부하 보고 → a의 밸런서가 둘을 알고 적은 쪽을 고름
+    InterNodeClient from_b(rpc, "node-b");
+    InterNodeClient from_c(rpc, "node-c");
+    b.info.current_connections = 50;
+    c.info.current_connections = 10;
+    ASSERT_TRUE(from_b.ReportLoad(a.info, b.info).ok());
+    ASSERT_TRUE(from_c.ReportLoad(a.info, c.info).ok());
+    ASSERT_EQ(2u, a.balancer->GetAllServers().size());
+    EXPECT_EQ("node-c", a.balancer->SelectServer("p")->server_id);
+    EXPECT_EQ(c.server.Port(), a.balancer->GetServer("node-c")->grpc_port);
+
+    c.info.current_connections = 90;
+    c.info.tick_p99_ms = 12.0;
+    ASSERT_TRUE(from_c.ReportLoad(a.info, c.info).ok());
+    EXPECT_EQ(90, a.balancer->GetServer("node-c")->current_connections);
+    EXPECT_EQ("node-b", a.balancer->SelectServer("p")->server_id);
+
+    // 세 노드 사이 호출이 상대 노드마다 연결 하나로 처리됨
+    EXPECT_EQ(3u, rpc->ConnectionCount());
+    EXPECT_NE(std::string::npos,
+              a.server.MetricsSnapshot().find(
+                  "rpc_server_requests_total{method=\"InterNode/ReportLoad\",code=\"OK\"} 3"));
+    EXPECT_NE(std::string::npos,
+              rpc->MetricsSnapshot().find(
+                  "rpc_client_requests_total{method=\"InterNode/LookupSession\",code=\"NOT_FOUND\"} 1"));
+}
+
+namespace {
+
+// 게임 노드: io 스레드 + 게임 루프 + UDP 게임 서버
+struct GameNode {
+    GameNode() : work(io.get_executor()), session(60.0), loop(60.0) {
+        server = std::make_shared<pvpserver::UdpGameServer>(io, 0, session, loop);
+        server->EnableRollback();
+        server->Start();
+        loop.Start();
+        thread = std::thread([this] { io.run(); });
+    }
+    ~GameNode() {
+        loop.Stop();
+        loop.Join();
+        server->Stop();
+        work.reset();
+        io.stop();
+        thread.join();
+    }
+
+    boost::asio::io_context io;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work;
+    pvpserver::GameSession session;
+    pvpserver::GameLoop loop;
+    std::shared_ptr<pvpserver::UdpGameServer> server;
+    std::thread thread;
+};
+
+// 최소 UDP 클라이언트: CONNECT 전송
+void SendConnect(boost::asio::ip::udp::socket& socket, std::uint16_t port) {
+    pvpserver::ConnectPacket connect{"alice", 1};
+    const auto payload = connect.Serialize();
+    pvpserver::PacketHeader header{pvpserver::PacketType::CONNECT, 0,
+                                   static_cast<std::uint8_t>(payload.size())};
+    auto packet = header.Serialize();
+    packet.insert(packet.end(), payload.begin(), payload.end());
+    socket.send_to(boost::asio::buffer(packet),
+                   boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), port));
+}
+
+// type 패킷이 올 때까지 수신 (다른 타입은 버림)
+bool Await(boost::asio::ip::udp::socket& socket, pvpserver::PacketType type,
+           std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::vector<std::uint8_t> buffer(2048);
+    while (std::chrono::steady_clock::now() < deadline) {
+        boost::system::error_code ec;
+        boost::asio::ip::udp::endpoint from;
+        const auto size = socket.receive_from(boost::asio::buffer(buffer), from, 0, ec);
+        if (ec == boost::asio::error::would_block) {
+            std::this_thread::sleep_for(1ms);
+            continue;
+        }
+        if (!ec && size >= pvpserver::PacketHeader::SIZE &&
+            static_cast<pvpserver::PacketType>(buffer[0]) == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(InterNodeRpcTest, MatchHandoffOverRpcRedirectsClients) {
+    GameNode source;
+    GameNode target;
+    std::atomic<bool> reject{false};
+    RpcNode target_rpc("node-b", [&](const std::string& room_id,
+                                     const std::vector<std::uint8_t>& state) {
+        if (reject) {
+            throw std::runtime_error("node draining");
+        }
+        EXPECT_EQ("room-1", room_id);
+        target.server->ImportMigratedMatch(state);
+        return MigrationTarget{"127.0.0.1", target.server->Port()};
+    });
+
+    boost::asio::io_context io;
+    boost::asio::ip::udp::socket alice(io, boost::asio::ip::udp::v4());
+    alice.non_blocking(true);
+    SendConnect(alice, source.server->Port());
+    ASSERT_TRUE(Await(alice, pvpserver::PacketType::CONNECT_ACK, 1s));
+
+    InterNodeClient client(std::make_shared<RpcClient>(), "node-a", 1s);
+
+    // 거부: 원본이 재개하고 상태를 계속 보냄
+    reject = true;
+    const auto rejected = client.MigrateMatch(*source.server, "room-1", target_rpc.info);
+    EXPECT_FALSE(rejected.success);
+    EXPECT_NE(std::string::npos, rejected.error.find("node draining"));
+    EXPECT_TRUE(Await(alice, pvpserver::PacketType::STATE_FULL, 1s));
+
+    reject = false;
+    const auto result = client.MigrateMatch(*source.server, "room-1", target_rpc.info);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_GT(result.state_bytes, 0u);
+    EXPECT_EQ(target.server->Port(), result.target.udp_port);
+    EXPECT_EQ(1u, target.server->ClientCount());
+    EXPECT_TRUE(Await(alice, pvpserver::PacketType::REDIRECT, 1s));
+    EXPECT_NE(std::string::npos,
+              target_rpc.server.MetricsSnapshot().find(
+                  "rpc_server_requests_total{method=\"InterNode/HandoffMatch\",code=\"OK\"} 1"));
+}
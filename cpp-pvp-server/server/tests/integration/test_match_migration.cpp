@@ -0,0 +1,356 @@
+#include <gtest/gtest.h>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/core/game_loop.h"
+#include "pvpserver/distributed/match_migration.h"
+#include "pvpserver/game/game_session.h"
+#include "pvpserver/network/packet_types.h"
+#include "pvpserver/network/udp_game_server.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using boost::asio::ip::udp;
+using pvpserver::PacketHeader;
+using pvpserver::PacketType;
+using pvpserver::distributed::MatchMigrationReceiver;
+using pvpserver::distributed::MatchMigrator;
+using pvpserver::distributed::MigrationTarget;
+
+// 게임 노드 하나: io 스레드 + 60 TPS 게임 루프 + UDP 게임 서버
+struct Node {
+    Node() : work(io.get_executor()), session(60.0), loop(60.0) {
+        server = std::make_shared<pvpserver::UdpGameServer>(io, 0, session, loop);
+        server->EnableRollback();
+        server->Start();
+        loop.Start();
+        thread = std::thread([this] { io.run(); });
+    }
+    ~Node() {
+        loop.Stop();
+        loop.Join();
+        server->Stop();
+        work.reset();
+        io.stop();
+        thread.join();
+    }
+
+    boost::asio::io_context io;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work;
+    pvpserver::GameSession session;
+    pvpserver::GameLoop loop;
+    std::shared_ptr<pvpserver::UdpGameServer> server;
+    std::thread thread;
+};
+
+class Client {
+   public:
+    explicit Client(std::string player_id) : socket_(io_, udp::v4()), player_id_(std::move(player_id)) {
+        socket_.non_blocking(true);
+    }
+
+    void Send(std::uint16_t port, PacketType type, const std::vector<std::uint8_t>& payload) {
+        PacketHeader header{type, sequence_++, static_cast<std::uint8_t>(payload.size())};
+        auto packet = header.Serialize();
+        packet.insert(packet.end(), payload.begin(), payload.end());
+        socket_.send_to(boost::asio::buffer(packet),
+                        udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), port));
+    }
+
+    void Connect(std::uint16_t port) {
+        pvpserver::ConnectPacket connect{player_id_, 1};
+        Send(port, PacketType::CONNECT, connect.Serialize());
+    }
+
+    void Move(std::uint16_t port, bool right) {
+        pvpserver::InputCommand input{++input_sequence_, 0, right ? 1.0f : 0.0f, 0.0f, 0.0f, false};
+        Send(port, PacketType::INPUT, input.Serialize());
+    }
+
+    // type 패킷의 페이로드가 올 때까지 수신 (다른 타입은 버림)
+    std::optional<std::vector<std::uint8_t>> Receive(PacketType type,
+                                                     std::chrono::milliseconds timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        std::vector<std::uint8_t> buffer(2048);
+        while (std::chrono::steady_clock::now() < deadline) {
+            boost::system::error_code ec;
+            udp::endpoint from;
+            const auto size = socket_.receive_from(boost::asio::buffer(buffer), from, 0, ec);
+            if (ec == boost::asio::error::would_block) {
+                std::this_thread::sleep_for(1ms);
+                continue;
+            }
+            if (ec || size < PacketHeader::SIZE || static_cast<PacketType>(buffer[0]) != type) {
+                continue;
+            }
+            return std::vector<std::uint8_t>(buffer.begin() + PacketHeader::SIZE,
+                                             buffer.begin() + static_cast<std::ptrdiff_t>(size));
+        }
+        return std::nullopt;
+    }
+
+    // STATE_FULL의 틱 번호
+    std::optional<std::uint32_t> ReceiveTick(std::chrono::milliseconds timeout) {
+        const auto payload = Receive(PacketType::STATE_FULL, timeout);
+        if (!payload || payload->size() < 4) {
+            return std::nullopt;
+        }
+        return (std::uint32_t{(*payload)[0]} << 24) | (std::uint32_t{(*payload)[1]} << 16) |
+               (std::uint32_t{(*payload)[2]} << 8) | std::uint32_t{(*payload)[3]};
+    }
+
+    // STATE_FULL에서 자신의 상태
+    std::optional<pvpserver::PlayerSnapshot> ReceiveSelf(std::chrono::milliseconds timeout) {
+        const auto payload = Receive(PacketType::STATE_FULL, timeout);
+        if (!payload) {
+            return std::nullopt;
+        }
+        std::size_t offset = 5;  // tick(4) + count(1)
+        for (int i = 0; i < (*payload)[4]; ++i) {
+            auto player = pvpserver::PlayerSnapshot::Deserialize(*payload, offset);
+            if (player.player_id == player_id_) {
+                return player;
+            }
+        }
+        return std::nullopt;
+    }
+
+   private:
+    boost::asio::io_context io_;
+    udp::socket socket_;
+    std::string player_id_;
+    std::uint16_t sequence_ = 0;
+    std::uint32_t input_sequence_ = 0;
+};
+
+}  // namespace
+
+TEST(MatchMigrationTest, RunningMatchMovesToTargetWithShortPause) {
+    Node source;
+    Node target;
+    MatchMigrationReceiver receiver("127.0.0.1", 0, [&](const std::string& room_id,
+                                                         const std::vector<std::uint8_t>& state) {
+        EXPECT_EQ("room-1", room_id);
+        target.server->ImportMigratedMatch(state);
+        return MigrationTarget{"127.0.0.1", target.server->Port()};
+    });
+    receiver.Start();
+
+    Client alice("alice");
+    Client bob("bob");
+    alice.Connect(source.server->Port());
+    bob.Connect(source.server->Port());
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+    ASSERT_TRUE(bob.Receive(PacketType::CONNECT_ACK, 1s));
+
+    for (int i = 0; i < 10; ++i) {
+        alice.Move(source.server->Port(), true);
+        std::this_thread::sleep_for(2ms);
+    }
+    std::optional<pvpserver::PlayerSnapshot> before;
+    for (int i = 0; i < 50 && !(before && before->last_input_sequence == 10); ++i) {
+        before = alice.ReceiveSelf(200ms);
+    }
+    ASSERT_TRUE(before && before->last_input_sequence == 10);
+    ASSERT_GT(before->x, 0.0f);
+
+    MatchMigrator migrator;
+    const auto result = migrator.Migrate(*source.server, "room-1", "127.0.0.1", receiver.Port());
+    ASSERT_TRUE(result.success) << result.error;
+    std::cout << "[migration] pause=" << result.pause.count() << "us state_bytes="
+              << result.state_bytes << std::endl;
+    EXPECT_LT(result.pause, std::chrono::microseconds(100000));
+    EXPECT_EQ(2u, target.server->ClientCount());
+
+    // REDIRECT → 같은 player_id로 대상 노드에 재접속
+    const auto redirect_payload = alice.Receive(PacketType::REDIRECT, 1s);
+    ASSERT_TRUE(redirect_payload);
+    const auto redirect = pvpserver::RedirectPacket::Deserialize(*redirect_payload);
+    EXPECT_EQ(target.server->Port(), redirect.port);
+    alice.Connect(redirect.port);
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+
+    // 위치/체력/입력 시퀀스가 이어짐
+    std::optional<pvpserver::PlayerSnapshot> after;
+    for (int i = 0; i < 10 && !after; ++i) {
+        after = alice.ReceiveSelf(200ms);
+    }
+    ASSERT_TRUE(after);
+    EXPECT_FLOAT_EQ(before->x, after->x);
+    EXPECT_FLOAT_EQ(before->y, after->y);
+    EXPECT_EQ(before->health, after->health);
+    EXPECT_EQ(10u, after->last_input_sequence);
+
+    // 대상 노드에서 입력 계속 (시퀀스는 이전 노드에서 이어서)
+    alice.Move(redirect.port, true);
+    bool moved = false;
+    for (int i = 0; i < 20 && !moved; ++i) {
+        const auto state = alice.ReceiveSelf(200ms);
+        moved = state && state->last_input_sequence == 11 && state->x > after->x;
+    }
+    EXPECT_TRUE(moved);
+
+    // REDIRECT를 놓친 클라이언트도 원본에 패킷을 보내면 다시 받음
+    bob.Move(source.server->Port(), true);
+    EXPECT_TRUE(bob.Receive(PacketType::REDIRECT, 1s));
+    EXPECT_NE(std::string::npos,
+              migrator.MetricsSnapshot().find("match_migrations_total{result=\"success\"} 1"));
+    EXPECT_NE(std::string::npos,
+              receiver.MetricsSnapshot().find("match_migrations_received_total{result=\"imported\"} 1"));
+}
+
+TEST(MatchMigrationTest, RejectedOrUnreachableTargetLeavesMatchRunning) {
+    Node source;
+    MatchMigrationReceiver receiver(
+        "127.0.0.1", 0,
+        [](const std::string&, const std::vector<std::uint8_t>&) -> MigrationTarget {
+            throw std::runtime_error("node draining");
+        });
+    receiver.Start();
+
+    Client alice("alice");
+    alice.Connect(source.server->Port());
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+
+    MatchMigrator migrator(500ms);
+    const auto rejected = migrator.Migrate(*source.server, "room-1", "127.0.0.1", receiver.Port());
+    EXPECT_FALSE(rejected.success);
+    EXPECT_NE(std::string::npos, rejected.error.find("node draining"));
+
+    receiver.Stop();
+    const auto unreachable = migrator.Migrate(*source.server, "room-1", "127.0.0.1", receiver.Port());
+    EXPECT_FALSE(unreachable.success);
+
+    // 원본이 그대로 매치를 진행: 입력이 반영되고 상태가 계속 옴
+    alice.Move(source.server->Port(), true);
+    bool moved = false;
+    for (int i = 0; i < 20 && !moved; ++i) {
+        const auto state = alice.ReceiveSelf(200ms);
+        moved = state && state->last_input_sequence == 1;
+    }
+    EXPECT_TRUE(moved);
+    EXPECT_NE(std::string::npos,
+              migrator.MetricsSnapshot().find("match_migrations_total{result=\"failure\"} 2"));
+}
+
+TEST(MatchMigrationTest, TickContinuesAcrossHandoff) {
+    Node source;
+    std::this_thread::sleep_for(300ms);  // 대상 노드의 게임 루프 틱이 원본보다 한참 뒤처지게
+    Node target;
+    MatchMigrationReceiver receiver("127.0.0.1", 0, [&](const std::string&,
+                                                         const std::vector<std::uint8_t>& state) {
+        target.server->ImportMigratedMatch(state);
+        return MigrationTarget{"127.0.0.1", target.server->Port()};
+    });
+    receiver.Start();
+
+    Client alice("alice");
+    alice.Connect(source.server->Port());
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+    std::optional<std::uint32_t> before;
+    for (int i = 0; i < 5; ++i) {
+        if (const auto tick = alice.ReceiveTick(200ms)) {
+            before = tick;
+        }
+    }
+    ASSERT_TRUE(before);
+
+    MatchMigrator migrator;
+    ASSERT_TRUE(migrator.Migrate(*source.server, "room-1", "127.0.0.1", receiver.Port()).success);
+    const auto redirect_payload = alice.Receive(PacketType::REDIRECT, 1s);
+    ASSERT_TRUE(redirect_payload);
+    const auto redirect = pvpserver::RedirectPacket::Deserialize(*redirect_payload);
+    EXPECT_GE(redirect.server_tick, *before);
+
+    alice.Connect(redirect.port);
+    const auto ack_payload = alice.Receive(PacketType::CONNECT_ACK, 1s);
+    ASSERT_TRUE(ack_payload);
+    const auto ack = pvpserver::ConnectAckPacket::Deserialize(*ack_payload);
+    EXPECT_GE(ack.server_tick, redirect.server_tick);
+
+    // 대상 노드의 틱은 원본의 마지막 틱에서 이어지고 되돌아가지 않음
+    std::uint32_t last = redirect.server_tick;
+    int received = 0;
+    for (int i = 0; i < 10; ++i) {
+        const auto tick = alice.ReceiveTick(200ms);
+        if (!tick) {
+            continue;
+        }
+        EXPECT_GT(*tick, last);
+        last = *tick;
+        ++received;
+    }
+    EXPECT_GT(received, 0);
+    EXPECT_LT(last, redirect.server_tick + 60u);  // 대상 루프 틱으로 되돌아가지도, 건너뛰지도 않음
+}
+
+TEST(MatchMigrationTest, FrozenMatchHoldsRosterChanges) {
+    Node source;
+    Client alice("alice");
+    Client bob("bob");
+    alice.Connect(source.server->Port());
+    bob.Connect(source.server->Port());
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+    ASSERT_TRUE(bob.Receive(PacketType::CONNECT_ACK, 1s));
+
+    source.server->FreezeForMigration();
+
+    // 정지 중 새 접속은 ACK 없이 거절, 이탈은 보류
+    Client carol("carol");
+    carol.Connect(source.server->Port());
+    EXPECT_FALSE(carol.Receive(PacketType::CONNECT_ACK, 300ms));
+    bob.Send(source.server->Port(), PacketType::DISCONNECT, {});
+    std::this_thread::sleep_for(100ms);
+    EXPECT_EQ(2u, source.server->ClientCount());
+    EXPECT_EQ(2u, source.session.Snapshot().size());
+
+    // 이전 실패로 재개하면 보류된 이탈이 적용되고 새 접속도 받음
+    source.server->ResumeAfterMigrationFailure();
+    EXPECT_EQ(1u, source.server->ClientCount());
+    EXPECT_EQ(1u, source.session.Snapshot().size());
+    carol.Connect(source.server->Port());
+    EXPECT_TRUE(carol.Receive(PacketType::CONNECT_ACK, 1s));
+}
+
+TEST(MatchMigrationTest, ImportedPlayerThatNeverReconnectsIsRemoved) {
+    Node source;
+    Node target;
+    target.server->SetMigrationReconnectGrace(200ms);
+    MatchMigrationReceiver receiver("127.0.0.1", 0, [&](const std::string&,
+                                                         const std::vector<std::uint8_t>& state) {
+        target.server->ImportMigratedMatch(state);
+        return MigrationTarget{"127.0.0.1", target.server->Port()};
+    });
+    receiver.Start();
+
+    Client alice("alice");
+    Client bob("bob");
+    alice.Connect(source.server->Port());
+    bob.Connect(source.server->Port());
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+    ASSERT_TRUE(bob.Receive(PacketType::CONNECT_ACK, 1s));
+
+    MatchMigrator migrator;
+    ASSERT_TRUE(migrator.Migrate(*source.server, "room-1", "127.0.0.1", receiver.Port()).success);
+    EXPECT_EQ(2u, target.server->ClientCount());
+
+    // alice만 대상 노드로 재접속, bob은 유예 시간이 지나면 정리
+    alice.Connect(target.server->Port());
+    ASSERT_TRUE(alice.Receive(PacketType::CONNECT_ACK, 1s));
+    std::this_thread::sleep_for(500ms);
+    EXPECT_EQ(1u, target.server->ClientCount());
+    const auto players = target.session.Snapshot();
+    ASSERT_EQ(1u, players.size());
+    EXPECT_EQ("alice", players.front().player_id);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <libpq-fe.h>
+
+#include <atomic>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "pvpserver/storage/postgres_connection_pool.h"
+#include "pvpserver/storage/postgres_storage.h"
+
+// 로컬 Postgres가 있을 때만 실행:
+//   PVPSERVER_TEST_POSTGRES_DSN="host=localhost dbname=pvpserver_test user=postgres" ctest
+namespace {
+const char* TestDsn() { return std::getenv("PVPSERVER_TEST_POSTGRES_DSN"); }
+
+// 세션 이벤트 kEvents개를 풀에 넣고 모두 완료될 때까지 걸린 시간
+double MeasureEventsPerSecond(const char* dsn, bool pipeline, std::uint64_t* failures) {
+    constexpr int kEvents = 5000;
+    boost::asio::io_context io_context;
+    auto guard = boost::asio::make_work_guard(io_context);
+    std::thread io_thread([&] { io_context.run(); });
+
+    pvpserver::PostgresStorage storage(dsn);
+    pvpserver::PostgresPoolOptions options;
+    options.pipeline = pipeline;
+    options.max_queued = kEvents;
+    storage.StartAsync(io_context, options);
+
+    std::atomic<int> remaining{kEvents};
+    std::atomic<std::uint64_t> failed{0};
+    std::promise<void> all_done;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kEvents; ++i) {
+        const bool accepted = storage.RecordSessionEventAsync(
+            "pool-player" + std::to_string(i % 100), i % 2 ? "end" : "start",
+            [&](bool ok, const std::string&) {
+                if (!ok) {
+                    failed.fetch_add(1);
+                }
+                if (remaining.fetch_sub(1) == 1) {
+                    all_done.set_value();
+                }
+            });
+        EXPECT_TRUE(accepted);
+    }
+    all_done.get_future().wait_for(std::chrono::seconds(60));
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << storage.MetricsSnapshot();
+
+    storage.StopAsync();
+    guard.reset();
+    io_thread.join();
+    *failures = failed.load();
+    return kEvents / seconds;
+}
+}  // namespace
+
+TEST(PostgresAsyncPoolIntegrationTest, PipelinedSessionEventsComplete) {
+    const char* dsn = TestDsn();
+    if (!dsn) {
+        GTEST_SKIP() << "PVPSERVER_TEST_POSTGRES_DSN not set";
+    }
+    PGconn* admin = PQconnectdb(dsn);
+    ASSERT_EQ(CONNECTION_OK, PQstatus(admin)) << PQerrorMessage(admin);
+    PQclear(PQexec(admin,
+                   "CREATE TABLE IF NOT EXISTS session_events(player_id TEXT NOT NULL,"
+                   " event_type TEXT NOT NULL, created_at TIMESTAMPTZ NOT NULL)"));
+    PQfinish(admin);
+
+    std::uint64_t sequential_failures = 0;
+    std::uint64_t pipelined_failures = 0;
+    const double sequential = MeasureEventsPerSecond(dsn, false, &sequential_failures);
+    const double pipelined = MeasureEventsPerSecond(dsn, true, &pipelined_failures);
+    std::cout << "[PERF] postgres session events/s connections=4 sequential=" << sequential
+              << " pipelined=" << pipelined << std::endl;
+
+    EXPECT_EQ(0u, sequential_failures);
+    EXPECT_EQ(0u, pipelined_failures);
+}
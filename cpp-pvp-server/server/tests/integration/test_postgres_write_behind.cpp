@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <libpq-fe.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "pvpserver/storage/postgres_storage.h"
+
+// 로컬 Postgres가 있을 때만 실행:
+//   PVPSERVER_TEST_POSTGRES_DSN="host=localhost dbname=pvpserver_test user=postgres" ctest
+namespace {
+const char* TestDsn() { return std::getenv("PVPSERVER_TEST_POSTGRES_DSN"); }
+
+std::string QueryScalar(PGconn* conn, const std::string& sql) {
+    PGresult* result = PQexec(conn, sql.c_str());
+    std::string value;
+    if (PQresultStatus(result) == PGRES_TUPLES_OK && PQntuples(result) > 0) {
+        value = PQgetvalue(result, 0, 0);
+    }
+    PQclear(result);
+    return value;
+}
+
+pvpserver::ProfileRecord Profile(const std::string& player_id, int rating,
+                                 std::uint64_t matches) {
+    pvpserver::ProfileRecord profile;
+    profile.player_id = player_id;
+    profile.rating = rating;
+    profile.matches = matches;
+    profile.wins = matches;
+    return profile;
+}
+}  // namespace
+
+TEST(PostgresWriteBehindIntegrationTest, BatchesIdempotentUpsertsIntoPostgres) {
+    const char* dsn = TestDsn();
+    if (!dsn) {
+        GTEST_SKIP() << "PVPSERVER_TEST_POSTGRES_DSN not set";
+    }
+    PGconn* admin = PQconnectdb(dsn);
+    ASSERT_EQ(CONNECTION_OK, PQstatus(admin)) << PQerrorMessage(admin);
+    PQclear(PQexec(admin, "DROP TABLE IF EXISTS match_results, player_profiles"));
+
+    constexpr int kMatches = 5000;
+    pvpserver::PostgresStorage storage(dsn);
+    pvpserver::WriteBehindOptions options;
+    options.max_batch = 500;
+    storage.StartWriteBehind(options);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kMatches; ++i) {
+        const auto winner = "wb-player" + std::to_string(i % 100);
+        const auto loser = "wb-player" + std::to_string((i + 1) % 100);
+        ASSERT_TRUE(storage.EnqueueMatch(
+            pvpserver::MatchResultRecord{"wb-match-" + std::to_string(i), winner, loser,
+                                         winner + ";" + loser, 1700000000000 + i},
+            {Profile(winner, 1200 + i % 50, static_cast<std::uint64_t>(i + 1)),
+             Profile(loser, 1200 - i % 50, static_cast<std::uint64_t>(i + 1))}));
+    }
+    ASSERT_TRUE(storage.FlushWriteBehind(std::chrono::seconds(30)));
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[PERF] postgres write-behind matches=" << kMatches
+              << " matches_per_sec=" << kMatches / seconds << std::endl;
+
+    // 같은 매치 재전송 + 오래된 프로필 스냅샷은 무시되어야 함 (재시도 멱등성)
+    ASSERT_TRUE(storage.EnqueueMatch(
+        pvpserver::MatchResultRecord{"wb-match-0", "x", "y", "x;y", 0},
+        {Profile("wb-player0", 1, 1)}));
+    ASSERT_TRUE(storage.FlushWriteBehind(std::chrono::seconds(10)));
+    storage.StopWriteBehind();
+
+    EXPECT_EQ(std::to_string(kMatches), QueryScalar(admin, "SELECT COUNT(*) FROM match_results"));
+    EXPECT_EQ("100", QueryScalar(admin, "SELECT COUNT(*) FROM player_profiles"));
+    EXPECT_NE("1", QueryScalar(admin,
+                               "SELECT rating FROM player_profiles WHERE player_id = 'wb-player0'"));
+    EXPECT_NE(storage.MetricsSnapshot().find("postgres_write_behind_match_rows_total 5001"),
+              std::string::npos);
+    PQfinish(admin);
+}
@@ -93,3 +93,77 @@ TEST(ProfileHttpRouterIntegrationTest, ServesMetricsProfilesAndLeaderboard) {
         server_thread.join();
     }
 }
+
+TEST(ProfileHttpRouterIntegrationTest, KeepAliveConnectionSeesInvalidatedLeaderboard) {
+    boost::asio::io_context io_context;
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    auto profile_service = std::make_shared<pvpserver::PlayerProfileService>(leaderboard);
+
+    auto record = [&](const std::string& match_id, const std::string& winner,
+                      const std::string& loser) {
+        std::vector<PlayerMatchStats> stats{
+            PlayerMatchStats{match_id, winner, 5, 5, 1, 0, 100, 10},
+            PlayerMatchStats{match_id, loser, 4, 2, 0, 1, 40, 100},
+        };
+        profile_service->RecordMatch(
+            MatchResult{match_id, winner, loser, std::chrono::system_clock::now(), stats});
+    };
+    record("match-1", "alpha", "bravo");
+
+    pvpserver::ProfileHttpRouter::Options options;
+    options.leaderboard_refresh = std::chrono::milliseconds(0);
+    auto router = std::make_shared<pvpserver::ProfileHttpRouter>(
+        [] { return std::string{}; }, profile_service, options);
+    pvpserver::MetricsHttpServer::SharedRequestHandler handler =
+        [router](const pvpserver::MetricsHttpServer::Request& request) {
+            return router->HandleShared(request);
+        };
+    auto server = std::make_shared<pvpserver::MetricsHttpServer>(io_context, 0, handler);
+    server->Start();
+    std::thread server_thread([&]() { io_context.run(); });
+    const auto port = server->Port();
+    ASSERT_NE(port, 0);
+
+    boost::asio::io_context client_io;
+    boost::asio::ip::tcp::resolver resolver(client_io);
+    boost::beast::tcp_stream stream(client_io);
+    stream.connect(resolver.resolve("127.0.0.1", std::to_string(port)));
+    boost::beast::flat_buffer buffer;
+    auto get = [&](const std::string& target) {
+        http::request<http::string_body> request{http::verb::get, target, 11};
+        request.set(http::field::host, "127.0.0.1");
+        http::write(stream, request);
+        http::response<http::string_body> response;
+        http::read(stream, buffer, response);
+        return response;
+    };
+
+    // 같은 연결로 여러 요청 (서버가 연결을 닫으면 두 번째 write/read가 실패)
+    auto first = get("/leaderboard?limit=1");
+    EXPECT_TRUE(first.keep_alive());
+    EXPECT_NE(first.body().find("alpha"), std::string::npos);
+    auto cached = get("/leaderboard?limit=1");
+    EXPECT_EQ(first.body(), cached.body());
+
+    record("match-2", "bravo", "alpha");
+    record("match-3", "bravo", "alpha");
+    auto refreshed = get("/leaderboard?limit=1");
+    EXPECT_NE(refreshed.body().find("bravo"), std::string::npos);
+
+    auto profile = get("/profiles/bravo");
+    EXPECT_EQ(http::status::ok, profile.result());
+    EXPECT_NE(profile.body().find("\"wins\":2"), std::string::npos);
+
+    const auto metrics = router->MetricsSnapshot();
+    EXPECT_NE(metrics.find("http_response_cache_hits_total{cache=\"leaderboard\"} 1"),
+              std::string::npos);
+
+    boost::system::error_code ec;
+    stream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+    stream.socket().close(ec);
+    server->Stop();
+    io_context.stop();
+    if (server_thread.joinable()) {
+        server_thread.join();
+    }
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <string>
+
+#include "pvpserver/storage/redis_cluster_client.h"
+#include "pvpserver/storage/redis_session_store.h"
+
+// 로컬 redis-server가 있을 때만 실행:
+//   PVPSERVER_TEST_REDIS_ADDR=127.0.0.1:6379 ctest
+namespace {
+const char* TestAddress() { return std::getenv("PVPSERVER_TEST_REDIS_ADDR"); }
+
+pvpserver::storage::SessionData MakeSession(int index) {
+    pvpserver::storage::SessionData data;
+    data.player_id = "it-player-" + std::to_string(index);
+    data.player_name = "name";
+    data.server_id = "server-1";
+    data.created_at = 1000;
+    data.last_activity = 2000;
+    data.elo_rating = 1200 + index % 400;
+    return data;
+}
+}  // namespace
+
+TEST(RedisSessionStoreIntegrationTest, RoundTripAndAsyncSaveThroughput) {
+    const char* address = TestAddress();
+    if (!address) {
+        GTEST_SKIP() << "PVPSERVER_TEST_REDIS_ADDR not set";
+    }
+    pvpserver::storage::RedisConfig config;
+    config.cluster_nodes = {address};
+    config.connection_pool_size = 4;
+    config.session_ttl_seconds = 60;
+    pvpserver::storage::RedisSessionStore store(config);
+    ASSERT_TRUE(store.IsConnected());
+
+    ASSERT_TRUE(store.SaveSession("it-session", MakeSession(0)));
+    auto session = store.GetSession("it-session");
+    ASSERT_TRUE(session.has_value());
+    EXPECT_EQ("it-player-0", session->player_id);
+    EXPECT_EQ("it-session", store.GetSessionByPlayerId("it-player-0").value_or(""));
+    EXPECT_TRUE(store.DeleteSession("it-session"));
+
+    // 동기 저장 (저장마다 한 번의 왕복) vs 비동기 저장 (응답을 기다리지 않고 연속 전송)
+    constexpr int kSessions = 5000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSessions; ++i) {
+        store.SaveSession("it-sync-" + std::to_string(i), MakeSession(i));
+    }
+    const double sync_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::atomic<int> remaining{kSessions};
+    std::atomic<int> failures{0};
+    std::promise<void> done;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSessions; ++i) {
+        store.SaveSessionAsync("it-async-" + std::to_string(i), MakeSession(i), [&](bool ok) {
+            if (!ok) {
+                failures.fetch_add(1);
+            }
+            if (remaining.fetch_sub(1) == 1) {
+                done.set_value();
+            }
+        });
+    }
+    ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(std::chrono::seconds(30)));
+    const double async_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << store.MetricsSnapshot();
+    std::cout << "[PERF] redis session saves/s pool=4 sync=" << kSessions / sync_seconds
+              << " async=" << kSessions / async_seconds << std::endl;
+    EXPECT_EQ(0, failures.load());
+
+    for (int i = 0; i < kSessions; ++i) {
+        store.DeleteSession("it-sync-" + std::to_string(i));
+        store.DeleteSession("it-async-" + std::to_string(i));
+    }
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "pvpserver/distributed/consistent_hash.h"
+#include "pvpserver/distributed/load_balancer.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::distributed::ConsistentHashRing;
+
+constexpr int kServers = 50;
+
+// 예전 방식: std::map 링 + 바이트 단위 FNV-1a + "node#i" 문자열 가상 노드
+class MapRing {
+   public:
+    void AddNode(const std::string& node_id) {
+        for (int i = 0; i < 150; ++i) {
+            ring_[Fnv(node_id + "#" + std::to_string(i))] = node_id;
+        }
+    }
+    std::string GetNode(const std::string& key) const {
+        auto it = ring_.lower_bound(Fnv(key));
+        if (it == ring_.end()) {
+            it = ring_.begin();
+        }
+        return it->second;
+    }
+
+   private:
+    static std::size_t Fnv(const std::string& key) {
+        std::size_t hash = 14695981039346656037ULL;
+        for (char c : key) {
+            hash ^= static_cast<std::size_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+    std::map<std::size_t, std::string> ring_;
+};
+
+std::size_t BenchKeys() {
+    if (const char* env = std::getenv("PVPSERVER_HASH_BENCH_KEYS")) {
+        return static_cast<std::size_t>(std::strtoull(env, nullptr, 10));
+    }
+    return 200000;
+}
+
+// 최대 / 평균 (1.0 = 완전 균등)
+template <typename Lookup>
+double Spread(const std::vector<std::string>& keys, Lookup&& lookup) {
+    std::map<std::string, int> counts;
+    for (const auto& key : keys) {
+        ++counts[lookup(key)];
+    }
+    int max = 0;
+    for (const auto& [node, count] : counts) {
+        max = std::max(max, count);
+    }
+    return max / (static_cast<double>(keys.size()) / kServers);
+}
+
+template <typename Body>
+double LookupsPerSecond(const std::vector<std::string>& keys, Body&& body) {
+    const auto start = steady_clock::now();
+    for (const auto& key : keys) {
+        body(key);
+    }
+    return keys.size() / duration<double>(steady_clock::now() - start).count();
+}
+}  // namespace
+
+TEST(ConsistentHashPerformanceTest, FlatRingAndJumpLookupThroughput) {
+    std::vector<std::string> keys;
+    const auto key_count = BenchKeys();
+    for (std::size_t i = 0; i < key_count; ++i) {
+        keys.push_back("player-" + std::to_string(i * 7919));
+    }
+    MapRing map_ring;
+    ConsistentHashRing flat;
+    ConsistentHashRing jump(150, ConsistentHashRing::Mode::JUMP);
+    for (int i = 0; i < kServers; ++i) {
+        const auto id = "game-server-" + std::to_string(i);
+        map_ring.AddNode(id);
+        flat.AddNode(id);
+        jump.AddNode(id);
+    }
+
+    std::size_t sink = 0;
+    const double map_rate =
+        LookupsPerSecond(keys, [&](const std::string& key) { sink += map_ring.GetNode(key).size(); });
+    const double flat_rate =
+        LookupsPerSecond(keys, [&](const std::string& key) { sink += flat.Lookup(key)->size(); });
+    const double jump_rate =
+        LookupsPerSecond(keys, [&](const std::string& key) { sink += jump.Lookup(key)->size(); });
+    EXPECT_GT(sink, 0u);
+
+    const double map_spread = Spread(keys, [&](const std::string& key) { return map_ring.GetNode(key); });
+    const double flat_spread = Spread(keys, [&](const std::string& key) { return *flat.Lookup(key); });
+    const double jump_spread = Spread(keys, [&](const std::string& key) { return *jump.Lookup(key); });
+
+    std::cout << "[PERF] consistent hash servers=" << kServers << " keys=" << keys.size()
+              << " lookups/s map-ring=" << map_rate << " flat-ring=" << flat_rate
+              << " jump=" << jump_rate << std::endl;
+    std::cout << "[PERF] consistent hash max/avg load map-ring=" << map_spread
+              << " flat-ring=" << flat_spread << " jump=" << jump_spread << std::endl;
+    EXPECT_GT(flat_rate, map_rate);
+    EXPECT_LT(jump_spread, 1.1);
+}
+
+TEST(ConsistentHashPerformanceTest, BoundedLoadSelectionSpread) {
+    const auto key_count = BenchKeys() / 4;
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < key_count; ++i) {
+        keys.push_back("player-" + std::to_string(i * 7919));
+    }
+
+    for (const double factor : {0.0, 1.25, 1.1}) {
+        pvpserver::distributed::LoadBalancer balancer;
+        balancer.SetBoundedLoadFactor(factor);
+        for (int i = 0; i < kServers; ++i) {
+            pvpserver::distributed::ServerInfo info;
+            info.server_id = "game-server-" + std::to_string(i);
+            info.max_connections = 1 << 30;
+            balancer.RegisterServer(info);
+        }
+        std::map<std::string, int> load;
+        const auto start = steady_clock::now();
+        for (const auto& key : keys) {
+            const auto server = balancer.SelectServer(key);
+            balancer.UpdateServerLoad(server->server_id, ++load[server->server_id]);
+        }
+        const double rate = keys.size() / duration<double>(steady_clock::now() - start).count();
+        int max = 0;
+        for (const auto& [id, count] : load) {
+            max = std::max(max, count);
+        }
+        const double spread = max / (static_cast<double>(keys.size()) / kServers);
+        std::cout << "[PERF] bounded-load factor=" << factor << " max/avg=" << spread
+                  << " selections/s=" << rate << std::endl;
+        if (factor > 1.0) {
+            EXPECT_LE(spread, factor + 0.01);
+        }
+    }
+}
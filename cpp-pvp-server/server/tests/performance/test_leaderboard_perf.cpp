@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pvpserver/stats/leaderboard_store.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::InMemoryLeaderboardStore;
+
+// 기본 100만 명. PVPSERVER_LEADERBOARD_BENCH_ENTRIES=10000000 으로 1,000만 명 측정
+std::size_t BenchEntries() {
+    if (const char* env = std::getenv("PVPSERVER_LEADERBOARD_BENCH_ENTRIES")) {
+        const auto parsed = std::strtoull(env, nullptr, 10);
+        if (parsed > 0) {
+            return static_cast<std::size_t>(parsed);
+        }
+    }
+    return 1000000;
+}
+
+double MicrosPerOp(steady_clock::duration elapsed, std::size_t ops) {
+    return static_cast<double>(duration_cast<nanoseconds>(elapsed).count()) / 1000.0 /
+           static_cast<double>(ops);
+}
+}  // namespace
+
+// 대규모 리더보드에서 Rank / Range(중간 페이지) / 점수 갱신이 O(log N)인지 확인
+TEST(LeaderboardPerformanceTest, RankAndRangeStayLogarithmic) {
+    const std::size_t entries = BenchEntries();
+    constexpr std::size_t kQueries = 20000;
+    constexpr std::size_t kPages = 2000;
+    constexpr std::size_t kPageSize = 50;
+
+    InMemoryLeaderboardStore store;
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int> score(0, 4000);
+
+    auto start = steady_clock::now();
+    for (std::size_t i = 0; i < entries; ++i) {
+        store.Upsert("player" + std::to_string(i), score(rng));
+    }
+    const auto insert_elapsed = steady_clock::now() - start;
+    ASSERT_EQ(entries, store.Size());
+
+    std::vector<std::string> probes;
+    probes.reserve(kQueries);
+    for (std::size_t i = 0; i < kQueries; ++i) {
+        probes.push_back("player" + std::to_string(rng() % entries));
+    }
+
+    start = steady_clock::now();
+    std::size_t rank_sum = 0;
+    for (const auto& id : probes) {
+        rank_sum += store.Rank(id).value();
+    }
+    const auto rank_elapsed = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    std::size_t returned = 0;
+    for (std::size_t i = 0; i < kPages; ++i) {
+        returned += store.Range(entries / 2 + (rng() % (entries / 4)), kPageSize).size();
+    }
+    const auto range_elapsed = steady_clock::now() - start;
+    EXPECT_EQ(kPages * kPageSize, returned);
+
+    start = steady_clock::now();
+    for (const auto& id : probes) {
+        store.Upsert(id, score(rng));
+    }
+    const auto update_elapsed = steady_clock::now() - start;
+
+    const double rank_us = MicrosPerOp(rank_elapsed, kQueries);
+    const double range_us = MicrosPerOp(range_elapsed, kPages);
+    const double update_us = MicrosPerOp(update_elapsed, kQueries);
+    std::cout << "[PERF] leaderboard entries=" << entries
+              << " insert_us=" << MicrosPerOp(insert_elapsed, entries) << " rank_us=" << rank_us
+              << " range50_us=" << range_us << " update_us=" << update_us
+              << " (rank_sum=" << rank_sum << ")" << std::endl;
+
+    // 디버그 빌드 기준 여유 있는 예산 (O(N) 순회라면 100만 명에서 수 ms/회)
+    EXPECT_LT(rank_us, 200.0);
+    EXPECT_LT(range_us, 400.0);
+    EXPECT_LT(update_us, 400.0);
+}
@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "pvpserver/distributed/consistent_hash.h"
+#include "pvpserver/distributed/load_balancer.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::distributed::ConsistentHashRing;
+using pvpserver::distributed::LoadBalancer;
+using pvpserver::distributed::LoadBalanceStrategy;
+using pvpserver::distributed::ServerInfo;
+
+constexpr int kServers = 50;
+
+// 예전 방식: 전역 mutex + ID로 서버 표 조회 + 선택마다 ServerInfo 복사
+class MutexBalancer {
+   public:
+    void RegisterServer(const ServerInfo& server) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        servers_[server.server_id] = server;
+        ring_.AddNode(server.server_id);
+    }
+    std::optional<ServerInfo> SelectServer(const std::string& player_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const ServerInfo* selected = nullptr;
+        ring_.ForEachCandidate(player_id, [&](const std::string& server_id) {
+            auto it = servers_.find(server_id);
+            if (it == servers_.end() || !it->second.healthy || !it->second.HasCapacity()) {
+                return false;
+            }
+            selected = &it->second;
+            return true;
+        });
+        if (!selected) {
+            return std::nullopt;
+        }
+        return *selected;
+    }
+    void UpdateServerLoad(const std::string& server_id, int connections) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        servers_.at(server_id).current_connections = connections;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, ServerInfo> servers_;
+    ConsistentHashRing ring_;
+};
+
+int BenchThreads() {
+    if (const char* env = std::getenv("PVPSERVER_LB_BENCH_THREADS")) {
+        return std::max(1, std::atoi(env));
+    }
+    return static_cast<int>(std::max(4u, std::thread::hardware_concurrency()));
+}
+
+ServerInfo MakeServer(int i) {
+    ServerInfo info;
+    info.server_id = "game-server-" + std::to_string(i);
+    info.host = "10.0.0." + std::to_string(i);
+    info.region = "ap-northeast-2";
+    info.max_connections = 1 << 30;
+    return info;
+}
+
+// threads개 스레드가 select를 돌리는 동안 writer 스레드가 부하를 갱신, 초당 선택 수
+template <typename Select, typename Update>
+double SelectionsPerSecond(int threads, const std::vector<std::string>& keys, Select&& select,
+                           Update&& update) {
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<long long> total{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            long long count = 0;
+            std::size_t sink = 0;
+            for (std::size_t i = static_cast<std::size_t>(t); !stop.load(std::memory_order_relaxed);
+                 i += 7) {
+                sink += select(keys[i % keys.size()]);
+                ++count;
+            }
+            total += count + static_cast<long long>(sink == 0);
+        });
+    }
+    std::thread writer([&] {
+        int round = 0;
+        while (!stop.load()) {
+            update(round++ % kServers);
+            std::this_thread::sleep_for(microseconds(100));
+        }
+    });
+
+    const auto begin = steady_clock::now();
+    start = true;
+    std::this_thread::sleep_for(milliseconds(300));
+    stop = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    writer.join();
+    return total.load() / duration<double>(steady_clock::now() - begin).count();
+}
+// ---- 전략 비교 시뮬레이션 ----
+// 서버마다 하드웨어 속도와 이웃 프로세스 CPU가 다르고, 매치마다 틱 비용이 다릅니다.
+// 한 주기 = 하트비트 한 번: 연결 수는 배치 즉시 반영, 틱 p99/CPU는 주기 끝에 보고 (한 주기 늦음).
+constexpr int kSimServers = 20;
+constexpr int kSimPeriods = 200;
+constexpr int kSimWarmup = 60;
+constexpr int kSimPlayers = 2800;  // 정상 상태 동시 접속
+constexpr double kTickBudgetMs = 1000.0 / 60.0;
+
+struct SimServer {
+    double speed;           // 1.0 = 기준 하드웨어
+    double background_cpu;  // 다른 프로세스가 쓰는 몫
+    double work_ms = 0.0;   // 기준 하드웨어에서의 틱당 작업량 합
+    int players = 0;
+};
+
+struct SimPlayer {
+    int server;
+    double cost_ms;
+    int leaves_at;
+};
+
+struct SimResult {
+    double p99_ms;
+    double max_ms;
+    double over_budget_ratio;
+};
+
+SimResult SimulateTickTail(LoadBalanceStrategy strategy) {
+    std::mt19937_64 rng(20240601);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_int_distribution<int> lifetime(20, 60);
+
+    LoadBalancer balancer(strategy);
+    std::vector<SimServer> servers;
+    for (int i = 0; i < kSimServers; ++i) {
+        servers.push_back({i % 5 == 0 ? 0.6 : 1.0, i % 7 == 3 ? 0.35 : 0.05});
+        balancer.RegisterServer(MakeServer(i));
+    }
+    std::unordered_map<std::string, int> index;
+    for (int i = 0; i < kSimServers; ++i) {
+        index["game-server-" + std::to_string(i)] = i;
+    }
+
+    std::vector<SimPlayer> players;
+    std::vector<double> samples;
+    const int arrivals = kSimPlayers / 40;  // 평균 수명 40주기
+    long long next_player = 0;
+    for (int period = 0; period < kSimPeriods; ++period) {
+        for (int a = 0; a < arrivals; ++a) {
+            const auto handle = balancer.Select("player-" + std::to_string(next_player++ * 7919));
+            if (!handle) {
+                continue;
+            }
+            const int server = index.at(handle.Id());
+            const double cost = unit(rng) < 0.1 ? 0.2 : 0.04;  // 10%는 무거운 매치
+            players.push_back({server, cost, period + lifetime(rng)});
+            servers[server].work_ms += cost;
+            balancer.UpdateServerLoad(handle.Id(), ++servers[server].players);
+        }
+        for (std::size_t p = 0; p < players.size();) {
+            if (players[p].leaves_at > period) {
+                ++p;
+                continue;
+            }
+            auto& server = servers[players[p].server];
+            server.work_ms -= players[p].cost_ms;
+            balancer.UpdateServerLoad("game-server-" + std::to_string(players[p].server),
+                                      --server.players);
+            players[p] = players.back();
+            players.pop_back();
+        }
+        for (int i = 0; i < kSimServers; ++i) {
+            auto& server = servers[i];
+            const double effective = server.work_ms / (server.speed * (1.0 - server.background_cpu));
+            const double p99 = effective * (1.2 + 0.2 * unit(rng));  // 틱 간 흔들림 꼬리
+            const double cpu =
+                std::min(1.0, server.background_cpu + server.work_ms / (server.speed * kTickBudgetMs));
+            if (period >= kSimWarmup) {
+                samples.push_back(p99);
+            }
+            balancer.UpdateServerMetrics("game-server-" + std::to_string(i), server.players, p99, cpu);
+        }
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const auto over = std::count_if(samples.begin(), samples.end(),
+                                    [](double ms) { return ms > kTickBudgetMs; });
+    return {samples[samples.size() * 99 / 100], samples.back(),
+            static_cast<double>(over) / static_cast<double>(samples.size())};
+}
+}  // namespace
+
+TEST(LoadBalancerPerformanceTest, StrategyTickTailSimulation) {
+    const std::vector<std::pair<const char*, LoadBalanceStrategy>> strategies = {
+        {"consistent-hash", LoadBalanceStrategy::CONSISTENT_HASH},
+        {"round-robin", LoadBalanceStrategy::ROUND_ROBIN},
+        {"least-connections", LoadBalanceStrategy::LEAST_CONNECTIONS},
+        {"power-of-two", LoadBalanceStrategy::POWER_OF_TWO},
+        {"weighted-headroom", LoadBalanceStrategy::WEIGHTED_HEADROOM},
+    };
+    std::map<LoadBalanceStrategy, SimResult> results;
+    for (const auto& [name, strategy] : strategies) {
+        const auto result = SimulateTickTail(strategy);
+        results[strategy] = result;
+        std::cout << "[PERF] lb-sim strategy=" << name << " tick_p99_ms=" << result.p99_ms
+                  << " tick_max_ms=" << result.max_ms
+                  << " over_budget=" << result.over_budget_ratio * 100.0 << "%" << std::endl;
+    }
+
+    const auto& weighted = results[LoadBalanceStrategy::WEIGHTED_HEADROOM];
+    for (const auto strategy : {LoadBalanceStrategy::ROUND_ROBIN,
+                                LoadBalanceStrategy::LEAST_CONNECTIONS,
+                                LoadBalanceStrategy::POWER_OF_TWO}) {
+        EXPECT_LT(weighted.p99_ms, results[strategy].p99_ms);
+        EXPECT_LE(weighted.over_budget_ratio, results[strategy].over_budget_ratio);
+    }
+    EXPECT_LE(weighted.p99_ms, kTickBudgetMs);
+}
+
+TEST(LoadBalancerPerformanceTest, SnapshotSelectionScalesAcrossThreads) {
+    std::vector<std::string> keys;
+    for (int i = 0; i < 10000; ++i) {
+        keys.push_back("player-" + std::to_string(i * 7919));
+    }
+    MutexBalancer locked;
+    LoadBalancer snapshot;
+    snapshot.SetBoundedLoadFactor(0);
+    for (int i = 0; i < kServers; ++i) {
+        locked.RegisterServer(MakeServer(i));
+        snapshot.RegisterServer(MakeServer(i));
+    }
+
+    const int threads = BenchThreads();
+    const double mutex_rate = SelectionsPerSecond(
+        threads, keys,
+        [&](const std::string& key) { return locked.SelectServer(key)->server_id.size(); },
+        [&](int i) { locked.UpdateServerLoad("game-server-" + std::to_string(i), i); });
+    const double copy_rate = SelectionsPerSecond(
+        threads, keys,
+        [&](const std::string& key) { return snapshot.SelectServer(key)->server_id.size(); },
+        [&](int i) { snapshot.UpdateServerLoad("game-server-" + std::to_string(i), i); });
+    const double handle_rate = SelectionsPerSecond(
+        threads, keys, [&](const std::string& key) { return snapshot.Select(key).Id().size(); },
+        [&](int i) { snapshot.UpdateServerLoad("game-server-" + std::to_string(i), i); });
+
+    std::cout << "[PERF] load balancer select threads=" << threads << " servers=" << kServers
+              << " selections/s mutex+copy=" << mutex_rate << " snapshot+copy=" << copy_rate
+              << " snapshot+handle=" << handle_rate << std::endl;
+    EXPECT_GT(handle_rate, 0.0);
+#ifdef NDEBUG
+    // 최적화 없는 빌드에서는 shared_ptr/std::function 호출 비용이 잠금 비용보다 커서 비교하지 않음
+    EXPECT_GT(handle_rate, mutex_rate);
+#endif
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "pvpserver/matchmaking/match_queue.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::InMemoryMatchQueue;
+using pvpserver::MatchRequest;
+}  // namespace
+
+// 대기열 입장/취소가 섞인 100만 회 연산 (대기열 크기는 5만 명 근처 유지)
+TEST(MatchQueuePerformanceTest, EnqueueCancelChurnOneMillionOperations) {
+    constexpr int kOperations = 1000000;
+    constexpr int kSteadyState = 50000;
+    InMemoryMatchQueue queue;
+    const auto now = steady_clock::now();
+
+    std::vector<std::string> ids;
+    ids.reserve(kOperations);
+    for (int i = 0; i < kOperations; ++i) {
+        ids.push_back("churn" + std::to_string(i));
+    }
+
+    std::vector<std::size_t> enqueued;  // 입장 순서 (취소 대상 선택용)
+    enqueued.reserve(kOperations);
+    std::uint64_t order = 0;
+    std::size_t next_cancel = 0;
+    std::size_t cancelled = 0;
+    const auto start = steady_clock::now();
+    for (int i = 0; i < kOperations; ++i) {
+        if (static_cast<int>(queue.Size()) < kSteadyState || i % 2 == 0) {
+            const int elo = 800 + static_cast<int>((static_cast<std::uint64_t>(i) * 7919) % 1600);
+            queue.Upsert(MatchRequest{ids[i], elo, now}, ++order);
+            enqueued.push_back(static_cast<std::size_t>(i));
+        } else {
+            // 오래 기다린 플레이어부터 취소 (매칭으로 빠지는 것과 같은 패턴)
+            cancelled += queue.Remove(ids[enqueued[next_cancel++]]) ? 1 : 0;
+        }
+    }
+    const auto elapsed_ms = duration_cast<milliseconds>(steady_clock::now() - start).count();
+
+    std::size_t visited = 0;
+    queue.ForEachOrdered([&visited](const MatchRequest&, std::uint64_t) { ++visited; });
+    std::cout << "[PERF] match queue churn ops=" << kOperations << " cancelled=" << cancelled
+              << " remaining=" << queue.Size() << " elapsed_ms=" << elapsed_ms << std::endl;
+
+    EXPECT_EQ(queue.Size(), visited);
+    EXPECT_EQ(next_cancel, cancelled);
+    EXPECT_EQ(static_cast<std::size_t>(kSteadyState), queue.Size());
+    EXPECT_LE(elapsed_ms, 5000) << "Queue churn took " << elapsed_ms << " ms";
+}
@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "pvpserver/matchmaking/matchmaker.h"
 
@@ -31,3 +34,78 @@ TEST(MatchmakingPerformanceTest, MatchesTwoHundredPlayersUnderTwoMilliseconds) {
     EXPECT_EQ(100u, matches.size());
     EXPECT_LE(elapsed_us, 2000) << "Matchmaking took " << elapsed_us << " us";
 }
+
+TEST(MatchmakingPerformanceTest, SweepsOneHundredThousandQueuedPlayersWithinBudget) {
+    constexpr int kPlayers = 100000;
+    auto queue = std::make_shared<InMemoryMatchQueue>();
+    Matchmaker matchmaker(queue);
+    const auto base = steady_clock::now() - seconds(30);
+
+    // 매칭마다 로그가 출력되므로 측정 중에는 stdout을 버림
+    std::ostringstream sink;
+    auto* original = std::cout.rdbuf(sink.rdbuf());
+    for (int i = 0; i < kPlayers; ++i) {
+        const int elo = 800 + static_cast<int>((static_cast<std::uint64_t>(i) * 7919) % 1600);
+        const char* region = (i % 10 == 0) ? "any" : ((i % 2 == 0) ? "kr" : "us");
+        matchmaker.Enqueue(MatchRequest{"sweep" + std::to_string(i), elo,
+                                        base + microseconds(i), region});
+    }
+    sink.str({});
+
+    const auto start = steady_clock::now();
+    auto matches = matchmaker.RunMatching(base + seconds(30));
+    const auto end = steady_clock::now();
+    std::cout.rdbuf(original);
+
+    const auto elapsed_ms = duration_cast<milliseconds>(end - start).count();
+    std::cout << "[PERF] matchmaking sweep players=" << kPlayers << " matches=" << matches.size()
+              << " elapsed_ms=" << elapsed_ms << std::endl;
+
+    // 리전이 두 개 + any뿐이고 ELO 분포가 촘촘하므로 거의 전원 매칭
+    EXPECT_GE(matches.size(), static_cast<std::size_t>(kPlayers / 2 - 2));
+    EXPECT_EQ(static_cast<std::size_t>(kPlayers) - matches.size() * 2, queue->Size());
+    EXPECT_LE(elapsed_ms, 1500) << "Matchmaking sweep took " << elapsed_ms << " ms";
+}
+
+TEST(MatchmakingPerformanceTest, FormsFiveVersusFiveWithPartiesNearLinearly) {
+    constexpr int kRequests = 50000;
+    auto queue = std::make_shared<InMemoryMatchQueue>();
+    Matchmaker matchmaker(queue, pvpserver::MatchFormat::Teams(5, 3));
+    const auto base = steady_clock::now() - seconds(30);
+
+    std::ostringstream sink;
+    auto* original = std::cout.rdbuf(sink.rdbuf());
+    int players = 0;
+    for (int i = 0; i < kRequests; ++i) {
+        const int elo = 800 + static_cast<int>((static_cast<std::uint64_t>(i) * 7919) % 1600);
+        // 솔로 60%, 2인 파티 30%, 3인 파티 10%
+        std::vector<std::string> party;
+        const int roll = i % 10;
+        const int extra = roll < 6 ? 0 : (roll < 9 ? 1 : 2);
+        for (int m = 0; m < extra; ++m) {
+            party.push_back("party" + std::to_string(i) + "-" + std::to_string(m));
+        }
+        players += extra + 1;
+        matchmaker.Enqueue(MatchRequest{"team" + std::to_string(i), elo, base + microseconds(i),
+                                        (i % 2 == 0) ? "kr" : "us", std::move(party)});
+    }
+    sink.str({});
+
+    const auto start = steady_clock::now();
+    auto matches = matchmaker.RunMatching(base + seconds(30));
+    const auto end = steady_clock::now();
+    std::cout.rdbuf(original);
+
+    const auto elapsed_ms = duration_cast<milliseconds>(end - start).count();
+    std::cout << "[PERF] matchmaking 5v5 requests=" << kRequests << " players=" << players
+              << " matches=" << matches.size() << " elapsed_ms=" << elapsed_ms << std::endl;
+
+    for (const auto& match : matches) {
+        ASSERT_EQ(2u, match.teams().size());
+        EXPECT_EQ(5u, match.teams()[0].players.size());
+        EXPECT_EQ(5u, match.teams()[1].players.size());
+    }
+    // 대부분의 플레이어가 매칭되어야 함 (윈도우 가장자리 잔여분만 남음)
+    EXPECT_GE(matches.size() * 10, static_cast<std::size_t>(players) * 9 / 10);
+    EXPECT_LE(elapsed_ms, 1500) << "5v5 formation took " << elapsed_ms << " ms";
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "pvpserver/netcode/client_prediction.h"
+#include "pvpserver/netcode/fixed_client_prediction.h"
+#include "pvpserver/netcode/reconciliation.h"
+
+namespace {
+
+using namespace std::chrono;
+using pvpserver::InputCommand;
+using pvpserver::PlayerState;
+using pvpserver::netcode::ClientPrediction;
+using pvpserver::netcode::FixedClientPrediction;
+using pvpserver::netcode::PredictedPose;
+using pvpserver::netcode::Reconciliation;
+
+constexpr int kBots = 2000;
+constexpr int kTicks = 300;
+constexpr int kReconcileInterval = 3;  // 서버 스냅샷 주기 (20 Hz)
+constexpr int kServerLag = 6;          // 서버가 확인한 시퀀스 지연 (100ms)
+constexpr float kDelta = 1.0f / 60.0f;
+
+InputCommand MakeInput(std::uint32_t sequence) {
+    InputCommand input{};
+    input.sequence = sequence;
+    input.move_x = (sequence % 7 < 4) ? 1.0f : -1.0f;
+    input.move_y = (sequence % 5 < 2) ? 1.0f : 0.0f;
+    input.aim_radians = 0.5f;
+    return input;
+}
+
+}  // namespace
+
+// 봇 2000명 × 300틱: 매 틱 Predict+Save, 3틱마다 Reconcile
+TEST(PredictionPerformanceTest, FixedCapacityPredictReconcileThroughput) {
+    std::vector<FixedClientPrediction> bots(kBots);
+    std::vector<PredictedPose> poses(kBots);
+    std::vector<Reconciliation> reconcilers(kBots);
+
+    const auto start = steady_clock::now();
+    for (std::uint32_t seq = 1; seq <= static_cast<std::uint32_t>(kTicks); ++seq) {
+        const InputCommand input = MakeInput(seq);
+        for (int bot = 0; bot < kBots; ++bot) {
+            poses[bot] = bots[bot].Predict(poses[bot], input, kDelta);
+            bots[bot].SavePrediction(poses[bot]);
+            if (seq % kReconcileInterval == 0 && seq > static_cast<std::uint32_t>(kServerLag)) {
+                PredictedPose server = *bots[bot].GetPrediction(seq - kServerLag);
+                server.x += (bot % 10 == 0) ? 0.5 : 0.0;  // 10%는 예측 불일치
+                poses[bot] = reconcilers[bot].Reconcile(server, bots[bot], kDelta).corrected_pose;
+                poses[bot] = bots[bot].GetLatestPrediction().value_or(poses[bot]);
+            }
+        }
+    }
+    const double seconds = duration<double>(steady_clock::now() - start).count();
+    const double cycles_per_second = static_cast<double>(kBots) * kTicks / seconds;
+
+    std::cout << "[PERF] Fixed prediction: " << cycles_per_second
+              << " predict+reconcile cycles/sec (" << kBots << " bots)\n";
+    EXPECT_GT(cycles_per_second, 250'000.0);
+}
+
+// 비교용: 기존 deque/vector 기반 ClientPrediction
+TEST(PredictionPerformanceTest, LegacyPredictReconcileThroughput) {
+    std::vector<ClientPrediction> bots(kBots);
+    std::vector<PlayerState> states(kBots);
+    std::vector<Reconciliation> reconcilers(kBots);
+    for (int bot = 0; bot < kBots; ++bot) {
+        states[bot].player_id = "load-generator-bot-" + std::to_string(bot);
+    }
+
+    const auto start = steady_clock::now();
+    for (std::uint32_t seq = 1; seq <= static_cast<std::uint32_t>(kTicks); ++seq) {
+        const InputCommand input = MakeInput(seq);
+        for (int bot = 0; bot < kBots; ++bot) {
+            auto prediction = bots[bot].Predict(states[bot], input, kDelta);
+            bots[bot].SavePrediction(prediction);
+            states[bot] = prediction.state;
+            if (seq % kReconcileInterval == 0 && seq > static_cast<std::uint32_t>(kServerLag)) {
+                PlayerState server = bots[bot].GetPrediction(seq - kServerLag)->state;
+                server.x += (bot % 10 == 0) ? 0.5 : 0.0;
+                reconcilers[bot].Reconcile(server, seq - kServerLag, bots[bot], kDelta);
+            }
+        }
+    }
+    const double seconds = duration<double>(steady_clock::now() - start).count();
+    const double cycles_per_second = static_cast<double>(kBots) * kTicks / seconds;
+
+    std::cout << "[PERF] Legacy prediction: " << cycles_per_second
+              << " predict+reconcile cycles/sec (" << kBots << " bots)\n";
+    EXPECT_GT(cycles_per_second, 0.0);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/network/metrics_http_server.h"
+#include "pvpserver/network/profile_http_router.h"
+#include "pvpserver/stats/leaderboard_store.h"
+#include "pvpserver/stats/player_profile_service.h"
+
+namespace {
+using namespace std::chrono;
+namespace http = boost::beast::http;
+using pvpserver::MatchResult;
+using pvpserver::PlayerMatchStats;
+
+constexpr int kClients = 4;
+constexpr auto kDuration = milliseconds(1000);
+const std::string kTarget = "/leaderboard?limit=50";
+
+void RecordMatch(pvpserver::PlayerProfileService& service, int index, int players) {
+    const std::string match_id = "load-" + std::to_string(index);
+    const std::string winner = "player" + std::to_string(index % players);
+    const std::string loser = "player" + std::to_string((index * 7 + 1) % players);
+    if (winner == loser) {
+        return;
+    }
+    std::vector<PlayerMatchStats> stats{
+        PlayerMatchStats{match_id, winner, 5, 4, 1, 0, 100, 10},
+        PlayerMatchStats{match_id, loser, 5, 2, 0, 1, 40, 100},
+    };
+    service.RecordMatch(MatchResult{match_id, winner, loser, system_clock::now(), stats});
+}
+
+// 클라이언트 kClients개가 kDuration 동안 /leaderboard를 폴링하는 동안 매치 결과도 계속 기록
+double MeasureRequestsPerSecond(const pvpserver::ProfileHttpRouter::Options& options,
+                                bool keep_alive) {
+    constexpr int kPlayers = 2000;
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    auto service = std::make_shared<pvpserver::PlayerProfileService>(leaderboard);
+    for (int i = 0; i < kPlayers * 2; ++i) {
+        RecordMatch(*service, i, kPlayers);
+    }
+
+    boost::asio::io_context io_context;
+    auto router = std::make_shared<pvpserver::ProfileHttpRouter>(
+        [] { return std::string{}; }, service, options);
+    pvpserver::MetricsHttpServer::SharedRequestHandler handler =
+        [router](const pvpserver::MetricsHttpServer::Request& request) {
+            return router->HandleShared(request);
+        };
+    auto server = std::make_shared<pvpserver::MetricsHttpServer>(io_context, 0, handler);
+    server->Start();
+    std::thread server_thread([&]() { io_context.run(); });
+    const auto port = std::to_string(server->Port());
+
+    std::atomic<bool> running{true};
+    std::thread writer([&]() {
+        int index = kPlayers * 2;
+        while (running.load()) {
+            RecordMatch(*service, index++, kPlayers);
+            std::this_thread::sleep_for(milliseconds(5));
+        }
+    });
+
+    std::atomic<std::uint64_t> completed{0};
+    std::vector<std::thread> clients;
+    const auto deadline = steady_clock::now() + kDuration;
+    for (int c = 0; c < kClients; ++c) {
+        clients.emplace_back([&]() {
+            boost::asio::io_context client_io;
+            boost::asio::ip::tcp::resolver resolver(client_io);
+            const auto endpoints = resolver.resolve("127.0.0.1", port);
+            std::unique_ptr<boost::beast::tcp_stream> stream;
+            boost::beast::flat_buffer buffer;
+            while (steady_clock::now() < deadline) {
+                if (!stream) {
+                    stream = std::make_unique<boost::beast::tcp_stream>(client_io);
+                    stream->connect(endpoints);
+                }
+                http::request<http::string_body> request{http::verb::get, kTarget, 11};
+                request.set(http::field::host, "127.0.0.1");
+                request.keep_alive(keep_alive);
+                http::write(*stream, request);
+                http::response<http::string_body> response;
+                http::read(*stream, buffer, response);
+                if (response.result() == http::status::ok && !response.body().empty()) {
+                    completed.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (!response.keep_alive()) {
+                    boost::system::error_code ec;
+                    stream->socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+                    stream.reset();
+                    buffer.clear();
+                }
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    running = false;
+    writer.join();
+    server->Stop();
+    io_context.stop();
+    server_thread.join();
+
+    return static_cast<double>(completed.load()) /
+           duration_cast<duration<double>>(kDuration).count();
+}
+}  // namespace
+
+TEST(ProfileHttpLoadTest, CachedLeaderboardRequestsPerSecond) {
+    pvpserver::ProfileHttpRouter::Options uncached;
+    uncached.cache_enabled = false;
+    pvpserver::ProfileHttpRouter::Options cached;
+    cached.leaderboard_refresh = milliseconds(250);
+
+    const double baseline = MeasureRequestsPerSecond(uncached, false);
+    const double keep_alive_only = MeasureRequestsPerSecond(uncached, true);
+    const double cached_keep_alive = MeasureRequestsPerSecond(cached, true);
+
+    std::cout << "[PERF] /leaderboard?limit=50 clients=" << kClients
+              << " rps uncached+close=" << baseline << " uncached+keepalive=" << keep_alive_only
+              << " cached+keepalive=" << cached_keep_alive << std::endl;
+
+    EXPECT_GT(cached_keep_alive, 200.0);
+    EXPECT_GT(cached_keep_alive, baseline);
+}
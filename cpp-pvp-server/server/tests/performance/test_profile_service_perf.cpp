@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pvpserver/stats/leaderboard_store.h"
@@ -29,3 +32,74 @@ TEST(PlayerProfileServicePerformanceTest, RecordsHundredMatchesUnderBudget) {
         std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count();
     EXPECT_LE(elapsed_ms, 5);
 }
+
+// 방 4개가 동시에 매치를 기록하는 동안 HTTP 스레드 2개가 프로필을 폴링
+TEST(PlayerProfileServicePerformanceTest, ConcurrentRecordAndProfileReads) {
+    constexpr int kPlayers = 10000;
+    constexpr int kWriters = 4;
+    constexpr int kMatchesPerWriter = 5000;
+    constexpr int kReaders = 2;
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    pvpserver::PlayerProfileService service(leaderboard);
+    const auto now = std::chrono::system_clock::now();
+
+    std::vector<std::string> ids;
+    ids.reserve(kPlayers);
+    for (int i = 0; i < kPlayers; ++i) {
+        ids.push_back("player" + std::to_string(i));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<std::uint64_t> reads{0};
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kReaders; ++r) {
+        threads.emplace_back([&, r]() {
+            std::uint64_t local = 0;
+            for (std::size_t i = static_cast<std::size_t>(r); !done.load(std::memory_order_relaxed);
+                 i += 13) {
+                if (service.GetProfile(ids[i % ids.size()])) {
+                    ++local;
+                }
+                if (local % 512 == 0) {
+                    service.TopProfiles(50);
+                }
+            }
+            reads.fetch_add(local);
+        });
+    }
+    std::vector<std::thread> writers;
+    for (int w = 0; w < kWriters; ++w) {
+        writers.emplace_back([&, w]() {
+            for (int i = 0; i < kMatchesPerWriter; ++i) {
+                const auto& winner = ids[(i * 31 + w * 977) % kPlayers];
+                const auto& loser = ids[(i * 17 + w * 131 + 1) % kPlayers];
+                if (winner == loser) {
+                    continue;
+                }
+                const std::string match_id = std::to_string(w) + "-" + std::to_string(i);
+                std::vector<pvpserver::PlayerMatchStats> stats{
+                    pvpserver::PlayerMatchStats{match_id, winner, 5, 5, 1, 0, 100, 10},
+                    pvpserver::PlayerMatchStats{match_id, loser, 4, 2, 0, 1, 40, 100},
+                };
+                service.RecordMatch(pvpserver::MatchResult{match_id, winner, loser, now, stats});
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    done = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const double matches_per_sec = kWriters * kMatchesPerWriter / seconds;
+    std::cout << "[PERF] profile_service writers=" << kWriters << " readers=" << kReaders
+              << " matches_per_sec=" << matches_per_sec
+              << " profile_reads_per_sec=" << static_cast<double>(reads.load()) / seconds
+              << std::endl;
+    EXPECT_GT(matches_per_sec, 5000.0);
+}
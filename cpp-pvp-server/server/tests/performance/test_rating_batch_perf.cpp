@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/stats/leaderboard_store.h"
+#include "pvpserver/stats/player_profile_service.h"
+#include "pvpserver/stats/rating_batch_job.h"
+
+namespace {
+using namespace std::chrono;
+
+// 기본값은 게이트 빌드(최적화 없음)에서도 몇 초 안에 끝나는 크기.
+// 수백만 명 측정: PVPSERVER_RATING_BENCH_PROFILES=5000000
+std::size_t BenchProfiles(std::size_t fallback) {
+    if (const char* env = std::getenv("PVPSERVER_RATING_BENCH_PROFILES")) {
+        return static_cast<std::size_t>(std::strtoull(env, nullptr, 10));
+    }
+    return fallback;
+}
+
+double Seconds(steady_clock::time_point start) {
+    return duration<double>(steady_clock::now() - start).count();
+}
+
+// 예전 방식: 매치마다 pow 두 번
+std::pair<int, int> PowUpdate(int winner, int loser) {
+    const double expected_winner = 1.0 / (1.0 + std::pow(10.0, (loser - winner) / 400.0));
+    const double expected_loser = 1.0 / (1.0 + std::pow(10.0, (winner - loser) / 400.0));
+    return {static_cast<int>(std::lround(winner + 25.0 * (1.0 - expected_winner))),
+            static_cast<int>(std::lround(loser + 25.0 * (0.0 - expected_loser)))};
+}
+}  // namespace
+
+TEST(RatingBatchPerformanceTest, DecayAndReplayThroughput) {
+    const std::size_t profiles = BenchProfiles(1000000);
+    std::mt19937 rng(3);
+    std::vector<pvpserver::RatingRecord> records(profiles);
+    const std::int64_t now_ms = 400LL * 24 * 60 * 60 * 1000;
+    for (auto& record : records) {
+        record.rating = 900 + static_cast<int>(rng() % 1200);
+        record.matches = 1 + rng() % 200;
+        record.last_match_ms = now_ms - static_cast<std::int64_t>(rng() % 60) * 24 * 60 * 60 * 1000;
+    }
+    pvpserver::RatingDecayPolicy decay;
+    const pvpserver::RatingTransform transform = [&](const pvpserver::RatingRecord& record) {
+        return decay.Apply(record, now_ms);
+    };
+
+    pvpserver::RatingBatchEngine single(1);
+    pvpserver::RatingBatchEngine pool(0);
+    auto start = steady_clock::now();
+    const auto single_result = single.Transform(records, transform);
+    const double single_seconds = Seconds(start);
+    start = steady_clock::now();
+    const auto pool_result = pool.Transform(records, transform);
+    const double pool_seconds = Seconds(start);
+    EXPECT_EQ(single_result, pool_result);
+
+    // 1:1 매치 재계산: 표 + 라운드 병렬 vs pow 순차
+    const std::size_t players = std::max<std::size_t>(2, profiles / 10);
+    std::vector<pvpserver::DuelOutcome> duels(profiles);
+    for (auto& duel : duels) {
+        duel.winner = static_cast<std::uint32_t>(rng() % players);
+        duel.loser = static_cast<std::uint32_t>((duel.winner + 1 + rng() % (players - 1)) % players);
+    }
+    std::vector<int> pow_ratings(players, 1200);
+    start = steady_clock::now();
+    for (const auto& duel : duels) {
+        const auto update = PowUpdate(pow_ratings[duel.winner], pow_ratings[duel.loser]);
+        pow_ratings[duel.winner] = update.first;
+        pow_ratings[duel.loser] = update.second;
+    }
+    const double pow_seconds = Seconds(start);
+    std::vector<int> table_ratings(players, 1200);
+    start = steady_clock::now();
+    const auto rounds = pool.ReplayDuels(table_ratings, duels);
+    const double replay_seconds = Seconds(start);
+    EXPECT_EQ(pow_ratings, table_ratings);
+
+    std::cout << "[PERF] rating decay profiles=" << profiles
+              << " profiles/s 1-thread=" << profiles / single_seconds << " "
+              << pool.Threads() << "-thread=" << profiles / pool_seconds << std::endl;
+    std::cout << "[PERF] rating replay duels=" << duels.size() << " players=" << players
+              << " rounds=" << rounds << " duels/s pow-sequential=" << duels.size() / pow_seconds
+              << " table-batched=" << duels.size() / replay_seconds << std::endl;
+}
+
+TEST(RatingBatchPerformanceTest, ServiceApplyRatingJobProfilesPerSecond) {
+    const std::size_t profiles = BenchProfiles(1000000) / 5;
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    pvpserver::PlayerProfileService service(leaderboard);
+    const auto old = std::chrono::system_clock::now() - hours(24 * 30);
+    for (std::size_t i = 0; i + 1 < profiles; i += 2) {
+        const auto index = std::to_string(i);
+        std::vector<pvpserver::PlayerMatchStats> stats{
+            pvpserver::PlayerMatchStats{"m" + index, "w" + index, 1, 1, 0, 0, 10, 0},
+            pvpserver::PlayerMatchStats{"m" + index, "l" + index, 1, 0, 0, 0, 0, 10},
+        };
+        service.RecordMatch(
+            pvpserver::MatchResult{"m" + index, "w" + index, "l" + index, old, stats});
+    }
+
+    pvpserver::RatingBatchEngine engine(0);
+    pvpserver::SeasonResetPolicy reset;
+    reset.anchor = 1000;
+    const auto start = steady_clock::now();
+    const auto report = service.ApplyRatingJob(
+        engine, [&](const pvpserver::RatingRecord& record) { return reset.Apply(record); });
+    const double seconds = Seconds(start);
+
+    std::cout << "[PERF] rating job profiles=" << report.profiles
+              << " profiles/s=" << report.profiles / seconds
+              << " compute_ms=" << report.compute_seconds * 1000
+              << " stripes_locked_ms=" << report.apply_seconds * 1000
+              << " leaderboard_ms=" << report.leaderboard_seconds * 1000 << std::endl;
+    EXPECT_EQ(report.profiles, report.changed);
+    EXPECT_EQ(report.profiles, leaderboard->Size());
+    EXPECT_GT(report.profiles / seconds, 20000.0);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/storage/cached_session_store.h"
+#include "pvpserver/storage/in_memory_session_store.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::storage::InMemorySessionStore;
+using pvpserver::storage::SessionData;
+
+// 기본값은 게이트 빌드에서도 빨리 끝나는 크기. 크게: PVPSERVER_SESSION_BENCH_SESSIONS=500000
+std::size_t BenchSessions(std::size_t fallback) {
+    if (const char* env = std::getenv("PVPSERVER_SESSION_BENCH_SESSIONS")) {
+        return static_cast<std::size_t>(std::strtoull(env, nullptr, 10));
+    }
+    return fallback;
+}
+
+SessionData MakeSession(std::size_t index) {
+    SessionData data;
+    data.player_id = "player-" + std::to_string(index);
+    data.player_name = "name";
+    data.server_id = "server-1";
+    data.created_at = pvpserver::storage::GetCurrentTimestamp();
+    data.last_activity = data.created_at;
+    data.elo_rating = 1200;
+    return data;
+}
+}  // namespace
+
+// 16 스레드: Get 80% / Refresh 15% / Save 5%
+TEST(SessionStorePerformanceTest, MixedGetRefreshSaveContention) {
+    constexpr int kThreads = 16;
+    constexpr int kOpsPerThread = 20000;
+    const std::size_t sessions = BenchSessions(50000);
+
+    InMemorySessionStore store(3600, 3600);
+    std::vector<std::string> ids(sessions);
+    for (std::size_t i = 0; i < sessions; ++i) {
+        ids[i] = "session-" + std::to_string(i);
+        store.SaveSession(ids[i], MakeSession(i));
+    }
+
+    std::atomic<std::uint64_t> hits{0};
+    std::vector<std::thread> threads;
+    const auto start = steady_clock::now();
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 rng(static_cast<unsigned>(t));
+            std::uint64_t local_hits = 0;
+            for (int i = 0; i < kOpsPerThread; ++i) {
+                const std::size_t index = rng() % sessions;
+                const unsigned op = rng() % 100;
+                if (op < 80) {
+                    local_hits += store.GetSession(ids[index]).has_value() ? 1 : 0;
+                } else if (op < 95) {
+                    store.RefreshSession(ids[index]);
+                } else {
+                    store.SaveSession(ids[index], MakeSession(index));
+                }
+            }
+            hits.fetch_add(local_hits);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const double seconds = duration<double>(steady_clock::now() - start).count();
+    const double ops = static_cast<double>(kThreads) * kOpsPerThread;
+
+    // 만료 없는 정리 한 번 (살아 있는 세션 수와 무관해야 함)
+    const auto sweep_start = steady_clock::now();
+    store.CleanExpiredSessions();
+    const double sweep_ms = duration<double, std::milli>(steady_clock::now() - sweep_start).count();
+
+    std::cout << "[PERF] session store threads=" << kThreads << " sessions=" << sessions
+              << " ops/s=" << ops / seconds << " sweep_ms=" << sweep_ms << std::endl;
+    EXPECT_GT(hits.load(), 0u);
+    EXPECT_EQ(sessions, store.GetActiveSessionCount());
+}
+
+// SessionData 인코딩/디코딩: 바이너리 vs 이전 JSON
+TEST(SessionStorePerformanceTest, SessionDataCodecThroughput) {
+    constexpr int kIterations = 200000;
+    SessionData data = MakeSession(123456);
+    data.player_name = "PlayerNameLong";
+    data.match_id = "match-0123456789";
+
+    const auto measure = [](auto&& body) {
+        const auto start = steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            body(i);
+        }
+        return kIterations / duration<double>(steady_clock::now() - start).count();
+    };
+
+    std::size_t sink = 0;
+    std::string buffer;
+    const double json_encode = measure([&](int) { sink += data.SerializeJson().size(); });
+    const double binary_encode = measure([&](int) {
+        buffer.clear();
+        data.SerializeTo(buffer);
+        sink += buffer.size();
+    });
+    const std::string json = data.SerializeJson();
+    const std::string binary = data.Serialize();
+    const double json_decode =
+        measure([&](int) { sink += SessionData::Deserialize(json)->elo_rating; });
+    const double binary_decode =
+        measure([&](int) { sink += SessionData::Deserialize(binary)->elo_rating; });
+    const double view_decode = measure(
+        [&](int) { sink += pvpserver::storage::SessionDataView::Parse(binary)->player_id.size(); });
+
+    std::cout << "[PERF] session codec bytes json=" << json.size() << " binary=" << binary.size()
+              << " encode/s json=" << json_encode << " binary=" << binary_encode
+              << " decode/s json=" << json_decode << " binary=" << binary_decode
+              << " view=" << view_decode << std::endl;
+    EXPECT_GT(sink, 0u);
+    EXPECT_LT(binary.size(), json.size());
+}
+
+// near-cache 크기 정하기: 치우친 접근(상위 소수 세션에 집중)에서 capacity별 적중률
+// (백엔드가 인메모리라 속도 이득은 없음 - Redis에서는 miss 하나 = 왕복 하나)
+TEST(SessionStorePerformanceTest, NearCacheHitRatioByCapacity) {
+    constexpr int kLookups = 200000;
+    const std::size_t sessions = BenchSessions(50000);
+    auto backend = std::make_shared<InMemorySessionStore>(3600, 3600);
+    std::vector<std::string> ids(sessions);
+    for (std::size_t i = 0; i < sessions; ++i) {
+        ids[i] = "session-" + std::to_string(i);
+        backend->SaveSession(ids[i], MakeSession(i));
+    }
+    // u^4: 상위 10% 세션이 조회의 약 56%
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<std::size_t> accesses(kLookups);
+    for (auto& index : accesses) {
+        const double u = uniform(rng);
+        index = static_cast<std::size_t>(u * u * u * u * static_cast<double>(sessions - 1));
+    }
+
+    auto start = steady_clock::now();
+    for (const auto index : accesses) {
+        backend->GetSession(ids[index]);
+    }
+    const double direct = kLookups / duration<double>(steady_clock::now() - start).count();
+    std::cout << "[PERF] near-cache sessions=" << sessions << " direct lookups/s=" << direct
+              << std::endl;
+
+    double previous_ratio = -1.0;
+    for (const double fraction : {0.01, 0.05, 0.2}) {
+        pvpserver::storage::NearCacheOptions options;
+        options.capacity = std::max<std::size_t>(16, static_cast<std::size_t>(sessions * fraction));
+        options.ttl = seconds(60);
+        pvpserver::storage::CachedSessionStore cache(backend, options);
+        start = steady_clock::now();
+        for (const auto index : accesses) {
+            cache.GetSession(ids[index]);
+        }
+        const double cached = kLookups / duration<double>(steady_clock::now() - start).count();
+        const auto stats = cache.Stats();
+        std::cout << "[PERF] near-cache capacity=" << options.capacity
+                  << " hit_ratio=" << stats.SessionHitRatio() << " lookups/s=" << cached
+                  << " evictions=" << stats.evictions << std::endl;
+        EXPECT_GT(stats.SessionHitRatio(), previous_ratio);
+        previous_ratio = stats.SessionHitRatio();
+    }
+}
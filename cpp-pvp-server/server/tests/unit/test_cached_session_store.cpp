@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/storage/cached_session_store.h"
+#include "pvpserver/storage/in_memory_session_store.h"
+
+namespace {
+
+using pvpserver::storage::CachedSessionStore;
+using pvpserver::storage::InMemorySessionStore;
+using pvpserver::storage::NearCacheOptions;
+using pvpserver::storage::SessionData;
+using pvpserver::storage::SessionInvalidationBus;
+using pvpserver::storage::SessionStore;
+
+// 백엔드 호출 수를 세는 래퍼 (on_get: 조회 중 끼어들 동작)
+class CountingStore : public SessionStore {
+   public:
+    bool SaveSession(const std::string& id, const SessionData& data) override {
+        return inner_.SaveSession(id, data);
+    }
+    std::optional<SessionData> GetSession(const std::string& id) override {
+        ++gets;
+        auto data = inner_.GetSession(id);
+        if (on_get) {
+            on_get();
+        }
+        return data;
+    }
+    bool DeleteSession(const std::string& id) override { return inner_.DeleteSession(id); }
+    bool RefreshSession(const std::string& id) override { return inner_.RefreshSession(id); }
+    std::vector<std::string> GetAllSessionIds() override { return inner_.GetAllSessionIds(); }
+    std::optional<std::string> GetSessionByPlayerId(const std::string& player_id) override {
+        ++player_gets;
+        return inner_.GetSessionByPlayerId(player_id);
+    }
+    size_t GetActiveSessionCount() override { return inner_.GetActiveSessionCount(); }
+    bool SessionExists(const std::string& id) override { return inner_.SessionExists(id); }
+
+    int gets = 0;
+    int player_gets = 0;
+    std::function<void()> on_get;
+
+   private:
+    InMemorySessionStore inner_{3600, 3600};
+};
+
+// 프로세스 안에서 모든 구독자에게 바로 전달 (Redis Pub/Sub 대역)
+class LocalBus : public SessionInvalidationBus {
+   public:
+    void Publish(const std::string& message) override {
+        std::vector<Handler> handlers;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            handlers = handlers_;
+        }
+        for (const auto& handler : handlers) {
+            handler(message);
+        }
+    }
+    void Subscribe(Handler handler) override {
+        std::lock_guard<std::mutex> lk(mutex_);
+        handlers_.push_back(std::move(handler));
+    }
+
+   private:
+    std::mutex mutex_;
+    std::vector<Handler> handlers_;
+};
+
+SessionData MakeSession(const std::string& player_id, int elo = 1200) {
+    SessionData data;
+    data.player_id = player_id;
+    data.player_name = "name-" + player_id;
+    data.server_id = "server-1";
+    data.created_at = pvpserver::storage::GetCurrentTimestamp();
+    data.last_activity = data.created_at;
+    data.elo_rating = elo;
+    return data;
+}
+
+NearCacheOptions Options(std::size_t capacity, std::chrono::milliseconds ttl,
+                         std::size_t shards = 4) {
+    NearCacheOptions options;
+    options.capacity = capacity;
+    options.ttl = ttl;
+    options.shards = shards;
+    return options;
+}
+
+}  // namespace
+
+TEST(CachedSessionStoreTest, HitsSkipBackendAndReportRatio) {
+    auto backend = std::make_shared<CountingStore>();
+    CachedSessionStore cache(backend, Options(100, std::chrono::seconds(60)));
+    ASSERT_TRUE(cache.SaveSession("s1", MakeSession("p1")));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(cache.GetSession("s1").has_value());
+        EXPECT_EQ("s1", cache.GetSessionByPlayerId("p1").value_or(""));
+    }
+    EXPECT_TRUE(cache.SessionExists("s1"));
+    EXPECT_EQ(1, backend->gets);
+    EXPECT_EQ(1, backend->player_gets);
+
+    // 없는 세션은 캐시하지 않음
+    EXPECT_FALSE(cache.GetSession("missing").has_value());
+    EXPECT_FALSE(cache.GetSession("missing").has_value());
+    EXPECT_EQ(3, backend->gets);
+
+    const auto stats = cache.Stats();
+    EXPECT_EQ(4u, stats.session_hits);  // 4번 중 첫 번째는 miss, SessionExists는 hit
+    EXPECT_EQ(3u, stats.session_misses);
+    EXPECT_DOUBLE_EQ(0.75, stats.PlayerHitRatio());
+    const auto metrics = cache.MetricsSnapshot();
+    EXPECT_NE(std::string::npos,
+              metrics.find("session_near_cache_requests_total{cache=\"session\",result=\"hit\"} 4"));
+    EXPECT_NE(std::string::npos, metrics.find("session_near_cache_hit_ratio{cache=\"player\"} 0.75"));
+}
+
+TEST(CachedSessionStoreTest, SaveAndDeleteInvalidateSessionAndPlayer) {
+    auto backend = std::make_shared<CountingStore>();
+    CachedSessionStore cache(backend, Options(100, std::chrono::seconds(60)));
+    cache.SaveSession("s1", MakeSession("p1", 1200));
+    EXPECT_EQ(1200, cache.GetSession("s1")->elo_rating);
+    EXPECT_EQ("s1", cache.GetSessionByPlayerId("p1").value_or(""));
+
+    cache.SaveSession("s1", MakeSession("p1", 1300));
+    EXPECT_EQ(1300, cache.GetSession("s1")->elo_rating);
+
+    // 세션의 플레이어가 바뀌면 이전 플레이어 매핑도 버림
+    cache.SaveSession("s1", MakeSession("p2"));
+    EXPECT_EQ("s1", cache.GetSessionByPlayerId("p2").value_or(""));
+
+    // 캐시에 없는 세션을 지워도 player 매핑까지 무효화
+    cache.InvalidateSession("s1");
+    EXPECT_TRUE(cache.DeleteSession("s1"));
+    EXPECT_FALSE(cache.GetSession("s1").has_value());
+    EXPECT_FALSE(cache.GetSessionByPlayerId("p2").has_value());
+    EXPECT_GE(cache.Stats().local_invalidations, 4u);
+}
+
+TEST(CachedSessionStoreTest, EntriesExpireAfterTtl) {
+    auto backend = std::make_shared<CountingStore>();
+    CachedSessionStore cache(backend, Options(100, std::chrono::milliseconds(30)));
+    cache.SaveSession("s1", MakeSession("p1"));
+    cache.GetSession("s1");
+    cache.GetSession("s1");
+    EXPECT_EQ(1, backend->gets);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    cache.GetSession("s1");
+    EXPECT_EQ(2, backend->gets);
+    EXPECT_EQ(1u, cache.Stats().expirations);
+}
+
+TEST(CachedSessionStoreTest, CapacityEvictsLeastRecentlyUsed) {
+    auto backend = std::make_shared<CountingStore>();
+    CachedSessionStore cache(backend, Options(3, std::chrono::seconds(60), 1));
+    for (int i = 0; i < 3; ++i) {
+        cache.SaveSession("s" + std::to_string(i), MakeSession("p" + std::to_string(i)));
+        cache.GetSession("s" + std::to_string(i));
+    }
+    cache.GetSession("s0");  // s1이 가장 오래 안 쓴 엔트리가 됨
+    cache.SaveSession("s3", MakeSession("p3"));
+    cache.GetSession("s3");
+    EXPECT_EQ(1u, cache.Stats().evictions);
+    EXPECT_EQ(3u, cache.Stats().entries);
+
+    const int before = backend->gets;
+    cache.GetSession("s0");
+    cache.GetSession("s2");
+    EXPECT_EQ(before, backend->gets);
+    cache.GetSession("s1");
+    EXPECT_EQ(before + 1, backend->gets);
+}
+
+TEST(CachedSessionStoreTest, InvalidationDuringBackendReadDropsStaleValue) {
+    auto backend = std::make_shared<CountingStore>();
+    CachedSessionStore cache(backend, Options(100, std::chrono::seconds(60)));
+    backend->SaveSession("s1", MakeSession("p1", 1200));
+
+    // 백엔드가 옛 값을 돌려주는 사이 다른 스레드가 저장 + 무효화한 상황
+    bool fired = false;
+    backend->on_get = [&] {
+        if (!fired) {
+            fired = true;
+            cache.SaveSession("s1", MakeSession("p1", 1400));
+        }
+    };
+    EXPECT_EQ(1200, cache.GetSession("s1")->elo_rating);
+    EXPECT_EQ(1400, cache.GetSession("s1")->elo_rating);
+    EXPECT_EQ(2, backend->gets);
+}
+
+TEST(CachedSessionStoreTest, BusInvalidatesPeerNodes) {
+    auto backend = std::make_shared<CountingStore>();
+    auto bus = std::make_shared<LocalBus>();
+    CachedSessionStore node_a(backend, Options(100, std::chrono::seconds(60)), bus);
+    CachedSessionStore node_b(backend, Options(100, std::chrono::seconds(60)), bus);
+
+    node_a.SaveSession("s1", MakeSession("p1", 1200));
+    EXPECT_EQ(1200, node_b.GetSession("s1")->elo_rating);
+    EXPECT_EQ("s1", node_b.GetSessionByPlayerId("p1").value_or(""));
+
+    node_a.SaveSession("s1", MakeSession("p1", 1500));
+    EXPECT_EQ(1500, node_b.GetSession("s1")->elo_rating);
+    node_a.DeleteSession("s1");
+    EXPECT_FALSE(node_b.GetSessionByPlayerId("p1").has_value());
+
+    // 자기 메시지는 원격 무효화로 세지 않음
+    EXPECT_EQ(0u, node_a.Stats().remote_invalidations);
+    EXPECT_EQ(3u, node_b.Stats().remote_invalidations);
+
+    {
+        CachedSessionStore short_lived(backend, Options(10, std::chrono::seconds(60)), bus);
+    }
+    node_a.SaveSession("s2", MakeSession("p2"));  // 소멸한 구독자에게 가도 안전
+}
@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <string>
+#include <vector>
 
 #include "pvpserver/core/config.h"
 
@@ -46,3 +47,15 @@ TEST(GameConfigTest, ReadsEnvironmentVariables) {
     EXPECT_DOUBLE_EQ(75.0, config.tick_rate());
     EXPECT_EQ("postgresql://example.com:5432/arena", config.database_dsn());
 }
+
+TEST(GameConfigTest, ParsesMatchmakingRegionList) {
+    EnvVarGuard regions_guard("PVPSERVER_MATCHMAKING_REGIONS");
+
+    unsetenv("PVPSERVER_MATCHMAKING_REGIONS");
+    EXPECT_EQ(std::vector<std::string>{"global"},
+              pvpserver::GameConfig::FromEnv().matchmaking_regions());
+
+    setenv("PVPSERVER_MATCHMAKING_REGIONS", " kr, us ,,eu", 1);
+    EXPECT_EQ((std::vector<std::string>{"kr", "us", "eu"}),
+              pvpserver::GameConfig::FromEnv().matchmaking_regions());
+}
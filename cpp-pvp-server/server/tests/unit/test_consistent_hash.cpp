@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "pvpserver/distributed/consistent_hash.h"
+#include "pvpserver/distributed/load_balancer.h"
+
+namespace {
+
+using pvpserver::distributed::ConsistentHashRing;
+using pvpserver::distributed::LoadBalancer;
+using pvpserver::distributed::ServerInfo;
+
+std::vector<std::string> MakeKeys(int count) {
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        keys.push_back("player-" + std::to_string(i));
+    }
+    return keys;
+}
+
+ServerInfo MakeServer(const std::string& id, int connections = 0) {
+    ServerInfo info;
+    info.server_id = id;
+    info.host = "10.0.0.1";
+    info.current_connections = connections;
+    info.max_connections = 100000;
+    return info;
+}
+
+}  // namespace
+
+TEST(ConsistentHashRingTest, LookupAgreesWithGetNodesAndSpreadsEvenly) {
+    ConsistentHashRing ring;
+    for (int i = 0; i < 8; ++i) {
+        ring.AddNode("node-" + std::to_string(i));
+    }
+    ring.AddNode("node-0");  // 중복 무시
+    EXPECT_EQ(8u, ring.GetNodeCount());
+
+    const auto keys = MakeKeys(40000);
+    for (int i = 0; i < 200; ++i) {
+        const auto nodes = ring.GetNodes(keys[i], 3);
+        ASSERT_EQ(3u, nodes.size());
+        EXPECT_EQ(ring.GetNode(keys[i]), nodes[0]);
+        EXPECT_EQ(*ring.Lookup(keys[i]), nodes[0]);
+        EXPECT_NE(nodes[0], nodes[1]);
+        EXPECT_NE(nodes[1], nodes[2]);
+    }
+    EXPECT_EQ(8u, ring.GetNodes(keys[0], 100).size());
+
+    // 가상 노드 150개: 평균 대비 ±25% 안
+    const auto distribution = ring.GetDistribution(keys);
+    for (const auto& [node, count] : distribution) {
+        EXPECT_GT(count, 5000 * 0.75) << node;
+        EXPECT_LT(count, 5000 * 1.25) << node;
+    }
+}
+
+TEST(ConsistentHashRingTest, RemovingNodeMovesOnlyItsKeys) {
+    ConsistentHashRing ring;
+    for (int i = 0; i < 6; ++i) {
+        ring.AddNode("node-" + std::to_string(i));
+    }
+    const auto keys = MakeKeys(20000);
+    std::vector<std::string> before;
+    for (const auto& key : keys) {
+        before.push_back(ring.GetNode(key));
+    }
+
+    ring.RemoveNode("node-2");
+    EXPECT_FALSE(ring.HasNode("node-2"));
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto after = ring.GetNode(keys[i]);
+        if (before[i] != "node-2") {
+            EXPECT_EQ(before[i], after);
+        } else {
+            EXPECT_NE("node-2", after);
+        }
+    }
+
+    // 다시 추가하면 원래 배치로 (추가 순서와 무관)
+    ring.AddNode("node-2");
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(before[i], ring.GetNode(keys[i]));
+    }
+}
+
+TEST(ConsistentHashRingTest, JumpModeMovesOnlyToNewBucket) {
+    ConsistentHashRing ring(150, ConsistentHashRing::Mode::JUMP);
+    EXPECT_EQ(nullptr, ring.Lookup("nobody"));
+    for (int i = 0; i < 10; ++i) {
+        ring.AddNode("shard-" + std::to_string(i));
+    }
+    const auto keys = MakeKeys(50000);
+    std::vector<std::string> before;
+    for (const auto& key : keys) {
+        before.push_back(ring.GetNode(key));
+    }
+    ring.AddNode("shard-10");
+    int moved = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto after = ring.GetNode(keys[i]);
+        if (after != before[i]) {
+            EXPECT_EQ("shard-10", after);
+            ++moved;
+        }
+    }
+    // 기대 이동 비율 1/11
+    EXPECT_NEAR(50000.0 / 11, moved, 50000.0 / 11 * 0.1);
+
+    for (std::int32_t buckets = 1; buckets < 50; ++buckets) {
+        const auto bucket = ConsistentHashRing::JumpHash(0xDEADBEEFULL, buckets);
+        EXPECT_GE(bucket, 0);
+        EXPECT_LT(bucket, buckets);
+    }
+    EXPECT_EQ(0, ConsistentHashRing::JumpHash(12345, 1));
+}
+
+TEST(ConsistentHashRingTest, HashKeyCoversAllLengths) {
+    // 8바이트 경계 전후 길이에서 한 글자만 달라도 값이 바뀜
+    for (std::size_t length = 0; length < 24; ++length) {
+        std::string key(length, 'a');
+        const auto base = ConsistentHashRing::HashKey(key);
+        for (std::size_t i = 0; i < length; ++i) {
+            std::string changed = key;
+            changed[i] = 'b';
+            EXPECT_NE(base, ConsistentHashRing::HashKey(changed)) << length << ":" << i;
+        }
+        EXPECT_NE(base, ConsistentHashRing::HashKey(key + '\0'));
+    }
+}
+
+TEST(LoadBalancerBoundedLoadTest, HotServerSpillsToNextOnRing) {
+    LoadBalancer balancer;
+    for (int i = 0; i < 4; ++i) {
+        balancer.RegisterServer(MakeServer("game-" + std::to_string(i)));
+    }
+    const auto keys = MakeKeys(4000);
+    std::map<std::string, int> load;
+    for (const auto& key : keys) {
+        auto server = balancer.SelectServer(key);
+        ASSERT_TRUE(server.has_value());
+        balancer.UpdateServerLoad(server->server_id, ++load[server->server_id]);
+    }
+    // 상한 = ceil(평균 × 1.25)
+    for (const auto& [id, count] : load) {
+        EXPECT_LE(count, 1250) << id;
+    }
+
+    // 한 서버가 이미 과부하면 그 서버 담당 키도 다른 서버로
+    balancer.UpdateServerLoad("game-0", 100000 - 1);
+    for (int i = 0; i < 100; ++i) {
+        auto server = balancer.SelectServer(keys[i]);
+        ASSERT_TRUE(server.has_value());
+        EXPECT_NE("game-0", server->server_id);
+    }
+
+    // 상한 끄면 순수 해시 고정 (여유만 확인)
+    balancer.SetBoundedLoadFactor(0);
+    balancer.UpdateServerLoad("game-0", 0);
+    pvpserver::distributed::ConsistentHashRing ring;
+    for (int i = 0; i < 4; ++i) {
+        ring.AddNode("game-" + std::to_string(i));
+    }
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(ring.GetNode(keys[i]), balancer.SelectServer(keys[i])->server_id);
+    }
+}
+
+TEST(LoadBalancerBoundedLoadTest, UnhealthyServersAreSkippedInJumpMode) {
+    LoadBalancer balancer;
+    balancer.SetHashMode(ConsistentHashRing::Mode::JUMP);
+    balancer.RegisterServer(MakeServer("a"));
+    balancer.RegisterServer(MakeServer("b"));
+    balancer.MarkServerHealthy("a", false);
+    for (const auto& key : MakeKeys(50)) {
+        EXPECT_EQ("b", balancer.SelectServer(key).value_or(ServerInfo{}).server_id);
+    }
+    balancer.MarkServerHealthy("b", false);
+    EXPECT_FALSE(balancer.SelectServer("player-1").has_value());
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include "pvpserver/netcode/fixed_client_prediction.h"
+#include "pvpserver/netcode/reconciliation.h"
+
+namespace {
+
+using pvpserver::InputCommand;
+using pvpserver::netcode::FixedClientPrediction;
+using pvpserver::netcode::PredictedPose;
+using pvpserver::netcode::Reconciliation;
+
+constexpr float kDelta = 1.0f / 60.0f;
+
+InputCommand MakeInput(std::uint32_t sequence, float move_x) {
+    InputCommand input{};
+    input.sequence = sequence;
+    input.move_x = move_x;
+    return input;
+}
+
+}  // namespace
+
+TEST(FixedClientPredictionTest, UnacknowledgedInputsStayContiguousAcrossWrap) {
+    FixedClientPrediction prediction;
+    PredictedPose pose;
+    const std::uint32_t total = FixedClientPrediction::MAX_PENDING_INPUTS + 40;
+    for (std::uint32_t seq = 1; seq <= total; ++seq) {
+        pose = prediction.Predict(pose, MakeInput(seq, 1.0f), kDelta);
+        prediction.SavePrediction(pose);
+    }
+
+    // 용량 초과분은 오래된 순으로 버려짐
+    const auto all = prediction.GetUnacknowledgedInputs(0);
+    ASSERT_EQ(FixedClientPrediction::MAX_PENDING_INPUTS, all.size());
+    EXPECT_EQ(41u, all[0].sequence);
+    EXPECT_EQ(total, all.back().sequence);
+
+    prediction.AcknowledgeUpTo(total - 10);
+    const auto pending = prediction.GetUnacknowledgedInputs(total - 10);
+    ASSERT_EQ(10u, pending.size());
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        EXPECT_EQ(total - 9 + i, pending[i].sequence);
+    }
+    EXPECT_FALSE(prediction.GetPrediction(total - 10).has_value());
+    ASSERT_TRUE(prediction.GetPrediction(total).has_value());
+    EXPECT_EQ(total, prediction.GetLatestPrediction()->input_sequence);
+}
+
+TEST(FixedClientPredictionTest, ReconcileReplaysPendingInputsFromServerPose) {
+    FixedClientPrediction prediction;
+    Reconciliation reconciliation;
+    PredictedPose pose;
+    for (std::uint32_t seq = 1; seq <= 5; ++seq) {
+        pose = prediction.Predict(pose, MakeInput(seq, 1.0f), kDelta);
+        prediction.SavePrediction(pose);
+    }
+
+    // 서버는 시퀀스 3까지 처리했고 위치가 1m 어긋남
+    PredictedPose server = *prediction.GetPrediction(3);
+    server.x += 1.0;
+    const auto result = reconciliation.Reconcile(server, prediction, kDelta);
+
+    EXPECT_TRUE(result.mismatch_detected);
+    EXPECT_NEAR(pose.x + 1.0, result.corrected_pose.x, 1e-5);
+    EXPECT_EQ(5u, result.corrected_pose.input_sequence);
+    EXPECT_EQ(2u, prediction.GetUnacknowledgedInputs(3).size());
+    EXPECT_EQ(1u, reconciliation.GetStats().mismatches);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "pvpserver/game/fixed_point.h"
+#include "pvpserver/game/game_session.h"
+
+namespace {
+
+using pvpserver::Fixed;
+using pvpserver::FixedVec2;
+using pvpserver::GameSession;
+using pvpserver::MovementInput;
+using pvpserver::SimulationMode;
+
+constexpr double kDelta = 1.0 / 60.0;
+constexpr double kResolution = 1.0 / 65536.0;
+
+// alice는 왼쪽으로 물러나며 오른쪽(bob)을 사격하는 고정 스크립트 (틱별 체크섬 기록)
+std::vector<std::uint64_t> RunScript(GameSession& session) {
+    session.UpsertPlayer("alice");
+    session.UpsertPlayer("bob");
+    std::vector<std::uint64_t> checksums;
+    for (std::uint64_t tick = 0; tick < 120; ++tick) {
+        MovementInput a;
+        a.sequence = tick + 1;
+        a.left = tick % 3 != 0;
+        a.up = tick % 5 == 0;
+        a.mouse_x = 3.0;
+        a.mouse_y = 0.25;
+        a.fire = tick % 4 == 0;
+        session.ApplyInput("alice", a, kDelta);
+
+        MovementInput b;
+        b.sequence = tick + 1;
+        b.right = tick % 2 == 0;
+        b.down = tick % 7 == 0;
+        b.mouse_x = -1.0;
+        b.mouse_y = 0.1;
+        session.ApplyInput("bob", b, kDelta);
+
+        session.Tick(tick, kDelta);
+        checksums.push_back(session.StateChecksum());
+    }
+    return checksums;
+}
+
+}  // namespace
+
+TEST(FixedPointTest, ArithmeticRoundsAndSaturates) {
+    EXPECT_EQ(65536, Fixed::FromDouble(1.0).raw());
+    EXPECT_EQ(-32768, Fixed::FromDouble(-0.5).raw());
+    EXPECT_EQ(Fixed::FromDouble(1.5), Fixed::FromDouble(3.0) * Fixed::FromDouble(0.5));
+    EXPECT_EQ(Fixed::FromDouble(-0.75), Fixed::FromDouble(-1.5) / Fixed::FromInt(2));
+    EXPECT_EQ(INT32_MAX, Fixed::FromDouble(1e9).raw());
+    EXPECT_EQ(0, (Fixed::FromInt(1) / Fixed{}).raw());
+}
+
+TEST(FixedPointTest, CordicMatchesLibmWithinResolution) {
+    for (int degrees = -180; degrees <= 180; degrees += 15) {
+        const double radians = degrees * M_PI / 180.0;
+        const FixedVec2 dir = pvpserver::FixedDirection(Fixed::FromDouble(radians));
+        EXPECT_NEAR(std::cos(radians), dir.x.ToDouble(), 8 * kResolution) << degrees;
+        EXPECT_NEAR(std::sin(radians), dir.y.ToDouble(), 8 * kResolution) << degrees;
+
+        const Fixed angle = pvpserver::FixedAtan2(Fixed::FromDouble(std::sin(radians) * 4.0),
+                                                  Fixed::FromDouble(std::cos(radians) * 4.0));
+        EXPECT_NEAR(std::remainder(radians - angle.ToDouble(), 2 * M_PI), 0.0, 8 * kResolution)
+            << degrees;
+    }
+    const FixedVec2 unit = pvpserver::FixedNormalize(FixedVec2{Fixed::FromInt(3), Fixed::FromInt(4)});
+    EXPECT_NEAR(0.6, unit.x.ToDouble(), 2 * kResolution);
+    EXPECT_NEAR(0.8, unit.y.ToDouble(), 2 * kResolution);
+}
+
+TEST(FixedPointTest, FixedModeTracksFloatingPointMovement) {
+    GameSession floating(60.0);
+    GameSession fixed(60.0, SimulationMode::FixedPoint);
+    for (GameSession* session : {&floating, &fixed}) {
+        session->UpsertPlayer("p1");
+        MovementInput input;
+        input.up = true;
+        input.right = true;
+        input.mouse_x = 1.0;
+        input.mouse_y = 1.0;
+        for (std::uint64_t seq = 1; seq <= 60; ++seq) {
+            input.sequence = seq;
+            session->ApplyInput("p1", input, kDelta);
+        }
+    }
+    const auto expected = floating.GetPlayer("p1");
+    const auto actual = fixed.GetPlayer("p1");
+    // 틱마다 delta(1/60초)의 양자화 오차가 누적되므로 60틱 후 수 mm 이내
+    EXPECT_NEAR(expected.x, actual.x, 5e-3);
+    EXPECT_NEAR(expected.y, actual.y, 5e-3);
+    EXPECT_NEAR(expected.facing_radians, actual.facing_radians, 1e-3);
+}
+
+TEST(FixedPointTest, ReplayProducesIdenticalPerTickChecksums) {
+    GameSession first(60.0, SimulationMode::FixedPoint);
+    GameSession second(60.0, SimulationMode::FixedPoint);
+    const auto a = RunScript(first);
+    const auto b = RunScript(second);
+    EXPECT_EQ(a, b);
+    EXPECT_GT(first.GetPlayer("bob").health, 0);
+    EXPECT_LT(first.GetPlayer("bob").health, 100);  // 스크립트에서 적중 발생
+
+    // 정수 연산만 사용하므로 컴파일러/최적화 옵션과 무관한 골든 값 (리틀 엔디언 기준)
+    EXPECT_EQ(11644993758899598005ull, a.back());
+}
@@ -72,3 +72,35 @@ TEST(GameLoopTest, StopPreventsAdditionalTicks) {
     std::lock_guard<std::mutex> lock_guard(mutex);
     EXPECT_EQ(tick_count, 5);
 }
+
+TEST(GameLoopTest, TickWorkPercentileMeasuresCallbackTime) {
+    pvpserver::GameLoop loop(60.0);
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t tick_count = 0;
+
+    loop.SetUpdateCallback([&](const pvpserver::TickInfo& /*info*/) {
+        std::this_thread::sleep_for(2ms);
+        std::lock_guard<std::mutex> lk(mutex);
+        if (++tick_count == 6) {
+            cv.notify_one();
+        }
+    });
+    EXPECT_DOUBLE_EQ(0.0, loop.TickWorkPercentile(0.99));
+
+    loop.Start();
+    {
+        std::unique_lock<std::mutex> lk(mutex);
+        ASSERT_TRUE(cv.wait_for(lk, 1s, [&]() { return tick_count >= 6; }));
+    }
+    loop.Stop();
+    loop.Join();
+
+    // 틱 간격(~16.7ms)이 아니라 콜백이 쓴 시간(~2ms)
+    const double p99 = loop.TickWorkPercentile(0.99);
+    EXPECT_GE(p99, 0.002);
+    EXPECT_LT(p99, loop.TargetDelta());
+    EXPECT_LE(loop.TickWorkPercentile(0.5), p99);
+    EXPECT_NE(loop.PrometheusSnapshot().find("game_tick_work_seconds{quantile=\"0.99\"}"),
+              std::string::npos);
+}
@@ -39,3 +39,77 @@ TEST(GameSessionTest, RejectsOutOfOrderInputs) {
     const auto state = session.GetPlayer("p1");
     EXPECT_GT(state.last_sequence, 1u);
 }
+
+namespace {
+
+// 두 플레이어가 마주 보고 사격 → 발사체, 피격, 전투 로그가 모두 있는 상태
+void PlayDuel(pvpserver::GameSession& session, std::uint64_t ticks) {
+    session.UpsertPlayer("p1");
+    session.UpsertPlayer("p2");
+    pvpserver::MovementInput move;
+    move.sequence = 1;
+    move.right = true;
+    session.ApplyInput("p2", move, 1.0);  // p2를 p1 오른쪽 5m로
+    for (std::uint64_t tick = 0; tick < ticks; ++tick) {
+        pvpserver::MovementInput fire;
+        fire.sequence = tick + 1;
+        fire.mouse_x = 1.0;
+        fire.fire = true;
+        session.ApplyInput("p1", fire, 1.0 / 60.0);
+        session.Tick(tick, 1.0 / 60.0);
+    }
+}
+
+}  // namespace
+
+TEST(GameSessionTest, ExportImportRoundTripsAndContinuesIdentically) {
+    for (const auto mode :
+         {pvpserver::SimulationMode::FloatingPoint, pvpserver::SimulationMode::FixedPoint}) {
+        pvpserver::GameSession source(60.0, mode);
+        PlayDuel(source, 30);
+        ASSERT_GT(source.ActiveProjectileCount(), 0u);
+        ASSERT_LT(source.GetPlayer("p2").health, 100);
+
+        pvpserver::GameSession target(60.0, mode);
+        target.UpsertPlayer("stale");  // 복원은 기존 상태를 교체
+        target.ImportState(source.ExportState());
+        EXPECT_EQ(source.StateChecksum(), target.StateChecksum());
+        EXPECT_EQ(source.CombatLogSnapshot().size(), target.CombatLogSnapshot().size());
+        EXPECT_THROW(target.GetPlayer("stale"), std::exception);
+
+        // 이전 후에도 같은 입력이면 같은 결과 (피격/사망 판정 포함)
+        for (std::uint64_t tick = 30; tick < 90; ++tick) {
+            pvpserver::MovementInput fire;
+            fire.sequence = tick + 1;
+            fire.mouse_x = 1.0;
+            fire.fire = true;
+            source.ApplyInput("p1", fire, 1.0 / 60.0);
+            target.ApplyInput("p1", fire, 1.0 / 60.0);
+            source.Tick(tick, 1.0 / 60.0);
+            target.Tick(tick, 1.0 / 60.0);
+            ASSERT_EQ(source.StateChecksum(), target.StateChecksum()) << "tick " << tick;
+        }
+        EXPECT_EQ(source.GetPlayer("p2").health, target.GetPlayer("p2").health);
+        EXPECT_EQ(source.PlayersDeadTotal(), target.PlayersDeadTotal());
+    }
+}
+
+TEST(GameSessionTest, ImportRejectsMismatchedOrCorruptState) {
+    pvpserver::GameSession source(60.0);
+    PlayDuel(source, 10);
+    const auto state = source.ExportState();
+
+    pvpserver::GameSession fixed(60.0, pvpserver::SimulationMode::FixedPoint);
+    EXPECT_THROW(fixed.ImportState(state), std::runtime_error);
+
+    pvpserver::GameSession target(60.0);
+    target.UpsertPlayer("keep");
+    auto truncated = state;
+    truncated.resize(state.size() / 2);
+    EXPECT_THROW(target.ImportState(truncated), std::runtime_error);
+    auto bad_magic = state;
+    bad_magic[0] = 'X';
+    EXPECT_THROW(target.ImportState(bad_magic), std::runtime_error);
+    // 실패한 복원은 기존 상태를 건드리지 않음
+    EXPECT_NO_THROW(target.GetPlayer("keep"));
+}
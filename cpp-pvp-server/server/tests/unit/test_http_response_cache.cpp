@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "pvpserver/network/http_response_cache.h"
+
+namespace {
+using namespace std::chrono_literals;
+using pvpserver::HttpResponseCache;
+}  // namespace
+
+TEST(HttpResponseCacheTest, ReusesBytesUntilVersionChanges) {
+    HttpResponseCache cache("test");
+    int builds = 0;
+    auto builder = [&]() -> std::optional<std::string> {
+        ++builds;
+        return "v" + std::to_string(builds);
+    };
+
+    auto first = cache.GetOrBuild("top", 1, 0ms, builder);
+    auto second = cache.GetOrBuild("top", 1, 0ms, builder);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first.get(), second.get());  // 같은 버퍼 공유
+    EXPECT_EQ(1, builds);
+
+    auto third = cache.GetOrBuild("top", 2, 0ms, builder);
+    EXPECT_EQ("v2", *third);
+    EXPECT_EQ("v1", *first);  // 이전 버퍼는 그대로
+    EXPECT_EQ(2, builds);
+}
+
+TEST(HttpResponseCacheTest, ServesStaleBytesWithinRefreshInterval) {
+    HttpResponseCache cache("test");
+    int builds = 0;
+    auto builder = [&]() -> std::optional<std::string> {
+        ++builds;
+        return std::to_string(builds);
+    };
+
+    cache.GetOrBuild("top", 1, 200ms, builder);
+    EXPECT_EQ("1", *cache.GetOrBuild("top", 2, 200ms, builder));
+    EXPECT_EQ(1, builds);
+
+    std::this_thread::sleep_for(250ms);
+    EXPECT_EQ("2", *cache.GetOrBuild("top", 3, 200ms, builder));
+    EXPECT_EQ(2, builds);
+
+    const auto metrics = cache.MetricsSnapshot();
+    EXPECT_NE(metrics.find("http_response_cache_stale_hits_total{cache=\"test\"} 1"),
+              std::string::npos);
+    EXPECT_NE(metrics.find("http_response_cache_builds_total{cache=\"test\"} 2"),
+              std::string::npos);
+}
+
+TEST(HttpResponseCacheTest, DoesNotCacheMissingEntriesAndBoundsSize) {
+    HttpResponseCache cache("test", 2);
+    auto missing = [] { return std::optional<std::string>{}; };
+    EXPECT_EQ(nullptr, cache.GetOrBuild("ghost", 1, 0ms, missing));
+    EXPECT_EQ(0u, cache.Size());
+
+    auto builder = [] { return std::optional<std::string>{"x"}; };
+    cache.GetOrBuild("a", 1, 0ms, builder);
+    cache.GetOrBuild("b", 1, 0ms, builder);
+    cache.GetOrBuild("c", 2, 0ms, builder);  // 버전 1 항목부터 밀려남
+    EXPECT_EQ(1u, cache.Size());
+    cache.GetOrBuild("d", 2, 0ms, builder);
+    cache.GetOrBuild("e", 2, 0ms, builder);
+    EXPECT_LE(cache.Size(), 2u);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/storage/in_memory_session_store.h"
+#include "pvpserver/storage/timer_wheel.h"
+
+namespace {
+
+using namespace std::chrono;
+using pvpserver::storage::InMemorySessionStore;
+using pvpserver::storage::SessionData;
+using pvpserver::storage::TimerWheel;
+
+SessionData MakeSession(const std::string& player_id) {
+    SessionData data;
+    data.player_id = player_id;
+    data.player_name = "name-" + player_id;
+    data.server_id = "server-1";
+    data.created_at = pvpserver::storage::GetCurrentTimestamp();
+    data.last_activity = data.created_at;
+    data.elo_rating = 1200;
+    return data;
+}
+
+struct TestTimer : TimerWheel::Node {
+    int id{0};
+    std::uint64_t fired_at{0};
+};
+
+}  // namespace
+
+TEST(TimerWheelTest, ExpiresEveryNodeAtItsTickAcrossLevels) {
+    TimerWheel wheel(1000);
+    std::mt19937 rng(11);
+    std::vector<TestTimer> timers(2000);
+    for (std::size_t i = 0; i < timers.size(); ++i) {
+        timers[i].id = static_cast<int>(i);
+        // 레벨 0 ~ 3 모두 섞이도록 (64, 4096, 262144 경계 넘김)
+        const std::uint64_t span = std::uint64_t{1} << (6 * (1 + i % 4));
+        wheel.Schedule(timers[i], 1000 + rng() % span);
+    }
+    EXPECT_EQ(timers.size(), wheel.Size());
+
+    std::uint64_t now = 1000;
+    std::size_t expired = 0;
+    while (wheel.Size() > 0) {
+        now += 1 + rng() % 5000;
+        expired += wheel.Advance(now, [&](TimerWheel::Node& node) {
+            static_cast<TestTimer&>(node).fired_at = now;
+        });
+    }
+    EXPECT_EQ(timers.size(), expired);
+    for (const auto& timer : timers) {
+        // 만료 틱을 지난 첫 Advance에서 정확히 한 번
+        EXPECT_GE(timer.fired_at, timer.expiry_tick) << timer.id;
+        EXPECT_FALSE(timer.scheduled);
+    }
+}
+
+TEST(TimerWheelTest, RescheduleAndCancelMoveNodes) {
+    TimerWheel wheel(0);
+    TestTimer a;
+    TestTimer b;
+    wheel.Schedule(a, 10);
+    wheel.Schedule(b, 10);
+    wheel.Schedule(a, 5000);  // 재등록: 레벨 0 → 레벨 2
+    wheel.Cancel(b);
+    EXPECT_EQ(1u, wheel.Size());
+
+    std::vector<TimerWheel::Node*> fired;
+    const auto collect = [&](TimerWheel::Node& node) { fired.push_back(&node); };
+    EXPECT_EQ(0u, wheel.Advance(4999, collect));
+    EXPECT_EQ(1u, wheel.Advance(5000, collect));
+    ASSERT_EQ(1u, fired.size());
+    EXPECT_EQ(&a, fired[0]);
+    EXPECT_EQ(0u, wheel.Size());
+}
+
+TEST(InMemorySessionStoreTest, SaveGetAndPlayerLookup) {
+    InMemorySessionStore store(3600, 3600);
+    ASSERT_TRUE(store.SaveSession("s1", MakeSession("p1")));
+    ASSERT_TRUE(store.SaveSession("s2", MakeSession("p2")));
+
+    auto session = store.GetSession("s1");
+    ASSERT_TRUE(session.has_value());
+    EXPECT_EQ("p1", session->player_id);
+    EXPECT_EQ("s2", store.GetSessionByPlayerId("p2").value_or(""));
+    EXPECT_TRUE(store.SessionExists("s1"));
+    EXPECT_EQ(2u, store.GetActiveSessionCount());
+    EXPECT_EQ(2u, store.GetAllSessionIds().size());
+
+    EXPECT_TRUE(store.DeleteSession("s1"));
+    EXPECT_FALSE(store.DeleteSession("s1"));
+    EXPECT_FALSE(store.GetSession("s1").has_value());
+    EXPECT_FALSE(store.GetSessionByPlayerId("p1").has_value());
+    EXPECT_EQ(1u, store.GetActiveSessionCount());
+}
+
+TEST(InMemorySessionStoreTest, DeletingOldSessionKeepsNewerPlayerMapping) {
+    InMemorySessionStore store(3600, 3600);
+    store.SaveSession("old", MakeSession("p1"));
+    store.SaveSession("new", MakeSession("p1"));  // 재접속
+    EXPECT_EQ("new", store.GetSessionByPlayerId("p1").value_or(""));
+
+    store.DeleteSession("old");
+    EXPECT_EQ("new", store.GetSessionByPlayerId("p1").value_or(""));
+
+    // 같은 세션을 다른 플레이어로 덮어쓰면 이전 플레이어 매핑은 제거
+    store.SaveSession("new", MakeSession("p2"));
+    EXPECT_FALSE(store.GetSessionByPlayerId("p1").has_value());
+    EXPECT_EQ("new", store.GetSessionByPlayerId("p2").value_or(""));
+}
+
+TEST(InMemorySessionStoreTest, ExpiresOnWheelAndRefreshKeepsAlive) {
+    InMemorySessionStore store(milliseconds(150), seconds(3600), milliseconds(10));
+    store.SaveSession("idle", MakeSession("p-idle"));
+    store.SaveSession("active", MakeSession("p-active"));
+
+    for (int i = 0; i < 6; ++i) {
+        std::this_thread::sleep_for(milliseconds(50));
+        EXPECT_TRUE(store.RefreshSession("active"));
+    }
+    // idle은 조회 시점에 이미 만료로 보이고, 정리하면 메모리에서도 제거
+    EXPECT_FALSE(store.GetSession("idle").has_value());
+    EXPECT_FALSE(store.SessionExists("idle"));
+    EXPECT_FALSE(store.RefreshSession("idle"));
+    EXPECT_FALSE(store.GetSessionByPlayerId("p-idle").has_value());
+
+    store.CleanExpiredSessions();
+    EXPECT_EQ(1u, store.GetActiveSessionCount());
+    EXPECT_TRUE(store.GetSession("active").has_value());
+    EXPECT_EQ("active", store.GetSessionByPlayerId("p-active").value_or(""));
+}
+
+TEST(InMemorySessionStoreTest, ExpiredSessionsAreSweptWithinATick) {
+    InMemorySessionStore store(milliseconds(20), milliseconds(10), milliseconds(5));
+    for (int i = 0; i < 100; ++i) {
+        store.SaveSession("s" + std::to_string(i), MakeSession("p" + std::to_string(i)));
+    }
+    const auto deadline = steady_clock::now() + seconds(5);
+    // 만료 직후 한 틱 동안은 카운트에 남을 수 있음 → 몇 틱 기다림
+    while (store.GetActiveSessionCount() > 0 && steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+    EXPECT_EQ(0u, store.GetActiveSessionCount());
+    EXPECT_TRUE(store.GetAllSessionIds().empty());
+    store.StopCleanup();  // 소멸자와 중복 호출해도 안전
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -37,3 +40,109 @@ TEST(LeaderboardStoreTest, MaintainsDeterministicOrderingAndUpdates) {
     EXPECT_EQ("charlie", remaining[1].first);
     EXPECT_EQ(2u, store.Size());
 }
+
+TEST(LeaderboardStoreTest, RankAndRangeFollowDescendingOrder) {
+    pvpserver::InMemoryLeaderboardStore store;
+    store.Upsert("alice", 1200);
+    store.Upsert("bob", 1300);
+    store.Upsert("charlie", 1300);
+    store.Upsert("dave", 1100);
+
+    EXPECT_EQ(0u, store.Rank("bob").value());
+    EXPECT_EQ(1u, store.Rank("charlie").value());
+    EXPECT_EQ(2u, store.Rank("alice").value());
+    EXPECT_EQ(3u, store.Rank("dave").value());
+    EXPECT_FALSE(store.Rank("nobody").has_value());
+
+    auto middle = store.Range(1, 2);
+    ASSERT_EQ(2u, middle.size());
+    EXPECT_EQ("charlie", middle[0].first);
+    EXPECT_EQ("alice", middle[1].first);
+    EXPECT_TRUE(store.Range(4, 10).empty());
+    EXPECT_EQ(1u, store.Range(3, 10).size());
+
+    store.Upsert("dave", 1500);
+    EXPECT_EQ(0u, store.Rank("dave").value());
+    EXPECT_EQ(3u, store.Rank("alice").value());
+    store.Erase("bob");
+    EXPECT_EQ(1u, store.Rank("charlie").value());
+    EXPECT_EQ(3u, store.Size());
+}
+
+TEST(LeaderboardStoreTest, RankMatchesSortedReferenceUnderChurn) {
+    pvpserver::InMemoryLeaderboardStore store;
+    std::map<std::string, int> reference;
+    std::mt19937 rng(42);
+    for (int i = 0; i < 5000; ++i) {
+        const std::string id = "p" + std::to_string(rng() % 700);
+        if (rng() % 5 == 0) {
+            store.Erase(id);
+            reference.erase(id);
+        } else {
+            const int score = 1000 + static_cast<int>(rng() % 50);
+            store.Upsert(id, score);
+            reference[id] = score;
+        }
+    }
+
+    std::vector<std::pair<std::string, int>> expected(reference.begin(), reference.end());
+    std::sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.second != rhs.second) {
+            return lhs.second > rhs.second;
+        }
+        return lhs.first < rhs.first;
+    });
+
+    ASSERT_EQ(expected.size(), store.Size());
+    EXPECT_EQ(expected, store.TopN(expected.size() + 10));
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(i, store.Rank(expected[i].first).value());
+    }
+    const auto page = store.Range(100, 50);
+    ASSERT_EQ(50u, page.size());
+    EXPECT_EQ(expected[100], page.front());
+    EXPECT_EQ(expected[149], page.back());
+}
+
+TEST(LeaderboardStoreTest, UpsertBatchRebuildMatchesIndividualUpserts) {
+    pvpserver::InMemoryLeaderboardStore batched;
+    pvpserver::InMemoryLeaderboardStore reference;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 3000; ++i) {
+        const std::string id = "p" + std::to_string(i);
+        const int score = 1000 + static_cast<int>(rng() % 400);
+        batched.Upsert(id, score);
+        reference.Upsert(id, score);
+    }
+
+    // 기존 플레이어 절반 갱신 + 새 플레이어 + 같은 플레이어 중복 (마지막 값 적용)
+    std::vector<std::pair<std::string, int>> entries;
+    for (int i = 0; i < 3000; i += 2) {
+        entries.emplace_back("p" + std::to_string(i), 900 + static_cast<int>(rng() % 600));
+    }
+    for (int i = 3000; i < 3500; ++i) {
+        entries.emplace_back("p" + std::to_string(i), 1000 + static_cast<int>(rng() % 400));
+    }
+    entries.emplace_back("p0", 5000);
+    batched.UpsertBatch(entries);
+    for (const auto& entry : entries) {
+        reference.Upsert(entry.first, entry.second);
+    }
+
+    ASSERT_EQ(reference.Size(), batched.Size());
+    const auto expected = reference.TopN(reference.Size());
+    EXPECT_EQ(expected, batched.TopN(batched.Size()));
+    EXPECT_EQ(0u, batched.Rank("p0").value());
+    for (std::size_t i = 0; i < expected.size(); i += 97) {
+        ASSERT_EQ(i, batched.Rank(expected[i].first).value());
+    }
+    EXPECT_EQ(reference.Range(1234, 40), batched.Range(1234, 40));
+
+    // 재구성 뒤에도 개별 갱신/삭제가 스팬을 올바르게 유지
+    batched.Upsert("p1", 99999);
+    batched.Erase("p2");
+    reference.Upsert("p1", 99999);
+    reference.Erase("p2");
+    EXPECT_EQ(reference.TopN(reference.Size()), batched.TopN(batched.Size()));
+    EXPECT_EQ(reference.Rank("p4"), batched.Rank("p4"));
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/distributed/load_balancer.h"
+
+namespace {
+
+using pvpserver::distributed::LoadBalancer;
+using pvpserver::distributed::LoadBalanceStrategy;
+using pvpserver::distributed::ServerHandle;
+using pvpserver::distributed::ServerInfo;
+
+ServerInfo MakeServer(const std::string& id, int connections = 0, int max_connections = 1000) {
+    ServerInfo info;
+    info.server_id = id;
+    info.host = "10.0.0." + id;
+    info.udp_port = 7777;
+    info.current_connections = connections;
+    info.max_connections = max_connections;
+    return info;
+}
+
+}  // namespace
+
+TEST(LoadBalancerTest, HandleReflectsLiveLoadAndOutlivesUnregister) {
+    LoadBalancer balancer;
+    balancer.RegisterServer(MakeServer("a", 3));
+
+    ServerHandle handle = balancer.Select("player-1");
+    ASSERT_TRUE(handle);
+    EXPECT_EQ("a", handle.Id());
+    EXPECT_EQ("10.0.0.a", handle.Host());
+    EXPECT_EQ(3, handle.Connections());
+
+    // 부하/상태 갱신은 스냅샷 교체 없이 핸들에 바로 보임
+    const auto version = balancer.SnapshotVersion();
+    balancer.UpdateServerLoad("a", 9);
+    balancer.MarkServerHealthy("a", false);
+    EXPECT_EQ(version, balancer.SnapshotVersion());
+    EXPECT_EQ(9, handle.Connections());
+    EXPECT_FALSE(handle.Healthy());
+    EXPECT_EQ(9, handle.ToServerInfo().current_connections);
+    EXPECT_FALSE(balancer.Select("player-1"));
+
+    balancer.UnregisterServer("a");
+    EXPECT_NE(version, balancer.SnapshotVersion());
+    EXPECT_FALSE(balancer.GetServer("a").has_value());
+    EXPECT_EQ("a", handle.Id());  // 해제돼도 들고 있던 핸들은 유효
+}
+
+TEST(LoadBalancerTest, StrategiesSkipUnavailableServers) {
+    LoadBalancer balancer(LoadBalanceStrategy::ROUND_ROBIN);
+    balancer.RegisterServer(MakeServer("a", 5));
+    balancer.RegisterServer(MakeServer("b", 1));
+    balancer.RegisterServer(MakeServer("c", 10, 10));  // 가득 참
+
+    std::set<std::string> seen;
+    for (int i = 0; i < 6; ++i) {
+        seen.insert(balancer.Select("").Id());
+    }
+    EXPECT_EQ((std::set<std::string>{"a", "b"}), seen);
+
+    balancer.SetStrategy(LoadBalanceStrategy::LEAST_CONNECTIONS);
+    EXPECT_EQ("b", balancer.SelectServer("")->server_id);
+    balancer.MarkServerHealthy("b", false);
+    EXPECT_EQ("a", balancer.SelectServer("")->server_id);
+    EXPECT_EQ(2u, balancer.GetHealthyServers().size());
+    EXPECT_EQ(3u, balancer.GetAllServers().size());
+
+    // 재등록은 정보 교체 (수용량이 늘어난 c)
+    balancer.RegisterServer(MakeServer("c", 0, 100));
+    EXPECT_EQ("c", balancer.SelectServer("")->server_id);
+    EXPECT_EQ(3u, balancer.GetAllServers().size());
+}
+
+TEST(LoadBalancerTest, ConsistentHashStaysStableAcrossUnregisterOfOtherServer) {
+    LoadBalancer balancer;
+    for (int i = 0; i < 6; ++i) {
+        balancer.RegisterServer(MakeServer(std::to_string(i)));
+    }
+    balancer.SetBoundedLoadFactor(0);
+    std::vector<std::string> before;
+    for (int i = 0; i < 500; ++i) {
+        before.push_back(balancer.Select("player-" + std::to_string(i)).Id());
+    }
+
+    // 노드 번호가 당겨져도 servers 표와 링이 같은 순서를 유지해야 함
+    balancer.UnregisterServer("2");
+    for (int i = 0; i < 500; ++i) {
+        const auto& id = balancer.Select("player-" + std::to_string(i)).Id();
+        if (before[i] != "2") {
+            EXPECT_EQ(before[i], id);
+        } else {
+            EXPECT_NE("2", id);
+        }
+    }
+}
+
+TEST(LoadBalancerTest, ConcurrentReadersSeeConsistentSnapshots) {
+    LoadBalancer balancer;
+    balancer.RegisterServer(MakeServer("base"));
+
+    std::atomic<bool> stop{false};
+    std::atomic<long> selections{0};
+    std::atomic<long> misses{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&, t] {
+            long i = 0;
+            while (!stop.load()) {
+                auto handle = balancer.Select("player-" + std::to_string(t * 100000 + i++ % 1000));
+                if (!handle) {
+                    ++misses;
+                    continue;
+                }
+                // 핸들의 문자열은 교체 중에도 온전해야 함
+                if (handle.Id() != "base" && handle.Id().rfind("dyn-", 0) != 0) {
+                    ++misses;
+                }
+                ++selections;
+            }
+        });
+    }
+
+    for (int round = 0; round < 200; ++round) {
+        const auto id = "dyn-" + std::to_string(round % 8);
+        balancer.RegisterServer(MakeServer(id));
+        balancer.UpdateServerLoad(id, round % 5);
+        balancer.MarkServerHealthy(id, round % 3 != 0);
+        if (round % 2 == 1) {
+            balancer.UnregisterServer(id);
+        }
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_GT(selections.load(), 0);
+    EXPECT_EQ(0, misses.load());
+    // 합계가 어긋나지 않았는지: 상한 적용 상태에서도 모든 키가 배치됨
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_TRUE(balancer.Select("check-" + std::to_string(i)));
+    }
+}
+
+TEST(LoadBalancerTest, PowerOfTwoPrefersLessLoadedOfPair) {
+    LoadBalancer balancer(LoadBalanceStrategy::POWER_OF_TWO);
+    balancer.RegisterServer(MakeServer("busy", 900));
+    balancer.RegisterServer(MakeServer("idle", 10));
+
+    // 두 서버뿐이면 항상 둘을 비교 → 연결이 적은 쪽
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ("idle", balancer.Select("").Id());
+    }
+    balancer.MarkServerHealthy("idle", false);
+    EXPECT_EQ("busy", balancer.Select("").Id());
+    balancer.MarkServerHealthy("busy", false);
+    EXPECT_FALSE(balancer.Select(""));
+}
+
+TEST(LoadBalancerTest, WeightedHeadroomAvoidsServersOverTickBudget) {
+    LoadBalancer balancer(LoadBalanceStrategy::WEIGHTED_HEADROOM);
+    balancer.RegisterServer(MakeServer("slow", 10));
+    balancer.RegisterServer(MakeServer("fast", 400));
+    balancer.UpdateServerMetrics("slow", 10, 20.0, 0.5);  // 16.7ms 예산 초과
+    balancer.UpdateServerMetrics("fast", 400, 8.0, 0.6);
+
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ("fast", balancer.Select("").Id());
+    }
+    const auto slow = balancer.GetServer("slow");
+    ASSERT_TRUE(slow.has_value());
+    EXPECT_DOUBLE_EQ(20.0, slow->tick_p99_ms);
+    EXPECT_DOUBLE_EQ(0.5, slow->cpu_utilization);
+
+    // 예산 안에서는 가중 합으로 비교: CPU 가중치를 키우면 CPU가 낮은 쪽
+    balancer.UpdateServerMetrics("slow", 10, 12.0, 0.9);
+    balancer.UpdateServerMetrics("fast", 10, 12.0, 0.2);
+    auto weights = balancer.GetLoadWeights();
+    weights.cpu = 5.0;
+    balancer.SetLoadWeights(weights);
+    const auto fast_handle = balancer.Select("");
+    EXPECT_EQ("fast", fast_handle.Id());
+    balancer.MarkServerHealthy("fast", false);
+    const auto slow_handle = balancer.Select("");
+    EXPECT_LT(LoadBalancer::HeadroomCost(fast_handle, weights),
+              LoadBalancer::HeadroomCost(slow_handle, weights));
+}
+
+TEST(LoadBalancerTest, ServerInfoRoundTripsLoadMetrics) {
+    ServerInfo info = MakeServer("a", 42);
+    info.tick_p99_ms = 9.5;
+    info.cpu_utilization = 0.25;
+    const auto parsed = ServerInfo::Deserialize(info.Serialize());
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(42, parsed->current_connections);
+    EXPECT_DOUBLE_EQ(9.5, parsed->tick_p99_ms);
+    EXPECT_DOUBLE_EQ(0.25, parsed->cpu_utilization);
+
+    // 지표가 없는 이전 형식도 읽힘
+    const auto legacy = ServerInfo::Deserialize("{\"server_id\":\"old\",\"healthy\":true}");
+    ASSERT_TRUE(legacy.has_value());
+    EXPECT_DOUBLE_EQ(0.0, legacy->tick_p99_ms);
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/matchmaking/match_notification_channel.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::BoundedMpmcQueue;
+using pvpserver::Match;
+using pvpserver::MatchNotificationChannel;
+
+Match MakeMatch(int id) {
+    return Match{"match-" + std::to_string(id), std::vector<std::string>{"a", "b"}, 1200,
+                 steady_clock::now(), "global"};
+}
+}  // namespace
+
+TEST(BoundedMpmcQueueTest, RejectsWhenFullAndPreservesFifoOrder) {
+    BoundedMpmcQueue<int> queue(3);  // 2의 거듭제곱으로 올림 → 4
+    EXPECT_EQ(4u, queue.Capacity());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(99));
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(BoundedMpmcQueueTest, ConcurrentProducersAndConsumersLoseNothing) {
+    BoundedMpmcQueue<int> queue(1024);
+    constexpr int kPerProducer = 20000;
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 3; ++p) {
+        threads.emplace_back([&queue]() {
+            for (int i = 1; i <= kPerProducer; ++i) {
+                while (!queue.TryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < 3; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (popped.load() < 3 * kPerProducer) {
+                if (queue.TryPop(value)) {
+                    sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(3LL * kPerProducer * (kPerProducer + 1) / 2, sum.load());
+}
+
+TEST(MatchNotificationChannelTest, SlowSubscriberDoesNotBlockPublisherOrOthers) {
+    MatchNotificationChannel channel(MatchNotificationChannel::Options{8, 2, 4, false});
+    std::atomic<bool> release{false};
+    std::atomic<std::size_t> slow_seen{0};
+    std::mutex fast_mutex;
+    std::vector<std::string> fast_ids;
+    std::vector<std::size_t> fast_batches;
+
+    channel.Subscribe("slow", [&](const std::vector<Match>& batch) {
+        while (!release.load()) {
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        slow_seen += batch.size();
+    });
+    channel.Subscribe("fast", [&](const std::vector<Match>& batch) {
+        std::lock_guard<std::mutex> lk(fast_mutex);
+        fast_batches.push_back(batch.size());
+        for (const auto& match : batch) {
+            fast_ids.push_back(match.match_id());
+        }
+    });
+
+    const auto start = steady_clock::now();
+    for (int i = 0; i < 20; ++i) {
+        channel.Publish(MakeMatch(i));
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+    EXPECT_LT(duration_cast<milliseconds>(steady_clock::now() - start).count(), 1000);
+
+    // 느린 구독자는 다른 디스패처에 있으므로 빠른 구독자는 전부 순서대로 받음
+    const auto deadline = steady_clock::now() + seconds(5);
+    while (steady_clock::now() < deadline) {
+        std::lock_guard<std::mutex> lk(fast_mutex);
+        if (fast_ids.size() == 20u) {
+            break;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lk(fast_mutex);
+        ASSERT_EQ(20u, fast_ids.size());
+        EXPECT_EQ("match-0", fast_ids.front());
+        EXPECT_EQ("match-19", fast_ids.back());
+        for (auto size : fast_batches) {
+            EXPECT_LE(size, 4u);
+        }
+    }
+
+    // 느린 구독자 큐(용량 8)는 넘쳐서 넘침 목록으로 옮겨짐
+    const auto metrics = channel.MetricsSnapshot();
+    EXPECT_NE(metrics.find("match_notifications_published_total 20"), std::string::npos);
+    EXPECT_NE(metrics.find("match_notification_spilled_total{subscriber=\"fast\"} 0"),
+              std::string::npos);
+    EXPECT_EQ(metrics.find("match_notification_spilled_total{subscriber=\"slow\"} 0"),
+              std::string::npos);
+
+    release = true;
+    ASSERT_TRUE(channel.Flush());
+    EXPECT_EQ(20u, slow_seen.load());
+}
+
+TEST(MatchNotificationChannelTest, FullSubscriberQueueSpillsWithoutLosingMatches) {
+    MatchNotificationChannel channel(MatchNotificationChannel::Options{4, 1, 3, false});
+    std::atomic<bool> release{false};
+    std::mutex mutex;
+    std::vector<std::string> ids;
+    channel.Subscribe("session-creator", [&](const std::vector<Match>& batch) {
+        while (!release.load()) {
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lk(mutex);
+        for (const auto& match : batch) {
+            ids.push_back(match.match_id());
+        }
+    });
+
+    // 용량 4인 큐에 100개: 대부분 넘침 목록으로
+    constexpr int kMatches = 100;
+    for (int i = 0; i < kMatches; ++i) {
+        channel.Publish(MakeMatch(i));
+    }
+    EXPECT_EQ(channel.MetricsSnapshot().find(
+                  "match_notification_spilled_total{subscriber=\"session-creator\"} 0"),
+              std::string::npos);
+
+    // 중간에 풀어 줘도 새 알림이 넘친 알림을 앞지르지 않음
+    release = true;
+    for (int i = kMatches; i < kMatches * 2; ++i) {
+        channel.Publish(MakeMatch(i));
+    }
+    ASSERT_TRUE(channel.Flush());
+    std::lock_guard<std::mutex> lk(mutex);
+    ASSERT_EQ(static_cast<std::size_t>(kMatches * 2), ids.size());
+    for (int i = 0; i < kMatches * 2; ++i) {
+        EXPECT_EQ("match-" + std::to_string(i), ids[static_cast<std::size_t>(i)]);
+    }
+    EXPECT_NE(channel.MetricsSnapshot().find(
+                  "match_notification_overflow_depth{subscriber=\"session-creator\"} 0"),
+              std::string::npos);
+}
+
+TEST(MatchNotificationChannelTest, MailboxIsBoundedAndStopDeliversRemaining) {
+    MatchNotificationChannel channel(MatchNotificationChannel::Options{4, 1, 64, true});
+    std::atomic<std::size_t> delivered{0};
+    channel.Subscribe("counter", [&](const std::vector<Match>& batch) { delivered += batch.size(); });
+    for (int i = 0; i < 6; ++i) {
+        channel.Publish(MakeMatch(i));
+    }
+    const auto mailbox = channel.Drain();
+    ASSERT_EQ(4u, mailbox.size());
+    EXPECT_EQ("match-2", mailbox.front().match_id());  // 가장 오래된 것부터 버림
+    EXPECT_NE(channel.MetricsSnapshot().find("match_notification_mailbox_dropped_total 2"),
+              std::string::npos);
+
+    channel.Stop();
+    EXPECT_GE(delivered.load(), 4u);
+}
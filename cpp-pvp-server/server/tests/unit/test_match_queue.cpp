@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <string>
+#include <vector>
 
 #include "pvpserver/matchmaking/match_queue.h"
 
@@ -9,6 +11,25 @@ using namespace std::chrono;
 using pvpserver::InMemoryMatchQueue;
 using pvpserver::MatchQueue;
 using pvpserver::MatchRequest;
+using pvpserver::QueuedPlayer;
+
+// FetchOrdered만 구현하고 ForEachOrdered/ForEachInRange는 기본 구현을 쓰는 대기열
+class FetchOnlyMatchQueue : public MatchQueue {
+   public:
+    void Upsert(const MatchRequest& request, std::uint64_t order) override {
+        inner_.Upsert(request, order);
+    }
+    bool Remove(const std::string& player_id) override { return inner_.Remove(player_id); }
+    std::vector<bool> Claim(const std::vector<std::vector<std::string>>& groups) override {
+        return inner_.Claim(groups);
+    }
+    std::vector<QueuedPlayer> FetchOrdered() const override { return inner_.FetchOrdered(); }
+    std::size_t Size() const override { return inner_.Size(); }
+    std::string Snapshot() const override { return inner_.Snapshot(); }
+
+   private:
+    InMemoryMatchQueue inner_;
+};
 }  // namespace
 
 TEST(MatchQueueTest, OrdersByEloAndInsertion) {
@@ -50,3 +71,69 @@ TEST(MatchQueueTest, RemoveDeletesPlayer) {
     ASSERT_EQ(1u, ordered.size());
     EXPECT_EQ("bob", ordered.front().request.player_id());
 }
+
+TEST(MatchQueueTest, KeepsOrderForOutOfOrderInsertsAndSlotReuse) {
+    InMemoryMatchQueue queue;
+    const auto now = steady_clock::now();
+    queue.Upsert(MatchRequest{"a", 1200, now}, 10);
+    queue.Upsert(MatchRequest{"b", 1200, now}, 20);
+    queue.Upsert(MatchRequest{"c", 1200, now}, 5);  // 꼬리보다 작은 order
+    EXPECT_EQ("c:1200,a:1200,b:1200", queue.Snapshot());
+
+    // 앞쪽 제거 후 재삽입: 해제된 슬롯이 재사용되어도 툼스톤이 되살아나지 않음
+    EXPECT_TRUE(queue.Remove("c"));
+    EXPECT_TRUE(queue.Remove("a"));
+    queue.Upsert(MatchRequest{"d", 1200, now}, 1);
+    queue.Upsert(MatchRequest{"e", 1300, now}, 30);
+    EXPECT_EQ("d:1200,b:1200,e:1300", queue.Snapshot());
+    EXPECT_EQ(3u, queue.Size());
+
+    std::vector<std::string> band;
+    queue.ForEachInRange(1250, 1400, [&band](const pvpserver::MatchRequest& request,
+                                             std::uint64_t) { band.push_back(request.player_id()); });
+    EXPECT_EQ(std::vector<std::string>{"e"}, band);
+}
+
+TEST(MatchQueueTest, ChurnCompactsTombstones) {
+    InMemoryMatchQueue queue;
+    const auto now = steady_clock::now();
+    std::uint64_t order = 0;
+    for (int round = 0; round < 50; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            queue.Upsert(MatchRequest{"p" + std::to_string(round * 100 + i), 1500, now}, ++order);
+        }
+        // 대부분 제거하고 마지막 하나만 남김 (FIFO 앞쪽부터 매칭되는 패턴)
+        for (int i = 0; i < 99; ++i) {
+            EXPECT_TRUE(queue.Remove("p" + std::to_string(round * 100 + i)));
+        }
+    }
+    const auto ordered = queue.FetchOrdered();
+    ASSERT_EQ(50u, ordered.size());
+    for (std::size_t i = 1; i < ordered.size(); ++i) {
+        EXPECT_LT(ordered[i - 1].order, ordered[i].order);
+    }
+    EXPECT_EQ("p99", ordered.front().request.player_id());
+}
+
+TEST(MatchQueueTest, DefaultForEachOrderedKeepsReferencesAliveAfterReturn) {
+    FetchOnlyMatchQueue queue;
+    const auto now = steady_clock::now();
+    queue.Upsert(MatchRequest{"alice", 1200, now}, 1);
+    queue.Upsert(MatchRequest{"bob", 1100, now}, 2);
+
+    // Matchmaker처럼 참조를 모아 두었다가 순회가 끝난 뒤에 사용
+    std::vector<const MatchRequest*> visited;
+    queue.ForEachOrdered([&visited](const MatchRequest& request, std::uint64_t) {
+        visited.push_back(&request);
+    });
+    ASSERT_EQ(2u, visited.size());
+    EXPECT_EQ("bob", visited[0]->player_id());
+    EXPECT_EQ("alice", visited[1]->player_id());
+    EXPECT_EQ(1200, visited[1]->elo());
+
+    std::vector<std::string> band;
+    queue.ForEachInRange(1150, 1300, [&band](const MatchRequest& request, std::uint64_t) {
+        band.push_back(request.player_id());
+    });
+    EXPECT_EQ(std::vector<std::string>{"alice"}, band);
+}
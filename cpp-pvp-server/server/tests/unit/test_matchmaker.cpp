@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -13,6 +14,20 @@ using pvpserver::InMemoryMatchQueue;
 using pvpserver::Match;
 using pvpserver::Matchmaker;
 using pvpserver::MatchRequest;
+
+// 다른 매치메이커가 특정 플레이어를 먼저 가져간 공유 대기열 (Remove가 false)
+class ContendedMatchQueue : public InMemoryMatchQueue {
+   public:
+    explicit ContendedMatchQueue(std::string stolen) : stolen_(std::move(stolen)) {}
+
+    std::vector<bool> Claim(const std::vector<std::vector<std::string>>& groups) override {
+        Remove(stolen_);  // 확보 직전에 다른 서버가 가져감
+        return InMemoryMatchQueue::Claim(groups);
+    }
+
+   private:
+    std::string stolen_;
+};
 }  // namespace
 
 TEST(MatchmakerTest, DoesNotMatchOutsideTolerance) {
@@ -60,3 +75,111 @@ TEST(MatchmakerTest, CancelRemovesPlayer) {
     EXPECT_TRUE(matchmaker.Cancel("alice"));
     EXPECT_FALSE(matchmaker.Cancel("alice"));
 }
+
+TEST(MatchmakerTest, SweepSkipsMatchedAndIncompatiblePlayers) {
+    auto queue = std::make_shared<InMemoryMatchQueue>();
+    Matchmaker matchmaker(queue);
+    const auto now = steady_clock::now();
+    matchmaker.Enqueue(MatchRequest{"kr-low", 1000, now, "kr"});
+    matchmaker.Enqueue(MatchRequest{"us-low", 1010, now, "us"});
+    matchmaker.Enqueue(MatchRequest{"any-mid", 1050, now, "any"});
+    matchmaker.Enqueue(MatchRequest{"us-high", 1080, now, "us"});
+    matchmaker.Enqueue(MatchRequest{"kr-far", 1400, now, "kr"});
+
+    // kr-low는 us-low를 건너뛰고 any-mid와, us-low는 툼스톤이 된 any-mid를 건너뛰고 us-high와 매칭
+    auto matches = matchmaker.RunMatching(now);
+    ASSERT_EQ(2u, matches.size());
+    EXPECT_EQ((std::vector<std::string>{"kr-low", "any-mid"}), matches[0].players());
+    EXPECT_EQ((std::vector<std::string>{"us-low", "us-high"}), matches[1].players());
+    EXPECT_EQ(1u, queue->Size());
+    EXPECT_TRUE(matchmaker.Cancel("kr-far"));
+}
+
+TEST(MatchmakerTest, FormsBalancedTwoVersusTwoTeams) {
+    auto queue = std::make_shared<InMemoryMatchQueue>();
+    Matchmaker matchmaker(queue, pvpserver::MatchFormat::Teams(2, 1));
+    const auto now = steady_clock::now();
+    matchmaker.Enqueue(MatchRequest{"a", 1000, now});
+    matchmaker.Enqueue(MatchRequest{"b", 1020, now});
+    matchmaker.Enqueue(MatchRequest{"c", 1040, now});
+    matchmaker.Enqueue(MatchRequest{"d", 1060, now});
+
+    auto matches = matchmaker.RunMatching(now);
+    ASSERT_EQ(1u, matches.size());
+    EXPECT_EQ("2v2", matches[0].mode());
+    ASSERT_EQ(2u, matches[0].teams().size());
+    EXPECT_EQ(4u, matches[0].players().size());
+    // 가장 높은 ELO와 가장 낮은 ELO가 한 팀 → 팀 평균 동일
+    EXPECT_EQ((std::vector<std::string>{"d", "a"}), matches[0].teams()[0].players);
+    EXPECT_EQ((std::vector<std::string>{"c", "b"}), matches[0].teams()[1].players);
+    EXPECT_EQ(matches[0].teams()[0].average_elo, matches[0].teams()[1].average_elo);
+    EXPECT_EQ(0u, queue->Size());
+}
+
+TEST(MatchmakerTest, KeepsPartiesTogetherInFiveVersusFive) {
+    auto queue = std::make_shared<InMemoryMatchQueue>();
+    Matchmaker matchmaker(queue, pvpserver::MatchFormat::Teams(5, 3));
+    const auto now = steady_clock::now();
+    EXPECT_FALSE(matchmaker.Enqueue(
+        MatchRequest{"quad", 1200, now, "kr", {"q2", "q3", "q4"}}));  // 파티 최대 3명
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"p1", 1210, now, "kr", {"p1b", "p1c"}}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"p2", 1190, now, "kr", {"p2b", "p2c"}}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"p3", 1200, now, "any", {"p3b"}}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"p4", 1205, now, "kr", {"p4b"}}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"solo-us", 1200, now, "us"}));
+
+    auto matches = matchmaker.RunMatching(now);
+    ASSERT_EQ(1u, matches.size());
+    EXPECT_EQ("kr", matches[0].region());
+    ASSERT_EQ(2u, matches[0].teams().size());
+    for (const auto& team : matches[0].teams()) {
+        ASSERT_EQ(5u, team.players.size());
+        // 3인 파티 하나 + 2인 파티 하나
+        const bool has_p1 = std::find(team.players.begin(), team.players.end(), "p1") !=
+                            team.players.end();
+        const std::string trio = has_p1 ? "p1c" : "p2c";
+        EXPECT_NE(std::find(team.players.begin(), team.players.end(), trio), team.players.end());
+    }
+    EXPECT_EQ(1u, queue->Size());  // 리전이 다른 solo-us만 남음
+}
+
+TEST(MatchmakerTest, FormsEightPlayerFreeForAllWithinRegion) {
+    auto queue = std::make_shared<InMemoryMatchQueue>();
+    Matchmaker matchmaker(queue, pvpserver::MatchFormat::FreeForAll(8));
+    const auto now = steady_clock::now();
+    matchmaker.Enqueue(MatchRequest{"eu-0", 1000, now, "eu"});
+    for (int i = 0; i < 8; ++i) {
+        matchmaker.Enqueue(MatchRequest{"us-" + std::to_string(i), 1010 + i * 10, now, "us"});
+    }
+
+    auto matches = matchmaker.RunMatching(now);
+    ASSERT_EQ(1u, matches.size());
+    EXPECT_EQ("ffa8", matches[0].mode());
+    EXPECT_EQ(8u, matches[0].teams().size());
+    EXPECT_EQ("us", matches[0].region());
+    EXPECT_EQ(1045, matches[0].average_elo());
+    EXPECT_TRUE(matchmaker.Cancel("eu-0"));
+}
+
+TEST(MatchmakerTest, DropsMatchWhenPlayerWasClaimedElsewhere) {
+    auto queue = std::make_shared<ContendedMatchQueue>("bob");
+    Matchmaker matchmaker(queue);
+    const auto now = steady_clock::now();
+    matchmaker.Enqueue(MatchRequest{"alice", 1200, now - seconds(2)});
+    matchmaker.Enqueue(MatchRequest{"bob", 1210, now - seconds(1)});
+    matchmaker.Enqueue(MatchRequest{"carol", 1500, now});
+    matchmaker.Enqueue(MatchRequest{"dave", 1505, now});
+
+    // alice-bob 매치는 버리고 alice는 대기열에 그대로 (대기 순서 유지), carol-dave는 그대로 성사
+    auto matches = matchmaker.RunMatching(now);
+    ASSERT_EQ(1u, matches.size());
+    EXPECT_EQ("carol", matches[0].players()[0]);
+    EXPECT_EQ("dave", matches[0].players()[1]);
+    ASSERT_EQ(1u, queue->Size());
+    EXPECT_EQ("alice", queue->FetchOrdered().front().request.player_id());
+    EXPECT_EQ(now - seconds(2), queue->FetchOrdered().front().request.enqueued_at());
+    EXPECT_EQ(1u, matchmaker.GetMetricsTotals().matches_created);
+    // 버린 매치의 alice 대기 시간은 기록하지 않음
+    EXPECT_NE(std::string::npos,
+              matchmaker.MetricsSnapshot().find("matchmaking_wait_seconds_count 2"));
+}
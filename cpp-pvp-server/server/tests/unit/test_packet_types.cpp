@@ -160,3 +160,16 @@ TEST_F(PacketTypesTest, LongStringTruncation) {
     // 255자로 잘려야 함
     EXPECT_EQ(deserialized.player_id.size(), 255);
 }
+
+TEST_F(PacketTypesTest, RedirectPacketSerializeDeserialize) {
+    RedirectPacket packet;
+    packet.host = "10.0.0.7";
+    packet.port = 7777;
+    packet.server_tick = 123456;
+
+    auto deserialized = RedirectPacket::Deserialize(packet.Serialize());
+    EXPECT_EQ(deserialized.host, packet.host);
+    EXPECT_EQ(deserialized.port, packet.port);
+    EXPECT_EQ(deserialized.server_tick, packet.server_tick);
+    EXPECT_THROW(RedirectPacket::Deserialize({0x03, 'a'}), std::runtime_error);
+}
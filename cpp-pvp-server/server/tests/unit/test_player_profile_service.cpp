@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pvpserver/stats/leaderboard_store.h"
@@ -100,3 +102,124 @@ TEST(PlayerProfileServiceTest, UpdatesRatingsAggregatesStatsAndSerializes) {
     EXPECT_NE(metrics_after.find("matches_recorded_total 3"), std::string::npos);
     EXPECT_NE(metrics_after.find("rating_updates_total 6"), std::string::npos);
 }
+
+TEST(PlayerProfileServiceTest, AppliesTeamAndFreeForAllPlacements) {
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    pvpserver::PlayerProfileService service(leaderboard);
+    const auto now = std::chrono::system_clock::now();
+
+    MatchResult team_match{"match-2v2", {{"a1", "a2"}, {"b1", "b2"}}, now, {}};
+    service.RecordMatch(team_match);
+    // 팀 평균 1200 대 1200 → 1:1과 같은 ±12.5 (반올림 13 / -12)
+    EXPECT_EQ(1213, service.GetProfile("a2")->rating);
+    EXPECT_EQ(1188, service.GetProfile("b1")->rating);
+    EXPECT_EQ(1u, service.GetProfile("a1")->wins);
+    EXPECT_EQ(1u, service.GetProfile("b2")->losses);
+
+    std::vector<std::vector<std::string>> placements;
+    for (int i = 0; i < 8; ++i) {
+        placements.push_back({"ffa" + std::to_string(i)});
+    }
+    service.RecordMatch(MatchResult{"match-ffa", placements, now, {}});
+    EXPECT_EQ(1213, service.GetProfile("ffa0")->rating);
+    EXPECT_EQ(1202, service.GetProfile("ffa3")->rating);  // 4승 3패
+    EXPECT_EQ(1188, service.GetProfile("ffa7")->rating);
+
+    const std::string metrics = service.MetricsSnapshot();
+    EXPECT_NE(metrics.find("matches_recorded_total 2"), std::string::npos);
+    EXPECT_NE(metrics.find("rating_updates_total 12"), std::string::npos);
+}
+
+TEST(PlayerProfileServiceTest, ConcurrentMatchesKeepProfilesConsistent) {
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    pvpserver::PlayerProfileService service(leaderboard);
+    const auto now = std::chrono::system_clock::now();
+    constexpr int kPlayers = 64;
+    constexpr int kWriters = 4;
+    constexpr int kMatchesPerWriter = 500;
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn_reads{0};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            for (int i = 0; i < kPlayers; ++i) {
+                const auto profile = service.GetProfile("p" + std::to_string(i));
+                // 1:1 매치만 기록하므로 wins + losses == matches가 항상 성립해야 함
+                if (profile && profile->wins + profile->losses != profile->matches) {
+                    torn_reads.fetch_add(1);
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < kWriters; ++w) {
+        writers.emplace_back([&, w]() {
+            for (int i = 0; i < kMatchesPerWriter; ++i) {
+                // 작성자마다 반대 방향 쌍을 섞어 잠금 순서 역전을 유도
+                const int a = (i * 7 + w) % kPlayers;
+                const int b = (a + 1 + w) % kPlayers;
+                const auto winner = "p" + std::to_string(w % 2 == 0 ? a : b);
+                const auto loser = "p" + std::to_string(w % 2 == 0 ? b : a);
+                const std::string match_id = "m" + std::to_string(w) + "-" + std::to_string(i);
+                std::vector<PlayerMatchStats> stats{
+                    PlayerMatchStats{match_id, winner, 2, 1, 1, 0, 10, 0},
+                    PlayerMatchStats{match_id, loser, 2, 1, 0, 1, 0, 10},
+                };
+                service.RecordMatch(MatchResult{match_id, winner, loser, now, stats});
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(0, torn_reads.load());
+    std::uint64_t matches = 0;
+    std::uint64_t wins = 0;
+    for (int i = 0; i < kPlayers; ++i) {
+        const auto profile = service.GetProfile("p" + std::to_string(i));
+        ASSERT_TRUE(profile.has_value());
+        matches += profile->matches;
+        wins += profile->wins;
+        EXPECT_EQ(profile->rating, leaderboard->Get(profile->player_id).value());
+    }
+    EXPECT_EQ(2u * kWriters * kMatchesPerWriter, matches);
+    EXPECT_EQ(static_cast<std::uint64_t>(kWriters * kMatchesPerWriter), wins);
+    EXPECT_EQ(static_cast<std::uint64_t>(kWriters * kMatchesPerWriter), service.Version());
+    EXPECT_EQ(static_cast<std::size_t>(kPlayers), service.TopProfiles(1000).size());
+}
+
+TEST(PlayerProfileServiceTest, PersistenceSinkReceivesUpdatedParticipants) {
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    pvpserver::PlayerProfileService service(leaderboard);
+    std::vector<std::string> match_ids;
+    std::vector<pvpserver::PlayerProfile> last_profiles;
+    service.SetPersistenceSink([&](const MatchResult& result,
+                                   const std::vector<pvpserver::PlayerProfile>& profiles) {
+        match_ids.push_back(result.match_id());
+        last_profiles = profiles;
+    });
+
+    std::vector<PlayerMatchStats> stats{
+        PlayerMatchStats{"match-1", "attacker", 5, 5, 1, 0, 100, 20},
+        PlayerMatchStats{"match-1", "defender", 4, 2, 0, 1, 40, 100},
+    };
+    service.RecordMatch(
+        MatchResult{"match-1", "attacker", "defender", std::chrono::system_clock::now(), stats});
+
+    ASSERT_EQ(1u, match_ids.size());
+    ASSERT_EQ(2u, last_profiles.size());
+    for (const auto& profile : last_profiles) {
+        EXPECT_EQ(1u, profile.matches);
+        if (profile.player_id == "attacker") {
+            EXPECT_EQ(1213, profile.rating);
+            EXPECT_EQ(1u, profile.wins);
+        } else {
+            EXPECT_EQ("defender", profile.player_id);
+            EXPECT_EQ(1188, profile.rating);
+        }
+    }
+}
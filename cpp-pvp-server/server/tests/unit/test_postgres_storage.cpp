@@ -1,5 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "pvpserver/storage/postgres_storage.h"
 
 TEST(PostgresStorageTest, ConnectionFailureIsHandled) {
@@ -16,3 +24,120 @@ TEST(PostgresStorageTest, RecordSessionEventFailsWithoutConnection) {
     const auto snapshot = storage.MetricsSnapshot();
     EXPECT_NE(snapshot.find("database_query_duration_seconds"), std::string::npos);
 }
+
+namespace {
+pvpserver::MatchResultRecord MakeMatch(const std::string& match_id) {
+    return pvpserver::MatchResultRecord{match_id, "winner", "loser", "winner;loser", 1700000000000};
+}
+
+std::vector<pvpserver::ProfileRecord> MakeProfiles() {
+    pvpserver::ProfileRecord winner;
+    winner.player_id = "winner";
+    winner.rating = 1213;
+    winner.matches = 1;
+    winner.wins = 1;
+    pvpserver::ProfileRecord loser;
+    loser.player_id = "loser";
+    loser.rating = 1188;
+    loser.matches = 1;
+    loser.losses = 1;
+    return {winner, loser};
+}
+}  // namespace
+
+TEST(PostgresStorageTest, EnqueueWithoutWriteBehindIsDropped) {
+    pvpserver::PostgresStorage storage("postgresql://localhost:1/pvpserver");
+    EXPECT_FALSE(storage.EnqueueMatch(MakeMatch("m1"), MakeProfiles()));
+    EXPECT_NE(storage.MetricsSnapshot().find("postgres_write_behind_dropped_total 1"),
+              std::string::npos);
+}
+
+TEST(PostgresStorageTest, WriteBehindRetriesWithBackoffThenGivesUp) {
+    pvpserver::PostgresStorage storage("postgresql://localhost:1/pvpserver");
+    pvpserver::WriteBehindOptions options;
+    options.max_attempts = 3;
+    options.initial_backoff = std::chrono::milliseconds(5);
+    options.flush_interval = std::chrono::milliseconds(10);
+    storage.StartWriteBehind(options);
+
+    EXPECT_TRUE(storage.EnqueueMatch(MakeMatch("m1"), MakeProfiles()));
+    EXPECT_TRUE(storage.EnqueueMatch(MakeMatch("m2"), MakeProfiles()));
+    EXPECT_TRUE(storage.FlushWriteBehind(std::chrono::milliseconds(5000)));
+
+    const auto metrics = storage.MetricsSnapshot();
+    EXPECT_NE(metrics.find("postgres_write_behind_enqueued_total 2"), std::string::npos);
+    EXPECT_NE(metrics.find("postgres_write_behind_failed_batches_total 1"), std::string::npos);
+    EXPECT_NE(metrics.find("postgres_write_behind_retries_total 2"), std::string::npos);
+    EXPECT_NE(metrics.find("postgres_write_behind_match_rows_total 0"), std::string::npos);
+    storage.StopWriteBehind();
+}
+
+TEST(PostgresStorageTest, WriteBehindQueueIsBounded) {
+    pvpserver::PostgresStorage storage("postgresql://localhost:1/pvpserver");
+    pvpserver::WriteBehindOptions options;
+    options.capacity = 2;
+    options.max_attempts = 1;
+    options.flush_interval = std::chrono::seconds(30);
+    storage.StartWriteBehind(options);
+
+    EXPECT_TRUE(storage.EnqueueMatch(MakeMatch("m1"), MakeProfiles()));
+    EXPECT_TRUE(storage.EnqueueMatch(MakeMatch("m2"), MakeProfiles()));
+    EXPECT_FALSE(storage.EnqueueMatch(MakeMatch("m3"), MakeProfiles()));
+    EXPECT_NE(storage.MetricsSnapshot().find("postgres_write_behind_dropped_total 1"),
+              std::string::npos);
+    storage.StopWriteBehind();
+    EXPECT_NE(storage.MetricsSnapshot().find("postgres_write_behind_queue_depth 0"),
+              std::string::npos);
+}
+
+TEST(PostgresStorageTest, AsyncSessionEventFailsWithoutBlockingCaller) {
+    boost::asio::io_context io_context;
+    auto guard = boost::asio::make_work_guard(io_context);
+    std::thread io_thread([&] { io_context.run(); });
+
+    pvpserver::PostgresStorage storage("postgresql://localhost:1/pvpserver");
+    pvpserver::PostgresPoolOptions options;
+    options.connections = 2;
+    options.reconnect_backoff = std::chrono::milliseconds(20);
+    storage.StartAsync(io_context, options);
+
+    std::promise<bool> done;
+    auto result = done.get_future();
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(storage.RecordSessionEventAsync(
+        "player", "start", [&done](bool ok, const std::string&) { done.set_value(ok); }));
+    // 호출자는 연결 시도를 기다리지 않음
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+    ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(5)));
+    EXPECT_FALSE(result.get());
+
+    const auto metrics = storage.MetricsSnapshot();
+    EXPECT_NE(metrics.find("database_query_duration_seconds_count{query=\"session_event\"} 1"),
+              std::string::npos);
+    EXPECT_NE(metrics.find("database_query_errors_total{query=\"session_event\"} 1"),
+              std::string::npos);
+    EXPECT_NE(metrics.find("postgres_pool_queries_total{result=\"error\"} 1"),
+              std::string::npos);
+    EXPECT_NE(metrics.find("postgres_pool_connections_up 0"), std::string::npos);
+    EXPECT_EQ(metrics.find("postgres_pool_connect_failures_total 0"), std::string::npos);
+
+    storage.StopAsync();
+    guard.reset();
+    io_thread.join();  // Stop이 연결/타이머를 모두 정리해야 run()이 반환됨
+    EXPECT_FALSE(storage.RecordSessionEventAsync("player", "end"));
+}
+
+TEST(PostgresStorageTest, AsyncPoolRejectsWhenQueueIsFull) {
+    boost::asio::io_context io_context;  // run하지 않음 → 대기열이 비워지지 않음
+    pvpserver::PostgresStorage storage("postgresql://localhost:1/pvpserver");
+    pvpserver::PostgresPoolOptions options;
+    options.max_queued = 2;
+    storage.StartAsync(io_context, options);
+
+    EXPECT_TRUE(storage.RecordSessionEvent("p1", "start"));
+    EXPECT_TRUE(storage.RecordSessionEvent("p2", "start"));
+    EXPECT_FALSE(storage.RecordSessionEvent("p3", "start"));
+    const auto metrics = storage.MetricsSnapshot();
+    EXPECT_NE(metrics.find("postgres_pool_rejected_total 1"), std::string::npos);
+    EXPECT_NE(metrics.find("postgres_pool_pending 2"), std::string::npos);
+}
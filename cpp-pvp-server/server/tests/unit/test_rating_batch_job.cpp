@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pvpserver/stats/leaderboard_store.h"
+#include "pvpserver/stats/player_profile_service.h"
+#include "pvpserver/stats/rating_batch_job.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::MatchResult;
+using pvpserver::PlayerMatchStats;
+
+void RecordDuel(pvpserver::PlayerProfileService& service, const std::string& match_id,
+                const std::string& winner, const std::string& loser,
+                system_clock::time_point at) {
+    std::vector<PlayerMatchStats> stats{
+        PlayerMatchStats{match_id, winner, 5, 4, 1, 0, 100, 10},
+        PlayerMatchStats{match_id, loser, 5, 2, 0, 1, 40, 100},
+    };
+    service.RecordMatch(MatchResult{match_id, winner, loser, at, stats});
+}
+}  // namespace
+
+TEST(RatingBatchJobTest, ExpectedScoreTableMatchesPow) {
+    const auto& table = pvpserver::ExpectedScoreTable::Instance();
+    for (int difference = -2000; difference <= 2000; difference += 7) {
+        const double direct = 1.0 / (1.0 + std::pow(10.0, difference / 400.0));
+        EXPECT_DOUBLE_EQ(direct, table.Expected(1500, 1500 + difference));
+    }
+    // 범위 밖은 끝 값으로 고정
+    EXPECT_DOUBLE_EQ(table.Expected(0, 2000), table.Expected(0, 9000));
+    EXPECT_NEAR(0.5, table.Expected(1234, 1234), 1e-12);
+}
+
+TEST(RatingBatchJobTest, ReplayDuelsMatchesSequentialUpdates) {
+    constexpr std::uint32_t kPlayers = 3000;
+    std::mt19937 rng(11);
+    std::vector<pvpserver::DuelOutcome> duels;
+    for (int i = 0; i < 40000; ++i) {
+        const auto winner = static_cast<std::uint32_t>(rng() % kPlayers);
+        auto loser = static_cast<std::uint32_t>(rng() % kPlayers);
+        if (loser == winner) {
+            loser = (loser + 1) % kPlayers;
+        }
+        duels.push_back({winner, loser});
+    }
+
+    std::vector<int> sequential(kPlayers, 1200);
+    pvpserver::EloRatingCalculator calculator;
+    for (const auto& duel : duels) {
+        const auto update = calculator.Update(sequential[duel.winner], sequential[duel.loser]);
+        sequential[duel.winner] = update.winner_new;
+        sequential[duel.loser] = update.loser_new;
+    }
+
+    pvpserver::RatingBatchEngine engine(4);
+    std::vector<int> batched(kPlayers, 1200);
+    const auto rounds = engine.ReplayDuels(batched, duels);
+    EXPECT_EQ(sequential, batched);
+    EXPECT_LT(rounds, duels.size() / 10);  // 라운드당 매치가 여럿 → 병렬 처리 가능
+}
+
+TEST(RatingBatchJobTest, DecayAndSeasonResetPolicies) {
+    const std::int64_t day_ms = 24LL * 60 * 60 * 1000;
+    const std::int64_t now_ms = 100 * day_ms;
+    pvpserver::RatingDecayPolicy decay;  // 14일 유예, 15점, 하한 1200
+
+    EXPECT_EQ(1485, decay.Apply({1500, 10, now_ms - 20 * day_ms}, now_ms));
+    EXPECT_EQ(1500, decay.Apply({1500, 10, now_ms - 3 * day_ms}, now_ms));  // 최근 활동
+    EXPECT_EQ(1200, decay.Apply({1210, 10, 0}, now_ms));                      // 하한
+    EXPECT_EQ(1100, decay.Apply({1100, 10, 0}, now_ms));  // 하한보다 낮으면 그대로
+    EXPECT_EQ(1500, decay.Apply({1500, 0, 0}, now_ms));   // 매치 기록 없음
+
+    pvpserver::SeasonResetPolicy reset;  // 1200 기준 절반 유지
+    EXPECT_EQ(1400, reset.Apply({1600, 5, 0}));
+    EXPECT_EQ(1100, reset.Apply({1000, 5, 0}));
+    EXPECT_EQ(1200, reset.Apply({1200, 5, 0}));
+}
+
+TEST(RatingBatchJobTest, ParallelForCoversEveryIndexOnce) {
+    pvpserver::RatingBatchEngine engine(3);
+    EXPECT_EQ(3u, engine.Threads());
+    std::vector<int> hits(100000, 0);
+    for (int run = 0; run < 3; ++run) {
+        engine.ParallelFor(hits.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                ++hits[i];
+            }
+        });
+    }
+    for (const auto hit : hits) {
+        ASSERT_EQ(3, hit);
+    }
+}
+
+TEST(RatingBatchJobTest, ApplyRatingJobUpdatesProfilesAndLeaderboard) {
+    auto leaderboard = std::make_shared<pvpserver::InMemoryLeaderboardStore>();
+    pvpserver::PlayerProfileService service(leaderboard);
+    const auto now = system_clock::now();
+    RecordDuel(service, "m1", "veteran", "rookie", now - hours(24 * 30));
+    RecordDuel(service, "m2", "veteran", "rookie", now - hours(24 * 30));
+    RecordDuel(service, "m3", "active", "regular", now);
+    const auto before_version = service.Version();
+
+    pvpserver::RatingBatchEngine engine(2);
+    pvpserver::RatingDecayPolicy decay;
+    decay.points_per_run = 20;
+    const auto now_ms = duration_cast<milliseconds>(now.time_since_epoch()).count();
+    const auto report = service.ApplyRatingJob(
+        engine, [&](const pvpserver::RatingRecord& record) { return decay.Apply(record, now_ms); });
+
+    EXPECT_EQ(4u, report.profiles);
+    EXPECT_EQ(1u, report.changed);  // veteran만 (rookie는 하한 아래, 나머지는 최근 활동)
+    EXPECT_EQ(1225 - 20, service.GetProfile("veteran")->rating);
+    EXPECT_EQ(1213, service.GetProfile("active")->rating);
+    EXPECT_EQ(1205, leaderboard->Get("veteran").value());
+    EXPECT_GT(service.Version(), before_version);
+
+    pvpserver::SeasonResetPolicy reset;
+    reset.keep_fraction = 0.0;
+    service.ApplyRatingJob(
+        engine, [&](const pvpserver::RatingRecord& record) { return reset.Apply(record); });
+    for (const auto& entry : leaderboard->TopN(10)) {
+        EXPECT_EQ(1200, entry.second);
+        EXPECT_EQ(1200, service.GetProfile(entry.first)->rating);
+    }
+    EXPECT_NE(service.MetricsSnapshot().find("rating_jobs_total 2"), std::string::npos);
+}
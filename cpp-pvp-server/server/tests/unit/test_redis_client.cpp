@@ -0,0 +1,527 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/matchmaking/match_queue.h"
+#include "pvpserver/matchmaking/matchmaker.h"
+#include "pvpserver/storage/redis_client.h"
+
+namespace {
+
+using namespace std::chrono;
+using pvpserver::MatchRequest;
+using pvpserver::Matchmaker;
+using pvpserver::RedisMatchQueue;
+using pvpserver::storage::EncodeRespCommand;
+using pvpserver::storage::RedisClient;
+using pvpserver::storage::RedisClientConfig;
+using pvpserver::storage::RespParser;
+using pvpserver::storage::RespValue;
+
+// 테스트에 필요한 명령만 지원하는 인프로세스 RESP 서버
+// (PING, HELLO, ZADD, ZREM, ZCARD, ZRANGEBYSCORE, HSET, HDEL, HMGET, DEL,
+//  EVAL은 대기열 추가/매치 확보 스크립트만: 본문은 해석하지 않고 키 개수로 구분해 같은 동작을 흉내 냄)
+class RedisStubServer {
+   public:
+    RedisStubServer() : acceptor_(io_, {boost::asio::ip::make_address("127.0.0.1"), 0}) {
+        accept_thread_ = std::thread([this]() { AcceptLoop(); });
+    }
+
+    ~RedisStubServer() {
+        // 블로킹 accept()는 close로 깨어나지 않으므로 더미 연결로 깨움
+        stopping_ = true;
+        boost::system::error_code ignored;
+        boost::asio::ip::tcp::socket wake(io_);
+        wake.connect(acceptor_.local_endpoint(), ignored);
+        accept_thread_.join();
+        acceptor_.close(ignored);
+        DropConnections();
+        for (auto& thread : connection_threads_) {
+            thread.join();
+        }
+    }
+
+    std::uint16_t port() const { return acceptor_.local_endpoint().port(); }
+
+    // 열린 연결을 모두 끊음 (재연결 테스트용)
+    void DropConnections() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        for (auto& socket : sockets_) {
+            boost::system::error_code ignored;
+            socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+            socket->close(ignored);
+        }
+    }
+
+    // 한 번의 read에서 받은 명령 수의 최댓값 (파이프라이닝 확인용)
+    std::size_t max_commands_per_read() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return max_commands_per_read_;
+    }
+    std::size_t accepted() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return sockets_.size();
+    }
+
+   private:
+    void AcceptLoop() {
+        while (true) {
+            auto socket = std::make_shared<boost::asio::ip::tcp::socket>(io_);
+            boost::system::error_code ec;
+            acceptor_.accept(*socket, ec);
+            if (ec || stopping_) {
+                return;
+            }
+            std::lock_guard<std::mutex> lk(mutex_);
+            sockets_.push_back(socket);
+            connection_threads_.emplace_back([this, socket]() { Serve(*socket); });
+        }
+    }
+
+    void Serve(boost::asio::ip::tcp::socket& socket) {
+        RespParser parser;
+        std::array<char, 4096> buffer{};
+        while (true) {
+            boost::system::error_code ec;
+            const auto bytes = socket.read_some(boost::asio::buffer(buffer), ec);
+            if (ec) {
+                return;
+            }
+            parser.Feed(buffer.data(), bytes);
+            std::string out;
+            std::size_t commands = 0;
+            while (auto request = parser.Next()) {
+                std::vector<std::string> args;
+                for (const auto& element : request->elements) {
+                    args.push_back(element.text);
+                }
+                out += Execute(args);
+                ++commands;
+            }
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                max_commands_per_read_ = std::max(max_commands_per_read_, commands);
+            }
+            boost::asio::write(socket, boost::asio::buffer(out), ec);
+            if (ec) {
+                return;
+            }
+        }
+    }
+
+    static std::string Integer(long long value) { return ":" + std::to_string(value) + "\r\n"; }
+    static std::string Bulk(const std::string& value) {
+        return "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+    }
+
+    static bool InRange(double score, const std::string& min, const std::string& max) {
+        const auto parse = [](const std::string& text, bool& exclusive) {
+            exclusive = !text.empty() && text[0] == '(';
+            const std::string body = exclusive ? text.substr(1) : text;
+            if (body == "-inf") return -1e300;
+            if (body == "+inf" || body == "inf") return 1e300;
+            return std::strtod(body.c_str(), nullptr);
+        };
+        bool min_exclusive = false;
+        bool max_exclusive = false;
+        const double lo = parse(min, min_exclusive);
+        const double hi = parse(max, max_exclusive);
+        return (min_exclusive ? score > lo : score >= lo) &&
+               (max_exclusive ? score < hi : score <= hi);
+    }
+
+    std::string Execute(const std::vector<std::string>& args) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        const std::string& name = args.at(0);
+        if (name == "PING") {
+            return "+PONG\r\n";
+        }
+        if (name == "HELLO") {
+            return "%1\r\n+proto\r\n:3\r\n";
+        }
+        if (name == "ZADD") {
+            auto& zset = zsets_[args[1]];
+            const double score = std::strtod(args[2].c_str(), nullptr);
+            const bool added = zset.by_member.count(args[3]) == 0;
+            if (!added) {
+                zset.ordered.erase({zset.by_member[args[3]], args[3]});
+            }
+            zset.by_member[args[3]] = score;
+            zset.ordered.insert({score, args[3]});
+            return Integer(added ? 1 : 0);
+        }
+        if (name == "ZREM") {
+            auto& zset = zsets_[args[1]];
+            auto it = zset.by_member.find(args[2]);
+            if (it == zset.by_member.end()) {
+                return Integer(0);
+            }
+            zset.ordered.erase({it->second, it->first});
+            zset.by_member.erase(it);
+            return Integer(1);
+        }
+        if (name == "ZCARD") {
+            return Integer(static_cast<long long>(zsets_[args[1]].by_member.size()));
+        }
+        if (name == "ZRANGEBYSCORE") {
+            // ZRANGEBYSCORE key min max WITHSCORES LIMIT offset count
+            const auto& zset = zsets_[args[1]];
+            const std::size_t offset = std::stoul(args[6]);
+            const std::size_t count = std::stoul(args[7]);
+            std::vector<std::pair<double, std::string>> hits;
+            std::size_t skipped = 0;
+            for (const auto& entry : zset.ordered) {
+                if (!InRange(entry.first, args[2], args[3])) {
+                    continue;
+                }
+                if (skipped++ < offset) {
+                    continue;
+                }
+                if (hits.size() == count) {
+                    break;
+                }
+                hits.push_back(entry);
+            }
+            std::string out = "*" + std::to_string(hits.size() * 2) + "\r\n";
+            for (const auto& hit : hits) {
+                char score[64];
+                std::snprintf(score, sizeof(score), "%.17g", hit.first);
+                out += Bulk(hit.second) + Bulk(score);
+            }
+            return out;
+        }
+        if (name == "HSET") {
+            const bool added = hashes_[args[1]].count(args[2]) == 0;
+            hashes_[args[1]][args[2]] = args[3];
+            return Integer(added ? 1 : 0);
+        }
+        if (name == "HDEL") {
+            return Integer(static_cast<long long>(hashes_[args[1]].erase(args[2])));
+        }
+        if (name == "HMGET") {
+            const auto& hash = hashes_[args[1]];
+            std::string out = "*" + std::to_string(args.size() - 2) + "\r\n";
+            for (std::size_t i = 2; i < args.size(); ++i) {
+                auto it = hash.find(args[i]);
+                out += it == hash.end() ? "$-1\r\n" : Bulk(it->second);
+            }
+            return out;
+        }
+        if (name == "EVAL" && args[2] == "3") {
+            // 대기열 추가: EVAL script 3 queue requests order player_id elo body
+            const long long order = ++counters_[args[5]];
+            const double score = std::strtod(args[7].c_str(), nullptr) * 4294967296.0 +
+                                 static_cast<double>(order % 4294967296LL);
+            auto& zset = zsets_[args[3]];
+            if (zset.by_member.count(args[6]) > 0) {
+                zset.ordered.erase({zset.by_member[args[6]], args[6]});
+            }
+            zset.by_member[args[6]] = score;
+            zset.ordered.insert({score, args[6]});
+            const auto text = std::to_string(order);
+            hashes_[args[4]][args[6]] = std::to_string(text.size()) + ":" + text + args[8];
+            return Integer(order);
+        }
+        if (name == "EVAL") {
+            // 매치 확보: EVAL script 2 queue requests player_id...
+            auto& zset = zsets_[args[3]];
+            for (std::size_t i = 5; i < args.size(); ++i) {
+                if (zset.by_member.count(args[i]) == 0) {
+                    return Integer(0);
+                }
+            }
+            for (std::size_t i = 5; i < args.size(); ++i) {
+                zset.ordered.erase({zset.by_member[args[i]], args[i]});
+                zset.by_member.erase(args[i]);
+                hashes_[args[4]].erase(args[i]);
+            }
+            return Integer(1);
+        }
+        if (name == "DEL") {
+            long long removed = zsets_.erase(args[1]) + hashes_.erase(args[1]);
+            return Integer(removed);
+        }
+        return "-ERR unknown command '" + name + "'\r\n";
+    }
+
+    struct ZSet {
+        std::map<std::string, double> by_member;
+        std::set<std::pair<double, std::string>> ordered;
+    };
+
+    boost::asio::io_context io_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::thread accept_thread_;
+    std::atomic<bool> stopping_{false};
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> sockets_;
+    std::vector<std::thread> connection_threads_;
+    std::size_t max_commands_per_read_ = 0;
+    std::map<std::string, ZSet> zsets_;
+    std::map<std::string, std::map<std::string, std::string>> hashes_;
+    std::map<std::string, long long> counters_;
+};
+
+std::shared_ptr<RedisClient> MakeClient(const RedisStubServer& server, bool resp3 = false) {
+    RedisClientConfig config;
+    config.port = server.port();
+    config.command_timeout_ms = 2000;
+    config.use_resp3 = resp3;
+    return std::make_shared<RedisClient>(config);
+}
+
+}  // namespace
+
+TEST(RespParserTest, ParsesFragmentedResp2AndResp3Values) {
+    const std::string wire =
+        "+OK\r\n-ERR bad\r\n:42\r\n$5\r\nhello\r\n$-1\r\n*2\r\n$1\r\na\r\n:7\r\n"
+        "_\r\n#t\r\n,3.5\r\n%1\r\n+k\r\n$1\r\nv\r\n~1\r\n:1\r\n=8\r\ntxt:abcd\r\n"
+        "|1\r\n+ttl\r\n:5\r\n+after-attr\r\n";
+    RespParser parser;
+    std::vector<RespValue> values;
+    // 한 바이트씩 넣어도 같은 결과 (TCP 조각화)
+    for (char c : wire) {
+        parser.Feed(&c, 1);
+        while (auto value = parser.Next()) {
+            values.push_back(std::move(*value));
+        }
+    }
+    ASSERT_EQ(13u, values.size());
+    EXPECT_EQ("OK", values[0].text);
+    EXPECT_TRUE(values[1].IsError());
+    EXPECT_EQ(42, values[2].integer);
+    EXPECT_EQ("hello", values[3].text);
+    EXPECT_TRUE(values[4].IsNull());
+    ASSERT_EQ(2u, values[5].elements.size());
+    EXPECT_EQ(7, values[5].elements[1].integer);
+    EXPECT_TRUE(values[6].IsNull());
+    EXPECT_EQ(1, values[7].integer);
+    EXPECT_EQ("3.5", values[8].text);
+    ASSERT_EQ(RespValue::Type::Map, values[9].type);
+    EXPECT_EQ("v", values[9].elements[1].text);
+    EXPECT_EQ(RespValue::Type::Set, values[10].type);
+    EXPECT_EQ("abcd", values[11].text);
+    EXPECT_EQ("after-attr", values[12].text);  // 속성(|)은 건너뜀
+    EXPECT_EQ(0u, parser.Buffered());
+
+    parser.Feed("+after", 6);
+    EXPECT_FALSE(parser.Next().has_value());
+    EXPECT_EQ("*2\r\n$3\r\nGET\r\n$1\r\nk\r\n", EncodeRespCommand({"GET", "k"}));
+}
+
+TEST(RespParserTest, RejectsUnknownTypeByte) {
+    RespParser parser;
+    parser.Feed("?x\r\n", 4);
+    EXPECT_THROW(parser.Next(), std::runtime_error);
+}
+
+TEST(RedisClientTest, PipelinesConcurrentCommandsOverOneConnection) {
+    RedisStubServer server;
+    auto client = MakeClient(server);
+    ASSERT_TRUE(client->Execute({"PING"}).has_value());
+
+    std::vector<std::vector<std::string>> commands;
+    for (int i = 0; i < 200; ++i) {
+        commands.push_back({"ZADD", "z", std::to_string(i), "m" + std::to_string(i)});
+    }
+    const auto replies = client->Pipeline(commands);
+    ASSERT_TRUE(replies.has_value());
+    ASSERT_EQ(200u, replies->size());
+    EXPECT_EQ(1, replies->back().integer);
+    EXPECT_GT(server.max_commands_per_read(), 1u);  // 한 번의 write로 묶여 전송됨
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&client, t]() {
+            for (int i = 0; i < 50; ++i) {
+                const auto reply = client->Execute({"ZCARD", "z"});
+                ASSERT_TRUE(reply.has_value());
+                EXPECT_EQ(200, reply->integer) << t;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(1u, server.accepted());  // 연결 재사용
+    EXPECT_NE(std::string::npos,
+              client->MetricsSnapshot().find("redis_client_commands_total 401"));
+}
+
+TEST(RedisClientTest, ReconnectsAfterConnectionLoss) {
+    RedisStubServer server;
+    auto client = MakeClient(server, /*resp3=*/true);
+    ASSERT_TRUE(client->Execute({"PING"}).has_value());
+    server.DropConnections();
+
+    // 끊김을 감지한 뒤 다음 명령에서 새 연결
+    std::optional<RespValue> reply;
+    for (int attempt = 0; attempt < 50 && !reply; ++attempt) {
+        reply = client->Execute({"PING"});
+        if (!reply) {
+            std::this_thread::sleep_for(milliseconds(10));
+        }
+    }
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ("PONG", reply->text);
+    EXPECT_EQ(2u, server.accepted());
+    EXPECT_NE(std::string::npos, client->MetricsSnapshot().find("redis_client_reconnects_total 1"));
+}
+
+TEST(RedisClientTest, FailsFastWhenServerIsDown) {
+    std::uint16_t port = 0;
+    {
+        RedisStubServer server;
+        port = server.port();
+    }
+    RedisClientConfig config;
+    config.port = port;
+    config.command_timeout_ms = 500;
+    RedisClient client(config);
+    EXPECT_FALSE(client.Execute({"PING"}).has_value());
+    EXPECT_FALSE(client.IsConnected());
+}
+
+TEST(RedisMatchQueueTest, StoresRequestsInSortedSetOrder) {
+    RedisStubServer server;
+    RedisMatchQueue queue(MakeClient(server), "test:mm");
+    const auto now = steady_clock::now();
+    queue.Upsert(MatchRequest{"alice", 1200, now - seconds(3), "kr"}, 1);
+    queue.Upsert(MatchRequest{"bob", 1100, now}, 2);
+    queue.Upsert(MatchRequest{"carol", 1200, now, "global", {"dave"}}, 3);
+    queue.Upsert(MatchRequest{"bob", 1150, now}, 4);  // 갱신
+
+    EXPECT_EQ(3u, queue.Size());
+    const auto ordered = queue.FetchOrdered();
+    ASSERT_EQ(3u, ordered.size());
+    EXPECT_EQ("bob", ordered[0].request.player_id());
+    EXPECT_EQ(1150, ordered[0].request.elo());
+    EXPECT_EQ("alice", ordered[1].request.player_id());
+    EXPECT_EQ("kr", ordered[1].request.preferred_region());
+    EXPECT_NEAR(3.0, ordered[1].request.WaitSeconds(now), 0.05);
+    EXPECT_EQ("carol", ordered[2].request.player_id());
+    EXPECT_EQ(2u, ordered[2].request.party_size());
+    EXPECT_EQ(3u, ordered[2].order);
+
+    EXPECT_TRUE(queue.Remove("alice"));
+    EXPECT_FALSE(queue.Remove("alice"));
+    EXPECT_EQ("bob:1150,carol:1200", queue.Snapshot());
+}
+
+TEST(RedisMatchQueueTest, RangeFetchPagesThroughOnlyTheRequestedBand) {
+    RedisStubServer server;
+    RedisMatchQueue queue(MakeClient(server), "test:mm");
+    const auto now = steady_clock::now();
+    // 페이지 경계를 넘도록 많은 요청
+    const int players = static_cast<int>(RedisMatchQueue::kPageSize) * 2 + 37;
+    for (int i = 0; i < players; ++i) {
+        queue.Upsert(MatchRequest{"p" + std::to_string(i), 1000 + (i % 3) * 100, now},
+                     static_cast<std::uint64_t>(i));
+    }
+
+    std::vector<std::string> band;
+    int previous_elo = 0;
+    queue.ForEachInRange(1100, 1199, [&](const MatchRequest& request, std::uint64_t) {
+        EXPECT_GE(request.elo(), previous_elo);
+        previous_elo = request.elo();
+        band.push_back(request.player_id());
+    });
+    EXPECT_EQ(static_cast<std::size_t>(players / 3 + (players % 3 > 1 ? 1 : 0)), band.size());
+    EXPECT_EQ(std::set<std::string>(band.begin(), band.end()).size(), band.size());
+
+    // 전체 순회는 여러 페이지에 걸침: 누락/중복 없이 모두 한 번씩
+    std::set<std::string> all;
+    queue.ForEachOrdered(
+        [&all](const MatchRequest& request, std::uint64_t) { all.insert(request.player_id()); });
+    EXPECT_EQ(static_cast<std::size_t>(players), all.size());
+    EXPECT_EQ(static_cast<std::size_t>(players), queue.FetchOrdered().size());
+}
+
+TEST(RedisMatchQueueTest, ServersWithDisjointBandsShareOneQueue) {
+    RedisStubServer server;
+    auto queue_a = std::make_shared<RedisMatchQueue>(MakeClient(server), "test:mm");
+    auto queue_b = std::make_shared<RedisMatchQueue>(MakeClient(server), "test:mm");
+    Matchmaker low(queue_a);
+    Matchmaker high(queue_b);
+    low.SetEloBand(0, 1499);
+    high.SetEloBand(1500, 4000);
+
+    const auto now = steady_clock::now();
+    low.Enqueue(MatchRequest{"l1", 1200, now});
+    high.Enqueue(MatchRequest{"h1", 1600, now});
+    low.Enqueue(MatchRequest{"h2", 1610, now});  // 다른 서버에 접속했어도 같은 대기열
+    high.Enqueue(MatchRequest{"l2", 1210, now});
+
+    const auto low_matches = low.RunMatching(now);
+    const auto high_matches = high.RunMatching(now);
+    ASSERT_EQ(1u, low_matches.size());
+    ASSERT_EQ(1u, high_matches.size());
+    EXPECT_EQ(1205, low_matches.front().average_elo());
+    EXPECT_EQ(1605, high_matches.front().average_elo());
+    EXPECT_EQ(0u, queue_a->Size());
+}
+
+TEST(RedisMatchQueueTest, ClaimTakesWholeMatchOrNothing) {
+    RedisStubServer server;
+    auto client = MakeClient(server);
+    RedisMatchQueue queue(client, "test:mm");
+    RedisMatchQueue other_server(MakeClient(server), "test:mm");
+    const auto now = steady_clock::now();
+    for (const auto* id : {"a", "b", "c", "d"}) {
+        queue.Upsert(MatchRequest{id, 1200, now}, 1);
+    }
+    EXPECT_TRUE(other_server.Remove("b"));  // 다른 서버에서 취소
+
+    const auto claimed = queue.Claim({{"a", "b"}, {"c", "d"}});
+    ASSERT_EQ(2u, claimed.size());
+    EXPECT_FALSE(claimed[0]);
+    EXPECT_TRUE(claimed[1]);
+    // 실패한 매치의 a는 건드리지 않음, 취소한 b는 되살아나지 않음
+    EXPECT_EQ("a:1200", queue.Snapshot());
+}
+
+TEST(RedisMatchQueueTest, RegionAndPartyIdsMayContainAnyCharacters) {
+    RedisStubServer server;
+    RedisMatchQueue queue(MakeClient(server), "test:mm");
+    const auto now = steady_clock::now();
+    const std::vector<std::string> party{"a|b", "c,d", "12:x", ""};
+    queue.Upsert(MatchRequest{"leader", 1300, now, "eu|west,1", party}, 7);
+
+    const auto ordered = queue.FetchOrdered();
+    ASSERT_EQ(1u, ordered.size());
+    EXPECT_EQ("eu|west,1", ordered[0].request.preferred_region());
+    EXPECT_EQ(party, ordered[0].request.party_members());
+    EXPECT_EQ(1300, ordered[0].request.elo());
+}
+
+TEST(RedisMatchQueueTest, WaitOrderIsSharedAcrossServers) {
+    RedisStubServer server;
+    auto queue_a = std::make_shared<RedisMatchQueue>(MakeClient(server), "test:mm");
+    auto queue_b = std::make_shared<RedisMatchQueue>(MakeClient(server), "test:mm");
+    Matchmaker long_running(queue_a);
+    const auto now = steady_clock::now();
+    for (const auto* id : {"a1", "a2", "a3"}) {
+        long_running.Enqueue(MatchRequest{id, 1200, now});
+    }
+
+    // 방금 재시작한 서버: 자기 카운터는 1부터지만 먼저 기다린 플레이어 뒤에 섬
+    Matchmaker restarted(queue_b);
+    restarted.Enqueue(MatchRequest{"b1", 1200, now});
+    long_running.Enqueue(MatchRequest{"a4", 1200, now});
+
+    std::vector<std::string> order;
+    for (const auto& entry : queue_a->FetchOrdered()) {
+        order.push_back(entry.request.player_id());
+    }
+    EXPECT_EQ((std::vector<std::string>{"a1", "a2", "a3", "b1", "a4"}), order);
+}
@@ -0,0 +1,516 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pvpserver/distributed/service_discovery.h"
+#include "pvpserver/storage/cached_session_store.h"
+#include "pvpserver/storage/redis_cluster_client.h"
+#include "pvpserver/storage/redis_session_store.h"
+
+namespace {
+
+using pvpserver::storage::RedisClusterClient;
+using pvpserver::storage::RedisConfig;
+using pvpserver::storage::RedisSessionStore;
+using pvpserver::storage::RespParser;
+using pvpserver::storage::RespValue;
+using pvpserver::storage::SessionData;
+
+// 클러스터 노드 흉내를 내는 인프로세스 RESP 서버
+// - [slot_begin, slot_end] 밖의 키는 MOVED (redirect_port로)
+// - ask_keys는 ASK (ASKING 뒤에는 범위 밖이어도 실행)
+// - cluster_slots가 비어 있으면 단일 Redis처럼 CLUSTER SLOTS 오류
+// - SUBSCRIBE/PUBLISH는 RESP3 push로 구독 연결에 전달
+class ClusterStubServer {
+   public:
+    ClusterStubServer(int slot_begin = 0, int slot_end = 16383)
+        : slot_begin_(slot_begin),
+          slot_end_(slot_end),
+          acceptor_(io_, {boost::asio::ip::make_address("127.0.0.1"), 0}) {
+        accept_thread_ = std::thread([this]() { AcceptLoop(); });
+    }
+
+    ~ClusterStubServer() {
+        stopping_ = true;
+        boost::system::error_code ignored;
+        boost::asio::ip::tcp::socket wake(io_);
+        wake.connect(acceptor_.local_endpoint(), ignored);
+        accept_thread_.join();
+        acceptor_.close(ignored);
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            for (auto& socket : sockets_) {
+                socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+                socket->close(ignored);
+            }
+        }
+        for (auto& thread : connection_threads_) {
+            thread.join();
+        }
+    }
+
+    std::uint16_t port() const { return acceptor_.local_endpoint().port(); }
+    std::string address() const { return "127.0.0.1:" + std::to_string(port()); }
+
+    void SetClusterSlots(std::string raw_reply) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        cluster_slots_ = std::move(raw_reply);
+    }
+    void SetRedirect(const std::string& address) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        redirect_ = address;
+    }
+    void AddAskKey(const std::string& key) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        ask_keys_.insert(key);
+    }
+    bool HasKey(const std::string& key) const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return strings_.count(key) > 0;
+    }
+    std::size_t max_commands_per_read() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return max_commands_per_read_;
+    }
+
+   private:
+    struct Connection {
+        bool multi = false;
+        bool aborted = false;
+        bool asking = false;
+        std::vector<std::vector<std::string>> queued;
+        boost::asio::ip::tcp::socket* socket = nullptr;
+    };
+
+    void AcceptLoop() {
+        while (true) {
+            auto socket = std::make_shared<boost::asio::ip::tcp::socket>(io_);
+            boost::system::error_code ec;
+            acceptor_.accept(*socket, ec);
+            if (ec || stopping_) {
+                return;
+            }
+            std::lock_guard<std::mutex> lk(mutex_);
+            sockets_.push_back(socket);
+            connection_threads_.emplace_back([this, socket]() { Serve(*socket); });
+        }
+    }
+
+    void Serve(boost::asio::ip::tcp::socket& socket) {
+        RespParser parser;
+        Connection connection;
+        connection.socket = &socket;
+        std::array<char, 4096> buffer{};
+        while (true) {
+            boost::system::error_code ec;
+            const auto bytes = socket.read_some(boost::asio::buffer(buffer), ec);
+            if (ec) {
+                return;
+            }
+            parser.Feed(buffer.data(), bytes);
+            std::string out;
+            std::size_t commands = 0;
+            while (auto request = parser.Next()) {
+                std::vector<std::string> args;
+                for (const auto& element : request->elements) {
+                    args.push_back(element.text);
+                }
+                out += Handle(connection, args);
+                ++commands;
+            }
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                max_commands_per_read_ = std::max(max_commands_per_read_, commands);
+            }
+            std::lock_guard<std::mutex> write_lock(write_mutex_);
+            boost::asio::write(socket, boost::asio::buffer(out), ec);
+            if (ec) {
+                return;
+            }
+        }
+    }
+
+    static std::string Integer(long long value) { return ":" + std::to_string(value) + "\r\n"; }
+    static std::string Bulk(const std::string& value) {
+        return "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+    }
+
+    // 키 소유 확인: 리다이렉트 오류 또는 빈 문자열
+    std::string CheckOwner(Connection& connection, const std::vector<std::string>& args) {
+        static const std::set<std::string> keyless{"PING",  "CLUSTER", "ASKING",   "MULTI",
+                                                   "EXEC",  "HELLO",   "SUBSCRIBE", "PUBLISH"};
+        if (args.size() < 2 || keyless.count(args[0])) {
+            return "";
+        }
+        const bool asking = connection.asking;
+        connection.asking = false;
+        const int slot = RedisClusterClient::KeySlot(args[1]);
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (ask_keys_.count(args[1]) && !asking) {
+            return "-ASK " + std::to_string(slot) + " " + redirect_ + "\r\n";
+        }
+        if ((slot < slot_begin_ || slot > slot_end_) && !asking) {
+            return "-MOVED " + std::to_string(slot) + " " + redirect_ + "\r\n";
+        }
+        return "";
+    }
+
+    std::string Handle(Connection& connection, const std::vector<std::string>& args) {
+        const std::string& name = args.at(0);
+        if (name == "ASKING") {
+            connection.asking = true;
+            return "+OK\r\n";
+        }
+        if (name == "HELLO") {
+            return "%1\r\n+proto\r\n:3\r\n";
+        }
+        if (name == "SUBSCRIBE") {
+            std::string out;
+            std::lock_guard<std::mutex> lk(mutex_);
+            for (std::size_t i = 1; i < args.size(); ++i) {
+                subscribers_[args[i]].insert(connection.socket);
+                out += ">3\r\n" + Bulk("subscribe") + Bulk(args[i]) + Integer(1);
+            }
+            return out;
+        }
+        if (name == "MULTI") {
+            connection = Connection{};
+            connection.multi = true;
+            return "+OK\r\n";
+        }
+        if (name == "EXEC") {
+            auto queued = std::move(connection.queued);
+            const bool aborted = connection.aborted;
+            connection = Connection{};
+            if (aborted) {
+                return "-EXECABORT Transaction discarded because of previous errors.\r\n";
+            }
+            std::string out = "*" + std::to_string(queued.size()) + "\r\n";
+            for (const auto& command : queued) {
+                out += Execute(command);
+            }
+            return out;
+        }
+        const std::string redirect = CheckOwner(connection, args);
+        if (!redirect.empty()) {
+            connection.aborted = connection.aborted || connection.multi;
+            return redirect;
+        }
+        if (connection.multi) {
+            connection.queued.push_back(args);
+            return "+QUEUED\r\n";
+        }
+        return Execute(args);
+    }
+
+    std::string Execute(const std::vector<std::string>& args) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        const std::string& name = args.at(0);
+        if (name == "PING") return "+PONG\r\n";
+        if (name == "CLUSTER") {
+            return cluster_slots_.empty() ? "-ERR This instance has cluster support disabled\r\n"
+                                          : cluster_slots_;
+        }
+        if (name == "SET") {
+            strings_[args[1]] = args[2];
+            return "+OK\r\n";
+        }
+        if (name == "GET") {
+            auto it = strings_.find(args[1]);
+            return it == strings_.end() ? "$-1\r\n" : Bulk(it->second);
+        }
+        if (name == "DEL") return Integer(static_cast<long long>(strings_.erase(args[1])));
+        if (name == "EXISTS" || name == "EXPIRE") {
+            return Integer(static_cast<long long>(strings_.count(args[1])));
+        }
+        if (name == "SADD") return Integer(sets_[args[1]].insert(args[2]).second ? 1 : 0);
+        if (name == "SREM") return Integer(static_cast<long long>(sets_[args[1]].erase(args[2])));
+        if (name == "SCARD") return Integer(static_cast<long long>(sets_[args[1]].size()));
+        if (name == "SMEMBERS") {
+            const auto& members = sets_[args[1]];
+            std::string out = "*" + std::to_string(members.size()) + "\r\n";
+            for (const auto& member : members) {
+                out += Bulk(member);
+            }
+            return out;
+        }
+        if (name == "PUBLISH") {
+            const auto& sockets = subscribers_[args[1]];
+            const std::string push = ">3\r\n" + Bulk("message") + Bulk(args[1]) + Bulk(args[2]);
+            std::lock_guard<std::mutex> write_lock(write_mutex_);
+            for (auto* socket : sockets) {
+                boost::system::error_code ignored;
+                boost::asio::write(*socket, boost::asio::buffer(push), ignored);
+            }
+            return Integer(static_cast<long long>(sockets.size()));
+        }
+        return "-ERR unknown command '" + name + "'\r\n";
+    }
+
+    const int slot_begin_;
+    const int slot_end_;
+    boost::asio::io_context io_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::thread accept_thread_;
+    std::atomic<bool> stopping_{false};
+    mutable std::mutex mutex_;
+    std::mutex write_mutex_;  // 구독 연결에는 다른 연결 스레드도 씀 (mutex_ 다음에 잡음)
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> sockets_;
+    std::vector<std::thread> connection_threads_;
+    std::size_t max_commands_per_read_ = 0;
+    std::string cluster_slots_;
+    std::string redirect_;
+    std::set<std::string> ask_keys_;
+    std::map<std::string, std::string> strings_;
+    std::map<std::string, std::set<std::string>> sets_;
+    std::map<std::string, std::set<boost::asio::ip::tcp::socket*>> subscribers_;
+};
+
+RedisConfig MakeConfig(const std::vector<const ClusterStubServer*>& servers) {
+    RedisConfig config;
+    for (const auto* server : servers) {
+        config.cluster_nodes.push_back(server->address());
+    }
+    config.connection_pool_size = 2;
+    config.command_timeout_ms = 2000;
+    config.connection_timeout_ms = 2000;
+    return config;
+}
+
+// 슬롯이 [begin, end]인 키 찾기
+std::string KeyInSlots(const std::string& prefix, int begin, int end) {
+    for (int i = 0;; ++i) {
+        const std::string key = prefix + std::to_string(i);
+        const int slot = RedisClusterClient::KeySlot(key);
+        if (slot >= begin && slot <= end) {
+            return key;
+        }
+    }
+}
+
+SessionData MakeSession(const std::string& player_id) {
+    SessionData data;
+    data.player_id = player_id;
+    data.player_name = "name";
+    data.server_id = "server-1";
+    data.created_at = 1000;
+    data.last_activity = 2000;
+    data.elo_rating = 1500;
+    return data;
+}
+
+}  // namespace
+
+TEST(RedisClusterClientTest, KeySlotMatchesClusterSpec) {
+    EXPECT_EQ(12739, RedisClusterClient::KeySlot("123456789"));  // CRC16/XMODEM 검증 값 0x31C3
+    EXPECT_EQ(RedisClusterClient::KeySlot("{user1000}.following"),
+              RedisClusterClient::KeySlot("{user1000}.followers"));
+    EXPECT_EQ(RedisClusterClient::KeySlot("user1000"),
+              RedisClusterClient::KeySlot("{user1000}.following"));
+    // 빈 태그는 무시하고 키 전체, 태그는 첫 '{'부터 다음 '}'까지
+    EXPECT_EQ(8363, RedisClusterClient::KeySlot("foo{}{bar}"));
+    EXPECT_EQ(4015, RedisClusterClient::KeySlot("foo{{bar}}zap"));  // 태그 = "{bar"
+    EXPECT_EQ(5061, RedisClusterClient::KeySlot("foo{bar}{zap}"));
+}
+
+TEST(RedisClusterClientTest, SessionSaveIsOneTransactionRoundTrip) {
+    ClusterStubServer server;
+    RedisSessionStore store(MakeConfig({&server}));
+
+    ASSERT_TRUE(store.SaveSession("s1", MakeSession("p1")));
+    // MULTI + SET + SET + SADD + EXEC 가 한 번의 read로 도착
+    EXPECT_GE(server.max_commands_per_read(), 5u);
+
+    auto session = store.GetSession("s1");
+    ASSERT_TRUE(session.has_value());
+    EXPECT_EQ("p1", session->player_id);
+    EXPECT_EQ(1500, session->elo_rating);
+    EXPECT_EQ("s1", store.GetSessionByPlayerId("p1").value_or(""));
+    EXPECT_TRUE(store.SessionExists("s1"));
+    EXPECT_TRUE(store.RefreshSession("s1"));
+    EXPECT_EQ(1u, store.GetActiveSessionCount());
+    EXPECT_EQ(std::vector<std::string>{"s1"}, store.GetAllSessionIds());
+    EXPECT_TRUE(store.IsConnected());
+
+    std::promise<bool> saved;
+    store.SaveSessionAsync("s2", MakeSession("p2"), [&](bool ok) { saved.set_value(ok); });
+    EXPECT_TRUE(saved.get_future().get());
+    std::promise<std::optional<SessionData>> loaded;
+    store.GetSessionAsync("s2", [&](std::optional<SessionData> data) {
+        loaded.set_value(std::move(data));
+    });
+    EXPECT_EQ("p2", loaded.get_future().get().value_or(SessionData{}).player_id);
+
+    EXPECT_TRUE(store.DeleteSession("s1"));
+    EXPECT_FALSE(store.GetSession("s1").has_value());
+    EXPECT_FALSE(store.GetSessionByPlayerId("p1").has_value());
+    EXPECT_EQ(1u, store.GetActiveSessionCount());
+    EXPECT_NE(std::string::npos,
+              store.MetricsSnapshot().find("redis_cluster_transactions_total"));
+}
+
+TEST(RedisClusterClientTest, RoutesBySlotAndFollowsMovedRedirects) {
+    ClusterStubServer low(0, 8191);
+    ClusterStubServer high(8192, 16383);
+    low.SetRedirect(high.address());
+    high.SetRedirect(low.address());
+    // low는 낡은 슬롯 표를 알려줌 (전부 자기 것) → 클라이언트는 MOVED로 배워야 함
+    low.SetClusterSlots("*1\r\n*3\r\n:0\r\n:16383\r\n*2\r\n$9\r\n127.0.0.1\r\n:" +
+                        std::to_string(low.port()) + "\r\n");
+    RedisClusterClient client(MakeConfig({&low}));
+
+    const std::string low_key = KeyInSlots("low-", 0, 8191);
+    const std::string high_key = KeyInSlots("high-", 8192, 16383);
+    auto reply = client.Execute({"SET", high_key, "v-high"});
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ("OK", reply->text);
+    EXPECT_TRUE(high.HasKey(high_key));
+    EXPECT_FALSE(low.HasKey(high_key));
+    EXPECT_EQ(2u, client.NodeCount());
+
+    // 두 노드에 걸친 묶음: 응답은 요청 순서대로
+    auto replies = client.Batch({{"SET", low_key, "v-low"},
+                                 {"GET", high_key},
+                                 {"GET", low_key},
+                                 {"SADD", "pvp:sessions", "x"}});
+    ASSERT_TRUE(replies.has_value());
+    ASSERT_EQ(4u, replies->size());
+    EXPECT_EQ("OK", (*replies)[0].text);
+    EXPECT_EQ("v-high", (*replies)[1].text);
+    EXPECT_EQ("v-low", (*replies)[2].text);
+    EXPECT_EQ(1, (*replies)[3].integer);
+    EXPECT_TRUE(low.HasKey(low_key));
+    EXPECT_EQ(std::string::npos,
+              client.MetricsSnapshot().find("redis_cluster_redirects_total{type=\"moved\"} 0"));
+}
+
+TEST(RedisClusterClientTest, AskRedirectSendsAskingWithoutChangingSlotTable) {
+    ClusterStubServer source;
+    ClusterStubServer target(1, 0);  // 소유 슬롯 없음: ASKING 뒤에만 받음
+    source.SetRedirect(target.address());
+    source.AddAskKey("migrating");
+    RedisClusterClient client(MakeConfig({&source}));
+
+    auto reply = client.Execute({"SET", "migrating", "v"});
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ("OK", reply->text);
+    EXPECT_TRUE(target.HasKey("migrating"));
+    // 다른 키는 여전히 원래 노드
+    ASSERT_TRUE(client.Execute({"SET", "stays", "v"}).has_value());
+    EXPECT_TRUE(source.HasKey("stays"));
+    EXPECT_NE(std::string::npos,
+              client.MetricsSnapshot().find("redis_cluster_redirects_total{type=\"ask\"} 1"));
+}
+
+TEST(RedisClusterClientTest, ServiceDiscoverySharesClient) {
+    ClusterStubServer server;
+    auto client = std::make_shared<RedisClusterClient>(MakeConfig({&server}));
+    pvpserver::distributed::ServiceDiscovery discovery(client);
+
+    pvpserver::distributed::ServerInfo info;
+    info.server_id = "game-1";
+    info.host = "10.0.0.1";
+    info.udp_port = 7777;
+    discovery.UpdateServerInfo(info);  // 하트비트 스레드 없이 한 번 등록
+
+    std::vector<pvpserver::distributed::ServerInfo> servers;
+    for (int attempt = 0; attempt < 100 && servers.empty(); ++attempt) {
+        servers = discovery.GetAvailableServers();  // 등록은 비동기 전송
+        if (servers.empty()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_EQ(1u, servers.size());
+    EXPECT_EQ("game-1", servers[0].server_id);
+    EXPECT_EQ(7777, servers[0].udp_port);
+    EXPECT_TRUE(discovery.GetServer("game-1").has_value());
+
+    discovery.Unregister();
+    EXPECT_TRUE(discovery.GetAvailableServers().empty());
+}
+
+TEST(RedisClusterClientTest, FailsFastWhenNodeIsDown) {
+    std::string address;
+    {
+        ClusterStubServer server;
+        address = server.address();
+    }
+    RedisConfig config;
+    config.cluster_nodes = {address};
+    config.connection_pool_size = 1;
+    config.command_timeout_ms = 500;
+    RedisSessionStore store(config);
+    EXPECT_FALSE(store.SaveSession("s", MakeSession("p")));
+    EXPECT_FALSE(store.GetSession("s").has_value());
+    EXPECT_FALSE(store.IsConnected());
+}
+
+TEST(RedisClusterClientTest, PubSubDeliversToDedicatedSubscriber) {
+    ClusterStubServer server;
+    RedisClusterClient publisher(MakeConfig({&server}));
+    RedisClusterClient subscriber(MakeConfig({&server}));
+
+    std::promise<std::string> received;
+    std::atomic<bool> done{false};
+    subscriber.Subscribe("events", [&](const std::string& message) {
+        if (!done.exchange(true)) {
+            received.set_value(message);
+        }
+    });
+    // 구독이 자리 잡기 전 메시지는 유실 (Pub/Sub 규칙) → 받을 때까지 다시 발행
+    auto future = received.get_future();
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        publisher.Publish("events", "hello");
+        if (future.wait_for(std::chrono::milliseconds(10)) == std::future_status::ready) {
+            break;
+        }
+    }
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ("hello", future.get());
+    // 구독 연결도 일반 명령 처리와 분리 (풀 연결은 그대로 동작)
+    EXPECT_TRUE(subscriber.Ping());
+    EXPECT_EQ(std::string::npos, subscriber.MetricsSnapshot().find(
+                                     "redis_cluster_pubsub_messages_total{direction=\"received\"} 0"));
+}
+
+TEST(RedisClusterClientTest, NearCacheInvalidatesAcrossNodesViaPubSub) {
+    using pvpserver::storage::CachedSessionStore;
+    using pvpserver::storage::NearCacheOptions;
+    using pvpserver::storage::RedisSessionInvalidationBus;
+
+    ClusterStubServer server;
+    NearCacheOptions options;
+    options.ttl = std::chrono::seconds(60);  // TTL로는 설명되지 않게
+    auto backend_a = std::make_shared<RedisSessionStore>(MakeConfig({&server}));
+    auto backend_b = std::make_shared<RedisSessionStore>(MakeConfig({&server}));
+    CachedSessionStore node_a(backend_a, options,
+                              std::make_shared<RedisSessionInvalidationBus>(backend_a->Client()));
+    CachedSessionStore node_b(backend_b, options,
+                              std::make_shared<RedisSessionInvalidationBus>(backend_b->Client()));
+
+    ASSERT_TRUE(node_a.SaveSession("s1", MakeSession("p1")));
+    ASSERT_EQ(1500, node_b.GetSession("s1").value_or(SessionData{}).elo_rating);
+
+    auto updated = MakeSession("p1");
+    updated.elo_rating = 1700;
+    int seen = 0;
+    for (int attempt = 0; attempt < 200 && seen != 1700; ++attempt) {
+        ASSERT_TRUE(node_a.SaveSession("s1", updated));  // 구독 전 발행은 유실될 수 있음
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        seen = node_b.GetSession("s1").value_or(SessionData{}).elo_rating;
+    }
+    EXPECT_EQ(1700, seen);
+    EXPECT_GE(node_b.Stats().remote_invalidations, 1u);
+    EXPECT_EQ(0u, node_a.Stats().remote_invalidations);
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "pvpserver/game/game_session.h"
+#include "pvpserver/netcode/rollback_engine.h"
+
+namespace {
+
+using pvpserver::GameSession;
+using pvpserver::MovementInput;
+using pvpserver::netcode::InputDisposition;
+using pvpserver::netcode::RollbackConfig;
+using pvpserver::netcode::RollbackEngine;
+
+constexpr double kDelta = 1.0 / 60.0;
+
+MovementInput MakeInput(std::uint64_t sequence, bool up, bool right, bool fire = false) {
+    MovementInput input;
+    input.sequence = sequence;
+    input.up = up;
+    input.right = right;
+    input.mouse_x = 1.0;
+    input.mouse_y = 0.0;
+    input.fire = fire;
+    return input;
+}
+
+RollbackConfig GenerousBudget() {
+    RollbackConfig config;
+    config.history_ticks = 16;
+    config.tick_budget = std::chrono::seconds(1);
+    return config;
+}
+
+}  // namespace
+
+TEST(RollbackEngineTest, LateInputResimulatesToInOrderResult) {
+    // 기준: 모든 입력이 제시간에 도착한 경우
+    GameSession reference(60.0);
+    reference.UpsertPlayer("p1");
+    reference.UpsertPlayer("p2");
+    reference.ApplyInput("p1", MakeInput(1, true, false), kDelta);
+    reference.Tick(0, kDelta);
+    reference.ApplyInput("p1", MakeInput(2, false, true, true), kDelta);
+    reference.ApplyInput("p1", MakeInput(3, true, false), kDelta);
+    for (std::uint64_t tick = 1; tick < 6; ++tick) {
+        reference.Tick(tick, kDelta);
+    }
+
+    // 롤백: 시퀀스 2가 4틱 늦게 도착
+    GameSession session(60.0);
+    session.UpsertPlayer("p1");
+    session.UpsertPlayer("p2");
+    RollbackEngine engine(session, GenerousBudget());
+    EXPECT_EQ(InputDisposition::Applied,
+              engine.SubmitInput("p1", MakeInput(1, true, false), kDelta));
+    engine.AdvanceTick(0, kDelta);
+    EXPECT_EQ(InputDisposition::Applied,
+              engine.SubmitInput("p1", MakeInput(3, true, false), kDelta));
+    for (std::uint64_t tick = 1; tick < 5; ++tick) {
+        engine.AdvanceTick(tick, kDelta);
+    }
+    EXPECT_EQ(InputDisposition::RolledBack,
+              engine.SubmitInput("p1", MakeInput(2, false, true, true), kDelta));
+    engine.AdvanceTick(5, kDelta);
+
+    const auto expected = reference.GetPlayer("p1");
+    const auto actual = session.GetPlayer("p1");
+    EXPECT_DOUBLE_EQ(expected.x, actual.x);
+    EXPECT_DOUBLE_EQ(expected.y, actual.y);
+    EXPECT_EQ(expected.last_sequence, actual.last_sequence);
+    EXPECT_EQ(expected.shots_fired, actual.shots_fired);
+    EXPECT_EQ(reference.ActiveProjectileCount(), session.ActiveProjectileCount());
+
+    const auto stats = engine.GetStats();
+    EXPECT_EQ(1u, stats.rollbacks);
+    EXPECT_EQ(4u, stats.resimulated_ticks);
+}
+
+TEST(RollbackEngineTest, RejectsDuplicateAndOutOfWindowInputs) {
+    GameSession session(60.0);
+    session.UpsertPlayer("p1");
+    RollbackConfig config = GenerousBudget();
+    config.history_ticks = 4;
+    RollbackEngine engine(session, config);
+
+    EXPECT_EQ(InputDisposition::Applied, engine.SubmitInput("p1", MakeInput(5, true, false), kDelta));
+    EXPECT_EQ(InputDisposition::Duplicate,
+              engine.SubmitInput("p1", MakeInput(5, true, false), kDelta));
+    for (std::uint64_t tick = 0; tick < 8; ++tick) {
+        engine.AdvanceTick(tick, kDelta);
+    }
+    // 시퀀스 5가 기록된 프레임이 링 버퍼에서 밀려남 → 더 오래된 입력은 되돌릴 수 없음
+    EXPECT_EQ(InputDisposition::TooOld, engine.SubmitInput("p1", MakeInput(4, true, false), kDelta));
+    EXPECT_EQ(1u, engine.GetStats().late_inputs_dropped);
+}
+
+TEST(RollbackEngineTest, DropsLateInputWhenOverBudget) {
+    GameSession session(60.0);
+    session.UpsertPlayer("p1");
+    RollbackConfig config;
+    config.history_ticks = 16;
+    config.tick_budget = std::chrono::microseconds(0);
+    RollbackEngine engine(session, config);
+
+    engine.SubmitInput("p1", MakeInput(2, true, false), kDelta);
+    for (std::uint64_t tick = 0; tick < 4; ++tick) {
+        engine.AdvanceTick(tick, kDelta);
+    }
+    EXPECT_EQ(InputDisposition::TooOld, engine.SubmitInput("p1", MakeInput(1, false, true), kDelta));
+    EXPECT_EQ(1u, engine.GetStats().rollbacks_over_budget);
+}
+
+TEST(RollbackEngineTest, RosterChangeResetsHistory) {
+    GameSession session(60.0);
+    session.UpsertPlayer("p1");
+    RollbackEngine engine(session, GenerousBudget());
+
+    engine.SubmitInput("p1", MakeInput(2, true, false), kDelta);
+    engine.AdvanceTick(0, kDelta);
+    engine.AddPlayer("p2");
+    engine.AdvanceTick(1, kDelta);
+
+    // 로스터 변경 이전 프레임으로의 롤백은 불가, p2는 유지됨
+    EXPECT_EQ(InputDisposition::TooOld, engine.SubmitInput("p1", MakeInput(1, false, true), kDelta));
+    EXPECT_NO_THROW(session.GetPlayer("p2"));
+}
+
+TEST(RollbackEngineTest, RemovedPlayerIsNotRestoredByPendingRollback) {
+    GameSession session(60.0);
+    session.UpsertPlayer("p1");
+    session.UpsertPlayer("p2");
+    RollbackEngine engine(session, GenerousBudget());
+
+    engine.AdvanceTick(0, kDelta);
+    engine.SubmitInput("p1", MakeInput(2, true, false), kDelta);
+    engine.AdvanceTick(1, kDelta);
+    // p2가 있던 프레임으로의 롤백이 대기 중일 때 퇴장
+    ASSERT_EQ(InputDisposition::RolledBack,
+              engine.SubmitInput("p1", MakeInput(1, false, true), kDelta));
+    engine.RemovePlayer("p2");
+    engine.AdvanceTick(2, kDelta);
+
+    EXPECT_THROW(session.GetPlayer("p2"), std::exception);
+    EXPECT_EQ(0u, engine.GetStats().rollbacks);
+}
+
+TEST(RollbackEngineTest, ImportedHistoryAcceptsLateInputsFromBeforeMigration) {
+    GameSession source(60.0);
+    source.UpsertPlayer("p1");
+    source.UpsertPlayer("p2");
+    RollbackEngine source_engine(source, GenerousBudget());
+    source_engine.SubmitInput("p1", MakeInput(1, true, false), kDelta);
+    source_engine.AdvanceTick(0, kDelta);
+    source_engine.SubmitInput("p1", MakeInput(3, true, false), kDelta);
+    for (std::uint64_t tick = 1; tick < 4; ++tick) {
+        source_engine.AdvanceTick(tick, kDelta);
+    }
+
+    // 노드 이전: 세션 먼저, 그다음 히스토리
+    GameSession target(60.0);
+    RollbackEngine target_engine(target, GenerousBudget());
+    target.ImportState(source.ExportState());
+    target_engine.ImportHistory(source_engine.ExportHistory());
+    EXPECT_EQ(source_engine.HistoryTicks(), target_engine.HistoryTicks());
+
+    // 이전 전에 보냈던 시퀀스 2가 대상 노드에 늦게 도착 → 원본과 똑같이 롤백
+    EXPECT_EQ(InputDisposition::RolledBack,
+              source_engine.SubmitInput("p1", MakeInput(2, false, true, true), kDelta));
+    EXPECT_EQ(InputDisposition::RolledBack,
+              target_engine.SubmitInput("p1", MakeInput(2, false, true, true), kDelta));
+    source_engine.AdvanceTick(4, kDelta);
+    target_engine.AdvanceTick(4, kDelta);
+    EXPECT_EQ(source.StateChecksum(), target.StateChecksum());
+    EXPECT_EQ(1u, target_engine.GetStats().rollbacks);
+    EXPECT_EQ(InputDisposition::Duplicate,
+              target_engine.SubmitInput("p1", MakeInput(3, true, false), kDelta));
+
+    auto corrupt = source_engine.ExportHistory();
+    corrupt.resize(corrupt.size() - 3);
+    EXPECT_THROW(target_engine.ImportHistory(corrupt), std::runtime_error);
+}
+
+TEST(RollbackEngineTest, ImportMatchLeavesSessionUntouchedOnCorruptHistory) {
+    GameSession source(60.0);
+    source.UpsertPlayer("p1");
+    source.UpsertPlayer("p2");
+    RollbackEngine source_engine(source, GenerousBudget());
+    source_engine.SubmitInput("p1", MakeInput(1, true, false), kDelta);
+    source_engine.AdvanceTick(0, kDelta);
+
+    GameSession target(60.0);
+    target.UpsertPlayer("local");
+    RollbackEngine target_engine(target, GenerousBudget());
+    const auto before = target.StateChecksum();
+
+    // 히스토리가 깨졌으면 세션 상태도 적용하지 않음
+    auto corrupt = source_engine.ExportHistory();
+    corrupt.resize(corrupt.size() - 3);
+    EXPECT_THROW(target_engine.ImportMatch(source.ExportState(), corrupt), std::runtime_error);
+    EXPECT_EQ(before, target.StateChecksum());
+    EXPECT_EQ(1u, target.Snapshot().size());
+
+    target_engine.ImportMatch(source.ExportState(), source_engine.ExportHistory());
+    EXPECT_EQ(source.StateChecksum(), target.StateChecksum());
+    EXPECT_EQ(source_engine.HistoryTicks(), target_engine.HistoryTicks());
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "pvpserver/storage/session_store.h"
+
+namespace {
+
+using pvpserver::storage::SessionData;
+using pvpserver::storage::SessionDataView;
+
+SessionData SampleSession() {
+    SessionData data;
+    data.player_id = "player-42";
+    data.player_name = "Neo";
+    data.server_id = "game-server-3";
+    data.created_at = 1760000000123;
+    data.last_activity = 1760000065432;
+    data.elo_rating = 1734;
+    data.match_id = "match-9001";
+    return data;
+}
+
+void ExpectSameSession(const SessionData& expected, const SessionData& actual) {
+    EXPECT_EQ(expected.player_id, actual.player_id);
+    EXPECT_EQ(expected.player_name, actual.player_name);
+    EXPECT_EQ(expected.server_id, actual.server_id);
+    EXPECT_EQ(expected.created_at, actual.created_at);
+    EXPECT_EQ(expected.last_activity, actual.last_activity);
+    EXPECT_EQ(expected.elo_rating, actual.elo_rating);
+    EXPECT_EQ(expected.match_id, actual.match_id);
+}
+
+}  // namespace
+
+TEST(SessionDataTest, BinaryRoundTripIsSmallerThanJson) {
+    const SessionData data = SampleSession();
+    const std::string binary = data.Serialize();
+    ASSERT_TRUE(SessionDataView::IsBinary(binary));
+    EXPECT_LT(binary.size() * 2, data.SerializeJson().size());
+
+    const auto decoded = SessionData::Deserialize(binary);
+    ASSERT_TRUE(decoded.has_value());
+    ExpectSameSession(data, *decoded);
+}
+
+TEST(SessionDataTest, ViewPointsIntoBufferWithoutCopy) {
+    const std::string binary = SampleSession().Serialize();
+    const auto view = SessionDataView::Parse(binary);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ("player-42", view->player_id);
+    EXPECT_EQ("match-9001", view->match_id);
+    EXPECT_EQ(1734, view->elo_rating);
+    // 뷰의 문자열은 원본 버퍼 안을 가리킴
+    EXPECT_GE(view->player_id.data(), binary.data());
+    EXPECT_LE(view->match_id.data() + view->match_id.size(), binary.data() + binary.size());
+}
+
+TEST(SessionDataTest, ReadsLegacyJsonForMigration) {
+    const SessionData data = SampleSession();
+    const std::string legacy = data.SerializeJson();
+    EXPECT_FALSE(SessionDataView::Parse(legacy).has_value());
+
+    const auto decoded = SessionData::Deserialize(legacy);
+    ASSERT_TRUE(decoded.has_value());
+    ExpectSameSession(data, *decoded);
+}
+
+TEST(SessionDataTest, HandlesNegativeAndExtremeValues) {
+    SessionData data = SampleSession();
+    data.created_at = INT64_MAX;
+    data.last_activity = INT64_MIN;
+    data.elo_rating = -5;
+    data.match_id.clear();
+    const auto decoded = SessionData::Deserialize(data.Serialize());
+    ASSERT_TRUE(decoded.has_value());
+    ExpectSameSession(data, *decoded);
+}
+
+TEST(SessionDataTest, RejectsTruncatedOrEmptyPlayer) {
+    const std::string binary = SampleSession().Serialize();
+    for (std::size_t length = 0; length < binary.size(); ++length) {
+        EXPECT_FALSE(SessionData::Deserialize(binary.substr(0, length)).has_value()) << length;
+    }
+    SessionData empty = SampleSession();
+    empty.player_id.clear();
+    EXPECT_FALSE(SessionData::Deserialize(empty.Serialize()).has_value());
+
+    // 상위 버전이 뒤에 덧붙인 필드는 무시
+    std::string future = binary;
+    future[1] = 2;
+    future += "\x01\x02\x03";
+    EXPECT_TRUE(SessionDataView::Parse(future).has_value());
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "pvpserver/matchmaking/sharded_matchmaker.h"
+
+namespace {
+using namespace std::chrono;
+using pvpserver::Match;
+using pvpserver::MatchFormat;
+using pvpserver::MatchRequest;
+using pvpserver::ShardedMatchmaker;
+
+// 콜백이 expected개 이상 호출될 때까지 대기 (최대 5초)
+bool WaitForCount(const std::atomic<std::size_t>& count, std::size_t expected) {
+    const auto deadline = steady_clock::now() + seconds(5);
+    while (count.load() < expected && steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+    return count.load() >= expected;
+}
+}  // namespace
+
+TEST(ShardedMatchmakerTest, RoutesByRegionAndMode) {
+    ShardedMatchmaker matchmaker({"kr", "us"}, {MatchFormat::Duel(), MatchFormat::Teams(2, 2)});
+    EXPECT_EQ(4u, matchmaker.ShardCount());
+    std::vector<Match> created;
+    std::mutex created_mutex;
+    matchmaker.SetMatchCreatedCallback([&](const Match& match) {
+        std::lock_guard<std::mutex> lk(created_mutex);
+        created.push_back(match);
+    });
+
+    const auto now = steady_clock::now();
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"kr-1", 1200, now, "kr"}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"us-1", 1200, now, "us"}));
+    // 알 수 없는 리전은 기본 리전(kr) 샤드로 가되, 같은 리전끼리만 매칭
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"eu-1", 1210, now, "eu"}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"eu-2", 1205, now, "eu"}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"duo", 1200, now, "us", {"duo-2"}}, "2v2"));
+    EXPECT_FALSE(matchmaker.Enqueue(MatchRequest{"duo", 1200, now, "us", {"duo-2"}}));  // 1v1 파티 불가
+    EXPECT_FALSE(matchmaker.Enqueue(MatchRequest{"x", 1200, now, "us"}, "ffa8"));
+
+    EXPECT_EQ(1u, matchmaker.RunOnce(now));
+    ASSERT_TRUE(matchmaker.notification_channel().Flush());  // 콜백은 디스패처 스레드에서 호출
+    std::lock_guard<std::mutex> lk(created_mutex);
+    ASSERT_EQ(1u, created.size());
+    EXPECT_EQ((std::vector<std::string>{"eu-2", "eu-1"}), created[0].players());
+    EXPECT_EQ("eu", created[0].region());
+
+    const auto metrics = matchmaker.MetricsSnapshot();
+    EXPECT_NE(metrics.find("matchmaking_queue_size 3"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_shard_queue_size{shard=\"kr/1v1\"} 1"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_matches_total 1"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_shard_queue_size{shard=\"us/1v1\"} 1"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_shard_queue_size{shard=\"us/2v2\"} 1"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_shard_pass_seconds_count{shard=\"kr/1v1\"} 1"),
+              std::string::npos);
+}
+
+TEST(ShardedMatchmakerTest, CancelReachesOwningShard) {
+    ShardedMatchmaker matchmaker({"kr", "us"}, {MatchFormat::Duel()});
+    const auto now = steady_clock::now();
+    matchmaker.Enqueue(MatchRequest{"us-1", 1200, now, "us"});
+    matchmaker.Cancel("us-1");
+    matchmaker.Enqueue(MatchRequest{"us-2", 1200, now, "us"});
+
+    EXPECT_EQ(0u, matchmaker.RunOnce(now));
+    const auto metrics = matchmaker.MetricsSnapshot();
+    EXPECT_NE(metrics.find("matchmaking_shard_queue_size{shard=\"us/1v1\"} 1"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_shard_submissions_total{shard=\"kr/1v1\"} 1"),
+              std::string::npos);
+}
+
+TEST(ShardedMatchmakerTest, AnyRegionMatchesNonDefaultRegion) {
+    ShardedMatchmaker matchmaker({"kr", "us"}, {MatchFormat::Duel()});
+    std::vector<Match> created;
+    std::mutex created_mutex;
+    matchmaker.SetMatchCreatedCallback([&](const Match& match) {
+        std::lock_guard<std::mutex> lk(created_mutex);
+        created.push_back(match);
+    });
+
+    const auto now = steady_clock::now();
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"any-1", 1200, now, "any"}));
+    EXPECT_TRUE(matchmaker.Enqueue(MatchRequest{"us-1", 1210, now, "us"}));
+
+    EXPECT_EQ(1u, matchmaker.RunOnce(now));
+    // kr 샤드에 남은 복사본은 다음 패스에서 Cancel로 정리됨
+    EXPECT_EQ(0u, matchmaker.RunOnce(now));
+    ASSERT_TRUE(matchmaker.notification_channel().Flush());
+    std::lock_guard<std::mutex> lk(created_mutex);
+    ASSERT_EQ(1u, created.size());
+    EXPECT_EQ((std::vector<std::string>{"any-1", "us-1"}), created[0].players());
+    EXPECT_EQ("us", created[0].region());
+
+    const auto metrics = matchmaker.MetricsSnapshot();
+    EXPECT_NE(metrics.find("matchmaking_queue_size 0"), std::string::npos);
+    EXPECT_NE(metrics.find("matchmaking_shard_queue_size{shard=\"kr/1v1\"} 0"), std::string::npos);
+}
+
+TEST(ShardedMatchmakerTest, AnyRegionPlayerIsMatchedOnlyOnce) {
+    ShardedMatchmaker matchmaker({"kr", "us"}, {MatchFormat::Duel()});
+    std::vector<Match> created;
+    std::mutex created_mutex;
+    matchmaker.SetMatchCreatedCallback([&](const Match& match) {
+        std::lock_guard<std::mutex> lk(created_mutex);
+        created.push_back(match);
+    });
+
+    const auto now = steady_clock::now();
+    matchmaker.Enqueue(MatchRequest{"any-1", 1200, now, "any"});
+    matchmaker.Enqueue(MatchRequest{"kr-1", 1200, now, "kr"});
+    matchmaker.Enqueue(MatchRequest{"us-1", 1200, now, "us"});
+
+    EXPECT_EQ(1u, matchmaker.RunOnce(now));
+    ASSERT_TRUE(matchmaker.notification_channel().Flush());
+    {
+        std::lock_guard<std::mutex> lk(created_mutex);
+        ASSERT_EQ(1u, created.size());
+        EXPECT_EQ((std::vector<std::string>{"any-1", "kr-1"}), created[0].players());
+    }
+    EXPECT_NE(matchmaker.MetricsSnapshot().find("matchmaking_queue_size 1"), std::string::npos);
+
+    // 다시 "any"로 등록하면 새 표로 남은 us 플레이어와 매칭
+    matchmaker.Enqueue(MatchRequest{"any-1", 1200, now, "any"});
+    EXPECT_EQ(1u, matchmaker.RunOnce(now));
+    ASSERT_TRUE(matchmaker.notification_channel().Flush());
+    std::lock_guard<std::mutex> lk(created_mutex);
+    ASSERT_EQ(2u, created.size());
+    EXPECT_EQ((std::vector<std::string>{"us-1", "any-1"}), created[1].players());
+}
+
+TEST(ShardedMatchmakerTest, WorkersMatchConcurrentSubmissions) {
+    ShardedMatchmaker matchmaker({"kr", "us"}, {MatchFormat::Duel()}, milliseconds(5));
+    std::atomic<std::size_t> matched_players{0};
+    matchmaker.SetMatchCreatedCallback(
+        [&](const Match& match) { matched_players += match.players().size(); });
+    matchmaker.Start();
+
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 250;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&matchmaker, p]() {
+            for (int i = 0; i < kPerProducer; ++i) {
+                const std::string id = "p" + std::to_string(p) + "-" + std::to_string(i);
+                matchmaker.Enqueue(
+                    MatchRequest{id, 1200, steady_clock::now(), (i % 2 == 0) ? "kr" : "us"});
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(WaitForCount(matched_players, kProducers * kPerProducer));
+    matchmaker.Stop();
+    EXPECT_EQ(static_cast<std::size_t>(kProducers * kPerProducer), matched_players.load());
+}
+
+TEST(ShardedMatchmakerTest, ConcurrentAnyRegionPlayersAreNeverMatchedTwice) {
+    ShardedMatchmaker matchmaker({"kr", "us"}, {MatchFormat::Duel()}, milliseconds(1));
+    std::mutex seen_mutex;
+    std::unordered_set<std::string> seen;
+    std::atomic<std::size_t> matched_players{0};
+    std::atomic<std::size_t> duplicates{0};
+    matchmaker.SetMatchCreatedCallback([&](const Match& match) {
+        std::lock_guard<std::mutex> lk(seen_mutex);
+        for (const auto& player : match.players()) {
+            if (!seen.insert(player).second) {
+                duplicates.fetch_add(1);
+            }
+        }
+        matched_players.fetch_add(match.players().size());
+    });
+    matchmaker.Start();
+
+    // 절반은 "any": 두 샤드에 동시에 들어가므로 같은 패스에서 양쪽이 가져가려 할 수 있음
+    constexpr int kPlayers = 400;
+    const char* regions[] = {"any", "kr", "any", "us"};
+    for (int i = 0; i < kPlayers; ++i) {
+        matchmaker.Enqueue(
+            MatchRequest{"p" + std::to_string(i), 1200, steady_clock::now(), regions[i % 4]});
+    }
+
+    // kr/us가 각각 홀수로 남으면 짝이 없으므로 최대 2명은 대기열에 남을 수 있음
+    EXPECT_TRUE(WaitForCount(matched_players, kPlayers - 2));
+    matchmaker.Stop();
+    ASSERT_TRUE(matchmaker.notification_channel().Flush());
+    EXPECT_EQ(0u, duplicates.load());
+}